@@ -0,0 +1,60 @@
+#!/bin/sh
+# Usage: ./check_zero_cost.sh <zero_cost.o>
+#
+# Fails unless every gl_<name> function of the object disassembles to
+# the same instructions as its raw_<name> twin. The addresses and the
+# names of the functions themselves are dropped before the comparison,
+# the relocations are kept, so the twins must call the same GL entry
+# points too.
+
+set -e
+
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+
+# One file per function: <dir>/raw_<name> and <dir>/gl_<name>
+objdump -d -r --no-show-raw-insn "$1" | awk -v dir="$dir" '
+    /^[0-9a-f]+ <.*>:$/ {
+        name = $2
+        gsub(/[<>:]/, "", name)
+        out = (name ~ /^(raw|gl)_/) ? dir "/" name : ""
+        next
+    }
+    out == "" || NF == 0 { next }
+    {
+        line = $0
+        if (line ~ /R_X86_64_/) {
+            # The relocation, without its offset
+            sub(/^[ \t]*[0-9a-f]+:[ \t]*/, "", line)
+        } else {
+            # The instruction, without its address and with the jump
+            # targets inside the function relative to it
+            sub(/^[ \t]*[0-9a-f]+:[ \t]*/, "", line)
+            gsub(/[0-9a-f]+ <(raw|gl)_[A-Za-z0-9_]+/, "<self", line)
+            gsub(/[ \t]+/, " ", line)
+        }
+        # The padding between the functions
+        if (line ~ /^(nop|xchg %ax,%ax|data16|cs nop)/) next
+        print line > out
+    }'
+
+failed=0
+checked=0
+for wrapped in "$dir"/gl_*; do
+    name=${wrapped#"$dir"/gl_}
+    raw="$dir/raw_$name"
+    checked=$((checked + 1))
+    if [ ! -f "$raw" ]; then
+        echo "[FAIL] $name: raw_$name is missing"
+        failed=1
+    elif ! cmp -s "$raw" "$wrapped"; then
+        echo "[FAIL] $name: the wrapper is not the raw code"
+        diff "$raw" "$wrapped" | sed 's/^/    /'
+        failed=1
+    fi
+done
+
+if [ "$failed" -eq 0 ]; then
+    echo "[OK] $checked wrappers compile to the same instructions as the raw calls"
+fi
+exit "$failed"
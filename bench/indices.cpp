@@ -0,0 +1,401 @@
+// Reorders the index and vertex buffers of a sphere whose triangles and
+// vertices come in random order, like the output of some exporters.
+// Reports the ACMR of the FIFO cache model before and after, then draws
+// every version on a headless EGL context (Mesa llvmpipe works fine)
+// and counts the vertex shader invocations the driver actually did
+// with GL_ARB_pipeline_statistics_query.
+//
+// Then compares the narrowest index buffers gl_indices builds with
+// plain 32-bit indices: the sphere as triangles, and a grid as strips
+// stitched with primitive restart against one draw call per strip.
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <random>
+#include <vector>
+
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#define GL_HPP_STATS
+#include "gl.hpp"
+#include "gl_egl.hpp"
+#include "gl_indices.hpp"
+
+const size_t RINGS = 200;
+const size_t SEGMENTS = 400;
+const size_t GRID = 512;
+const size_t ROUNDS = 10;
+
+double now_secs()
+{
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+struct Mesh
+{
+    std::vector<gl::Vec3f> vertices;
+    std::vector<uint32_t> indices;
+};
+
+// A unit sphere with its triangles and vertices shuffled
+Mesh make_shuffled_sphere()
+{
+    Mesh mesh = {};
+    for (size_t ring = 0; ring <= RINGS; ++ring) {
+        for (size_t segment = 0; segment <= SEGMENTS; ++segment) {
+            const float theta = (float) segment / (float) SEGMENTS * 2.0f * (float) M_PI;
+            const float phi = (float) ring / (float) RINGS * (float) M_PI;
+            mesh.vertices.push_back({std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta)});
+        }
+    }
+
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (size_t ring = 0; ring < RINGS; ++ring) {
+        for (size_t segment = 0; segment < SEGMENTS; ++segment) {
+            const uint32_t a = (uint32_t) (ring * (SEGMENTS + 1) + segment);
+            const uint32_t b = a + (uint32_t) (SEGMENTS + 1);
+            triangles.push_back({a, b, a + 1});
+            triangles.push_back({a + 1, b, b + 1});
+        }
+    }
+
+    std::mt19937 rng(69);
+    std::shuffle(triangles.begin(), triangles.end(), rng);
+
+    std::vector<uint32_t> order(mesh.vertices.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = (uint32_t) i;
+    std::shuffle(order.begin(), order.end(), rng);
+
+    std::vector<gl::Vec3f> vertices(mesh.vertices.size());
+    gl_indices::remap_vertices(mesh.vertices.data(), sizeof(gl::Vec3f), mesh.vertices.size(),
+                               order.data(), vertices.data());
+    mesh.vertices = vertices;
+    for (const auto &triangle : triangles) {
+        for (uint32_t v : triangle) mesh.indices.push_back(order[v]);
+    }
+    return mesh;
+}
+
+// The triangles as positions, each one rotated to start at its
+// smallest vertex, so two orders of the same mesh compare equal
+std::vector<std::array<float, 9>> canonical_triangles(const Mesh &mesh)
+{
+    std::vector<std::array<float, 9>> triangles;
+    for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+        std::array<gl::Vec3f, 3> t = {};
+        for (int k = 0; k < 3; ++k) t[k] = mesh.vertices[mesh.indices[i + k]];
+        const auto less = [](const gl::Vec3f &a, const gl::Vec3f &b) {
+            return std::array<float, 3>{a.x, a.y, a.z} < std::array<float, 3>{b.x, b.y, b.z};
+        };
+        std::rotate(t.begin(), std::min_element(t.begin(), t.end(), less), t.end());
+        triangles.push_back({t[0].x, t[0].y, t[0].z, t[1].x, t[1].y, t[1].z, t[2].x, t[2].y, t[2].z});
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+const char *const vert_source =
+    "#version 130\n"
+    "in vec3 position;\n"
+    "out vec3 color;\n"
+    "void main() { color = position * 0.5 + 0.5; gl_Position = vec4(position * 0.9, 1.0); }\n";
+
+const char *const frag_source =
+    "#version 130\n"
+    "in vec3 color;\n"
+    "void main() { gl_FragColor = vec4(color, 1.0); }\n";
+
+const GLsizei FRAMEBUFFER_SIZE = 256;
+
+gl::Shader compile_shader(gl::Shader_Type type, const char *source)
+{
+    auto shader = gl::createShader(type);
+    gl::shaderSource(shader, 1, &source, NULL);
+    gl::compileShader(shader);
+    assert(gl::compileStatus(shader));
+    return shader;
+}
+
+struct Draw_Result
+{
+    GLuint64 vs_invocations;
+    double best_ms;
+    size_t draw_calls;
+    std::vector<unsigned char> pixels;
+};
+
+// Uploads the vertices and the indices, then runs `issue` once to
+// count the vertex shader invocations and read the pixels back, and
+// ROUNDS more times to time it
+template <typename Issue>
+Draw_Result draw(const std::vector<gl::Vec3f> &vertex_data, const void *index_data, size_t index_bytes,
+                 gl::Attribute_Location position, Issue issue)
+{
+    auto vao = gl::genVertexArray();
+    gl::bindVertexArray(vao);
+
+    auto vertices = gl::genBuffer();
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, vertices);
+    gl::bufferData(gl::Buffer_Target::ARRAY, (GLsizeiptr) (vertex_data.size() * sizeof(gl::Vec3f)),
+                   vertex_data.data(), gl::Buffer_Usage::STATIC_DRAW);
+    gl::vertexAttribPointer(position, gl::Attribute_Size::THREE, gl::Attribute_Type::FLOAT,
+                            GL_FALSE, 0, nullptr);
+    gl::enableVertexAttribArray(position);
+
+    auto indices = gl::genBuffer();
+    gl::bindBuffer(gl::Buffer_Target::ELEMENT_ARRAY, indices);
+    gl::bufferData(gl::Buffer_Target::ELEMENT_ARRAY, (GLsizeiptr) index_bytes, index_data,
+                   gl::Buffer_Usage::STATIC_DRAW);
+
+    Draw_Result result = {};
+    gl::clear(gl::Buffer_Bit::COLOR);
+
+    // gl.hpp has no query wrappers, the raw calls do for a benchmark
+    GLuint query = 0;
+    glGenQueries(1, &query);
+    glBeginQuery(GL_VERTEX_SHADER_INVOCATIONS_ARB, query);
+    const size_t draw_calls = gl::stats.draw_calls;
+    issue();
+    result.draw_calls = gl::stats.draw_calls - draw_calls;
+    glEndQuery(GL_VERTEX_SHADER_INVOCATIONS_ARB);
+    glGetQueryObjectui64v(query, GL_QUERY_RESULT, &result.vs_invocations);
+    glDeleteQueries(1, &query);
+
+    result.pixels.resize(4 * FRAMEBUFFER_SIZE * FRAMEBUFFER_SIZE);
+    glReadPixels(0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, result.pixels.data());
+
+    for (size_t round = 0; round < ROUNDS; ++round) {
+        const double start = now_secs();
+        issue();
+        glFinish();
+        const double ms = (now_secs() - start) * 1000.0;
+        if (round == 0 || ms < result.best_ms) result.best_ms = ms;
+    }
+
+    gl::deleteObject(indices);
+    gl::deleteObject(vertices);
+    const GLuint vao_name = vao.unwrap;
+    glDeleteVertexArrays(1, &vao_name);
+
+    return result;
+}
+
+template <typename Issue>
+Draw_Result draw(const Mesh &mesh, gl::Attribute_Location position, Issue issue)
+{
+    return draw(mesh.vertices, mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t), position, issue);
+}
+
+Draw_Result draw(const Mesh &mesh, gl::Attribute_Location position)
+{
+    return draw(mesh, position, [&] {
+        gl::drawElements(gl::Draw_Mode::TRIANGLES, (GLsizei) mesh.indices.size(),
+                         gl::Element_Index_Type::UNSIGNED_INT, nullptr);
+    });
+}
+
+Draw_Result draw(const std::vector<gl::Vec3f> &vertices, const gl_indices::Index_Buffer &buffer,
+                 gl::Attribute_Location position)
+{
+    return draw(vertices, buffer.data.data(), buffer.data.size(), position, [&] { gl_indices::draw(buffer); });
+}
+
+// The indices of a built buffer back as 32-bit ones, one run per
+// primitive restart or draw
+std::vector<std::vector<uint32_t>> decode(const gl_indices::Index_Buffer &buffer)
+{
+    std::vector<std::vector<uint32_t>> runs;
+    for (const auto &draw : buffer.draws) {
+        const size_t size = gl_indices::index_size(draw.type);
+        assert(draw.offset % size == 0);
+        runs.emplace_back();
+        for (GLsizei i = 0; i < draw.count; ++i) {
+            uint32_t index = 0;
+            memcpy(&index, &buffer.data[draw.offset + (size_t) i * size], size);
+            if (buffer.primitive_restart && index == gl_indices::restart_index(draw.type)) {
+                runs.emplace_back();
+            } else {
+                runs.back().push_back(index + (uint32_t) draw.base_vertex);
+            }
+        }
+    }
+    return runs;
+}
+
+const char *type_name(gl::Element_Index_Type type)
+{
+    switch (type) {
+    case gl::Element_Index_Type::UNSIGNED_BYTE:  return "UNSIGNED_BYTE";
+    case gl::Element_Index_Type::UNSIGNED_SHORT: return "UNSIGNED_SHORT";
+    case gl::Element_Index_Type::UNSIGNED_INT:   return "UNSIGNED_INT";
+    }
+    return "?";
+}
+
+void print_buffer(const char *name, const gl_indices::Index_Buffer &buffer)
+{
+    printf("%s: %zu draws of", name, buffer.draws.size());
+    for (const auto &draw : buffer.draws) printf(" %s", type_name(draw.type));
+    printf(", %zu bytes of indices instead of %zu\n", buffer.data.size(), buffer.uint_bytes);
+}
+
+// A flat grid of GRID x GRID vertices drawn as one strip per row
+void compare_strips(gl::Attribute_Location position)
+{
+    std::vector<gl::Vec3f> vertices;
+    for (size_t row = 0; row < GRID; ++row) {
+        for (size_t column = 0; column < GRID; ++column) {
+            const float x = (float) column / (float) (GRID - 1) * 2.0f - 1.0f;
+            const float y = (float) row / (float) (GRID - 1) * 2.0f - 1.0f;
+            vertices.push_back({x, y, 0.0f});
+        }
+    }
+
+    std::vector<uint32_t> indices;
+    std::vector<gl_indices::Strip> strips;
+    for (size_t row = 0; row + 1 < GRID; ++row) {
+        for (size_t column = 0; column < GRID; ++column) {
+            indices.push_back((uint32_t) ((row + 1) * GRID + column));
+            indices.push_back((uint32_t) (row * GRID + column));
+        }
+    }
+    const size_t strip_length = 2 * GRID;
+    for (size_t row = 0; row + 1 < GRID; ++row) strips.push_back({&indices[row * strip_length], strip_length});
+
+    const auto buffer = gl_indices::build_strips(strips.data(), strips.size());
+    const auto runs = decode(buffer);
+    assert(runs.size() == strips.size());
+    for (size_t i = 0; i < runs.size(); ++i) {
+        assert(std::equal(runs[i].begin(), runs[i].end(), strips[i].indices, strips[i].indices + strips[i].count));
+    }
+    print_buffer("Strips", buffer);
+
+    const Draw_Result separate = draw(vertices, indices.data(), indices.size() * sizeof(uint32_t), position, [&] {
+        for (size_t row = 0; row + 1 < GRID; ++row) {
+            const GLvoid *offset = reinterpret_cast<const GLvoid*>(row * strip_length * sizeof(uint32_t));
+            gl::drawElements(gl::Draw_Mode::TRIANGLE_STRIP, (GLsizei) strip_length,
+                             gl::Element_Index_Type::UNSIGNED_INT, offset);
+        }
+    });
+    const Draw_Result stitched = draw(vertices, buffer, position);
+    assert(separate.pixels == stitched.pixels);
+
+    printf("%-22s %10s %14s %10s\n", "strips", "draws", "VS invocations", "draw ms");
+    printf("%-22s %10zu %14llu %10.2f\n", "one draw per strip", separate.draw_calls,
+           (unsigned long long) separate.vs_invocations, separate.best_ms);
+    printf("%-22s %10zu %14llu %10.2f\n", "primitive restart", stitched.draw_calls,
+           (unsigned long long) stitched.vs_invocations, stitched.best_ms);
+}
+
+int main()
+{
+    const Mesh shuffled = make_shuffled_sphere();
+    const size_t vertex_count = shuffled.vertices.size();
+    const size_t triangle_count = shuffled.indices.size() / 3;
+
+    Mesh cache_optimized = shuffled;
+    double start = now_secs();
+    gl_indices::optimize_vertex_cache(shuffled.indices.data(), shuffled.indices.size(), vertex_count,
+                                      cache_optimized.indices.data());
+    const double cache_ms = (now_secs() - start) * 1000.0;
+
+    Mesh fetch_optimized = cache_optimized;
+    start = now_secs();
+    std::vector<uint32_t> remap(vertex_count);
+    gl_indices::optimize_vertex_fetch(fetch_optimized.indices.data(), fetch_optimized.indices.size(),
+                                      vertex_count, remap.data());
+    gl_indices::remap_vertices(cache_optimized.vertices.data(), sizeof(gl::Vec3f), vertex_count,
+                               remap.data(), fetch_optimized.vertices.data());
+    const double fetch_ms = (now_secs() - start) * 1000.0;
+
+    const auto expected = canonical_triangles(shuffled);
+    assert(canonical_triangles(cache_optimized) == expected);
+    assert(canonical_triangles(fetch_optimized) == expected);
+
+    printf("%zu vertices, %zu triangles\n", vertex_count, triangle_count);
+    printf("optimize_vertex_cache: %.2f ms\n", cache_ms);
+    printf("optimize_vertex_fetch: %.2f ms\n", fetch_ms);
+
+    auto context = gl_egl::create_headless_context(3, 3);
+    if (!context.has_value) {
+        fprintf(stderr, "Could not create a headless EGL context\n");
+        return 1;
+    }
+
+    // There is no default framebuffer without a surface
+    GLuint fbo = 0, color = 0;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(1, &color);
+    glBindRenderbuffer(GL_RENDERBUFFER, color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    glViewport(0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+
+    printf("Renderer: %s\n", gl::getString(gl::String_Name::RENDERER));
+
+    auto program = gl::createProgram();
+    gl::attachShader(program, compile_shader(gl::Shader_Type::Vertex, vert_source));
+    gl::attachShader(program, compile_shader(gl::Shader_Type::Fragment, frag_source));
+    gl::Attribute_Location position = {0};
+    gl::bindAttribLocation(program, position, "position");
+    gl::linkProgram(program);
+    assert(gl::linkStatus(program));
+    gl::useProgram(program);
+
+    const struct
+    {
+        const char *name;
+        const Mesh *mesh;
+    } versions[] = {
+        {"shuffled", &shuffled},
+        {"vertex cache", &cache_optimized},
+        {"vertex cache + fetch", &fetch_optimized},
+    };
+
+    printf("%-22s %8s %8s %14s %10s %10s\n", "order", "ACMR 16", "ACMR 32", "VS invocations", "per tri", "draw ms");
+    for (const auto &version : versions) {
+        const auto &indices = version.mesh->indices;
+        const Draw_Result result = draw(*version.mesh, position);
+        printf("%-22s %8.3f %8.3f %14llu %10.3f %10.2f\n", version.name,
+               gl_indices::acmr(indices.data(), indices.size(), vertex_count, 16),
+               gl_indices::acmr(indices.data(), indices.size(), vertex_count, 32),
+               (unsigned long long) result.vs_invocations,
+               (double) result.vs_invocations / (double) triangle_count,
+               result.best_ms);
+    }
+
+    // The same triangles with the narrowest indices, split in 16-bit
+    // ranges since the sphere has more than 65536 vertices
+    const auto buffer = gl_indices::build_triangles(fetch_optimized.indices.data(), fetch_optimized.indices.size());
+    const auto runs = decode(buffer);
+    std::vector<uint32_t> decoded;
+    for (const auto &run : runs) decoded.insert(decoded.end(), run.begin(), run.end());
+    assert(decoded == fetch_optimized.indices);
+    print_buffer("Triangles", buffer);
+
+    const Draw_Result unsplit = draw(fetch_optimized, position);
+    const Draw_Result split = draw(fetch_optimized.vertices, buffer, position);
+    assert(unsplit.pixels == split.pixels);
+    printf("%-22s %10s %14s %10s\n", "triangles", "draws", "VS invocations", "draw ms");
+    printf("%-22s %10zu %14llu %10.2f\n", "32-bit indices", unsplit.draw_calls,
+           (unsigned long long) unsplit.vs_invocations, unsplit.best_ms);
+    printf("%-22s %10zu %14llu %10.2f\n", "built", split.draw_calls,
+           (unsigned long long) split.vs_invocations, split.best_ms);
+
+    compare_strips(position);
+
+    gl::deleteObject(program);
+    gl_egl::destroy_context(context.unwrap);
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+// Per-call cost of the gl.hpp wrappers against the raw GL calls they
+// wrap. By default it runs on a headless EGL context (Mesa llvmpipe
+// works fine). Built with -DBENCH_NULL_BACKEND it runs against
+// gl_null.hpp instead, which isolates the cost of the wrappers from
+// the noise of a real driver.
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+#ifdef BENCH_NULL_BACKEND
+#    include "gl_null.hpp"
+#    include "gl.hpp"
+#else
+#    define GL_GLEXT_PROTOTYPES
+#    include <GL/gl.h>
+#    include <GL/glext.h>
+#    include "gl.hpp"
+#    include "gl_egl.hpp"
+#endif
+#include "gl_uniforms.hpp"
+
+const size_t CALLS = 100 * 1000;
+const size_t ROUNDS = 10;
+
+double now_secs()
+{
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+// The best of ROUNDS runs of CALLS calls, in nanoseconds per call
+template <typename Body>
+double measure(Body body)
+{
+    double best = 0.0;
+    for (size_t round = 0; round < ROUNDS; ++round) {
+        const double start = now_secs();
+        for (size_t i = 0; i < CALLS; ++i) {
+            body(i);
+        }
+        const double ns = (now_secs() - start) * 1e9 / (double) CALLS;
+        if (round == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+template <typename Raw, typename Wrapped>
+void compare(const char *name, Raw raw, Wrapped wrapped)
+{
+    // Warm up the driver caches before the first measurement
+    measure(raw);
+
+    const double raw_ns = measure(raw);
+    const double wrapped_ns = measure(wrapped);
+    printf("%-24s %10.2f %10.2f %+9.2f%%\n",
+           name, raw_ns, wrapped_ns, (wrapped_ns - raw_ns) / raw_ns * 100.0);
+}
+
+const char *const vert_source =
+    "#version 130\n"
+    "in vec4 position;\n"
+    "void main() { gl_Position = position; }\n";
+
+const char *const frag_source =
+    "#version 130\n"
+    "uniform float u_time;\n"
+    "uniform vec2 u_resolution;\n"
+    "uniform mat4 u_mvp;\n"
+    "uniform vec4 u_colors[16];\n"
+    "void main() { gl_FragColor = u_mvp * u_colors[int(u_time)] + vec4(u_time, u_resolution, 1.0); }\n";
+
+gl::Shader compile_shader(gl::Shader_Type type, const char *source)
+{
+    auto shader = gl::createShader(type);
+    gl::shaderSource(shader, 1, &source, NULL);
+    gl::compileShader(shader);
+    assert(gl::compileStatus(shader));
+    return shader;
+}
+
+int main()
+{
+#ifndef BENCH_NULL_BACKEND
+    auto context = gl_egl::create_headless_context(3, 3);
+    if (!context.has_value) {
+        fprintf(stderr, "Could not create a headless EGL context\n");
+        return 1;
+    }
+
+    // There is no default framebuffer without a surface
+    GLuint fbo = 0, color = 0;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(1, &color);
+    glBindRenderbuffer(GL_RENDERBUFFER, color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, 64, 64);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    glViewport(0, 0, 64, 64);
+#endif
+
+    printf("Renderer: %s\n", gl::getString(gl::String_Name::RENDERER));
+
+    auto program = gl::createProgram();
+    gl::attachShader(program, compile_shader(gl::Shader_Type::Vertex, vert_source));
+    gl::attachShader(program, compile_shader(gl::Shader_Type::Fragment, frag_source));
+    gl::Attribute_Location position = {0};
+    gl::bindAttribLocation(program, position, "position");
+    gl::linkProgram(program);
+    assert(gl::linkStatus(program));
+    gl::useProgram(program);
+
+    auto u_time = gl::getUniformLocation(program, "u_time");
+    auto u_resolution = gl::getUniformLocation(program, "u_resolution");
+    auto u_mvp = gl::getUniformLocation(program, "u_mvp");
+    auto u_colors = gl::getUniformLocation(program, "u_colors");
+    assert(u_time.has_value && u_resolution.has_value && u_mvp.has_value && u_colors.has_value);
+
+    auto vao = gl::genVertexArray();
+    gl::bindVertexArray(vao);
+
+    auto buffer = gl::genBuffer();
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, buffer);
+    const GLfloat points[] = {0.0f, 0.0f, 0.5f, 0.5f};
+    gl::bufferData(gl::Buffer_Target::ARRAY, sizeof(points), points, gl::Buffer_Usage::STATIC_DRAW);
+    gl::enableVertexAttribArray(position);
+
+    printf("%-24s %10s %10s %10s\n", "call", "raw ns", "gl:: ns", "overhead");
+
+    compare("uniform(float)",
+            [&](size_t i) { glUniform1f(u_time.unwrap.unwrap, (GLfloat) i); },
+            [&](size_t i) { gl::uniform(u_time.unwrap, (GLfloat) i); });
+
+    compare("uniform(Vec2f)",
+            [&](size_t i) { glUniform2f(u_resolution.unwrap.unwrap, (GLfloat) i, 1.0f); },
+            [&](size_t i) { gl::uniform(u_resolution.unwrap, gl::Vec2f {(GLfloat) i, 1.0f}); });
+
+    // Uploads of values the program already has, which is what most
+    // uniforms look like from one draw to the next
+    gl_uniforms::Shadow shadow = {};
+    gl_uniforms::reset(&shadow, program);
+    const gl::Mat4f mvp = {{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
+    gl::Vec4f colors[16] = {};
+    const GLfloat raw_colors[16 * 4] = {};
+
+    compare("shadow uniform(Mat4f)",
+            [&](size_t) { glUniformMatrix4fv(u_mvp.unwrap.unwrap, 1, GL_FALSE, mvp.m); },
+            [&](size_t) { gl_uniforms::uniform(&shadow, u_mvp.unwrap, mvp); });
+
+    compare("shadow uniform(Vec4f[])",
+            [&](size_t) { glUniform4fv(u_colors.unwrap.unwrap, 16, raw_colors); },
+            [&](size_t) { gl_uniforms::uniform(&shadow, u_colors.unwrap, 16, colors); });
+
+    printf("%-24s %zu issued, %zu skipped\n", "shadow stats", shadow.stats.issued, shadow.stats.skipped);
+
+    compare("getUniformLocation",
+            [&](size_t) { glGetUniformLocation(program.unwrap, "u_time"); },
+            [&](size_t) { gl::getUniformLocation(program, "u_time"); });
+
+    compare("bindVertexArray",
+            [&](size_t) { glBindVertexArray(vao.unwrap); },
+            [&](size_t) { gl::bindVertexArray(vao); });
+
+    compare("bindBuffer",
+            [&](size_t) { glBindBuffer(GL_ARRAY_BUFFER, buffer.unwrap); },
+            [&](size_t) { gl::bindBuffer(gl::Buffer_Target::ARRAY, buffer); });
+
+    compare("vertexAttribPointer",
+            [&](size_t) { glVertexAttribPointer(position.unwrap, 2, GL_FLOAT, GL_FALSE, 0, nullptr); },
+            [&](size_t) {
+                gl::vertexAttribPointer(position, gl::Attribute_Size::TWO, gl::Attribute_Type::FLOAT,
+                                        GL_FALSE, 0, nullptr);
+            });
+
+    compare("drawArrays",
+            [&](size_t) { glDrawArrays(GL_POINTS, 0, 2); },
+            [&](size_t) { gl::drawArrays(gl::Draw_Mode::POINTS, 0, 2); });
+
+    gl::deleteObject(buffer);
+    gl::deleteObject(program);
+
+#ifndef BENCH_NULL_BACKEND
+    gl_egl::destroy_context(context.unwrap);
+#endif
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+// Packs a sphere with gl_pack and reports the formats it picked, the
+// errors and the size of the vertex data against plain floats. Then
+// times the converters against the per-vertex scalar functions and
+// checks that both agree.
+//
+// Built with -fno-tree-vectorize so the scalar loops stay scalar.
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+#include "gl_null.hpp"
+#include "gl.hpp"
+#include "gl_pack.hpp"
+
+const size_t RINGS = 250;
+const size_t SEGMENTS = 500;
+const size_t ROUNDS = 20;
+
+double now_secs()
+{
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+// The best of ROUNDS runs, in nanoseconds per element
+template <typename Body>
+double measure(size_t count, Body body)
+{
+    double best = 0.0;
+    for (size_t round = 0; round < ROUNDS; ++round) {
+        const double start = now_secs();
+        body();
+        const double ns = (now_secs() - start) * 1e9 / (double) count;
+        if (round == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+struct Sphere
+{
+    std::vector<GLfloat> positions;
+    std::vector<GLfloat> normals;
+    std::vector<GLfloat> uvs;
+    size_t vertex_count;
+};
+
+// A sphere of radius 5 around (100, 0, -20), so the quantization has
+// an offset to deal with
+Sphere make_sphere()
+{
+    Sphere sphere = {};
+    for (size_t ring = 0; ring <= RINGS; ++ring) {
+        for (size_t segment = 0; segment <= SEGMENTS; ++segment) {
+            const float u = (float) segment / (float) SEGMENTS;
+            const float v = (float) ring / (float) RINGS;
+            const float theta = u * 2.0f * (float) M_PI;
+            const float phi = v * (float) M_PI;
+            const float n[3] = {std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta)};
+
+            sphere.positions.insert(sphere.positions.end(), {100.0f + 5.0f * n[0], 5.0f * n[1], -20.0f + 5.0f * n[2]});
+            sphere.normals.insert(sphere.normals.end(), {n[0], n[1], n[2]});
+            sphere.uvs.insert(sphere.uvs.end(), {u, v});
+            sphere.vertex_count += 1;
+        }
+    }
+    return sphere;
+}
+
+const char *type_name(gl::Attribute_Type type)
+{
+    switch (type) {
+    case gl::Attribute_Type::SHORT:              return "SHORT";
+    case gl::Attribute_Type::HALF_FLOAT:         return "HALF_FLOAT";
+    case gl::Attribute_Type::FLOAT:              return "FLOAT";
+    case gl::Attribute_Type::INT_2_10_10_10_REV: return "INT_2_10_10_10_REV";
+    default:                                     return "?";
+    }
+}
+
+void check_and_time(const Sphere &sphere)
+{
+    const size_t n = sphere.vertex_count;
+    const gl_pack::Quantization q = gl_pack::quantization_of(sphere.positions.data(), n);
+
+    std::vector<GLhalf> halves(2 * n), halves_scalar(2 * n);
+    std::vector<GLuint> normals(n), normals_scalar(n);
+    std::vector<GLshort> positions(4 * n), positions_scalar(4 * n);
+
+    const double halves_ns = measure(2 * n, [&] {
+        gl_pack::halves_from_floats(sphere.uvs.data(), halves.data(), 2 * n);
+    });
+    const double halves_scalar_ns = measure(2 * n, [&] {
+        for (size_t i = 0; i < 2 * n; ++i) halves_scalar[i] = gl_pack::half_from_float(sphere.uvs[i]);
+    });
+
+    const double normals_ns = measure(n, [&] {
+        gl_pack::normals_from_floats(sphere.normals.data(), normals.data(), n);
+    });
+    const double normals_scalar_ns = measure(n, [&] {
+        for (size_t i = 0; i < n; ++i) {
+            const GLfloat *xyz = &sphere.normals[3 * i];
+            normals_scalar[i] = gl_pack::normal_from_floats(xyz[0], xyz[1], xyz[2]);
+        }
+    });
+
+    const double positions_ns = measure(n, [&] {
+        gl_pack::positions_from_floats(sphere.positions.data(), positions.data(), n, q);
+    });
+    const double positions_scalar_ns = measure(n, [&] {
+        for (size_t i = 0; i < n; ++i) {
+            for (int axis = 0; axis < 3; ++axis) {
+                const GLfloat x = (sphere.positions[3 * i + axis] - q.offset[axis]) / q.scale[axis];
+                positions_scalar[4 * i + axis] = (GLshort) gl_pack::snorm_from_float(x, 16);
+            }
+            positions_scalar[4 * i + 3] = 32767;
+        }
+    });
+
+    assert(halves == halves_scalar);
+    assert(normals == normals_scalar);
+    // The SIMD code multiplies by the inverse of the scale, which may
+    // round the other way once in a while
+    for (size_t i = 0; i < 4 * n; ++i) {
+        assert(std::abs(positions[i] - positions_scalar[i]) <= 1);
+    }
+
+    // Specials and subnormals of the half floats
+    const GLfloat specials[] = {
+        0.0f, -0.0f, 1.0f, -2.5f, 65504.0f, 65520.0f, 1e9f, -INFINITY, INFINITY,
+        5.96e-8f, 6.1e-5f, 3.0e-6f, 1e-10f, 0.333333f, -1234.567f, 2049.0f, 2051.0f,
+    };
+    const size_t specials_count = sizeof(specials) / sizeof(specials[0]);
+    GLhalf special_halves[specials_count];
+    gl_pack::halves_from_floats(specials, special_halves, specials_count);
+    for (size_t i = 0; i < specials_count; ++i) {
+        assert(special_halves[i] == gl_pack::half_from_float(specials[i]));
+    }
+
+    printf("%-24s %10s %10s\n", "converter", "scalar ns", "SIMD ns");
+    printf("%-24s %10.3f %10.3f\n", "halves_from_floats", halves_scalar_ns, halves_ns);
+    printf("%-24s %10.3f %10.3f\n", "normals_from_floats", normals_scalar_ns, normals_ns);
+    printf("%-24s %10.3f %10.3f\n", "positions_from_floats", positions_scalar_ns, positions_ns);
+}
+
+int main()
+{
+    const Sphere sphere = make_sphere();
+
+    const gl_pack::Attribute attributes[] = {
+        {{0}, gl_pack::Semantic::POSITION, sphere.positions.data(), 3, 1e-3f},
+        {{1}, gl_pack::Semantic::NORMAL,   sphere.normals.data(),   3, 2e-3f},
+        {{2}, gl_pack::Semantic::GENERIC,  sphere.uvs.data(),       2, 1e-3f},
+    };
+    const size_t attributes_count = sizeof(attributes) / sizeof(attributes[0]);
+
+    const double start = now_secs();
+    const gl_pack::Packed_Mesh mesh = gl_pack::pack(attributes, attributes_count, sphere.vertex_count);
+    const double pack_ms = (now_secs() - start) * 1000.0;
+
+    printf("%zu vertices packed in %.3f ms\n", mesh.vertex_count, pack_ms);
+    printf("%-9s %-20s %5s %7s %10s\n", "location", "type", "size", "stride", "max error");
+    for (const auto &attribute : mesh.attributes) {
+        printf("%-9u %-20s %5d %7d %10.2e\n", attribute.location.unwrap, type_name(attribute.type),
+               static_cast<int>(attribute.size), attribute.stride, attribute.max_error);
+        assert(attribute.max_error <= attributes[&attribute - mesh.attributes.data()].tolerance);
+    }
+    printf("Vertex data: %zu bytes instead of %zu (%.2fx smaller)\n",
+           mesh.data.size(), mesh.float_bytes, (double) mesh.float_bytes / (double) mesh.data.size());
+
+    // The setup that goes with the data, on the null backend
+    auto buffer = gl::genBuffer();
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, buffer);
+    gl::bufferData(gl::Buffer_Target::ARRAY, (GLsizeiptr) mesh.data.size(), mesh.data.data(),
+                   gl::Buffer_Usage::STATIC_DRAW);
+    gl_pack::setup_attributes(mesh);
+    assert(gl_null::context.count(gl_null::Call::glVertexAttribPointer) == attributes_count);
+    assert(gl_null::context.error == GL_NO_ERROR);
+
+    check_and_time(sphere);
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+// What gl_trace costs per gl.hpp call, against gl_null.hpp so only the
+// cost of the wrappers and of the tracer is measured. Built twice:
+//
+// - trace_off: without GL_HPP_TRACE, the wrappers are the raw calls
+//   (`make check` proves it instruction by instruction),
+// - trace_on: with GL_HPP_TRACE, stopped and then recording.
+//
+// trace_on then records a few frames of a render thread and of a
+// loader thread and writes them to trace.json, for chrome://tracing or
+// ui.perfetto.dev.
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "gl_null.hpp"
+#include "gl_trace.hpp"
+#include "gl.hpp"
+
+const size_t FRAMES = 10 * 1000;
+const size_t ROUNDS = 10;
+const size_t RECORDED_FRAMES = 1000;
+const size_t RECORDED_ROUNDS = 3;
+const size_t DRAWS = 10;
+// The gl:: calls of one frame()
+const size_t FRAME_CALLS = 2 + DRAWS * 4;
+
+double now_secs()
+{
+    return (double) gl_trace::now_ns() * 1e-9;
+}
+
+void raw_frame(GLuint program, GLuint buffer, GLint location)
+{
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(program);
+    for (size_t i = 0; i < DRAWS; ++i) {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glUniform1f(location, (GLfloat) i);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+}
+
+void frame(gl::Program program, gl::Buffer buffer, gl::Uniform location)
+{
+    gl::clear(gl::Buffer_Bit::COLOR);
+    gl::useProgram(program);
+    for (size_t i = 0; i < DRAWS; ++i) {
+        gl::bindBuffer(gl::Buffer_Target::ARRAY, buffer);
+        gl::vertexAttribPointer({0}, gl::Attribute_Size::TWO, gl::Attribute_Type::FLOAT, GL_FALSE, 0, nullptr);
+        gl::uniform(location, (GLfloat) i);
+        gl::drawArrays(gl::Draw_Mode::TRIANGLES, 0, 3);
+    }
+}
+
+// The best of `rounds` runs of `frames` frames, in nanoseconds per call
+template <typename Body>
+double measure(Body body, size_t frames = FRAMES, size_t rounds = ROUNDS)
+{
+    double best = 0.0;
+    for (size_t round = 0; round < rounds; ++round) {
+        const double start = now_secs();
+        for (size_t i = 0; i < frames; ++i) {
+            body();
+        }
+        const double ns = (now_secs() - start) * 1e9 / (double) (frames * FRAME_CALLS);
+        if (round == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+void report(const char *name, double raw_ns, double ns)
+{
+    printf("%-24s %10.2f %10.2f %+9.2f%%\n", name, raw_ns, ns, (ns - raw_ns) / raw_ns * 100.0);
+}
+
+int main()
+{
+    auto program = gl::createProgram();
+    auto buffer = gl::genBuffer();
+    const gl::Uniform location = {0};
+
+    printf("%-24s %10s %10s %10s\n", "gl:: calls", "raw ns", "gl:: ns", "overhead");
+
+    auto raw = [&] { raw_frame(program.unwrap, buffer.unwrap, location.unwrap); };
+    auto wrapped = [&] { frame(program, buffer, location); };
+    measure(raw);
+    const double raw_ns = measure(raw);
+
+#ifndef GL_HPP_TRACE
+    report("without GL_HPP_TRACE", raw_ns, measure(wrapped));
+#else
+    report("GL_HPP_TRACE, stopped", raw_ns, measure(wrapped));
+
+    // Every event takes memory until it is exported, so fewer of them
+    gl_trace::start();
+    report("GL_HPP_TRACE, recording", raw_ns, measure(wrapped, RECORDED_FRAMES, RECORDED_ROUNDS));
+    gl_trace::stop();
+    gl_trace::clear();
+
+    // What a trace of a real program looks like: frames made of passes
+    // on the render thread, and a loader thread next to it. Only the
+    // render thread calls gl_null, which is not thread safe.
+    gl_trace::name_thread("render");
+    gl_trace::start();
+
+    std::thread loader([] {
+        gl_trace::name_thread("loader");
+        for (size_t i = 0; i < 4; ++i) {
+            gl_trace::Scope load("load chunk");
+            std::this_thread::sleep_for(std::chrono::milliseconds(3));
+        }
+        gl_trace::mark("level loaded");
+    });
+
+    for (size_t i = 0; i < 8; ++i) {
+        gl_trace::Scope scope("frame", gl_trace::Category::FRAME);
+        {
+            gl_trace::Scope pass("opaque");
+            frame(program, buffer, location);
+        }
+        {
+            gl_trace::Scope pass("transparent");
+            frame(program, buffer, location);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    loader.join();
+    gl_trace::stop();
+
+    FILE *out = fopen("trace.json", "w");
+    if (!out) {
+        perror("trace.json");
+        return 1;
+    }
+    const size_t events = gl_trace::write_chrome_json(out);
+    fclose(out);
+    printf("Wrote %zu events to trace.json\n", events);
+#endif
+
+    gl::deleteObject(buffer);
+    gl::deleteObject(program);
+
+    return 0;
+}
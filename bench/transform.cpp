@@ -0,0 +1,141 @@
+// Batched vertex transform of gl_math against the plain scalar loop
+// people write when they do not have a math library at hand. It also
+// checks that the SIMD kernels agree with the scalar code.
+//
+// Built with -fno-tree-vectorize so the scalar loop stays scalar: the
+// intrinsics of gl_math are not affected by it.
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+// Only for the GL types, nothing is drawn
+#include "gl_null.hpp"
+#include "gl.hpp"
+#include "gl_math.hpp"
+
+const size_t VERTICES = 64 * 1024;
+const size_t ROUNDS = 50;
+
+double now_secs()
+{
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+void transform_scalar(const gl::Mat4f &m, const gl::Vec4f *in, gl::Vec4f *out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const gl::Vec4f v = in[i];
+        out[i].x = m.m[0] * v.x + m.m[4] * v.y + m.m[8]  * v.z + m.m[12] * v.w;
+        out[i].y = m.m[1] * v.x + m.m[5] * v.y + m.m[9]  * v.z + m.m[13] * v.w;
+        out[i].z = m.m[2] * v.x + m.m[6] * v.y + m.m[10] * v.z + m.m[14] * v.w;
+        out[i].w = m.m[3] * v.x + m.m[7] * v.y + m.m[11] * v.z + m.m[15] * v.w;
+    }
+}
+
+// The best of ROUNDS runs, in nanoseconds per vertex
+template <typename Body>
+double measure(Body body)
+{
+    double best = 0.0;
+    for (size_t round = 0; round < ROUNDS; ++round) {
+        const double start = now_secs();
+        body();
+        const double ns = (now_secs() - start) * 1e9 / (double) VERTICES;
+        if (round == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+float random_float()
+{
+    return (float) rand() / (float) RAND_MAX * 2.0f - 1.0f;
+}
+
+gl_math::Mat4 random_mat4()
+{
+    gl_math::Mat4 m;
+    for (auto &x : m.m) x = random_float();
+    return m;
+}
+
+float max_error(const gl_math::Mat4 &a, const gl_math::Mat4 &b)
+{
+    float error = 0.0f;
+    for (int i = 0; i < 16; ++i) error = std::fmax(error, std::fabs(a.m[i] - b.m[i]));
+    return error;
+}
+
+void check_kernels()
+{
+    srand(69);
+
+    float inverse_error = 0.0f;
+    for (int n = 0; n < 1000; ++n) {
+        const gl_math::Mat4 m = random_mat4();
+        const auto inv = gl_math::inverse(m);
+        assert(inv.has_value);
+        inverse_error = std::fmax(inverse_error, max_error(m * inv.unwrap, gl_math::mat4_identity()));
+
+        gl_math::Mat3 m3 = {};
+        for (int j = 0; j < 3; ++j) {
+            for (int i = 0; i < 3; ++i) m3.m[4 * j + i] = m.m[4 * j + i];
+        }
+        const auto inv3 = gl_math::inverse(m3);
+        assert(inv3.has_value);
+        const gl_math::Mat3 id3 = m3 * inv3.unwrap;
+        for (int j = 0; j < 3; ++j) {
+            for (int i = 0; i < 3; ++i) {
+                inverse_error = std::fmax(inverse_error, std::fabs(id3.m[4 * j + i] - (i == j ? 1.0f : 0.0f)));
+            }
+        }
+    }
+
+    gl_math::Mat4 singular = random_mat4();
+    for (int i = 0; i < 4; ++i) singular.m[8 + i] = 0.0f;
+    assert(!gl_math::inverse(singular).has_value);
+
+    // Odd count for the tail of the AVX loop
+    std::vector<gl_math::Vec4> in(1001), out(1001);
+    std::vector<gl::Vec4f> expected(1001);
+    for (auto &v : in) v = {random_float(), random_float(), random_float(), 1.0f};
+    const gl_math::Mat4 m = random_mat4();
+    gl_math::transform(m, in.data(), out.data(), in.size());
+    transform_scalar(m, in.data(), expected.data(), in.size());
+
+    float transform_error = 0.0f;
+    for (size_t i = 0; i < in.size(); ++i) {
+        const gl_math::Vec4 single = m * in[i];
+        transform_error = std::fmax(transform_error, std::fabs(out[i].x - expected[i].x));
+        transform_error = std::fmax(transform_error, std::fabs(out[i].w - expected[i].w));
+        transform_error = std::fmax(transform_error, std::fabs(single.y - expected[i].y));
+    }
+
+    printf("Max inverse error:   %g\n", inverse_error);
+    printf("Max transform error: %g\n", transform_error);
+    assert(inverse_error < 1e-2f);
+    assert(transform_error < 1e-5f);
+}
+
+int main()
+{
+    check_kernels();
+
+    std::vector<gl_math::Vec4> in(VERTICES), out(VERTICES);
+    for (auto &v : in) v = {random_float(), random_float(), random_float(), 1.0f};
+    const gl_math::Mat4 m = gl_math::mat4_translation({1.0f, 2.0f, 3.0f}) * gl_math::mat4_scale({2.0f, 2.0f, 2.0f});
+
+    const double scalar_ns = measure([&] { transform_scalar(m, in.data(), out.data(), VERTICES); });
+    const double simd_ns = measure([&] { gl_math::transform(m, in.data(), out.data(), VERTICES); });
+
+    printf("Transform of %zu vertices, ns per vertex\n", VERTICES);
+    printf("%-12s %8.3f\n", "scalar", scalar_ns);
+    printf("%-12s %8.3f (%.1fx)\n", gl_math::SIMD, simd_ns, scalar_ns / simd_ns);
+
+    return 0;
+}
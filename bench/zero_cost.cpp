@@ -0,0 +1,356 @@
+// Every gl.hpp wrapper next to the raw GL code it is supposed to be
+// equivalent to. The file is only compiled, never linked: `make check`
+// disassembles every gl_<name> function and its raw_<name> twin and
+// fails unless they are the same instructions, i.e. if the wrapper
+// stopped being free.
+//
+// The results are stored through an out parameter like the user code
+// would do, and the _by_value pairs return them as well: the handles
+// and Maybe<T> must cost nothing more than the structs of the raw code
+// when they cross a function boundary.
+
+#include <cassert>
+#include <cstddef>
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+// Included but without GL_HPP_TRACE, like in a release build: the
+// wrappers must stay the raw calls
+#include "gl_trace.hpp"
+#include "gl.hpp"
+#include "gl_math.hpp"
+
+#define ZERO_COST extern "C" __attribute__((noinline, used))
+
+struct Raw_Location
+{
+    bool has_value;
+    GLint unwrap;
+};
+
+// GCC never turns the call of a function returning a GLuint into a tail
+// call when the caller returns a struct, whatever the struct, so the raw
+// twins of the handle returns return one too: the comparison is then
+// between the gl.hpp handle and a plain struct of the same GLuint.
+struct Raw_Handle
+{
+    GLuint unwrap;
+};
+
+ZERO_COST void raw_clear(GLbitfield mask) { glClear(mask); }
+ZERO_COST void gl_clear(gl::Buffer_Bit mask) { gl::clear(mask); }
+
+ZERO_COST void raw_clearColor(GLclampf r, GLclampf g, GLclampf b, GLclampf a) { glClearColor(r, g, b, a); }
+ZERO_COST void gl_clearColor(GLclampf r, GLclampf g, GLclampf b, GLclampf a) { gl::clearColor({r, g, b, a}); }
+
+ZERO_COST void raw_createShader(GLenum type, GLuint *out) { *out = glCreateShader(type); }
+ZERO_COST void gl_createShader(gl::Shader_Type type, gl::Shader *out) { *out = gl::createShader(type); }
+
+ZERO_COST void raw_createProgram(GLuint *out) { *out = glCreateProgram(); }
+ZERO_COST void gl_createProgram(gl::Program *out) { *out = gl::createProgram(); }
+
+ZERO_COST void raw_attachShader(GLuint program, GLuint shader) { glAttachShader(program, shader); }
+ZERO_COST void gl_attachShader(gl::Program program, gl::Shader shader) { gl::attachShader(program, shader); }
+
+ZERO_COST void raw_linkProgram(GLuint program) { glLinkProgram(program); }
+ZERO_COST void gl_linkProgram(gl::Program program) { gl::linkProgram(program); }
+
+ZERO_COST void raw_shaderSource(GLuint shader, GLsizei count, const GLchar **string, const GLint *length)
+{
+    glShaderSource(shader, count, string, length);
+}
+ZERO_COST void gl_shaderSource(gl::Shader shader, GLsizei count, const GLchar **string, const GLint *length)
+{
+    gl::shaderSource(shader, count, string, length);
+}
+
+ZERO_COST void raw_compileShader(GLuint shader) { glCompileShader(shader); }
+ZERO_COST void gl_compileShader(gl::Shader shader) { gl::compileShader(shader); }
+
+ZERO_COST void raw_compileStatus(GLuint shader, bool *out)
+{
+    GLint param = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &param);
+    *out = param;
+}
+ZERO_COST void gl_compileStatus(gl::Shader shader, bool *out) { *out = gl::compileStatus(shader); }
+
+ZERO_COST void raw_useProgram(GLuint program) { glUseProgram(program); }
+ZERO_COST void gl_useProgram(gl::Program program) { gl::useProgram(program); }
+
+ZERO_COST void raw_drawArrays(GLenum mode, GLint first, GLsizei count) { glDrawArrays(mode, first, count); }
+ZERO_COST void gl_drawArrays(gl::Draw_Mode mode, GLint first, GLsizei count) { gl::drawArrays(mode, first, count); }
+
+ZERO_COST void raw_drawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices)
+{
+    glDrawElements(mode, count, type, indices);
+}
+ZERO_COST void gl_drawElements(gl::Draw_Mode mode, GLsizei count, gl::Element_Index_Type type, const GLvoid *indices)
+{
+    gl::drawElements(mode, count, type, indices);
+}
+
+ZERO_COST void raw_drawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLint base)
+{
+    glDrawElementsBaseVertex(mode, count, type, indices, base);
+}
+ZERO_COST void gl_drawElementsBaseVertex(gl::Draw_Mode mode, GLsizei count, gl::Element_Index_Type type,
+                                         const GLvoid *indices, GLint base)
+{
+    gl::drawElementsBaseVertex(mode, count, type, indices, base);
+}
+
+ZERO_COST void raw_enable(GLenum cap) { glEnable(cap); }
+ZERO_COST void gl_enable(gl::Capability cap) { gl::enable(cap); }
+
+ZERO_COST void raw_bindBufferBase(GLuint index, GLuint buffer) { glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, index, buffer); }
+ZERO_COST void gl_bindBufferBase(GLuint index, gl::Buffer buffer)
+{
+    gl::bindBufferBase(gl::Indexed_Buffer_Target::TRANSFORM_FEEDBACK, index, buffer);
+}
+
+ZERO_COST void raw_beginTransformFeedback(GLenum mode) { glBeginTransformFeedback(mode); }
+ZERO_COST void gl_beginTransformFeedback(gl::Transform_Feedback_Primitive_Mode mode) { gl::beginTransformFeedback(mode); }
+
+ZERO_COST void raw_drawTransformFeedback(GLenum mode, GLuint id) { glDrawTransformFeedback(mode, id); }
+ZERO_COST void gl_drawTransformFeedback(gl::Draw_Mode mode, gl::Transform_Feedback feedback)
+{
+    gl::drawTransformFeedback(mode, feedback);
+}
+
+ZERO_COST void raw_beginQuery(GLuint query) { glBeginQuery(GL_ANY_SAMPLES_PASSED, query); }
+ZERO_COST void gl_beginQuery(gl::Query query) { gl::beginQuery(gl::Query_Target::ANY_SAMPLES_PASSED, query); }
+
+ZERO_COST void raw_queryResultAvailable(GLuint query, bool *out)
+{
+    GLuint available = 0;
+    glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    *out = available;
+}
+ZERO_COST void gl_queryResultAvailable(gl::Query query, bool *out) { *out = gl::queryResultAvailable(query); }
+
+ZERO_COST void raw_beginConditionalRender(GLuint query, GLenum mode) { glBeginConditionalRender(query, mode); }
+ZERO_COST void gl_beginConditionalRender(gl::Query query, gl::Conditional_Render_Mode mode)
+{
+    gl::beginConditionalRender(query, mode);
+}
+
+ZERO_COST void raw_clientWaitSync(const GLsync *sync, GLuint64 timeout, GLenum *out)
+{
+    *out = glClientWaitSync(*sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+}
+ZERO_COST void gl_clientWaitSync(const gl::Fence *fence, GLuint64 timeout, gl::Wait_Result *out)
+{
+    *out = gl::clientWaitSync(*fence, true, timeout);
+}
+
+ZERO_COST void raw_signaled(const GLsync *sync, bool *out)
+{
+    GLint status = GL_UNSIGNALED;
+    glGetSynciv(*sync, GL_SYNC_STATUS, 1, nullptr, &status);
+    *out = status == GL_SIGNALED;
+}
+ZERO_COST void gl_signaled(const gl::Fence *fence, bool *out) { *out = gl::signaled(*fence); }
+
+ZERO_COST void raw_debugMessageControl(GLenum severity, GLboolean enabled)
+{
+    glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, severity, 0, nullptr, enabled);
+}
+ZERO_COST void gl_debugMessageControl(gl::Debug_Severity severity, bool enabled)
+{
+    gl::debugMessageControl(gl::Debug_Source::DONT_CARE, gl::Debug_Type::DONT_CARE, severity, enabled);
+}
+
+ZERO_COST void raw_debugMessageInsert(GLenum type, GLuint id, GLenum severity, const GLchar *message)
+{
+    glDebugMessageInsert(GL_DEBUG_SOURCE_APPLICATION, type, id, severity, -1, message);
+}
+ZERO_COST void gl_debugMessageInsert(gl::Debug_Type type, GLuint id, gl::Debug_Severity severity,
+                                     const GLchar *message)
+{
+    gl::debugMessageInsert(gl::Debug_Source::APPLICATION, type, id, severity, message);
+}
+
+ZERO_COST void raw_primitiveRestartIndex(GLuint index) { glPrimitiveRestartIndex(index); }
+ZERO_COST void gl_primitiveRestartIndex(GLuint index) { gl::primitiveRestartIndex(index); }
+
+ZERO_COST void raw_getUniformLocation(GLuint program, const GLchar *name, Raw_Location *out)
+{
+    GLint location = glGetUniformLocation(program, name);
+    *out = {location >= 0, location};
+}
+ZERO_COST void gl_getUniformLocation(gl::Program program, const GLchar *name, Maybe<gl::Uniform> *out)
+{
+    *out = gl::getUniformLocation(program, name);
+}
+
+ZERO_COST void raw_uniform2f(GLint location, GLfloat x, GLfloat y) { glUniform2f(location, x, y); }
+ZERO_COST void gl_uniform2f(gl::Uniform location, GLfloat x, GLfloat y) { gl::uniform(location, gl::Vec2f {x, y}); }
+
+ZERO_COST void raw_uniform1f(GLint location, GLfloat x) { glUniform1f(location, x); }
+ZERO_COST void gl_uniform1f(gl::Uniform location, GLfloat x) { gl::uniform(location, x); }
+
+ZERO_COST void raw_uniform1iv(GLint location, GLsizei count, GLint *xs) { glUniform1iv(location, count, xs); }
+ZERO_COST void gl_uniform1iv(gl::Uniform location, GLsizei count, GLint *xs) { gl::uniform(location, count, xs); }
+
+ZERO_COST void raw_uniform1i(GLint location, GLint x) { glUniform1i(location, x); }
+ZERO_COST void gl_uniform1i(gl::Uniform location, GLint x) { gl::uniformi(location, x); }
+
+ZERO_COST void raw_uniform1ui(GLint location, GLuint x) { glUniform1ui(location, x); }
+ZERO_COST void gl_uniform1ui(gl::Uniform location, GLuint x) { gl::uniformui(location, x); }
+
+ZERO_COST void raw_typed_uniform1i(GLint location, GLint x) { glUniform1i(location, x); }
+ZERO_COST void gl_typed_uniform1i(gl::Typed_Uniform<GLint> location, GLint x) { gl::uniform(location, x); }
+
+ZERO_COST void raw_uniform4f(GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { glUniform4f(location, x, y, z, w); }
+ZERO_COST void gl_uniform4f(gl::Uniform location, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { gl::uniform(location, gl::Vec4f {x, y, z, w}); }
+
+ZERO_COST void raw_uniform4fv(GLint location, GLsizei count, const GLfloat *xs) { glUniform4fv(location, count, xs); }
+ZERO_COST void gl_uniform4fv(gl::Uniform location, GLsizei count, const gl::Vec4f *xs) { gl::uniform(location, count, xs); }
+
+ZERO_COST void raw_uniformMatrix4fv(GLint location, const GLfloat *m) { glUniformMatrix4fv(location, 1, GL_FALSE, m); }
+ZERO_COST void gl_uniformMatrix4fv(gl::Uniform location, const gl::Mat4f *m) { gl::uniform(location, *m); }
+
+// The gl_math types are uploaded to the typed uniforms of the gl.hpp
+// type they derive from
+ZERO_COST void raw_typed_uniform4f_math(GLint location, const GLfloat *v) { glUniform4f(location, v[0], v[1], v[2], v[3]); }
+ZERO_COST void gl_typed_uniform4f_math(gl::Typed_Uniform<gl::Vec4f> location, const gl_math::Vec4 *v) { gl::uniform(location, *v); }
+
+ZERO_COST void raw_typed_uniform4fv_math(GLint location, GLsizei count, const GLfloat *xs) { glUniform4fv(location, count, xs); }
+ZERO_COST void gl_typed_uniform4fv_math(gl::Typed_Uniform<gl::Vec4f[16]> location, GLsizei count, const gl_math::Vec4 *xs) { gl::uniform(location, count, xs); }
+
+ZERO_COST void raw_typed_uniformMatrix4fv_math(GLint location, const GLfloat *m) { glUniformMatrix4fv(location, 1, GL_FALSE, m); }
+ZERO_COST void gl_typed_uniformMatrix4fv_math(gl::Typed_Uniform<gl::Mat4f> location, const gl_math::Mat4 *m) { gl::uniform(location, *m); }
+
+ZERO_COST void raw_genVertexArray(GLuint *out)
+{
+    GLuint id = 0;
+    glGenVertexArrays(1, &id);
+    *out = id;
+}
+ZERO_COST void gl_genVertexArray(gl::Vertex_Array *out) { *out = gl::genVertexArray(); }
+
+ZERO_COST void raw_bindVertexArray(GLuint array) { glBindVertexArray(array); }
+ZERO_COST void gl_bindVertexArray(gl::Vertex_Array array) { gl::bindVertexArray(array); }
+
+ZERO_COST void raw_genBuffer(GLuint *out)
+{
+    GLuint id = 0;
+    glGenBuffers(1, &id);
+    *out = id;
+}
+ZERO_COST void gl_genBuffer(gl::Buffer *out) { *out = gl::genBuffer(); }
+
+ZERO_COST void raw_bindBuffer(GLenum target, GLuint buffer) { glBindBuffer(target, buffer); }
+ZERO_COST void gl_bindBuffer(gl::Buffer_Target target, gl::Buffer buffer) { gl::bindBuffer(target, buffer); }
+
+ZERO_COST void raw_bufferData(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage)
+{
+    glBufferData(target, size, data, usage);
+}
+ZERO_COST void gl_bufferData(gl::Buffer_Target target, GLsizeiptr size, const GLvoid *data, gl::Buffer_Usage usage)
+{
+    gl::bufferData(target, size, data, usage);
+}
+
+ZERO_COST void raw_enableVertexAttribArray(GLuint index) { glEnableVertexAttribArray(index); }
+ZERO_COST void gl_enableVertexAttribArray(gl::Attribute_Location index) { gl::enableVertexAttribArray(index); }
+
+ZERO_COST void raw_vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized,
+                                       GLsizei stride, const GLvoid *pointer)
+{
+    glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+ZERO_COST void gl_vertexAttribPointer(gl::Attribute_Location index, gl::Attribute_Size size, gl::Attribute_Type type,
+                                      GLboolean normalized, GLsizei stride, const GLvoid *pointer)
+{
+    gl::vertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+ZERO_COST void raw_vertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+    glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+ZERO_COST void gl_vertexAttribIPointer(gl::Attribute_Location index, gl::Attribute_Size size, gl::Attribute_IType type,
+                                       GLsizei stride, const GLvoid *pointer)
+{
+    gl::vertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+ZERO_COST void raw_getAttribLocation(GLuint program, const GLchar *name, Raw_Location *out)
+{
+    GLint location = glGetAttribLocation(program, name);
+    *out = {location >= 0, location};
+}
+ZERO_COST void gl_getAttribLocation(gl::Program program, const GLchar *name, Maybe<gl::Attribute_Location> *out)
+{
+    *out = gl::getAttribLocation(program, name);
+}
+
+ZERO_COST void raw_bindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+    glBindAttribLocation(program, index, name);
+}
+ZERO_COST void gl_bindAttribLocation(gl::Program program, gl::Attribute_Location index, const GLchar *name)
+{
+    gl::bindAttribLocation(program, index, name);
+}
+
+ZERO_COST Raw_Handle raw_createShader_by_value(GLenum type) { return {glCreateShader(type)}; }
+ZERO_COST gl::Shader gl_createShader_by_value(gl::Shader_Type type) { return gl::createShader(type); }
+
+ZERO_COST Raw_Handle raw_createProgram_by_value() { return {glCreateProgram()}; }
+ZERO_COST gl::Program gl_createProgram_by_value() { return gl::createProgram(); }
+
+ZERO_COST bool raw_compileStatus_by_value(GLuint shader)
+{
+    GLint param = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &param);
+    return param;
+}
+ZERO_COST bool gl_compileStatus_by_value(gl::Shader shader) { return gl::compileStatus(shader); }
+
+ZERO_COST Raw_Handle raw_genVertexArray_by_value()
+{
+    GLuint id = 0;
+    glGenVertexArrays(1, &id);
+    return {id};
+}
+ZERO_COST gl::Vertex_Array gl_genVertexArray_by_value() { return gl::genVertexArray(); }
+
+ZERO_COST Raw_Handle raw_genBuffer_by_value()
+{
+    GLuint id = 0;
+    glGenBuffers(1, &id);
+    return {id};
+}
+ZERO_COST gl::Buffer gl_genBuffer_by_value() { return gl::genBuffer(); }
+
+ZERO_COST GLenum raw_clientWaitSync_by_value(const GLsync &sync, GLuint64 timeout)
+{
+    return glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+}
+ZERO_COST gl::Wait_Result gl_clientWaitSync_by_value(const gl::Fence &fence, GLuint64 timeout)
+{
+    return gl::clientWaitSync(fence, true, timeout);
+}
+
+ZERO_COST Raw_Location raw_getUniformLocation_by_value(GLuint program, const GLchar *name)
+{
+    GLint location = glGetUniformLocation(program, name);
+    return {location >= 0, location};
+}
+ZERO_COST Maybe<gl::Uniform> gl_getUniformLocation_by_value(gl::Program program, const GLchar *name)
+{
+    return gl::getUniformLocation(program, name);
+}
+
+ZERO_COST Raw_Location raw_getAttribLocation_by_value(GLuint program, const GLchar *name)
+{
+    GLint location = glGetAttribLocation(program, name);
+    return {location >= 0, location};
+}
+ZERO_COST Maybe<gl::Attribute_Location> gl_getAttribLocation_by_value(gl::Program program, const GLchar *name)
+{
+    return gl::getAttribLocation(program, name);
+}
@@ -0,0 +1,104 @@
+// How much a chatty driver costs the render thread, on a headless EGL
+// context (Mesa llvmpipe works fine). The "driver" is debugMessageInsert
+// here, which goes through the same path as the messages of the
+// driver: filtering, then the callback on the calling thread.
+//
+// - raw: a glDebugMessageCallback that fprintfs every message,
+// - gl_debug: the lock-free ring drained on a background thread, which
+//   prints every distinct message once,
+// - filtered: gl_debug with messages below its minimum severity, which
+//   the driver drops before the callback.
+//
+// Both print to /dev/null without buffering, like stderr does, so the
+// cost of the write syscalls is there without flooding the terminal.
+
+#include <cstdio>
+#include <cstdlib>
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#include "gl.hpp"
+#include "gl_debug.hpp"
+#include "gl_egl.hpp"
+#include "gl_frame.hpp"
+
+const size_t MESSAGES = 100000;
+// How many of them are different
+const size_t DISTINCT = 16;
+
+FILE *out = nullptr;
+
+void raw_callback(GLenum, GLenum, GLuint, GLenum, GLsizei, const GLchar *message, const void *)
+{
+    fprintf(out, "%s\n", message);
+}
+
+// Nanoseconds per message on the render thread
+double insert_messages(gl::Debug_Severity severity)
+{
+    char text[64];
+    const double start = gl_frame::now_secs();
+    for (size_t i = 0; i < MESSAGES; ++i) {
+        const GLuint id = (GLuint) (i % DISTINCT);
+        snprintf(text, sizeof(text), "Draw %u took the slow path", id);
+        gl::debugMessageInsert(gl::Debug_Source::APPLICATION, gl::Debug_Type::PERFORMANCE, id, severity, text);
+    }
+    return (gl_frame::now_secs() - start) * 1e9 / MESSAGES;
+}
+
+void report(const char *name, double ns, const gl_debug::Stats &stats)
+{
+    printf("%-10s %10.1f %10zu %10zu %10zu %10zu %10zu\n", name, ns,
+           stats.received, stats.printed, stats.duplicates, stats.rate_limited, stats.dropped);
+}
+
+int main()
+{
+    auto context = gl_egl::create_headless_context(3, 3);
+    if (!context.has_value) {
+        fprintf(stderr, "Could not create a headless EGL context\n");
+        return 1;
+    }
+    printf("Renderer: %s\n", gl::getString(gl::String_Name::RENDERER));
+
+    out = fopen("/dev/null", "w");
+    if (!out) {
+        perror("/dev/null");
+        return 1;
+    }
+    setvbuf(out, nullptr, _IONBF, 0);
+
+    printf("%zu messages, %zu different ones\n", MESSAGES, DISTINCT);
+    printf("%-10s %10s %10s %10s %10s %10s %10s\n",
+           "", "ns/msg", "received", "printed", "repeated", "limited", "dropped");
+
+    gl::enable(gl::Capability::DEBUG_OUTPUT);
+    glDebugMessageCallback(raw_callback, nullptr);
+    const double raw_ns = insert_messages(gl::Debug_Severity::HIGH);
+    glDebugMessageCallback(nullptr, nullptr);
+    gl_debug::Stats raw_stats = {};
+    raw_stats.received = MESSAGES;
+    raw_stats.printed = MESSAGES;
+    report("raw", raw_ns, raw_stats);
+
+    {
+        gl_debug::Log log = {};
+        gl_debug::start(&log, gl::Debug_Severity::MEDIUM, 20, out, 1 << 17);
+        const double ns = insert_messages(gl::Debug_Severity::HIGH);
+        gl_debug::stop(&log);
+        report("gl_debug", ns, gl_debug::stats(log));
+    }
+
+    {
+        gl_debug::Log log = {};
+        gl_debug::start(&log, gl::Debug_Severity::MEDIUM, 20, out, 1 << 17);
+        const double ns = insert_messages(gl::Debug_Severity::NOTIFICATION);
+        gl_debug::stop(&log);
+        report("filtered", ns, gl_debug::stats(log));
+    }
+
+    fclose(out);
+    gl_egl::destroy_context(context.unwrap);
+
+    return 0;
+}
@@ -1,18 +1,16 @@
-uniform vec2 u_resolution;
-uniform float u_time;
+#version 130
+#extension GL_ARB_explicit_attrib_location : require
+#extension GL_ARB_explicit_uniform_location : require
 
-float random (vec2 st) {
-    return fract(sin(dot(st.xy,
-                         vec2(12.9898,78.233))) *
-        43758.5453123);
-}
+layout(location = 0) uniform vec2 u_resolution;
+layout(location = 1) uniform float u_time;
+
+#include "random.glsl"
 
 #define TILE_SIZE_INVERSED 50.0
 #define VELOCITY_FACTOR 5.0
 #define PADDING 0.2
 
-#define VERTICAL
-
 void main() {
     vec2 st = (gl_FragCoord.xy / u_resolution);
     st *= TILE_SIZE_INVERSED;
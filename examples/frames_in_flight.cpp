@@ -0,0 +1,168 @@
+// The same frames rendered on a headless EGL context (Mesa llvmpipe
+// works fine, its rasterizer threads play the GPU) with 1, 2 and 3
+// frames in flight through gl_sync::Frame_Ring. Every frame spends
+// CPU_WORK_MS on "game logic", uploads its vertices into the buffer of
+// its slot and draws a quad with a heavy fragment shader.
+//
+// With one frame in flight the CPU waits for the whole GPU frame before
+// it starts the next one, so the frame time is the sum of both. With two
+// or more they overlap and it goes down to the longer of the two, the
+// GPU here, which the CPU then blocks on every frame for the difference:
+// past that point a bigger N only adds latency.
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#include "gl.hpp"
+#include "gl_egl.hpp"
+#include "gl_frame.hpp"
+#include "gl_sync.hpp"
+
+const size_t FRAMES = 60;
+const double CPU_WORK_MS = 15.0;
+const GLsizei FRAMEBUFFER_SIZE = 512;
+
+const char *const vert_source =
+    "#version 130\n"
+    "in vec2 position;\n"
+    "out vec2 uv;\n"
+    "void main() {\n"
+    "    uv = position * 0.5 + 0.5;\n"
+    "    gl_Position = vec4(position, 0.0, 1.0);\n"
+    "}\n";
+
+// Enough iterations to take longer than the CPU work on llvmpipe
+const char *const frag_source =
+    "#version 130\n"
+    "in vec2 uv;\n"
+    "void main() {\n"
+    "    vec2 z = uv;\n"
+    "    for (int i = 0; i < 512; ++i) z = vec2(z.x * z.x - z.y * z.y, 2.0 * z.x * z.y) + uv - 0.5;\n"
+    "    gl_FragColor = vec4(fract(z), 0.0, 1.0);\n"
+    "}\n";
+
+const gl::Attribute_Location POSITION = {0};
+
+gl::Shader compile_shader(gl::Shader_Type type, const char *source)
+{
+    auto shader = gl::createShader(type);
+    gl::shaderSource(shader, 1, &source, NULL);
+    gl::compileShader(shader);
+    if (!gl::compileStatus(shader)) {
+        fprintf(stderr, "%s\n", gl::getShaderInfoLog<1024>(shader).value);
+        abort();
+    }
+    return shader;
+}
+
+// Stands for whatever the CPU does every frame. It sleeps instead of
+// spinning so that llvmpipe gets the core on a single core machine.
+void cpu_work(double ms)
+{
+    const double deadline = gl_frame::now_secs() + ms * 1e-3;
+    gl_frame::sleep_until(deadline);
+}
+
+template <size_t N>
+void run()
+{
+    gl::Buffer buffers[N];
+    gl::Vertex_Array vertex_arrays[N];
+    for (size_t i = 0; i < N; ++i) {
+        buffers[i] = gl::genBuffer();
+        vertex_arrays[i] = gl::genVertexArray();
+        gl::bindVertexArray(vertex_arrays[i]);
+        gl::bindBuffer(gl::Buffer_Target::ARRAY, buffers[i]);
+        gl::bufferData(gl::Buffer_Target::ARRAY, 4 * sizeof(gl::Vec2f), nullptr, gl::Buffer_Usage::STREAM_DRAW);
+        gl::vertexAttribPointer(POSITION, gl::Attribute_Size::TWO, gl::Attribute_Type::FLOAT, GL_FALSE, 0, nullptr);
+        gl::enableVertexAttribArray(POSITION);
+    }
+
+    gl_sync::Frame_Ring<N> ring = {};
+    const double start = gl_frame::now_secs();
+    for (size_t frame = 0; frame < FRAMES; ++frame) {
+        const size_t slot = gl_sync::begin_frame(&ring);
+        cpu_work(CPU_WORK_MS);
+
+        // The GPU is done with the last frame that drew from this
+        // buffer, so the driver needs neither a stall nor a copy
+        const GLfloat x = (float) (frame % 8) * 0.01f;
+        const gl::Vec2f quad[4] = {{-1.0f + x, -1.0f}, {1.0f, -1.0f}, {-1.0f + x, 1.0f}, {1.0f, 1.0f}};
+        gl::bindBuffer(gl::Buffer_Target::ARRAY, buffers[slot]);
+        gl::bufferData(gl::Buffer_Target::ARRAY, sizeof(quad), quad, gl::Buffer_Usage::STREAM_DRAW);
+
+        gl::clear(gl::Buffer_Bit::COLOR);
+        gl::bindVertexArray(vertex_arrays[slot]);
+        gl::drawArrays(gl::Draw_Mode::TRIANGLE_STRIP, 0, 4);
+        gl_sync::end_frame(&ring);
+        // What the swap does with a window: hands the frame to the GPU
+        glFlush();
+    }
+    gl_sync::finish(&ring);
+    const double ms_per_frame = (gl_frame::now_secs() - start) * 1000.0 / FRAMES;
+
+    const gl_frame::Report blocked = gl_frame::report(ring.stats);
+    printf("%-10zu %10.2f %10.2f %10.2f %10.2f\n",
+           N, ms_per_frame, blocked.p50 * 1000.0, blocked.p95 * 1000.0, blocked.max * 1000.0);
+
+    gl::bindVertexArray({0});
+    for (size_t i = 0; i < N; ++i) {
+        gl::deleteObject(vertex_arrays[i]);
+        gl::deleteObject(buffers[i]);
+    }
+}
+
+int main()
+{
+    // llvmpipe renders in the flush itself when it has no rasterizer
+    // threads, which is the default with a single core, and then nothing
+    // is ever in flight
+    setenv("LP_NUM_THREADS", "2", 0);
+
+    auto context = gl_egl::create_headless_context(3, 3);
+    if (!context.has_value) {
+        fprintf(stderr, "Could not create a headless EGL context\n");
+        return 1;
+    }
+
+    // There is no default framebuffer without a surface
+    GLuint fbo = 0, color = 0;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(1, &color);
+    glBindRenderbuffer(GL_RENDERBUFFER, color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    glViewport(0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+
+    printf("Renderer: %s\n", gl::getString(gl::String_Name::RENDERER));
+
+    auto program = gl::createProgram();
+    gl::attachShader(program, compile_shader(gl::Shader_Type::Vertex, vert_source));
+    gl::attachShader(program, compile_shader(gl::Shader_Type::Fragment, frag_source));
+    gl::bindAttribLocation(program, POSITION, "position");
+    gl::linkProgram(program);
+    assert(gl::linkStatus(program));
+    gl::useProgram(program);
+
+    // A fence on nothing signals right away
+    gl::Fence fence = gl::fenceSync();
+    glFinish();
+    assert(gl::signaled(fence));
+    assert(gl::clientWaitSync(fence, false, 0) == gl::Wait_Result::ALREADY_SIGNALED);
+    fence.reset();
+
+    printf("%zu frames of %.0f ms of CPU work, the CPU blocked on the GPU for (ms):\n", FRAMES, CPU_WORK_MS);
+    printf("%-10s %10s %10s %10s %10s\n", "in flight", "ms/frame", "p50", "p95", "max");
+    run<1>();
+    run<2>();
+    run<3>();
+
+    gl::deleteObject(program);
+    gl_egl::destroy_context(context.unwrap);
+
+    return 0;
+}
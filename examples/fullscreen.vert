@@ -0,0 +1,9 @@
+#version 130
+
+// Covers the whole viewport with a TRIANGLE_STRIP of 4 vertices
+// without any vertex attributes.
+void main(void)
+{
+    vec2 uv = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+    gl_Position = vec4(2.0 * uv - 1.0, 0.0, 1.0);
+}
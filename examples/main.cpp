@@ -1,85 +1,44 @@
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#ifdef TILES_HEADLESS
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#else
 #define GL_GLEXT_PROTOTYPES 2
 #include <GLFW/glfw3.h>
-#include <unistd.h>
+#endif
 #define GL_HPP_ASSERT_GL_ERRORS
+#define GL_HPP_STATS
+#ifdef GL_HPP_CAPTURE
+#include "gl_capture.hpp"
+#endif
 #include "gl.hpp"
-
-void platformSleep(float secs)
-{
-    usleep((useconds_t) (secs * 1e+6f));
-}
-
-const size_t INFO_LOG_CAPACITY = 512;
-
-template <GLsizei Max_Length>
-void print_info_log(FILE *stream, gl::Info_Log<Max_Length> *log)
-{
-    fwrite(log->value, 1, log->length, stderr);
-    fprintf(stderr, "\n");
-}
-
-// TODO: read_whole_file does not check all the errors
-const char *read_whole_file(const char *file_path)
-{
-    FILE *f = fopen(file_path, "rb");
-    if (!f) return NULL;
-
-    fseek(f, 0, SEEK_END);
-    long m = ftell(f);
-    char *result = (char *) malloc(m + 1);
-    fseek(f, 0, SEEK_SET);
-    fread(result, 1, m, f);
-    result[m] = '\0';
-
-    fclose(f);
-
-    return result;
-}
-
-gl::Program link_program(gl::Shader vert, gl::Shader frag)
-{
-    gl::Program program = gl::createProgram();
-    gl::attachShader(program, vert);
-    gl::attachShader(program, frag);
-    gl::linkProgram(program);
-    if (!gl::linkStatus(program)) {
-        auto log = gl::getProgramInfoLog<INFO_LOG_CAPACITY>(program);
-        fprintf(stderr, "Program link error: ");
-        print_info_log<INFO_LOG_CAPACITY>(stderr, &log);
-        gl::deleteObject(program);
-        abort();
-    }
-    return program;
-}
-
-gl::Shader read_and_compile_shader(gl::Shader_Type shaderType, const char *file_path)
-{
-    const char *shader_source = read_whole_file(file_path);
-    assert(shader_source);
-
-    auto shader = gl::createShader(shaderType);
-    gl::shaderSource(shader, 1, &shader_source, NULL);
-    gl::compileShader(shader);
-    if (!gl::compileStatus(shader)) {
-        auto infoLog = gl::getShaderInfoLog<INFO_LOG_CAPACITY>(shader);
-        fprintf(stderr, "Shader compilation failed `%s`: ", file_path);
-        print_info_log<INFO_LOG_CAPACITY>(stderr, &infoLog);
-        gl::deleteObject(shader);
-        abort();
-    }
-
-    free((void*) shader_source);
-    return shader;
-}
-
+#include "gl_debug.hpp"
+#include "gl_frame.hpp"
+#include "gl_source.hpp"
+#include "gl_reload.hpp"
+#include "gl_variants.hpp"
+#include "gl_uniforms.hpp"
+#include "shaders.hpp"
+#ifdef TILES_HEADLESS
+#include "gl_egl.hpp"
+#endif
+
+gl_source::Include_Cache includes = {};
+gl_source::Shader_Cache shader_cache = {};
+
+#ifndef TILES_HEADLESS
 void oopsie_doopsie(int code, const char* description)
 {
     fprintf(stderr, "GLFW did an oopsie-doopsie: %s\n", description);
     abort();
 }
+#endif
 
 const int WINDOW_WIDTH = 640;
 const int WINDOW_HEIGHT = 640;
@@ -91,16 +50,110 @@ GLint tiles[] = {
     4, 4, 4, 4,
 };
 
-void funcname(GLenum source, GLenum type, GLuint id,
-              GLenum severity, GLsizei length,
-              const GLchar* message,
-              const void* userParam)
+struct Scene
 {
-    fprintf(stderr, "%s\n", message);
+    const char *name;
+    const char *vert_path;
+    const char *frag_path;
+    GLsizei vertex_count;
+    // The switches of the shader variants, see gl_variants
+    std::vector<std::string> defines;
+    // From shaders.hpp, so the variants share them
+    Maybe<gl::Typed_Uniform<gl::Vec2f>> u_resolution;
+    Maybe<gl::Typed_Uniform<GLfloat>> u_time;
+};
+
+Scene scenes[] = {
+    {"tiles", shaders::Tiles::vert_path, shaders::Tiles::frag_path,
+     sizeof(tiles) / sizeof(tiles[0]), {}, {}, {}},
+    {"epic", shaders::Epic::vert_path, shaders::Epic::frag_path,
+     4, {"VERTICAL"}, {true, shaders::Epic::u_resolution}, {true, shaders::Epic::u_time}},
+};
+
+// Every scene cycles through its variants, one per VARIANT_PERIOD seconds
+const double VARIANT_PERIOD = 2.0;
+const size_t VARIANTS_BUDGET = 8;
+
+const size_t SCENES_COUNT = sizeof(scenes) / sizeof(scenes[0]);
+
+void usage(FILE *stream)
+{
+    fprintf(stream, "Usage: tiles [--scene <name>] [--frames <n>] [--fps <n>] [--watch]\n");
+    fprintf(stream, "    --scene <name>    Scene to render:");
+    for (size_t i = 0; i < SCENES_COUNT; ++i) {
+        fprintf(stream, " %s", scenes[i].name);
+    }
+    fprintf(stream, " (default: %s)\n", scenes[0].name);
+    fprintf(stream, "    --frames <n>      Exit after rendering <n> frames\n");
+    fprintf(stream, "    --fps <n>         Pace the loop to <n> frames per second, 0 to run unpaced\n");
+    fprintf(stream, "    --watch           Reload the shaders when their files change\n");
+#ifdef GL_HPP_CAPTURE
+    fprintf(stream, "    --capture <file>  Capture the GL calls for tools/replay\n");
+#endif
 }
 
 int main(int argc, char *argv[])
 {
+    const Scene *scene = &scenes[0];
+    long max_frames = -1;
+    bool watch = false;
+#ifdef GL_HPP_CAPTURE
+    const char *capture_path = NULL;
+#endif
+#ifdef TILES_HEADLESS
+    double fps = 0.0;
+#else
+    double fps = 60.0;
+#endif
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--scene") == 0 && i + 1 < argc) {
+            const char *name = argv[++i];
+            scene = NULL;
+            for (size_t j = 0; j < SCENES_COUNT; ++j) {
+                if (strcmp(scenes[j].name, name) == 0) {
+                    scene = &scenes[j];
+                }
+            }
+            if (!scene) {
+                fprintf(stderr, "Unknown scene `%s`\n", name);
+                usage(stderr);
+                exit(1);
+            }
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            max_frames = strtol(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            fps = strtod(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--watch") == 0) {
+            watch = true;
+#ifdef GL_HPP_CAPTURE
+        } else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+            capture_path = argv[++i];
+#endif
+        } else {
+            usage(stderr);
+            exit(1);
+        }
+    }
+
+#ifdef TILES_HEADLESS
+    auto context = gl_egl::create_headless_context(3, 3);
+    if (!context.has_value) {
+        fprintf(stderr, "Could not create a headless EGL context\n");
+        exit(1);
+    }
+
+    // There is no default framebuffer without a surface, so render into
+    // an FBO of the size of the window
+    GLuint fbo = 0, color = 0;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(1, &color);
+    glBindRenderbuffer(GL_RENDERBUFFER, color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, WINDOW_WIDTH, WINDOW_HEIGHT);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    assert(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+#else
     glfwSetErrorCallback(oopsie_doopsie);
 
     glfwInit();
@@ -112,15 +165,28 @@ int main(int argc, char *argv[])
             NULL, NULL);
 
     glfwMakeContextCurrent(window);
+#endif
 
     printf("OpenGL Version: %s\n", gl::getString(gl::String_Name::VERSION));
 
-    glDebugMessageCallback(funcname, NULL);
+#ifdef GL_HPP_CAPTURE
+    // Before anything is created, so the replay creates it too
+    gl_capture::Capture capture = {};
+    if (capture_path && !gl_capture::start(&capture, capture_path, WINDOW_WIDTH, WINDOW_HEIGHT)) {
+        fprintf(stderr, "Could not create `%s`: %s\n", capture_path, strerror(errno));
+        exit(1);
+    }
+#endif
+
+    gl_debug::Log debug_log = {};
+    gl_debug::start(&debug_log, gl::Debug_Severity::LOW);
 
-    auto vert = read_and_compile_shader(gl::Shader_Type::Vertex, "shader.vert");
-    auto frag = read_and_compile_shader(gl::Shader_Type::Fragment, "shader.frag");
-    auto program = link_program(vert, frag);
-    gl::useProgram(program);
+    gl_variants::Set variants =
+        gl_variants::make_set(&includes, &shader_cache, scene->vert_path, scene->frag_path,
+                              scene->defines, 0, VARIANTS_BUDGET);
+    if (!gl_variants::init(&variants, true)) {
+        exit(1);
+    }
 
     auto vao = gl::genVertexArray();
     gl::bindVertexArray(vao);
@@ -130,49 +196,178 @@ int main(int argc, char *argv[])
     gl::bindBuffer(gl::Buffer_Target::ARRAY, tile_buffer);
     gl::bufferData(gl::Buffer_Target::ARRAY, sizeof(tiles), tiles, gl::Buffer_Usage::STATIC_DRAW);
 
-    gl::Attribute_Location tileAttrib = {0};
-    gl::bindAttribLocation(program, tileAttrib, "tile");
-    gl::enableVertexAttribArray(tileAttrib);
-    gl::vertexAttribIPointer(tileAttrib,
-                             gl::Attribute_Size::ONE,
+    static_assert(shaders::Tiles::tile_integer, "`tile` is fed with vertexAttribIPointer");
+    gl::enableVertexAttribArray(shaders::Tiles::tile);
+    gl::vertexAttribIPointer(shaders::Tiles::tile,
+                             shaders::Tiles::tile_size,
                              gl::Attribute_IType::INT,
                              0,
                              nullptr);
 
-    auto u_resolution = gl::getUniformLocation(program, "u_resolution");
-    auto u_time = gl::getUniformLocation(program, "u_time");
+    gl::Program program = {};
+    gl_uniforms::Shadow uniforms = {};
+
+    gl_reload::Watcher watcher = {};
+    double changed_at = 0.0;
+    bool reload_pending = false;
+    size_t reload_failures = 0;
+    size_t reloads = 0;
+    size_t reloads_rejected = 0;
+    if (watch) {
+        // Every file the shaders were built from, the includes too
+        for (const auto &file : includes.files) {
+            if (!gl_reload::watch(&watcher, file.first.c_str())) {
+                fprintf(stderr, "Could not watch `%s`: %s\n", file.first.c_str(), strerror(errno));
+                exit(1);
+            }
+        }
+        if (!gl_reload::start(&watcher)) {
+            fprintf(stderr, "Could not watch the shaders: %s\n", strerror(errno));
+            exit(1);
+        }
+    }
+
+    size_t draw_calls = 0;
+    size_t bytes_uploaded = 0;
+
+    gl_frame::Loop loop = gl_frame::make_loop(fps > 0.0 ? 1.0 / fps : 0.0);
+    for (long frame = 0; max_frames < 0 || frame < max_frames; ++frame) {
+#ifdef TILES_HEADLESS
+        int width = WINDOW_WIDTH, height = WINDOW_HEIGHT;
+#else
+        if (glfwWindowShouldClose(window)) break;
 
-    const float delta_time = 1.0f / 60.0f;
-    float time = 0.0f;
-    while (!glfwWindowShouldClose(window)) {
         int width, height;
         glfwGetFramebufferSize(window, &width, &height);
+#endif
+
+        gl_frame::begin(&loop);
+        gl::stats = {};
+
+        if (watch) {
+            const gl_reload::Taken taken = gl_reload::take_sources(&watcher, &includes);
+            if (taken.rejected > 0) {
+                fprintf(stderr, "Kept the previous sources of %zu shader files\n", taken.rejected);
+                reloads_rejected += taken.rejected;
+            }
+            if (taken.changed > 0) {
+                gl_variants::invalidate(&variants);
+                changed_at = taken.changed_at;
+                reload_pending = true;
+                reload_failures = variants.stats.failures;
+            }
+        }
+
+        const size_t variants_count = (size_t) 1 << scene->defines.size();
+        const auto key = (gl_variants::Key) ((size_t) (loop.frame_start - loop.start) / VARIANT_PERIOD) % variants_count;
+        const gl::Program next_program = gl_variants::get(&variants, key);
+        if (reload_pending && variants.stats.failures > reload_failures) {
+            // The old programs stay in use
+            reload_pending = false;
+        }
+        if (next_program.unwrap != program.unwrap) {
+            program = next_program;
+            gl::useProgram(program);
+            gl_uniforms::reset(&uniforms, program);
+            if (reload_pending) {
+                reload_pending = false;
+                reloads += 1;
+                fprintf(stderr, "Reloaded the shaders in %.3f ms\n",
+                        (gl_frame::now_secs() - changed_at) * 1000.0);
+            }
+        }
 
         glViewport(0, 0, width, height);
 
         gl::clearColor({0.0f, 0.0f, 0.0f, 1.0f});
         gl::clear(gl::Buffer_Bit::COLOR | gl::Buffer_Bit::DEPTH);
 
-        if (u_resolution.has_value) {
-            gl::uniform(u_resolution.unwrap, gl::Vec2f {(GLfloat) width, (GLfloat) height});
+        if (scene->u_resolution.has_value) {
+            gl_uniforms::uniform(&uniforms, scene->u_resolution.unwrap,
+                                 gl::Vec2f {(GLfloat) width, (GLfloat) height});
         }
 
-        if (u_time.has_value) {
-            gl::uniform(u_time.unwrap, time);
+        if (scene->u_time.has_value) {
+            gl_uniforms::uniform(&uniforms, scene->u_time.unwrap, (GLfloat) gl_frame::late_latch(&loop));
         }
 
         gl::bindVertexArray(vao);
-        gl::drawArrays(gl::Draw_Mode::TRIANGLE_STRIP, 0, sizeof(tiles) / sizeof(tiles[0]));
+        gl::drawArrays(gl::Draw_Mode::TRIANGLE_STRIP, 0, scene->vertex_count);
 
+#ifdef TILES_HEADLESS
+        // Nothing is presented, so wait for the frame to be actually
+        // rendered to measure the throughput instead of the submission
+        glFinish();
+#else
         glfwSwapBuffers(window);
         glfwPollEvents();
-        platformSleep(delta_time);
-        time += delta_time;
+#endif
+#ifdef GL_HPP_CAPTURE
+        if (capture_path) gl_capture::end_frame(&capture);
+#endif
+        draw_calls += gl::stats.draw_calls;
+        bytes_uploaded += gl::stats.bytes_uploaded;
+
+        if (gl_frame::end(&loop)) {
+            fprintf(stderr, "Hitch: frame %zu took %.3f ms\n",
+                    loop.stats.last_hitch_frame, loop.stats.last_hitch * 1000.0);
+        }
+    }
+
+    gl_debug::stop(&debug_log);
+
+#ifdef GL_HPP_CAPTURE
+    if (capture_path) {
+        if (!gl_capture::stop(&capture)) {
+            fprintf(stderr, "Could not write `%s`\n", capture_path);
+            exit(1);
+        }
+        printf("Capture:         %zu calls in %zu frames, %zu bytes of data, %zu bytes before compression\n",
+               capture.stats.calls, capture.stats.frames, capture.stats.data_bytes, capture.stats.bytes);
+    }
+#endif
+
+    const gl_frame::Report report = gl_frame::report(loop.stats);
+    if (report.frames > 0) {
+        const double elapsed = gl_frame::late_latch(&loop);
+        const double frames = (double) report.frames;
+        printf("Scene:           %s\n", scene->name);
+        printf("Frames:          %zu in %.3f s (%.1f FPS)\n", report.frames, elapsed, frames / elapsed);
+        printf("Frame time p50:  %.3f ms\n", report.p50 * 1000.0);
+        printf("Frame time p95:  %.3f ms\n", report.p95 * 1000.0);
+        printf("Frame time p99:  %.3f ms\n", report.p99 * 1000.0);
+        printf("Frame time max:  %.3f ms\n", report.max * 1000.0);
+        printf("Hitches:         %zu\n", report.hitches);
+        printf("Draw calls:      %.1f per frame\n", (double) draw_calls / frames);
+        printf("Bytes uploaded:  %.1f per frame\n", (double) bytes_uploaded / frames);
+        printf("Uniforms:        %zu issued, %zu skipped (%zu bytes)\n",
+               uniforms.stats.issued, uniforms.stats.skipped, uniforms.stats.bytes_skipped);
+        const gl_variants::Stats &stats = variants.stats;
+        printf("Variants:        %zu hits, %zu fallbacks, %zu misses, %zu evictions\n",
+               stats.hits, stats.fallbacks, stats.misses, stats.evictions);
+        printf("Variant builds:  %zu (%zu failed), %.3f ms on average, %.3f ms max\n",
+               stats.compiles, stats.failures,
+               stats.compiles > 0 ? stats.compile_time_total * 1000.0 / (double) stats.compiles : 0.0,
+               stats.compile_time_max * 1000.0);
+        printf("Shaders:         %zu compiled, %zu shared\n", shader_cache.misses, shader_cache.hits);
+        const gl_debug::Stats debug = gl_debug::stats(debug_log);
+        printf("Debug messages:  %zu (%zu printed, %zu repeated, %zu rate limited, %zu dropped)\n",
+               debug.received, debug.printed, debug.duplicates, debug.rate_limited, debug.dropped);
+        if (watch) {
+            printf("Shader reloads:  %zu (%zu files rejected)\n", reloads, reloads_rejected);
+        }
     }
 
+    gl_reload::stop(&watcher);
     gl::deleteObjects(1, &tile_buffer);
+    gl_variants::destroy(&variants);
+    gl_source::destroy(&shader_cache);
 
+#ifdef TILES_HEADLESS
+    gl_egl::destroy_context(context.unwrap);
+#else
     glfwTerminate();
+#endif
 
     return 0;
 }
@@ -0,0 +1,115 @@
+// The same scene as main.cpp but against the null backend of gl.hpp:
+// no window, no driver, no sleeping. Runs a fixed number of frames and
+// reports the calls that went through the wrappers, which is
+// deterministic and can run on any machine.
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include "gl_null.hpp"
+#define GL_HPP_ASSERT_GL_ERRORS
+#include "gl.hpp"
+
+const size_t INFO_LOG_CAPACITY = 512;
+
+const char *const vert_source = "#version 130\n";
+const char *const frag_source = "#version 130\n";
+
+GLint tiles[] = {
+    1, 1, 1, 1,
+    2, 2, 2, 2,
+    3, 3, 3, 3,
+    4, 4, 4, 4,
+};
+
+gl::Shader compile_shader(gl::Shader_Type shaderType, const char *source)
+{
+    auto shader = gl::createShader(shaderType);
+    gl::shaderSource(shader, 1, &source, NULL);
+    gl::compileShader(shader);
+    assert(gl::compileStatus(shader));
+    return shader;
+}
+
+double now_secs()
+{
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+    const long frames = argc > 1 ? strtol(argv[1], NULL, 10) : 1000;
+
+    printf("OpenGL Version: %s\n", gl::getString(gl::String_Name::VERSION));
+
+    auto vert = compile_shader(gl::Shader_Type::Vertex, vert_source);
+    auto frag = compile_shader(gl::Shader_Type::Fragment, frag_source);
+    gl::Program program = gl::createProgram();
+    gl::attachShader(program, vert);
+    gl::attachShader(program, frag);
+    gl::linkProgram(program);
+    assert(gl::linkStatus(program));
+    gl::useProgram(program);
+
+    auto vao = gl::genVertexArray();
+    gl::bindVertexArray(vao);
+
+    gl::Buffer tile_buffer = {};
+    gl::genBuffers(1, &tile_buffer);
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, tile_buffer);
+    gl::bufferData(gl::Buffer_Target::ARRAY, sizeof(tiles), tiles, gl::Buffer_Usage::STATIC_DRAW);
+
+    gl::Attribute_Location tileAttrib = {0};
+    gl::bindAttribLocation(program, tileAttrib, "tile");
+    gl::enableVertexAttribArray(tileAttrib);
+    gl::vertexAttribIPointer(tileAttrib,
+                             gl::Attribute_Size::ONE,
+                             gl::Attribute_IType::INT,
+                             0,
+                             nullptr);
+
+    auto u_resolution = gl::getUniformLocation(program, "u_resolution");
+    auto u_time = gl::getUniformLocation(program, "u_time");
+
+    const double start = now_secs();
+    const float delta_time = 1.0f / 60.0f;
+    float time = 0.0f;
+    for (long frame = 0; frame < frames; ++frame) {
+        gl::clearColor({0.0f, 0.0f, 0.0f, 1.0f});
+        gl::clear(gl::Buffer_Bit::COLOR | gl::Buffer_Bit::DEPTH);
+
+        if (u_resolution.has_value) {
+            gl::uniform(u_resolution.unwrap, gl::Vec2f {640.0f, 640.0f});
+        }
+
+        if (u_time.has_value) {
+            gl::uniform(u_time.unwrap, time);
+        }
+
+        gl::bindVertexArray(vao);
+        gl::drawArrays(gl::Draw_Mode::TRIANGLE_STRIP, 0, sizeof(tiles) / sizeof(tiles[0]));
+
+        time += delta_time;
+    }
+    const double elapsed = now_secs() - start;
+
+    gl::deleteObjects(1, &tile_buffer);
+
+    const auto &context = gl_null::context;
+    printf("Frames:         %ld\n", frames);
+    printf("Draw calls:     %zu\n", context.draw_calls);
+    printf("Vertices:       %zu\n", context.vertices_drawn);
+    printf("Bytes uploaded: %zu\n", context.bytes_uploaded);
+    printf("GL calls:       %zu\n", context.total_calls());
+    for (size_t i = 0; i < static_cast<size_t>(gl_null::Call::COUNT); ++i) {
+        if (context.calls[i] > 0) {
+            printf("    %-28s %zu\n", gl_null::call_names[i], context.calls[i]);
+        }
+    }
+    printf("Time per frame: %.1f ns\n", elapsed * 1e9 / (double) (frames > 0 ? frames : 1));
+
+    return 0;
+}
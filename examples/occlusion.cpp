@@ -0,0 +1,274 @@
+// A grid of heavy spheres, most of them behind a wall, drawn on a
+// headless EGL context (Mesa llvmpipe works fine) once without culling
+// and once with gl_occlusion, which tests the bounds of every sphere
+// with an ANY_SAMPLES_PASSED query and draws it next frame inside a
+// conditional render. Reports the time per frame, how many draws the
+// GPU skipped, and checks that both ways render the same image.
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#define GL_HPP_STATS
+#include "gl.hpp"
+#include "gl_egl.hpp"
+#include "gl_frame.hpp"
+#include "gl_occlusion.hpp"
+
+const size_t GRID = 6;
+const GLfloat RADIUS = 0.1f;
+const size_t RINGS = 100;
+const size_t SEGMENTS = 200;
+const size_t FRAMES = 30;
+const GLsizei FRAMEBUFFER_SIZE = 512;
+
+const char *const vert_source =
+    "#version 130\n"
+    "in vec3 position;\n"
+    "uniform vec3 u_offset;\n"
+    "uniform float u_scale;\n"
+    "out vec3 normal;\n"
+    "void main() {\n"
+    "    normal = position;\n"
+    "    gl_Position = vec4(u_offset + position * u_scale, 1.0);\n"
+    "}\n";
+
+const char *const frag_source =
+    "#version 130\n"
+    "in vec3 normal;\n"
+    "void main() {\n"
+    "    float light = max(dot(normalize(normal), normalize(vec3(-1.0, 1.0, -1.0))), 0.1);\n"
+    "    gl_FragColor = vec4(vec3(light), 1.0);\n"
+    "}\n";
+
+const gl::Attribute_Location POSITION = {0};
+
+gl::Shader compile_shader(gl::Shader_Type type, const char *source)
+{
+    auto shader = gl::createShader(type);
+    gl::shaderSource(shader, 1, &source, NULL);
+    gl::compileShader(shader);
+    if (!gl::compileStatus(shader)) {
+        fprintf(stderr, "%s\n", gl::getShaderInfoLog<1024>(shader).value);
+        abort();
+    }
+    return shader;
+}
+
+struct Mesh
+{
+    gl::Vertex_Array vertex_array;
+    gl::Buffer vertices;
+    gl::Buffer indices;
+    GLsizei count;
+};
+
+Mesh upload_mesh(const std::vector<gl::Vec3f> &vertices, const std::vector<GLuint> &indices)
+{
+    Mesh mesh = {};
+    mesh.vertex_array = gl::genVertexArray();
+    gl::bindVertexArray(mesh.vertex_array);
+
+    mesh.vertices = gl::genBuffer();
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, mesh.vertices);
+    gl::bufferData(gl::Buffer_Target::ARRAY, (GLsizeiptr) (vertices.size() * sizeof(gl::Vec3f)),
+                   vertices.data(), gl::Buffer_Usage::STATIC_DRAW);
+    gl::vertexAttribPointer(POSITION, gl::Attribute_Size::THREE, gl::Attribute_Type::FLOAT, GL_FALSE, 0, nullptr);
+    gl::enableVertexAttribArray(POSITION);
+
+    mesh.indices = gl::genBuffer();
+    gl::bindBuffer(gl::Buffer_Target::ELEMENT_ARRAY, mesh.indices);
+    gl::bufferData(gl::Buffer_Target::ELEMENT_ARRAY, (GLsizeiptr) (indices.size() * sizeof(GLuint)),
+                   indices.data(), gl::Buffer_Usage::STATIC_DRAW);
+    mesh.count = (GLsizei) indices.size();
+
+    gl::bindVertexArray({0});
+    return mesh;
+}
+
+void draw_mesh(const Mesh &mesh)
+{
+    gl::bindVertexArray(mesh.vertex_array);
+    gl::drawElements(gl::Draw_Mode::TRIANGLES, mesh.count, gl::Element_Index_Type::UNSIGNED_INT, nullptr);
+}
+
+void destroy_mesh(Mesh *mesh)
+{
+    gl::deleteObject(mesh->indices);
+    gl::deleteObject(mesh->vertices);
+    gl::deleteObject(mesh->vertex_array);
+}
+
+// A unit sphere
+Mesh make_sphere()
+{
+    std::vector<gl::Vec3f> vertices;
+    std::vector<GLuint> indices;
+    for (size_t ring = 0; ring <= RINGS; ++ring) {
+        for (size_t segment = 0; segment <= SEGMENTS; ++segment) {
+            const float theta = (float) segment / (float) SEGMENTS * 2.0f * (float) M_PI;
+            const float phi = (float) ring / (float) RINGS * (float) M_PI;
+            vertices.push_back({std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta)});
+        }
+    }
+    for (size_t ring = 0; ring < RINGS; ++ring) {
+        for (size_t segment = 0; segment < SEGMENTS; ++segment) {
+            const GLuint a = (GLuint) (ring * (SEGMENTS + 1) + segment);
+            const GLuint b = a + (GLuint) (SEGMENTS + 1);
+            indices.insert(indices.end(), {a, b, a + 1, a + 1, b, b + 1});
+        }
+    }
+    return upload_mesh(vertices, indices);
+}
+
+// The front face of the bounding box of the unit sphere, which is all
+// the depth test needs
+Mesh make_bounds()
+{
+    return upload_mesh({{-1.0f, -1.0f, -1.0f}, {1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, -1.0f}, {-1.0f, 1.0f, -1.0f}},
+                       {0, 1, 2, 0, 2, 3});
+}
+
+struct Scene
+{
+    gl::Program program;
+    gl::Uniform u_offset;
+    gl::Uniform u_scale;
+    Mesh sphere;
+    Mesh bounds;
+    std::vector<gl::Vec3f> centers;
+};
+
+void draw_wall(const Scene &scene)
+{
+    // The bounds quad stretched over the left three quarters of the
+    // screen, in front of the spheres
+    gl::uniform(scene.u_offset, gl::Vec3f {-0.25f, 0.0f, 0.0f});
+    gl::uniform(scene.u_scale, 0.75f);
+    draw_mesh(scene.bounds);
+}
+
+void draw_sphere(const Scene &scene, size_t i, const Mesh &mesh)
+{
+    gl::uniform(scene.u_offset, scene.centers[i]);
+    gl::uniform(scene.u_scale, RADIUS);
+    draw_mesh(mesh);
+}
+
+struct Run
+{
+    double ms_per_frame;
+    size_t draw_calls_per_frame;
+    std::vector<unsigned char> pixels;
+};
+
+template <typename Draw_Spheres>
+Run run(const Scene &scene, Draw_Spheres draw_spheres)
+{
+    Run result = {};
+    gl::stats = {};
+    const double start = gl_frame::now_secs();
+    for (size_t frame = 0; frame < FRAMES; ++frame) {
+        gl::clear(gl::Buffer_Bit::COLOR | gl::Buffer_Bit::DEPTH);
+        draw_wall(scene);
+        draw_spheres();
+        glFinish();
+    }
+    result.ms_per_frame = (gl_frame::now_secs() - start) * 1000.0 / FRAMES;
+    result.draw_calls_per_frame = gl::stats.draw_calls / FRAMES;
+
+    result.pixels.resize(4 * FRAMEBUFFER_SIZE * FRAMEBUFFER_SIZE);
+    glReadPixels(0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, result.pixels.data());
+    return result;
+}
+
+int main()
+{
+    auto context = gl_egl::create_headless_context(3, 3);
+    if (!context.has_value) {
+        fprintf(stderr, "Could not create a headless EGL context\n");
+        return 1;
+    }
+
+    // There is no default framebuffer without a surface
+    GLuint fbo = 0, renderbuffers[2] = {};
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(2, renderbuffers);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, renderbuffers[1]);
+    glViewport(0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+
+    printf("Renderer: %s\n", gl::getString(gl::String_Name::RENDERER));
+
+    Scene scene = {};
+    scene.program = gl::createProgram();
+    gl::attachShader(scene.program, compile_shader(gl::Shader_Type::Vertex, vert_source));
+    gl::attachShader(scene.program, compile_shader(gl::Shader_Type::Fragment, frag_source));
+    gl::bindAttribLocation(scene.program, POSITION, "position");
+    gl::linkProgram(scene.program);
+    assert(gl::linkStatus(scene.program));
+    gl::useProgram(scene.program);
+
+    auto u_offset = gl::getUniformLocation(scene.program, "u_offset");
+    auto u_scale = gl::getUniformLocation(scene.program, "u_scale");
+    assert(u_offset.has_value && u_scale.has_value);
+    scene.u_offset = u_offset.unwrap;
+    scene.u_scale = u_scale.unwrap;
+
+    scene.sphere = make_sphere();
+    scene.bounds = make_bounds();
+    for (size_t row = 0; row < GRID; ++row) {
+        for (size_t column = 0; column < GRID; ++column) {
+            const float x = ((float) column + 0.5f) / (float) GRID * 1.8f - 0.9f;
+            const float y = ((float) row + 0.5f) / (float) GRID * 1.8f - 0.9f;
+            scene.centers.push_back({x, y, 0.5f});
+        }
+    }
+
+    gl::enable(gl::Capability::DEPTH_TEST);
+    gl::clearColor({0.1f, 0.1f, 0.2f, 1.0f});
+
+    const Run all = run(scene, [&] {
+        for (size_t i = 0; i < scene.centers.size(); ++i) draw_sphere(scene, i, scene.sphere);
+    });
+
+    gl_occlusion::Culler culler = gl_occlusion::create_culler(scene.centers.size());
+    const Run culled = run(scene, [&] {
+        gl_occlusion::begin_frame(&culler);
+        for (size_t i = 0; i < scene.centers.size(); ++i) {
+            gl_occlusion::draw(&culler, i,
+                               [&] { draw_sphere(scene, i, scene.sphere); },
+                               [&] { draw_sphere(scene, i, scene.bounds); });
+        }
+    });
+
+    printf("%zu spheres of %zu triangles, %zu frames\n",
+           scene.centers.size(), (size_t) scene.sphere.count / 3, FRAMES);
+    printf("%-18s %10s %12s\n", "", "ms/frame", "draws/frame");
+    printf("%-18s %10.2f %12zu\n", "no culling", all.ms_per_frame, all.draw_calls_per_frame);
+    // The draws inside conditional renders count as issued even when
+    // the GPU skips them
+    printf("%-18s %10.2f %12zu\n", "occlusion queries", culled.ms_per_frame, culled.draw_calls_per_frame);
+    printf("Conditional draws: %zu, culled on the GPU: %zu, results not ready for the stats: %zu\n",
+           culler.stats.conditional_draws, culler.stats.culled, culler.stats.unknown);
+
+    // Only the first frame draws every sphere, the image is the same
+    assert(all.pixels == culled.pixels);
+
+    gl_occlusion::destroy(&culler);
+    destroy_mesh(&scene.bounds);
+    destroy_mesh(&scene.sphere);
+    gl::deleteObject(scene.program);
+    gl_egl::destroy_context(context.unwrap);
+
+    return 0;
+}
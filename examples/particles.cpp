@@ -0,0 +1,250 @@
+// Particles bouncing on the floor, simulated two ways on a headless
+// EGL context (Mesa llvmpipe works fine):
+//
+// - cpu: the usual loop that moves the particles on the CPU and
+//   uploads all of them with bufferData every frame,
+// - gpu: a vertex shader moves them and transform feedback captures
+//   the result into the other buffer of gl_feedback::Ping_Pong, so the
+//   state never leaves the GPU after the first upload.
+//
+// Both render the particles as points every frame. At the end the GPU
+// state is read back once and compared with the CPU one. On llvmpipe
+// the "GPU" runs on the CPU as well, so the frame times come out close:
+// what goes away is the upload of the whole state every frame.
+//
+// --no-feedback-objects takes the GL 3 path, without transform
+// feedback objects and drawTransformFeedback.
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#define GL_HPP_STATS
+#include "gl.hpp"
+#include "gl_egl.hpp"
+#include "gl_feedback.hpp"
+#include "gl_frame.hpp"
+
+const GLsizei PARTICLES = 256 * 1024;
+const size_t FRAMES = 120;
+const GLfloat DT = 1.0f / 60.0f;
+const GLsizei FRAMEBUFFER_SIZE = 512;
+
+struct Particle
+{
+    gl::Vec2f position;
+    gl::Vec2f velocity;
+};
+
+// The same step as step_vert_source, keep them in sync
+void step_cpu(Particle *particles, size_t count, GLfloat dt)
+{
+    for (size_t i = 0; i < count; ++i) {
+        Particle &p = particles[i];
+        p.velocity.y -= 9.8f * dt;
+        p.position.x += p.velocity.x * dt;
+        p.position.y += p.velocity.y * dt;
+        if (p.position.y < -1.0f) {
+            p.position.y = -1.0f;
+            p.velocity.y = -p.velocity.y * 0.8f;
+        }
+        if (std::fabs(p.position.x) > 1.0f) p.velocity.x = -p.velocity.x;
+    }
+}
+
+const char *const step_vert_source =
+    "#version 130\n"
+    "in vec2 position;\n"
+    "in vec2 velocity;\n"
+    "out vec2 out_position;\n"
+    "out vec2 out_velocity;\n"
+    "uniform float dt;\n"
+    "void main() {\n"
+    "    vec2 v = velocity;\n"
+    "    v.y -= 9.8 * dt;\n"
+    "    vec2 p = position + v * dt;\n"
+    "    if (p.y < -1.0) { p.y = -1.0; v.y = -v.y * 0.8; }\n"
+    "    if (abs(p.x) > 1.0) v.x = -v.x;\n"
+    "    out_position = p;\n"
+    "    out_velocity = v;\n"
+    "    gl_Position = vec4(p, 0.0, 1.0);\n"
+    "}\n";
+
+const char *const render_vert_source =
+    "#version 130\n"
+    "in vec2 position;\n"
+    "void main() { gl_Position = vec4(position, 0.0, 1.0); }\n";
+
+const char *const render_frag_source =
+    "#version 130\n"
+    "void main() { gl_FragColor = vec4(1.0, 0.6, 0.2, 1.0); }\n";
+
+const gl::Attribute_Location POSITION = {0};
+const gl::Attribute_Location VELOCITY = {1};
+
+gl::Shader compile_shader(gl::Shader_Type type, const char *source)
+{
+    auto shader = gl::createShader(type);
+    gl::shaderSource(shader, 1, &source, NULL);
+    gl::compileShader(shader);
+    if (!gl::compileStatus(shader)) {
+        fprintf(stderr, "%s\n", gl::getShaderInfoLog<1024>(shader).value);
+        abort();
+    }
+    return shader;
+}
+
+// Links the program after the varyings when there are any
+gl::Program link_program(const char *vert_source, const char *frag_source,
+                         const GLchar *const *varyings, GLsizei varyings_count)
+{
+    auto program = gl::createProgram();
+    gl::attachShader(program, compile_shader(gl::Shader_Type::Vertex, vert_source));
+    if (frag_source) gl::attachShader(program, compile_shader(gl::Shader_Type::Fragment, frag_source));
+    gl::bindAttribLocation(program, POSITION, "position");
+    gl::bindAttribLocation(program, VELOCITY, "velocity");
+    if (varyings_count > 0) {
+        gl::transformFeedbackVaryings(program, varyings_count, varyings,
+                                      gl::Transform_Feedback_Buffer_Mode::INTERLEAVED_ATTRIBS);
+    }
+    gl::linkProgram(program);
+    if (!gl::linkStatus(program)) {
+        fprintf(stderr, "%s\n", gl::getProgramInfoLog<1024>(program).value);
+        abort();
+    }
+    return program;
+}
+
+void setup_particle_attributes()
+{
+    gl::vertexAttribPointer(POSITION, gl::Attribute_Size::TWO, gl::Attribute_Type::FLOAT, GL_FALSE,
+                            sizeof(Particle), reinterpret_cast<const GLvoid*>(offsetof(Particle, position)));
+    gl::enableVertexAttribArray(POSITION);
+    gl::vertexAttribPointer(VELOCITY, gl::Attribute_Size::TWO, gl::Attribute_Type::FLOAT, GL_FALSE,
+                            sizeof(Particle), reinterpret_cast<const GLvoid*>(offsetof(Particle, velocity)));
+    gl::enableVertexAttribArray(VELOCITY);
+}
+
+struct Run
+{
+    double ms_per_frame;
+    size_t bytes_uploaded_per_frame;
+};
+
+void report(const char *name, Run run)
+{
+    printf("%-6s %10.2f %16zu\n", name, run.ms_per_frame, run.bytes_uploaded_per_frame);
+}
+
+int main(int argc, char **argv)
+{
+    auto context = gl_egl::create_headless_context(3, 3);
+    if (!context.has_value) {
+        fprintf(stderr, "Could not create a headless EGL context\n");
+        return 1;
+    }
+
+    // There is no default framebuffer without a surface
+    GLuint fbo = 0, color = 0;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(1, &color);
+    glBindRenderbuffer(GL_RENDERBUFFER, color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    glViewport(0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+
+    printf("Renderer: %s\n", gl::getString(gl::String_Name::RENDERER));
+    const bool feedback_objects = gl_feedback::has_feedback_objects()
+        && !(argc > 1 && strcmp(argv[1], "--no-feedback-objects") == 0);
+    printf("Transform feedback objects: %s\n", feedback_objects ? "yes" : "no");
+
+    srand(69);
+    std::vector<Particle> initial(PARTICLES);
+    for (auto &p : initial) {
+        const float random_x = (float) rand() / (float) RAND_MAX;
+        const float random_y = (float) rand() / (float) RAND_MAX;
+        p.position = {random_x * 2.0f - 1.0f, random_y};
+        p.velocity = {random_y - 0.5f, random_x * 2.0f};
+    }
+
+    const GLchar *const varyings[] = {"out_position", "out_velocity"};
+    auto step_program = link_program(step_vert_source, nullptr, varyings, 2);
+    auto render_program = link_program(render_vert_source, render_frag_source, nullptr, 0);
+    auto u_dt = gl::getUniformLocation(step_program, "dt");
+    assert(u_dt.has_value);
+
+    gl::clearColor({0.0f, 0.0f, 0.0f, 1.0f});
+
+    // CPU: simulate, upload, draw
+    std::vector<Particle> particles = initial;
+    auto cpu_vertex_array = gl::genVertexArray();
+    gl::bindVertexArray(cpu_vertex_array);
+    auto cpu_buffer = gl::genBuffer();
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, cpu_buffer);
+    setup_particle_attributes();
+    gl::useProgram(render_program);
+
+    gl::stats = {};
+    double start = gl_frame::now_secs();
+    for (size_t frame = 0; frame < FRAMES; ++frame) {
+        step_cpu(particles.data(), particles.size(), DT);
+        gl::bufferData(gl::Buffer_Target::ARRAY, PARTICLES * sizeof(Particle), particles.data(),
+                       gl::Buffer_Usage::STREAM_DRAW);
+        gl::clear(gl::Buffer_Bit::COLOR);
+        gl::drawArrays(gl::Draw_Mode::POINTS, 0, PARTICLES);
+        glFinish();
+    }
+    const Run cpu = {(gl_frame::now_secs() - start) * 1000.0 / FRAMES, gl::stats.bytes_uploaded / FRAMES};
+    gl::bindVertexArray({0});
+
+    // GPU: step with transform feedback, draw
+    auto ping_pong = gl_feedback::create_ping_pong(PARTICLES * sizeof(Particle), initial.data(), PARTICLES,
+                                                   [](gl::Buffer) { setup_particle_attributes(); },
+                                                   feedback_objects);
+    gl::useProgram(step_program);
+    gl::uniform(u_dt.unwrap, DT);
+
+    gl::stats = {};
+    start = gl_frame::now_secs();
+    for (size_t frame = 0; frame < FRAMES; ++frame) {
+        gl::useProgram(step_program);
+        gl_feedback::step(&ping_pong);
+        gl::useProgram(render_program);
+        gl::clear(gl::Buffer_Bit::COLOR);
+        gl_feedback::draw(ping_pong, gl::Draw_Mode::POINTS);
+        glFinish();
+    }
+    const Run gpu = {(gl_frame::now_secs() - start) * 1000.0 / FRAMES, gl::stats.bytes_uploaded / FRAMES};
+
+    printf("%zu particles, %zu frames\n", (size_t) PARTICLES, FRAMES);
+    printf("%-6s %10s %16s\n", "path", "ms/frame", "uploaded B/frame");
+    report("cpu", cpu);
+    report("gpu", gpu);
+
+    // The GPU rounds a bit differently, the bounces amplify it a bit
+    std::vector<Particle> captured(PARTICLES);
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, ping_pong.buffers[ping_pong.current]);
+    glGetBufferSubData(GL_ARRAY_BUFFER, 0, PARTICLES * sizeof(Particle), captured.data());
+    float max_error = 0.0f;
+    for (size_t i = 0; i < captured.size(); ++i) {
+        max_error = std::fmax(max_error, std::fabs(captured[i].position.x - particles[i].position.x));
+        max_error = std::fmax(max_error, std::fabs(captured[i].position.y - particles[i].position.y));
+    }
+    printf("Max position difference between the paths: %g\n", max_error);
+
+    gl_feedback::destroy(&ping_pong);
+    gl::deleteObject(cpu_buffer);
+    gl::deleteObject(cpu_vertex_array);
+    gl::deleteObject(step_program);
+    gl::deleteObject(render_program);
+    gl_egl::destroy_context(context.unwrap);
+
+    return max_error < 1e-2f ? 0 : 1;
+}
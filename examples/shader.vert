@@ -1,6 +1,7 @@
 #version 130
+#extension GL_ARB_explicit_attrib_location : require
 
-in int tile;
+layout(location = 0) in int tile;
 out vec4 color;
 
 #define TILE_SIZE 0.1
@@ -0,0 +1,31 @@
+// Generated by tools/reflect. Do not edit.
+#ifndef SHADERS_HPP
+#define SHADERS_HPP
+
+namespace shaders
+{
+    struct Tiles
+    {
+        static constexpr const char *vert_path = "shader.vert";
+        static constexpr const char *frag_path = "shader.frag";
+
+        // layout(location = 0) in int tile;
+        static constexpr gl::Attribute_Location tile = {0};
+        static constexpr gl::Attribute_Size tile_size = gl::Attribute_Size::ONE;
+        static constexpr bool tile_integer = true;
+    };
+
+    struct Epic
+    {
+        static constexpr const char *vert_path = "fullscreen.vert";
+        static constexpr const char *frag_path = "epic-animation.frag";
+
+        // layout(location = 0) uniform vec2 u_resolution;
+        static constexpr gl::Typed_Uniform<gl::Vec2f> u_resolution = {{0}};
+
+        // layout(location = 1) uniform float u_time;
+        static constexpr gl::Typed_Uniform<GLfloat> u_time = {{1}};
+    };
+}
+
+#endif  // SHADERS_HPP
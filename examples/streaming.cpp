@@ -0,0 +1,262 @@
+// Streaming a "level" in while rendering, on a headless EGL context
+// (Mesa llvmpipe works fine). Every chunk of the level is a buffer of
+// generated vertices, a texture and a program of its own. They are
+// loaded two ways while the render loop keeps drawing:
+//
+// - inline: on the render thread, one chunk per frame,
+// - workers: with gl_worker on two shared contexts, handed back to the
+//   render thread once their fences signaled.
+//
+// The render loop is paced at 60 FPS, so the workers get the time the
+// render thread sleeps even on a single core. Reports the frame times
+// of the render loop while the chunks come in and checks on the render
+// thread that every chunk arrived intact.
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#include "gl.hpp"
+#include "gl_egl.hpp"
+#include "gl_frame.hpp"
+#include "gl_worker.hpp"
+
+const size_t CHUNKS = 16;
+const size_t CHUNK_VERTICES = 512 * 1024;
+const GLsizei TEXTURE_SIZE = 512;
+const size_t WORKERS = 2;
+const GLsizei FRAMEBUFFER_SIZE = 256;
+const double FPS = 60.0;
+
+const char *const vert_source =
+    "#version 130\n"
+    "in vec2 position;\n"
+    "void main() { gl_Position = vec4(position, 0.0, 1.0); }\n";
+
+// Every chunk gets a program of its own, so nothing comes from a cache
+const char *const frag_template =
+    "#version 130\n"
+    "uniform sampler2D u_texture;\n"
+    "void main() {\n"
+    "    vec4 color = texture(u_texture, gl_FragCoord.xy / 256.0);\n"
+    "    for (int i = 0; i < 4; ++i) color = color * color + vec4(%zu.0 / 16.0);\n"
+    "    gl_FragColor = color;\n"
+    "}\n";
+
+const gl::Attribute_Location POSITION = {0};
+
+struct Chunk
+{
+    gl::Buffer vertices;
+    GLuint texture;
+    gl::Program program;
+    bool ready;
+};
+
+gl::Shader compile_shader(gl::Shader_Type type, const char *source)
+{
+    auto shader = gl::createShader(type);
+    gl::shaderSource(shader, 1, &source, NULL);
+    gl::compileShader(shader);
+    if (!gl::compileStatus(shader)) {
+        fprintf(stderr, "%s\n", gl::getShaderInfoLog<1024>(shader).value);
+        abort();
+    }
+    return shader;
+}
+
+gl::Program link_program(const char *frag_source)
+{
+    auto program = gl::createProgram();
+    auto vert = compile_shader(gl::Shader_Type::Vertex, vert_source);
+    auto frag = compile_shader(gl::Shader_Type::Fragment, frag_source);
+    gl::attachShader(program, vert);
+    gl::attachShader(program, frag);
+    gl::bindAttribLocation(program, POSITION, "position");
+    gl::linkProgram(program);
+    gl::deleteObject(vert);
+    gl::deleteObject(frag);
+    return program;
+}
+
+float vertex_value(size_t chunk, size_t i)
+{
+    return std::sin((float) (chunk * CHUNK_VERTICES + i) * 0.001f);
+}
+
+// Everything a chunk costs to load: generating its data, uploading it
+// and building its program
+void load_chunk(size_t index, Chunk *chunk)
+{
+    std::vector<gl::Vec2f> vertices(CHUNK_VERTICES);
+    for (size_t i = 0; i < CHUNK_VERTICES; ++i) {
+        vertices[i] = {vertex_value(index, i), (float) index};
+    }
+    chunk->vertices = gl::genBuffer();
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, chunk->vertices);
+    gl::bufferData(gl::Buffer_Target::ARRAY, (GLsizeiptr) (vertices.size() * sizeof(gl::Vec2f)),
+                   vertices.data(), gl::Buffer_Usage::STATIC_DRAW);
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, {0});
+
+    std::vector<unsigned char> texels(4 * TEXTURE_SIZE * TEXTURE_SIZE, (unsigned char) index);
+    glGenTextures(1, &chunk->texture);
+    glBindTexture(GL_TEXTURE_2D, chunk->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, TEXTURE_SIZE, TEXTURE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    char frag_source[512];
+    snprintf(frag_source, sizeof(frag_source), frag_template, index);
+    chunk->program = link_program(frag_source);
+}
+
+// On the render thread, after the chunk was handed over
+bool check_chunk(size_t index, const Chunk &chunk)
+{
+    gl::Vec2f last = {};
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, chunk.vertices);
+    glGetBufferSubData(GL_ARRAY_BUFFER, (GLintptr) ((CHUNK_VERTICES - 1) * sizeof(gl::Vec2f)), sizeof(last), &last);
+    gl::bindBuffer(gl::Buffer_Target::ARRAY, {0});
+
+    std::vector<unsigned char> texels(4 * TEXTURE_SIZE * TEXTURE_SIZE);
+    glBindTexture(GL_TEXTURE_2D, chunk.texture);
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    return last.x == vertex_value(index, CHUNK_VERTICES - 1) && last.y == (float) index
+        && texels.back() == (unsigned char) index && gl::linkStatus(chunk.program);
+}
+
+void destroy_chunk(Chunk *chunk)
+{
+    gl::deleteObject(chunk->vertices);
+    glDeleteTextures(1, &chunk->texture);
+    gl::deleteObject(chunk->program);
+}
+
+// The frame of the render loop: a few chunks that are ready, drawn as
+// points
+void render_frame(const Chunk *chunks, gl::Vertex_Array vertex_array)
+{
+    gl::clear(gl::Buffer_Bit::COLOR);
+    gl::bindVertexArray(vertex_array);
+    for (size_t i = 0; i < CHUNKS; ++i) {
+        if (!chunks[i].ready) continue;
+        gl::useProgram(chunks[i].program);
+        glBindTexture(GL_TEXTURE_2D, chunks[i].texture);
+        gl::bindBuffer(gl::Buffer_Target::ARRAY, chunks[i].vertices);
+        gl::vertexAttribPointer(POSITION, gl::Attribute_Size::TWO, gl::Attribute_Type::FLOAT, GL_FALSE, 0, nullptr);
+        gl::enableVertexAttribArray(POSITION);
+        gl::drawArrays(gl::Draw_Mode::POINTS, 0, 1024);
+    }
+    glFinish();
+}
+
+struct Run
+{
+    size_t frames;
+    gl_frame::Report report;
+    bool intact;
+};
+
+void report(const char *name, const Run &run)
+{
+    printf("%-8s %8zu %10.2f %10.2f %10.2f %8s\n", name, run.frames, run.report.p50 * 1000.0,
+           run.report.p99 * 1000.0, run.report.max * 1000.0, run.intact ? "yes" : "NO");
+}
+
+template <typename Load>
+Run run(Load load)
+{
+    Chunk chunks[CHUNKS] = {};
+    auto vertex_array = gl::genVertexArray();
+
+    // The loop runs at FPS until every chunk is in. Only the time the
+    // frames take is recorded, not the sleep until the next one.
+    gl_frame::Stats stats = {};
+    size_t ready = 0;
+    double deadline = gl_frame::now_secs();
+    while (ready < CHUNKS) {
+        const double start = gl_frame::now_secs();
+        ready += load(chunks);
+        render_frame(chunks, vertex_array);
+        gl_frame::record(&stats, gl_frame::now_secs() - start, 0.0);
+
+        deadline += 1.0 / FPS;
+        gl_frame::sleep_until(deadline);
+    }
+
+    Run result = {stats.count, gl_frame::report(stats), true};
+    for (size_t i = 0; i < CHUNKS; ++i) {
+        result.intact = result.intact && check_chunk(i, chunks[i]);
+        destroy_chunk(&chunks[i]);
+    }
+    gl::bindVertexArray({0});
+    gl::deleteObject(vertex_array);
+    return result;
+}
+
+int main()
+{
+    auto context = gl_egl::create_headless_context(3, 3);
+    if (!context.has_value) {
+        fprintf(stderr, "Could not create a headless EGL context\n");
+        return 1;
+    }
+
+    // There is no default framebuffer without a surface
+    GLuint fbo = 0, color = 0;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(1, &color);
+    glBindRenderbuffer(GL_RENDERBUFFER, color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    glViewport(0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE);
+
+    printf("Renderer: %s\n", gl::getString(gl::String_Name::RENDERER));
+    printf("%zu chunks of %zu vertices, a %dx%d texture and a program\n",
+           CHUNKS, CHUNK_VERTICES, TEXTURE_SIZE, TEXTURE_SIZE);
+    printf("%-8s %8s %10s %10s %10s %8s\n", "loading", "frames", "p50 ms", "p99 ms", "max ms", "intact");
+
+    size_t next = 0;
+    const Run inline_run = run([&](Chunk *chunks) -> size_t {
+        if (next == CHUNKS) return 0;
+        load_chunk(next, &chunks[next]);
+        chunks[next].ready = true;
+        next += 1;
+        return 1;
+    });
+    report("inline", inline_run);
+
+    gl_worker::Pool pool = {};
+    if (!gl_worker::start(&pool, context.unwrap, WORKERS, 3, 3)) {
+        fprintf(stderr, "Could not create the worker contexts\n");
+        return 1;
+    }
+    bool submitted = false;
+    const Run workers_run = run([&](Chunk *chunks) -> size_t {
+        if (!submitted) {
+            for (size_t i = 0; i < CHUNKS; ++i) {
+                Chunk *chunk = &chunks[i];
+                gl_worker::submit(&pool, [=] { load_chunk(i, chunk); }, [=] { chunk->ready = true; });
+            }
+            submitted = true;
+        }
+        return gl_worker::poll(&pool);
+    });
+    report("workers", workers_run);
+
+    const gl_worker::Stats stats = gl_worker::stats(&pool);
+    printf("The workers spent %.1f ms in the chunks, %.1f ms at most in one\n",
+           stats.create_time_total * 1000.0, stats.create_time_max * 1000.0);
+    gl_worker::stop(&pool);
+
+    gl_egl::destroy_context(context.unwrap);
+
+    return inline_run.intact && workers_run.intact ? 0 : 1;
+}
@@ -27,6 +27,34 @@ struct Maybe
 #    endif
 #endif
 
+// Define GL_HPP_STATS to count the draw calls and the uploaded bytes
+// in gl::stats. Reset it yourself whenever you want, e.g. every frame.
+#ifdef GL_HPP_STATS
+namespace gl
+{
+    struct Stats
+    {
+        size_t draw_calls;
+        size_t bytes_uploaded;
+    };
+
+    inline Stats stats = {};
+}
+#    define GL_HPP_STAT(field, value) (gl::stats.field += (value))
+#else
+#    define GL_HPP_STAT(field, value) do {} while(0)
+#endif
+
+// Define GL_HPP_TRACE and include gl_trace.hpp first to record every
+// call in the timeline of gl_trace, with its arguments.
+#ifdef GL_HPP_TRACE
+#    define GL_HPP_TRACE_CALL(...)                                        \
+        gl_trace::Call_Scope gl_hpp_trace_call(__func__, #__VA_ARGS__);  \
+        gl_hpp_trace_call.args(__VA_ARGS__)
+#else
+#    define GL_HPP_TRACE_CALL(...) do {} while(0)
+#endif
+
 // TODO: gl.hpp supports only OpenGL 3.0 for now
 
 namespace gl
@@ -63,12 +91,14 @@ namespace gl
 
     ALWAYS_INLINE void clear(Buffer_Bit buffer)
     {
+        GL_HPP_TRACE_CALL(buffer);
         glClear(buffer.unwrap);
         ASSERT_GL_ERROR;
     }
 
     ALWAYS_INLINE void clearColor(Color4 color)
     {
+        GL_HPP_TRACE_CALL(color);
         glClearColor(color.r, color.g, color.b, color.a);
         ASSERT_GL_ERROR;
     }
@@ -80,13 +110,17 @@ namespace gl
         Geometry = GL_GEOMETRY_SHADER
     };
 
-    struct PACKED Shader
+    // The handles are not PACKED: one GLuint has no padding to squeeze
+    // out, and an alignment of 1 would make a returned Maybe<handle> go
+    // through memory instead of a register.
+    struct Shader
     {
         GLuint unwrap;
     };
 
     ALWAYS_INLINE Shader createShader(Shader_Type type)
     {
+        GL_HPP_TRACE_CALL(type);
         auto shader = glCreateShader(static_cast<GLenum>(type));
         ASSERT_GL_ERROR;
         return Shader { shader };
@@ -97,6 +131,7 @@ namespace gl
                                     const GLchar ** string,
                                     const GLint * length)
     {
+        GL_HPP_TRACE_CALL(shader, count, string, length);
         glShaderSource(shader.unwrap, count, string, length);
         ASSERT_GL_ERROR;
     }
@@ -110,6 +145,7 @@ namespace gl
 
     ALWAYS_INLINE void compileShader(Shader shader)
     {
+        GL_HPP_TRACE_CALL(shader);
         glCompileShader(shader.unwrap);
         ASSERT_GL_ERROR;
     }
@@ -117,6 +153,7 @@ namespace gl
     template <GLsizei Max_Length>
     ALWAYS_INLINE void getShaderInfoLog(Shader shader, Info_Log<Max_Length> *infoLog)
     {
+        GL_HPP_TRACE_CALL(shader, infoLog);
         glGetShaderInfoLog(shader.unwrap, Max_Length, &infoLog->length, infoLog->value);
         ASSERT_GL_ERROR;
     }
@@ -124,6 +161,7 @@ namespace gl
     template <GLsizei Max_Length>
     ALWAYS_INLINE Info_Log<Max_Length> getShaderInfoLog(Shader shader)
     {
+        GL_HPP_TRACE_CALL(shader);
         Info_Log<Max_Length> infoLog = {};
         glGetShaderInfoLog(shader.unwrap, Max_Length, &infoLog.length, infoLog.value);
         ASSERT_GL_ERROR;
@@ -132,25 +170,42 @@ namespace gl
 
     ALWAYS_INLINE bool compileStatus(Shader shader)
     {
+        GL_HPP_TRACE_CALL(shader);
         GLint param = 0;
         glGetShaderiv(shader.unwrap, GL_COMPILE_STATUS, &param);
         ASSERT_GL_ERROR;
         return static_cast<bool>(param);
     }
 
-    struct PACKED Buffer
+#ifdef GL_KHR_parallel_shader_compile
+    // GL_KHR_parallel_shader_compile: false while the driver is still
+    // compiling the shader in the background. Unlike compileStatus it
+    // never blocks.
+    ALWAYS_INLINE bool completionStatus(Shader shader)
+    {
+        GL_HPP_TRACE_CALL(shader);
+        GLint param = 0;
+        glGetShaderiv(shader.unwrap, GL_COMPLETION_STATUS_KHR, &param);
+        ASSERT_GL_ERROR;
+        return static_cast<bool>(param);
+    }
+#endif
+
+    struct Buffer
     {
         GLuint unwrap;
     };
 
     ALWAYS_INLINE void deleteObject(Shader shader)
     {
+        GL_HPP_TRACE_CALL(shader);
         glDeleteShader(shader.unwrap);
         ASSERT_GL_ERROR;
     }
 
     ALWAYS_INLINE void deleteObject(Buffer buffer)
     {
+        GL_HPP_TRACE_CALL(buffer);
         GLuint id = buffer.unwrap;
         glDeleteBuffers(1, &id);
         ASSERT_GL_ERROR;
@@ -158,6 +213,7 @@ namespace gl
 
     ALWAYS_INLINE void deleteObjects(GLsizei n, Buffer *buffers)
     {
+        GL_HPP_TRACE_CALL(n, buffers);
         static_assert(
                 sizeof(Buffer) == sizeof(GLuint),
                 "Cannot use gl::deleteObjects(GLsizei n, Buffer *buffers), properly because it makes an assumption "
@@ -170,13 +226,14 @@ namespace gl
         ASSERT_GL_ERROR;
     }
 
-    struct PACKED Program
+    struct Program
     {
         GLuint unwrap;
     };
 
     ALWAYS_INLINE Program createProgram(void)
     {
+        GL_HPP_TRACE_CALL();
         auto program = glCreateProgram();
         ASSERT_GL_ERROR;
         return Program { program };
@@ -184,33 +241,52 @@ namespace gl
 
     ALWAYS_INLINE void deleteObject(Program program)
     {
+        GL_HPP_TRACE_CALL(program);
         glDeleteProgram(program.unwrap);
         ASSERT_GL_ERROR;
     }
 
     ALWAYS_INLINE void attachShader(Program program, Shader shader)
     {
+        GL_HPP_TRACE_CALL(program, shader);
         glAttachShader(program.unwrap, shader.unwrap);
         ASSERT_GL_ERROR;
     }
 
     ALWAYS_INLINE void linkProgram(Program program)
     {
+        GL_HPP_TRACE_CALL(program);
         glLinkProgram(program.unwrap);
         ASSERT_GL_ERROR;
     }
 
     ALWAYS_INLINE bool linkStatus(Program program)
     {
+        GL_HPP_TRACE_CALL(program);
         GLint linked = 0;
         glGetProgramiv(program.unwrap, GL_LINK_STATUS, &linked);
         ASSERT_GL_ERROR;
         return static_cast<bool>(linked);
     }
 
+#ifdef GL_KHR_parallel_shader_compile
+    // GL_KHR_parallel_shader_compile: false while the driver is still
+    // linking the program in the background. Unlike linkStatus it never
+    // blocks.
+    ALWAYS_INLINE bool completionStatus(Program program)
+    {
+        GL_HPP_TRACE_CALL(program);
+        GLint completed = 0;
+        glGetProgramiv(program.unwrap, GL_COMPLETION_STATUS_KHR, &completed);
+        ASSERT_GL_ERROR;
+        return static_cast<bool>(completed);
+    }
+#endif
+
     template <GLsizei Max_Length>
     ALWAYS_INLINE void getProgramInfoLog(Program program, Info_Log<Max_Length> *infoLog)
     {
+        GL_HPP_TRACE_CALL(program, infoLog);
         glGetProgramInfoLog(program.unwrap, Max_Length, &infoLog->length, infoLog->value);
         ASSERT_GL_ERROR;
     }
@@ -218,6 +294,7 @@ namespace gl
     template <GLsizei Max_Length>
     ALWAYS_INLINE Info_Log<Max_Length> getProgramInfoLog(Program program)
     {
+        GL_HPP_TRACE_CALL(program);
         Info_Log<Max_Length> infoLog = {};
         glGetProgramInfoLog(program.unwrap, Max_Length, &infoLog.length, infoLog.value);
         ASSERT_GL_ERROR;
@@ -226,6 +303,7 @@ namespace gl
 
     void useProgram(Program program)
     {
+        GL_HPP_TRACE_CALL(program);
         glUseProgram(program.unwrap);
         ASSERT_GL_ERROR;
     }
@@ -246,11 +324,13 @@ namespace gl
 
     ALWAYS_INLINE void drawArrays(Draw_Mode mode, GLint first, GLsizei count)
     {
+        GL_HPP_TRACE_CALL(mode, first, count);
         glDrawArrays(static_cast<GLenum>(mode), first, count);
         ASSERT_GL_ERROR;
+        GL_HPP_STAT(draw_calls, 1);
     }
 
-    struct PACKED Uniform
+    struct Uniform
     {
         GLint unwrap;
     };
@@ -261,40 +341,345 @@ namespace gl
         T x, y;
     };
 
+    template <typename T>
+    struct PACKED Vec3
+    {
+        T x, y, z;
+    };
+
+    template <typename T>
+    struct PACKED Vec4
+    {
+        T x, y, z, w;
+    };
+
+    // The components of an array of vectors, for the glUniform*v calls.
+    // PACKED lays the vectors out exactly like the array of T that GL
+    // reads, but a T* into a packed struct may be unaligned, so the
+    // pointer is converted through void*.
+    template <typename T>
+    ALWAYS_INLINE const T *components(const Vec2<T> *xs)
+    {
+        static_assert(sizeof(Vec2<T>) == 2 * sizeof(T), "Vec2 must be laid out as T[2]");
+        const void *data = xs;
+        return static_cast<const T*>(data);
+    }
+
+    template <typename T>
+    ALWAYS_INLINE const T *components(const Vec3<T> *xs)
+    {
+        static_assert(sizeof(Vec3<T>) == 3 * sizeof(T), "Vec3 must be laid out as T[3]");
+        const void *data = xs;
+        return static_cast<const T*>(data);
+    }
+
+    template <typename T>
+    ALWAYS_INLINE const T *components(const Vec4<T> *xs)
+    {
+        static_assert(sizeof(Vec4<T>) == 4 * sizeof(T), "Vec4 must be laid out as T[4]");
+        const void *data = xs;
+        return static_cast<const T*>(data);
+    }
+
     using Vec2f = Vec2<GLfloat>;
+    using Vec3f = Vec3<GLfloat>;
+    using Vec4f = Vec4<GLfloat>;
+    using Vec2i = Vec2<GLint>;
+    using Vec3i = Vec3<GLint>;
+    using Vec4i = Vec4<GLint>;
+
+    // Column-major, like GLSL and std140 (one column after another)
+    struct Mat2f
+    {
+        GLfloat m[2 * 2];
+    };
+
+    struct Mat3f
+    {
+        GLfloat m[3 * 3];
+    };
+
+    struct Mat4f
+    {
+        GLfloat m[4 * 4];
+    };
 
     ALWAYS_INLINE Maybe<Uniform> getUniformLocation(Program program, const GLchar *name)
     {
+        GL_HPP_TRACE_CALL(program, name);
         auto location = glGetUniformLocation(program.unwrap, name);
         ASSERT_GL_ERROR;
         return {location >= 0, {location}};
     }
 
+    ALWAYS_INLINE void uniform(Uniform uniform, GLfloat x)
+    {
+        GL_HPP_TRACE_CALL(uniform, x);
+        glUniform1f(uniform.unwrap, x);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(x));
+    }
+
     ALWAYS_INLINE void uniform(Uniform uniform, Vec2<GLfloat> vec)
     {
+        GL_HPP_TRACE_CALL(uniform, vec);
         glUniform2f(uniform.unwrap, vec.x, vec.y);
         ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(vec));
     }
 
-    ALWAYS_INLINE void uniform(Uniform uniform, GLfloat x)
+    ALWAYS_INLINE void uniform(Uniform uniform, Vec3<GLfloat> vec)
     {
-        glUniform1f(uniform.unwrap, x);
+        GL_HPP_TRACE_CALL(uniform, vec);
+        glUniform3f(uniform.unwrap, vec.x, vec.y, vec.z);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(vec));
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, Vec4<GLfloat> vec)
+    {
+        GL_HPP_TRACE_CALL(uniform, vec);
+        glUniform4f(uniform.unwrap, vec.x, vec.y, vec.z, vec.w);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(vec));
+    }
+
+    // Not an overload of uniform(), so that uniform(location, 0) keeps
+    // setting a float. Also sets bool and sampler uniforms.
+    ALWAYS_INLINE void uniformi(Uniform uniform, GLint x)
+    {
+        GL_HPP_TRACE_CALL(uniform, x);
+        glUniform1i(uniform.unwrap, x);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(x));
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, Vec2<GLint> vec)
+    {
+        GL_HPP_TRACE_CALL(uniform, vec);
+        glUniform2i(uniform.unwrap, vec.x, vec.y);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(vec));
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, Vec3<GLint> vec)
+    {
+        GL_HPP_TRACE_CALL(uniform, vec);
+        glUniform3i(uniform.unwrap, vec.x, vec.y, vec.z);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(vec));
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, Vec4<GLint> vec)
+    {
+        GL_HPP_TRACE_CALL(uniform, vec);
+        glUniform4i(uniform.unwrap, vec.x, vec.y, vec.z, vec.w);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(vec));
+    }
+
+    ALWAYS_INLINE void uniformui(Uniform uniform, GLuint x)
+    {
+        GL_HPP_TRACE_CALL(uniform, x);
+        glUniform1ui(uniform.unwrap, x);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(x));
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, const Mat2f &mat)
+    {
+        GL_HPP_TRACE_CALL(uniform, mat);
+        glUniformMatrix2fv(uniform.unwrap, 1, GL_FALSE, mat.m);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(mat));
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, const Mat3f &mat)
+    {
+        GL_HPP_TRACE_CALL(uniform, mat);
+        glUniformMatrix3fv(uniform.unwrap, 1, GL_FALSE, mat.m);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(mat));
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, const Mat4f &mat)
+    {
+        GL_HPP_TRACE_CALL(uniform, mat);
+        glUniformMatrix4fv(uniform.unwrap, 1, GL_FALSE, mat.m);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(mat));
+    }
+
+    // Arrays: `count` elements starting at `xs`
+
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const GLfloat *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniform1fv(uniform.unwrap, count, xs);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const Vec2<GLfloat> *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniform2fv(uniform.unwrap, count, components(xs));
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const Vec3<GLfloat> *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniform3fv(uniform.unwrap, count, components(xs));
         ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
     }
 
-    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, GLint *xs)
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const Vec4<GLfloat> *xs)
     {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniform4fv(uniform.unwrap, count, components(xs));
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const GLint *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
         glUniform1iv(uniform.unwrap, count, xs);
         ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const Vec2<GLint> *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniform2iv(uniform.unwrap, count, components(xs));
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const Vec3<GLint> *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniform3iv(uniform.unwrap, count, components(xs));
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const Vec4<GLint> *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniform4iv(uniform.unwrap, count, components(xs));
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
     }
 
-    struct PACKED Vertex_Array
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const GLuint *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniform1uiv(uniform.unwrap, count, xs);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const Mat2f *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniformMatrix2fv(uniform.unwrap, count, GL_FALSE, xs->m);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const Mat3f *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniformMatrix3fv(uniform.unwrap, count, GL_FALSE, xs->m);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
+    }
+
+    ALWAYS_INLINE void uniform(Uniform uniform, GLsizei count, const Mat4f *xs)
+    {
+        GL_HPP_TRACE_CALL(uniform, count, xs);
+        glUniformMatrix4fv(uniform.unwrap, count, GL_FALSE, xs->m);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(bytes_uploaded, sizeof(*xs) * count);
+    }
+
+    template <typename T, typename U>
+    struct Is_Same
+    {
+        static const bool value = false;
+    };
+
+    template <typename T>
+    struct Is_Same<T, T>
+    {
+        static const bool value = true;
+    };
+
+    // True if U is T or publicly derives from T, like gl_math::Vec4
+    // from Vec4f: a U is then uploaded as the T it is
+    template <typename T, typename U>
+    struct Is_Uploadable_As
+    {
+        static char check(const T *);
+        static long check(...);
+        static const bool value = sizeof(check(static_cast<const U *>(nullptr))) == sizeof(char);
+    };
+
+    // A uniform whose GLSL type is known at compile time, usually
+    // generated by tools/reflect. Uploading a value of any other type
+    // than T or a type derived from it, even one that converts to T,
+    // is a compile error instead of a GL error or of a silently
+    // converted value.
+    template <typename T>
+    struct Typed_Uniform
+    {
+        Uniform unwrap;
+    };
+
+    template <typename T, typename U>
+    ALWAYS_INLINE void uniform(Typed_Uniform<T> location, const U &value)
+    {
+        static_assert(Is_Uploadable_As<T, U>::value,
+                      "The value must have the type of the uniform, convert it explicitly");
+        static_assert(sizeof(U) == sizeof(T), "The value must have the layout of the uniform");
+        uniform(location.unwrap, static_cast<const T &>(value));
+    }
+
+    // The type of the uniform picks the upload of the integer scalars
+    ALWAYS_INLINE void uniform(Typed_Uniform<GLint> location, GLint x)
+    {
+        uniformi(location.unwrap, x);
+    }
+
+    ALWAYS_INLINE void uniform(Typed_Uniform<GLuint> location, GLuint x)
+    {
+        uniformui(location.unwrap, x);
+    }
+
+    // Typed_Uniform<T[N]> is a `T name[N]` array uniform
+    template <typename T, GLsizei N, typename U>
+    ALWAYS_INLINE void uniform(Typed_Uniform<T[N]> location, GLsizei count, const U *xs)
+    {
+        static_assert(Is_Uploadable_As<T, U>::value,
+                      "The values must have the type of the uniform, convert them explicitly");
+        // The elements are read as an array of T
+        static_assert(sizeof(U) == sizeof(T), "The values must have the layout of the uniform");
+        uniform(location.unwrap, count, static_cast<const T *>(xs));
+    }
+
+    struct Vertex_Array
     {
         GLuint unwrap;
     };
 
     ALWAYS_INLINE void genVertexArrays(GLsizei n, Vertex_Array *arrays)
     {
+        GL_HPP_TRACE_CALL(n, arrays);
         static_assert(
                 sizeof(Vertex_Array) == sizeof(GLuint),
                 "Cannot use gl::genVertexArrays properly because it makes an assumption "
@@ -309,6 +694,7 @@ namespace gl
 
     ALWAYS_INLINE Vertex_Array genVertexArray()
     {
+        GL_HPP_TRACE_CALL();
         GLuint id = {};
         glGenVertexArrays(1, &id);
         ASSERT_GL_ERROR;
@@ -317,12 +703,22 @@ namespace gl
 
     ALWAYS_INLINE void bindVertexArray(Vertex_Array array)
     {
+        GL_HPP_TRACE_CALL(array);
         glBindVertexArray(array.unwrap);
         ASSERT_GL_ERROR;
     }
 
+    ALWAYS_INLINE void deleteObject(Vertex_Array array)
+    {
+        GL_HPP_TRACE_CALL(array);
+        GLuint id = array.unwrap;
+        glDeleteVertexArrays(1, &id);
+        ASSERT_GL_ERROR;
+    }
+
     ALWAYS_INLINE void genBuffers(GLsizei n, Buffer *buffers)
     {
+        GL_HPP_TRACE_CALL(n, buffers);
         static_assert(
                 sizeof(Buffer) == sizeof(GLuint),
                 "Cannot use gl::genBuffers properly because it makes an assumption "
@@ -336,6 +732,7 @@ namespace gl
 
     ALWAYS_INLINE Buffer genBuffer()
     {
+        GL_HPP_TRACE_CALL();
         GLuint id = {};
         glGenBuffers(1, &id);
         ASSERT_GL_ERROR;
@@ -365,6 +762,7 @@ namespace gl
 
     void bindBuffer(Buffer_Target target, Buffer buffer)
     {
+        GL_HPP_TRACE_CALL(target, buffer);
         glBindBuffer(static_cast<GLenum>(target), buffer.unwrap);
         ASSERT_GL_ERROR;
     }
@@ -374,17 +772,34 @@ namespace gl
                     const GLvoid *data,
                     Buffer_Usage  usage)
     {
+        GL_HPP_TRACE_CALL(target, size, data, usage);
         glBufferData(static_cast<GLenum>(target), size, data, static_cast<GLenum>(usage));
         ASSERT_GL_ERROR;
+        if (data) GL_HPP_STAT(bytes_uploaded, size);
+    }
+
+    // The targets with numbered binding points, see bindBufferBase
+    enum class Indexed_Buffer_Target
+    {
+        TRANSFORM_FEEDBACK = GL_TRANSFORM_FEEDBACK_BUFFER,
+        UNIFORM            = GL_UNIFORM_BUFFER
+    };
+
+    ALWAYS_INLINE void bindBufferBase(Indexed_Buffer_Target target, GLuint index, Buffer buffer)
+    {
+        GL_HPP_TRACE_CALL(target, index, buffer);
+        glBindBufferBase(static_cast<GLenum>(target), index, buffer.unwrap);
+        ASSERT_GL_ERROR;
     }
 
-    struct PACKED Attribute_Location
+    struct Attribute_Location
     {
         GLuint unwrap;
     };
 
     ALWAYS_INLINE void enableVertexAttribArray(Attribute_Location index)
     {
+        GL_HPP_TRACE_CALL(index);
         glEnableVertexAttribArray(index.unwrap);
         ASSERT_GL_ERROR;
     }
@@ -401,6 +816,7 @@ namespace gl
     ALWAYS_INLINE Maybe<Attribute_Location> getAttribLocation(Program program,
             const GLchar * name)
     {
+        GL_HPP_TRACE_CALL(program, name);
         GLint id = glGetAttribLocation(program.unwrap, name);
         ASSERT_GL_ERROR;
         return {id >= 0, {static_cast<GLuint>(id)}};
@@ -408,6 +824,12 @@ namespace gl
 
     enum class Attribute_Type
     {
+        BYTE                        = GL_BYTE,
+        UNSIGNED_BYTE               = GL_UNSIGNED_BYTE,
+        SHORT                       = GL_SHORT,
+        UNSIGNED_SHORT              = GL_UNSIGNED_SHORT,
+        INT                         = GL_INT,
+        UNSIGNED_INT                = GL_UNSIGNED_INT,
         HALF_FLOAT                  = GL_HALF_FLOAT,
         FLOAT                       = GL_FLOAT,
         DOUBLE                      = GL_DOUBLE,
@@ -422,6 +844,7 @@ namespace gl
                                            GLsizei  stride,
                                            const GLvoid *pointer)
     {
+        GL_HPP_TRACE_CALL(index, size, type, normalized, stride, pointer);
         glVertexAttribPointer(
             index.unwrap,
             static_cast<GLint>(size),
@@ -449,6 +872,7 @@ namespace gl
                               GLsizei stride,
                               const GLvoid *pointer)
     {
+        GL_HPP_TRACE_CALL(index, size, type, stride, pointer);
         glVertexAttribIPointer(index.unwrap,
                 static_cast<GLint>(size), 
                 static_cast<GLenum>(type), 
@@ -469,6 +893,7 @@ namespace gl
     ALWAYS_INLINE
     const GLubyte *getString(String_Name name)
     {
+        GL_HPP_TRACE_CALL(name);
         return glGetString(static_cast<GLenum>(name));
     }
 
@@ -484,18 +909,473 @@ namespace gl
                       Element_Index_Type type,
                       const GLvoid *indices)
     {
+        GL_HPP_TRACE_CALL(mode, count, type, indices);
         glDrawElements(
                 static_cast<GLenum>(mode), 
                 count, 
                 static_cast<GLenum>(type), 
                 indices);
         ASSERT_GL_ERROR;
+        GL_HPP_STAT(draw_calls, 1);
+    }
+
+    // The indices are relative to basevertex, so a mesh with more
+    // vertices than 16-bit indices can reach still draws from one
+    // vertex buffer
+    ALWAYS_INLINE
+    void drawElementsBaseVertex(Draw_Mode mode,
+                                GLsizei count,
+                                Element_Index_Type type,
+                                const GLvoid *indices,
+                                GLint basevertex)
+    {
+        GL_HPP_TRACE_CALL(mode, count, type, indices, basevertex);
+        glDrawElementsBaseVertex(
+                static_cast<GLenum>(mode),
+                count,
+                static_cast<GLenum>(type),
+                indices,
+                basevertex);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(draw_calls, 1);
+    }
+
+    enum class Capability
+    {
+        BLEND                    = GL_BLEND,
+        CULL_FACE                = GL_CULL_FACE,
+        // GL 4.3 or KHR_debug
+        DEBUG_OUTPUT             = GL_DEBUG_OUTPUT,
+        DEBUG_OUTPUT_SYNCHRONOUS = GL_DEBUG_OUTPUT_SYNCHRONOUS,
+        DEPTH_TEST               = GL_DEPTH_TEST,
+        PRIMITIVE_RESTART        = GL_PRIMITIVE_RESTART,
+        RASTERIZER_DISCARD       = GL_RASTERIZER_DISCARD,
+        SCISSOR_TEST             = GL_SCISSOR_TEST,
+    };
+
+    ALWAYS_INLINE void enable(Capability cap)
+    {
+        GL_HPP_TRACE_CALL(cap);
+        glEnable(static_cast<GLenum>(cap));
+        ASSERT_GL_ERROR;
+    }
+
+    ALWAYS_INLINE void disable(Capability cap)
+    {
+        GL_HPP_TRACE_CALL(cap);
+        glDisable(static_cast<GLenum>(cap));
+        ASSERT_GL_ERROR;
+    }
+
+    // Only used while Capability::PRIMITIVE_RESTART is enabled
+    ALWAYS_INLINE void primitiveRestartIndex(GLuint index)
+    {
+        GL_HPP_TRACE_CALL(index);
+        glPrimitiveRestartIndex(index);
+        ASSERT_GL_ERROR;
+    }
+
+    enum class Transform_Feedback_Buffer_Mode
+    {
+        INTERLEAVED_ATTRIBS = GL_INTERLEAVED_ATTRIBS,
+        SEPARATE_ATTRIBS    = GL_SEPARATE_ATTRIBS
+    };
+
+    // Takes effect on the next linkProgram
+    ALWAYS_INLINE void transformFeedbackVaryings(Program program,
+                                                 GLsizei count,
+                                                 const GLchar *const *varyings,
+                                                 Transform_Feedback_Buffer_Mode mode)
+    {
+        GL_HPP_TRACE_CALL(program, count, varyings, mode);
+        glTransformFeedbackVaryings(program.unwrap, count, varyings, static_cast<GLenum>(mode));
+        ASSERT_GL_ERROR;
+    }
+
+    template <GLsizei N>
+    ALWAYS_INLINE void transformFeedbackVaryings(Program program,
+                                                 const GLchar *const (&varyings)[N],
+                                                 Transform_Feedback_Buffer_Mode mode)
+    {
+        transformFeedbackVaryings(program, N, varyings, mode);
+    }
+
+    // The only modes beginTransformFeedback accepts, the draws inside
+    // must produce the same primitives
+    enum class Transform_Feedback_Primitive_Mode
+    {
+        POINTS    = GL_POINTS,
+        LINES     = GL_LINES,
+        TRIANGLES = GL_TRIANGLES
+    };
+
+    ALWAYS_INLINE void beginTransformFeedback(Transform_Feedback_Primitive_Mode mode)
+    {
+        GL_HPP_TRACE_CALL(mode);
+        glBeginTransformFeedback(static_cast<GLenum>(mode));
+        ASSERT_GL_ERROR;
+    }
+
+    ALWAYS_INLINE void endTransformFeedback()
+    {
+        GL_HPP_TRACE_CALL();
+        glEndTransformFeedback();
+        ASSERT_GL_ERROR;
+    }
+
+    // Transform feedback objects: GL 4.0 or ARB_transform_feedback2
+    struct Transform_Feedback
+    {
+        GLuint unwrap;
+    };
+
+    ALWAYS_INLINE Transform_Feedback genTransformFeedback()
+    {
+        GL_HPP_TRACE_CALL();
+        GLuint id = {};
+        glGenTransformFeedbacks(1, &id);
+        ASSERT_GL_ERROR;
+        return {id};
+    }
+
+    ALWAYS_INLINE void deleteObject(Transform_Feedback feedback)
+    {
+        GL_HPP_TRACE_CALL(feedback);
+        GLuint id = feedback.unwrap;
+        glDeleteTransformFeedbacks(1, &id);
+        ASSERT_GL_ERROR;
+    }
+
+    // {0} binds the default transform feedback object back
+    ALWAYS_INLINE void bindTransformFeedback(Transform_Feedback feedback)
+    {
+        GL_HPP_TRACE_CALL(feedback);
+        glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, feedback.unwrap);
+        ASSERT_GL_ERROR;
+    }
+
+    // Draws as many vertices as the last feedback into `feedback`
+    // wrote, without reading the count back to the CPU
+    ALWAYS_INLINE void drawTransformFeedback(Draw_Mode mode, Transform_Feedback feedback)
+    {
+        GL_HPP_TRACE_CALL(mode, feedback);
+        glDrawTransformFeedback(static_cast<GLenum>(mode), feedback.unwrap);
+        ASSERT_GL_ERROR;
+        GL_HPP_STAT(draw_calls, 1);
+    }
+
+    ALWAYS_INLINE void colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+    {
+        GL_HPP_TRACE_CALL(red, green, blue, alpha);
+        glColorMask(red, green, blue, alpha);
+        ASSERT_GL_ERROR;
+    }
+
+    ALWAYS_INLINE void depthMask(GLboolean flag)
+    {
+        GL_HPP_TRACE_CALL(flag);
+        glDepthMask(flag);
+        ASSERT_GL_ERROR;
+    }
+
+    struct Query
+    {
+        GLuint unwrap;
+    };
+
+    ALWAYS_INLINE Query genQuery()
+    {
+        GL_HPP_TRACE_CALL();
+        GLuint id = {};
+        glGenQueries(1, &id);
+        ASSERT_GL_ERROR;
+        return {id};
+    }
+
+    ALWAYS_INLINE void deleteObject(Query query)
+    {
+        GL_HPP_TRACE_CALL(query);
+        GLuint id = query.unwrap;
+        glDeleteQueries(1, &id);
+        ASSERT_GL_ERROR;
+    }
+
+    enum class Query_Target
+    {
+        SAMPLES_PASSED                        = GL_SAMPLES_PASSED,
+        // GL 3.3, only tells zero from non-zero, which can be cheaper
+        ANY_SAMPLES_PASSED                    = GL_ANY_SAMPLES_PASSED,
+        PRIMITIVES_GENERATED                  = GL_PRIMITIVES_GENERATED,
+        TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN = GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN,
+        TIME_ELAPSED                          = GL_TIME_ELAPSED
+    };
+
+    ALWAYS_INLINE void beginQuery(Query_Target target, Query query)
+    {
+        GL_HPP_TRACE_CALL(target, query);
+        glBeginQuery(static_cast<GLenum>(target), query.unwrap);
+        ASSERT_GL_ERROR;
+    }
+
+    ALWAYS_INLINE void endQuery(Query_Target target)
+    {
+        GL_HPP_TRACE_CALL(target);
+        glEndQuery(static_cast<GLenum>(target));
+        ASSERT_GL_ERROR;
+    }
+
+    // Never waits for the GPU
+    ALWAYS_INLINE bool queryResultAvailable(Query query)
+    {
+        GL_HPP_TRACE_CALL(query);
+        GLuint available = 0;
+        glGetQueryObjectuiv(query.unwrap, GL_QUERY_RESULT_AVAILABLE, &available);
+        ASSERT_GL_ERROR;
+        return static_cast<bool>(available);
+    }
+
+    // Waits for the GPU until the result is available
+    ALWAYS_INLINE GLuint64 queryResult(Query query)
+    {
+        GL_HPP_TRACE_CALL(query);
+        GLuint64 result = 0;
+        glGetQueryObjectui64v(query.unwrap, GL_QUERY_RESULT, &result);
+        ASSERT_GL_ERROR;
+        return result;
+    }
+
+    enum class Conditional_Render_Mode
+    {
+        QUERY_WAIT              = GL_QUERY_WAIT,
+        // Draws anyway when the result is not there yet
+        QUERY_NO_WAIT           = GL_QUERY_NO_WAIT,
+        QUERY_BY_REGION_WAIT    = GL_QUERY_BY_REGION_WAIT,
+        QUERY_BY_REGION_NO_WAIT = GL_QUERY_BY_REGION_NO_WAIT
+    };
+
+    // The draws until endConditionalRender are discarded on the GPU
+    // when the SAMPLES_PASSED or ANY_SAMPLES_PASSED `query` is zero
+    ALWAYS_INLINE void beginConditionalRender(Query query, Conditional_Render_Mode mode)
+    {
+        GL_HPP_TRACE_CALL(query, mode);
+        glBeginConditionalRender(query.unwrap, static_cast<GLenum>(mode));
+        ASSERT_GL_ERROR;
+    }
+
+    ALWAYS_INLINE void endConditionalRender()
+    {
+        GL_HPP_TRACE_CALL();
+        glEndConditionalRender();
+        ASSERT_GL_ERROR;
+    }
+
+    // Signaled once the GPU has finished every command issued before
+    // fenceSync. Unlike the other handles it owns the sync object and
+    // deletes it, so it is move-only: a copy would be waited on after
+    // the original deleted it.
+    struct Fence
+    {
+        GLsync unwrap;
+
+        Fence(): unwrap(nullptr) {}
+        explicit Fence(GLsync sync): unwrap(sync) {}
+
+        Fence(const Fence&) = delete;
+        Fence &operator=(const Fence&) = delete;
+
+        Fence(Fence &&that): unwrap(that.unwrap)
+        {
+            that.unwrap = nullptr;
+        }
+
+        Fence &operator=(Fence &&that)
+        {
+            if (this != &that) {
+                reset();
+                unwrap = that.unwrap;
+                that.unwrap = nullptr;
+            }
+            return *this;
+        }
+
+        ~Fence()
+        {
+            reset();
+        }
+
+        void reset()
+        {
+            if (unwrap) {
+                glDeleteSync(unwrap);
+                ASSERT_GL_ERROR;
+                unwrap = nullptr;
+            }
+        }
+
+        explicit operator bool() const
+        {
+            return unwrap != nullptr;
+        }
+    };
+
+    ALWAYS_INLINE Fence fenceSync()
+    {
+        GL_HPP_TRACE_CALL();
+        Fence fence(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        ASSERT_GL_ERROR;
+        return fence;
+    }
+
+    // Never waits for the GPU. It does not flush either, so a fence that
+    // is polled in a loop must have been flushed by something else
+    // (clientWaitSync with `flush`, glFlush, a swap) or it may never
+    // signal.
+    ALWAYS_INLINE bool signaled(const Fence &fence)
+    {
+        GL_HPP_TRACE_CALL(fence);
+        GLint status = GL_UNSIGNALED;
+        glGetSynciv(fence.unwrap, GL_SYNC_STATUS, 1, nullptr, &status);
+        ASSERT_GL_ERROR;
+        return status == GL_SIGNALED;
+    }
+
+    enum class Wait_Result
+    {
+        ALREADY_SIGNALED    = GL_ALREADY_SIGNALED,
+        TIMEOUT_EXPIRED     = GL_TIMEOUT_EXPIRED,
+        CONDITION_SATISFIED = GL_CONDITION_SATISFIED,
+        WAIT_FAILED         = GL_WAIT_FAILED
+    };
+
+    // Blocks the CPU for at most `timeout_ns` nanoseconds, 0 only polls.
+    // `flush` flushes the commands up to the fence first, which a
+    // waiting loop needs once.
+    ALWAYS_INLINE Wait_Result clientWaitSync(const Fence &fence, bool flush, GLuint64 timeout_ns)
+    {
+        GL_HPP_TRACE_CALL(fence, flush, timeout_ns);
+        auto result = glClientWaitSync(fence.unwrap, flush ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, timeout_ns);
+        ASSERT_GL_ERROR;
+        return static_cast<Wait_Result>(result);
+    }
+
+    // Makes the GPU, not the CPU, wait for the fence before running the
+    // commands issued after it, for fences of another shared context
+    ALWAYS_INLINE void waitSync(const Fence &fence)
+    {
+        GL_HPP_TRACE_CALL(fence);
+        glWaitSync(fence.unwrap, 0, GL_TIMEOUT_IGNORED);
+        ASSERT_GL_ERROR;
+    }
+
+    enum class Debug_Source
+    {
+        API             = GL_DEBUG_SOURCE_API,
+        WINDOW_SYSTEM   = GL_DEBUG_SOURCE_WINDOW_SYSTEM,
+        SHADER_COMPILER = GL_DEBUG_SOURCE_SHADER_COMPILER,
+        THIRD_PARTY     = GL_DEBUG_SOURCE_THIRD_PARTY,
+        APPLICATION     = GL_DEBUG_SOURCE_APPLICATION,
+        OTHER           = GL_DEBUG_SOURCE_OTHER,
+        // Only for debugMessageControl
+        DONT_CARE       = GL_DONT_CARE
+    };
+
+    enum class Debug_Type
+    {
+        ERROR               = GL_DEBUG_TYPE_ERROR,
+        DEPRECATED_BEHAVIOR = GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR,
+        UNDEFINED_BEHAVIOR  = GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR,
+        PORTABILITY         = GL_DEBUG_TYPE_PORTABILITY,
+        PERFORMANCE         = GL_DEBUG_TYPE_PERFORMANCE,
+        MARKER              = GL_DEBUG_TYPE_MARKER,
+        PUSH_GROUP          = GL_DEBUG_TYPE_PUSH_GROUP,
+        POP_GROUP           = GL_DEBUG_TYPE_POP_GROUP,
+        OTHER               = GL_DEBUG_TYPE_OTHER,
+        // Only for debugMessageControl
+        DONT_CARE           = GL_DONT_CARE
+    };
+
+    enum class Debug_Severity
+    {
+        HIGH         = GL_DEBUG_SEVERITY_HIGH,
+        MEDIUM       = GL_DEBUG_SEVERITY_MEDIUM,
+        LOW          = GL_DEBUG_SEVERITY_LOW,
+        NOTIFICATION = GL_DEBUG_SEVERITY_NOTIFICATION,
+        // Only for debugMessageControl
+        DONT_CARE    = GL_DONT_CARE
+    };
+
+    typedef void (*Debug_Callback)(Debug_Source source, Debug_Type type, GLuint id, Debug_Severity severity,
+                                   GLsizei length, const GLchar *message, const void *user_param);
+
+    // The driver calls the raw GLDEBUGPROC, which hands the typed
+    // arguments to `Callback` without any indirection
+    template <Debug_Callback Callback>
+    struct Debug_Trampoline
+    {
+        static void APIENTRY call(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                  GLsizei length, const GLchar *message, const void *user_param)
+        {
+            Callback(static_cast<Debug_Source>(source), static_cast<Debug_Type>(type), id,
+                     static_cast<Debug_Severity>(severity), length, message, user_param);
+        }
+    };
+
+    // Without DEBUG_OUTPUT_SYNCHRONOUS the driver may call `Callback`
+    // from any of its threads, several at a time
+    template <Debug_Callback Callback>
+    ALWAYS_INLINE void debugMessageCallback(const void *user_param)
+    {
+        GL_HPP_TRACE_CALL(user_param);
+        glDebugMessageCallback(Debug_Trampoline<Callback>::call, user_param);
+        ASSERT_GL_ERROR;
+    }
+
+    // Removes the callback
+    ALWAYS_INLINE void debugMessageCallback(decltype(nullptr))
+    {
+        GL_HPP_TRACE_CALL();
+        glDebugMessageCallback(nullptr, nullptr);
+        ASSERT_GL_ERROR;
+    }
+
+    // The messages that are disabled are dropped inside the driver,
+    // before the callback. DONT_CARE matches everything.
+    ALWAYS_INLINE void debugMessageControl(Debug_Source source, Debug_Type type, Debug_Severity severity,
+                                           bool enabled)
+    {
+        GL_HPP_TRACE_CALL(source, type, severity, enabled);
+        glDebugMessageControl(static_cast<GLenum>(source), static_cast<GLenum>(type),
+                              static_cast<GLenum>(severity), 0, nullptr, enabled ? GL_TRUE : GL_FALSE);
+        ASSERT_GL_ERROR;
+    }
+
+    // Only the messages of the `count` `ids`, which requires a source
+    // and a type and no severity
+    ALWAYS_INLINE void debugMessageControl(Debug_Source source, Debug_Type type,
+                                           GLsizei count, const GLuint *ids, bool enabled)
+    {
+        GL_HPP_TRACE_CALL(source, type, count, ids, enabled);
+        glDebugMessageControl(static_cast<GLenum>(source), static_cast<GLenum>(type), GL_DONT_CARE,
+                              count, ids, enabled ? GL_TRUE : GL_FALSE);
+        ASSERT_GL_ERROR;
+    }
+
+    // `message` is null-terminated. Only APPLICATION and THIRD_PARTY
+    // messages can be inserted.
+    ALWAYS_INLINE void debugMessageInsert(Debug_Source source, Debug_Type type, GLuint id,
+                                          Debug_Severity severity, const GLchar *message)
+    {
+        GL_HPP_TRACE_CALL(source, type, id, severity, message);
+        glDebugMessageInsert(static_cast<GLenum>(source), static_cast<GLenum>(type), id,
+                             static_cast<GLenum>(severity), -1, message);
+        ASSERT_GL_ERROR;
     }
 
     void bindAttribLocation(Program program,
                             Attribute_Location index,
                             const GLchar *name)
     {
+        GL_HPP_TRACE_CALL(program, index, name);
         glBindAttribLocation(program.unwrap,
                              index.unwrap,
                              name);
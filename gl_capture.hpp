@@ -0,0 +1,1104 @@
+#ifndef GL_CAPTURE_HPP
+#define GL_CAPTURE_HPP
+
+// Binary capture of everything gl.hpp sends to the driver, with the
+// data it points to (buffer uploads, shader sources, uniform arrays),
+// so a slow frame can be replayed anywhere with tools/replay instead of
+// shipping the whole program:
+//
+//     #define GL_HPP_CAPTURE
+//     #include "gl_capture.hpp"
+//     #include "gl.hpp"
+//
+//     gl_capture::Capture capture = {};
+//     gl_capture::start(&capture, "frames.glcap", width, height);
+//     while (running) {
+//         ... render ...
+//         gl_capture::end_frame(&capture);
+//     }
+//     gl_capture::stop(&capture);
+//
+// GL_HPP_CAPTURE redirects the entry points that gl.hpp calls (the same
+// ones gl_null.hpp implements) to recorders that call the driver and
+// then append the call to a buffer: the GL calls of the helpers and of
+// the program itself are captured as well, as long as they use these
+// entry points. A full buffer is handed to a background thread that
+// compresses it into the file with zlib, so the file is written while
+// the program runs and the render thread never waits for the disk.
+//
+// Only the calls of the thread that called start are recorded. The
+// debug callback is not: a function pointer means nothing in another
+// process. Vertex attributes and indices must come from buffers, the
+// pointers are recorded as offsets. The framebuffers are not captured,
+// the replay renders into one of `width` by `height`.
+//
+// The same file has the reader that tools/replay uses. Include it after
+// the GL headers (or gl_null.hpp) and before gl.hpp. Link with
+// `pkg-config --libs zlib` and -pthread.
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <zlib.h>
+
+#define GL_CAPTURE_ENTRY_POINTS(X)              \
+    X(glAttachShader)                           \
+    X(glBeginConditionalRender)                 \
+    X(glBeginQuery)                             \
+    X(glBeginTransformFeedback)                 \
+    X(glBindAttribLocation)                     \
+    X(glBindBuffer)                             \
+    X(glBindBufferBase)                         \
+    X(glBindTransformFeedback)                  \
+    X(glBindVertexArray)                        \
+    X(glBufferData)                             \
+    X(glClear)                                  \
+    X(glClearColor)                             \
+    X(glClientWaitSync)                         \
+    X(glColorMask)                              \
+    X(glCompileShader)                          \
+    X(glCreateProgram)                          \
+    X(glCreateShader)                           \
+    X(glDebugMessageControl)                    \
+    X(glDebugMessageInsert)                     \
+    X(glDeleteBuffers)                          \
+    X(glDeleteProgram)                          \
+    X(glDeleteQueries)                          \
+    X(glDeleteShader)                           \
+    X(glDeleteSync)                             \
+    X(glDeleteTransformFeedbacks)               \
+    X(glDeleteVertexArrays)                     \
+    X(glDepthMask)                              \
+    X(glDisable)                                \
+    X(glDrawArrays)                             \
+    X(glDrawElements)                           \
+    X(glDrawElementsBaseVertex)                 \
+    X(glDrawTransformFeedback)                  \
+    X(glEnable)                                 \
+    X(glEnableVertexAttribArray)                \
+    X(glEndConditionalRender)                   \
+    X(glEndQuery)                               \
+    X(glEndTransformFeedback)                   \
+    X(glFenceSync)                              \
+    X(glGenBuffers)                             \
+    X(glGenQueries)                             \
+    X(glGenTransformFeedbacks)                  \
+    X(glGenVertexArrays)                        \
+    X(glGetAttribLocation)                      \
+    X(glGetError)                               \
+    X(glGetProgramInfoLog)                      \
+    X(glGetProgramiv)                           \
+    X(glGetQueryObjectui64v)                    \
+    X(glGetQueryObjectuiv)                      \
+    X(glGetShaderInfoLog)                       \
+    X(glGetShaderiv)                            \
+    X(glGetString)                              \
+    X(glGetSynciv)                              \
+    X(glGetUniformLocation)                     \
+    X(glLinkProgram)                            \
+    X(glPrimitiveRestartIndex)                  \
+    X(glShaderSource)                           \
+    X(glTransformFeedbackVaryings)              \
+    X(glUniform1f)                              \
+    X(glUniform1fv)                             \
+    X(glUniform1i)                              \
+    X(glUniform1iv)                             \
+    X(glUniform1ui)                             \
+    X(glUniform1uiv)                            \
+    X(glUniform2f)                              \
+    X(glUniform2fv)                             \
+    X(glUniform2i)                              \
+    X(glUniform2iv)                             \
+    X(glUniform3f)                              \
+    X(glUniform3fv)                             \
+    X(glUniform3i)                              \
+    X(glUniform3iv)                             \
+    X(glUniform4f)                              \
+    X(glUniform4fv)                             \
+    X(glUniform4i)                              \
+    X(glUniform4iv)                             \
+    X(glUniformMatrix2fv)                       \
+    X(glUniformMatrix3fv)                       \
+    X(glUniformMatrix4fv)                       \
+    X(glUseProgram)                             \
+    X(glVertexAttribIPointer)                   \
+    X(glVertexAttribPointer)                    \
+    X(glWaitSync)
+
+namespace gl_capture
+{
+    // The file is one zlib (gzip) stream: the header, then the records.
+    // A record is its Op in one byte and its arguments. The integers are
+    // LEB128 varints, zigzagged when signed, the floats are their four
+    // bytes, the data is its size as a varint and then the bytes, and
+    // the strings are followed by a zero byte.
+    const char MAGIC[8] = {'G', 'L', 'C', 'A', 'P', 'T', 'U', 'R'};
+    const uint64_t VERSION = 1;
+
+    // Handed to the compression thread once it holds that much
+    const size_t FLUSH_SIZE = 1 << 20;
+
+    enum class Op : uint8_t
+    {
+        // The end of a frame, with its time since start in nanoseconds
+        FRAME,
+#define GL_CAPTURE_OP_ENUM(name) name,
+        GL_CAPTURE_ENTRY_POINTS(GL_CAPTURE_OP_ENUM)
+#undef GL_CAPTURE_OP_ENUM
+        COUNT
+    };
+
+    const char *const op_names[] = {
+        "FRAME",
+#define GL_CAPTURE_OP_NAME(name) #name,
+        GL_CAPTURE_ENTRY_POINTS(GL_CAPTURE_OP_NAME)
+#undef GL_CAPTURE_OP_NAME
+    };
+
+    struct Header
+    {
+        uint64_t version;
+        // Of the framebuffer the capture rendered to
+        uint64_t width;
+        uint64_t height;
+    };
+
+    struct Stats
+    {
+        size_t calls;
+        size_t frames;
+        // Of the buffer uploads, the shader sources, the uniform arrays...
+        size_t data_bytes;
+        // Before compression
+        size_t bytes;
+    };
+
+    struct Capture
+    {
+        gzFile file;
+        uint64_t start_ns;
+        // Only touched by the capturing thread
+        std::vector<unsigned char> buffer;
+        Stats stats;
+
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable wake;
+        // Guarded by mutex
+        std::deque<std::vector<unsigned char>> full;
+        bool stopping;
+        bool failed;
+    };
+
+    // The capture of the calling thread, if it is capturing
+    inline thread_local Capture *current = nullptr;
+
+    inline uint64_t now_ns()
+    {
+        struct timespec ts = {};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+    }
+
+    inline void put_uint(std::vector<unsigned char> *buffer, uint64_t x)
+    {
+        while (x >= 0x80) {
+            buffer->push_back((unsigned char) (x | 0x80));
+            x >>= 7;
+        }
+        buffer->push_back((unsigned char) x);
+    }
+
+    inline void put_int(std::vector<unsigned char> *buffer, int64_t x)
+    {
+        put_uint(buffer, ((uint64_t) x << 1) ^ (uint64_t) (x >> 63));
+    }
+
+    inline void put_float(std::vector<unsigned char> *buffer, float x)
+    {
+        unsigned char bytes[sizeof(x)];
+        memcpy(bytes, &x, sizeof(x));
+        buffer->insert(buffer->end(), bytes, bytes + sizeof(x));
+    }
+
+    inline void put_bytes(Capture *capture, const void *data, size_t size)
+    {
+        put_uint(&capture->buffer, size);
+        const unsigned char *bytes = static_cast<const unsigned char*>(data);
+        capture->buffer.insert(capture->buffer.end(), bytes, bytes + size);
+        capture->stats.data_bytes += size;
+    }
+
+    // `length` < 0 for null-terminated strings, like GL
+    inline void put_string(Capture *capture, const char *s, GLint length)
+    {
+        put_bytes(capture, s, length < 0 ? strlen(s) : (size_t) length);
+        capture->buffer.push_back(0);
+    }
+
+    inline void put(Capture *capture, GLuint x) { put_uint(&capture->buffer, x); }
+    inline void put(Capture *capture, GLint x) { put_int(&capture->buffer, x); }
+    inline void put(Capture *capture, GLboolean x) { put_uint(&capture->buffer, x); }
+    inline void put(Capture *capture, GLfloat x) { put_float(&capture->buffer, x); }
+    inline void put(Capture *capture, uint64_t x) { put_uint(&capture->buffer, x); }
+    inline void put(Capture *capture, int64_t x) { put_int(&capture->buffer, x); }
+    // Sync objects by address, vertex and index pointers by offset
+    inline void put(Capture *capture, const void *p) { put_uint(&capture->buffer, (uint64_t) (uintptr_t) p); }
+
+    inline void compress_thread(Capture *capture)
+    {
+        std::unique_lock<std::mutex> lock(capture->mutex);
+        for (;;) {
+            capture->wake.wait(lock, [&] { return capture->stopping || !capture->full.empty(); });
+            if (capture->full.empty()) break;
+
+            std::vector<unsigned char> buffer = std::move(capture->full.front());
+            capture->full.pop_front();
+            lock.unlock();
+            const bool written = gzwrite(capture->file, buffer.data(), (unsigned) buffer.size()) == (int) buffer.size();
+            lock.lock();
+            if (!written) capture->failed = true;
+        }
+    }
+
+    inline void hand_over(Capture *capture)
+    {
+        if (capture->buffer.empty()) return;
+        capture->stats.bytes += capture->buffer.size();
+        {
+            std::lock_guard<std::mutex> lock(capture->mutex);
+            capture->full.push_back(std::move(capture->buffer));
+        }
+        capture->wake.notify_one();
+        capture->buffer = std::vector<unsigned char>();
+        capture->buffer.reserve(FLUSH_SIZE + FLUSH_SIZE / 4);
+    }
+
+    // The data of the call, if any, goes right after
+    template <typename... Args>
+    void record(Capture *capture, Op op, Args... args)
+    {
+        if (capture->buffer.size() >= FLUSH_SIZE) hand_over(capture);
+        capture->buffer.push_back((unsigned char) op);
+        (put(capture, args), ...);
+        capture->stats.calls += 1;
+    }
+
+    // On the thread that renders, with its context current. `level` is
+    // the zlib one: 1 compresses the fastest, 9 the most.
+    inline bool start(Capture *capture, const char *path, GLuint width, GLuint height, int level = 1)
+    {
+        char mode[] = {'w', 'b', (char) ('0' + level), '\0'};
+        capture->file = gzopen(path, mode);
+        if (!capture->file) return false;
+
+        capture->start_ns = now_ns();
+        capture->buffer.reserve(FLUSH_SIZE + FLUSH_SIZE / 4);
+        capture->buffer.insert(capture->buffer.end(), MAGIC, MAGIC + sizeof(MAGIC));
+        put_uint(&capture->buffer, VERSION);
+        put_uint(&capture->buffer, width);
+        put_uint(&capture->buffer, height);
+
+        capture->thread = std::thread(compress_thread, capture);
+        current = capture;
+        return true;
+    }
+
+    inline void end_frame(Capture *capture)
+    {
+        capture->buffer.push_back((unsigned char) Op::FRAME);
+        put_uint(&capture->buffer, now_ns() - capture->start_ns);
+        capture->stats.frames += 1;
+    }
+
+    // Waits until everything is compressed into the file. Returns false
+    // if it could not be written.
+    inline bool stop(Capture *capture)
+    {
+        if (current == capture) current = nullptr;
+        hand_over(capture);
+        {
+            std::lock_guard<std::mutex> lock(capture->mutex);
+            capture->stopping = true;
+        }
+        capture->wake.notify_one();
+        if (capture->thread.joinable()) capture->thread.join();
+
+        const bool closed = gzclose(capture->file) == Z_OK;
+        capture->file = nullptr;
+        return closed && !capture->failed;
+    }
+
+    // The records are read from memory, so decompressing the file is
+    // not part of what tools/replay measures
+    struct Reader
+    {
+        std::vector<unsigned char> data;
+        size_t pos;
+        // Turns false on the first read past the end
+        bool ok;
+    };
+
+    inline bool at_end(const Reader &reader)
+    {
+        return reader.pos >= reader.data.size();
+    }
+
+    inline uint64_t get_uint(Reader *reader)
+    {
+        uint64_t x = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (at_end(*reader)) {
+                reader->ok = false;
+                return 0;
+            }
+            const unsigned char byte = reader->data[reader->pos++];
+            x |= (uint64_t) (byte & 0x7f) << shift;
+            if (!(byte & 0x80)) return x;
+        }
+        reader->ok = false;
+        return 0;
+    }
+
+    inline int64_t get_int(Reader *reader)
+    {
+        const uint64_t x = get_uint(reader);
+        return (int64_t) (x >> 1) ^ -(int64_t) (x & 1);
+    }
+
+    inline float get_float(Reader *reader)
+    {
+        float x = 0.0f;
+        if (reader->data.size() - reader->pos < sizeof(x)) {
+            reader->ok = false;
+            reader->pos = reader->data.size();
+            return x;
+        }
+        memcpy(&x, &reader->data[reader->pos], sizeof(x));
+        reader->pos += sizeof(x);
+        return x;
+    }
+
+    // Points into the reader
+    inline const unsigned char *get_bytes(Reader *reader, size_t *size)
+    {
+        *size = (size_t) get_uint(reader);
+        if (!reader->ok || reader->data.size() - reader->pos < *size) {
+            reader->ok = false;
+            reader->pos = reader->data.size();
+            *size = 0;
+            return nullptr;
+        }
+        const unsigned char *bytes = &reader->data[reader->pos];
+        reader->pos += *size;
+        return bytes;
+    }
+
+    // Null-terminated, points into the reader
+    inline const GLchar *get_string(Reader *reader, GLint *length = nullptr)
+    {
+        size_t size = 0;
+        const unsigned char *bytes = get_bytes(reader, &size);
+        if (!reader->ok || at_end(*reader) || reader->data[reader->pos] != 0) {
+            reader->ok = false;
+            return "";
+        }
+        reader->pos += 1;
+        if (length) *length = (GLint) size;
+        return reinterpret_cast<const GLchar*>(bytes);
+    }
+
+    // Decompresses the whole file and reads its header
+    inline bool load(Reader *reader, const char *path, Header *header)
+    {
+        gzFile file = gzopen(path, "rb");
+        if (!file) return false;
+
+        reader->data.clear();
+        unsigned char chunk[1 << 16];
+        int size = 0;
+        while ((size = gzread(file, chunk, sizeof(chunk))) > 0) {
+            reader->data.insert(reader->data.end(), chunk, chunk + size);
+        }
+        const bool read = size == 0;
+        gzclose(file);
+        if (!read) return false;
+
+        reader->pos = 0;
+        reader->ok = true;
+        if (reader->data.size() < sizeof(MAGIC) || memcmp(reader->data.data(), MAGIC, sizeof(MAGIC)) != 0) {
+            return false;
+        }
+        reader->pos = sizeof(MAGIC);
+        header->version = get_uint(reader);
+        header->width = get_uint(reader);
+        header->height = get_uint(reader);
+        return reader->ok && header->version == VERSION;
+    }
+}
+
+#ifdef GL_HPP_CAPTURE
+// Every recorder calls the driver first, so the names it returns can be
+// recorded with the call
+namespace gl_capture
+{
+    inline void glAttachShader(GLuint program, GLuint shader)
+    {
+        ::glAttachShader(program, shader);
+        if (Capture *capture = current) record(capture, Op::glAttachShader, program, shader);
+    }
+
+    inline void glBeginConditionalRender(GLuint id, GLenum mode)
+    {
+        ::glBeginConditionalRender(id, mode);
+        if (Capture *capture = current) record(capture, Op::glBeginConditionalRender, id, mode);
+    }
+
+    inline void glBeginQuery(GLenum target, GLuint id)
+    {
+        ::glBeginQuery(target, id);
+        if (Capture *capture = current) record(capture, Op::glBeginQuery, target, id);
+    }
+
+    inline void glBeginTransformFeedback(GLenum primitiveMode)
+    {
+        ::glBeginTransformFeedback(primitiveMode);
+        if (Capture *capture = current) record(capture, Op::glBeginTransformFeedback, primitiveMode);
+    }
+
+    inline void glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+    {
+        ::glBindAttribLocation(program, index, name);
+        if (Capture *capture = current) {
+            record(capture, Op::glBindAttribLocation, program, index);
+            put_string(capture, name, -1);
+        }
+    }
+
+    inline void glBindBuffer(GLenum target, GLuint buffer)
+    {
+        ::glBindBuffer(target, buffer);
+        if (Capture *capture = current) record(capture, Op::glBindBuffer, target, buffer);
+    }
+
+    inline void glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        ::glBindBufferBase(target, index, buffer);
+        if (Capture *capture = current) record(capture, Op::glBindBufferBase, target, index, buffer);
+    }
+
+    inline void glBindTransformFeedback(GLenum target, GLuint id)
+    {
+        ::glBindTransformFeedback(target, id);
+        if (Capture *capture = current) record(capture, Op::glBindTransformFeedback, target, id);
+    }
+
+    inline void glBindVertexArray(GLuint array)
+    {
+        ::glBindVertexArray(array);
+        if (Capture *capture = current) record(capture, Op::glBindVertexArray, array);
+    }
+
+    inline void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+    {
+        ::glBufferData(target, size, data, usage);
+        if (Capture *capture = current) {
+            record(capture, Op::glBufferData, target, (int64_t) size, usage, (GLboolean) (data != nullptr));
+            if (data) put_bytes(capture, data, (size_t) size);
+        }
+    }
+
+    inline void glClear(GLbitfield mask)
+    {
+        ::glClear(mask);
+        if (Capture *capture = current) record(capture, Op::glClear, mask);
+    }
+
+    inline void glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        ::glClearColor(red, green, blue, alpha);
+        if (Capture *capture = current) record(capture, Op::glClearColor, red, green, blue, alpha);
+    }
+
+    inline GLenum glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        const GLenum result = ::glClientWaitSync(sync, flags, timeout);
+        if (Capture *capture = current) {
+            record(capture, Op::glClientWaitSync, (const void*) sync, flags, (uint64_t) timeout);
+        }
+        return result;
+    }
+
+    inline void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+    {
+        ::glColorMask(red, green, blue, alpha);
+        if (Capture *capture = current) record(capture, Op::glColorMask, red, green, blue, alpha);
+    }
+
+    inline void glCompileShader(GLuint shader)
+    {
+        ::glCompileShader(shader);
+        if (Capture *capture = current) record(capture, Op::glCompileShader, shader);
+    }
+
+    inline GLuint glCreateProgram()
+    {
+        const GLuint program = ::glCreateProgram();
+        if (Capture *capture = current) record(capture, Op::glCreateProgram, program);
+        return program;
+    }
+
+    inline GLuint glCreateShader(GLenum type)
+    {
+        const GLuint shader = ::glCreateShader(type);
+        if (Capture *capture = current) record(capture, Op::glCreateShader, type, shader);
+        return shader;
+    }
+
+    inline void glDebugMessageControl(GLenum source, GLenum type, GLenum severity,
+                                      GLsizei count, const GLuint *ids, GLboolean enabled)
+    {
+        ::glDebugMessageControl(source, type, severity, count, ids, enabled);
+        if (Capture *capture = current) {
+            record(capture, Op::glDebugMessageControl, source, type, severity, enabled, count);
+            for (GLsizei i = 0; i < count; ++i) put(capture, ids[i]);
+        }
+    }
+
+    inline void glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                     GLsizei length, const GLchar *buf)
+    {
+        ::glDebugMessageInsert(source, type, id, severity, length, buf);
+        if (Capture *capture = current) {
+            record(capture, Op::glDebugMessageInsert, source, type, id, severity);
+            put_string(capture, buf, length);
+        }
+    }
+
+    // The names of the deleted objects
+    inline void record_names(Capture *capture, Op op, GLsizei n, const GLuint *names)
+    {
+        record(capture, op, n);
+        for (GLsizei i = 0; i < n; ++i) put(capture, names[i]);
+    }
+
+    inline void glDeleteBuffers(GLsizei n, const GLuint *buffers)
+    {
+        ::glDeleteBuffers(n, buffers);
+        if (Capture *capture = current) record_names(capture, Op::glDeleteBuffers, n, buffers);
+    }
+
+    inline void glDeleteProgram(GLuint program)
+    {
+        ::glDeleteProgram(program);
+        if (Capture *capture = current) record(capture, Op::glDeleteProgram, program);
+    }
+
+    inline void glDeleteQueries(GLsizei n, const GLuint *ids)
+    {
+        ::glDeleteQueries(n, ids);
+        if (Capture *capture = current) record_names(capture, Op::glDeleteQueries, n, ids);
+    }
+
+    inline void glDeleteShader(GLuint shader)
+    {
+        ::glDeleteShader(shader);
+        if (Capture *capture = current) record(capture, Op::glDeleteShader, shader);
+    }
+
+    inline void glDeleteSync(GLsync sync)
+    {
+        ::glDeleteSync(sync);
+        if (Capture *capture = current) record(capture, Op::glDeleteSync, (const void*) sync);
+    }
+
+    inline void glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
+    {
+        ::glDeleteTransformFeedbacks(n, ids);
+        if (Capture *capture = current) record_names(capture, Op::glDeleteTransformFeedbacks, n, ids);
+    }
+
+    inline void glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+    {
+        ::glDeleteVertexArrays(n, arrays);
+        if (Capture *capture = current) record_names(capture, Op::glDeleteVertexArrays, n, arrays);
+    }
+
+    inline void glDepthMask(GLboolean flag)
+    {
+        ::glDepthMask(flag);
+        if (Capture *capture = current) record(capture, Op::glDepthMask, flag);
+    }
+
+    inline void glDisable(GLenum cap)
+    {
+        ::glDisable(cap);
+        if (Capture *capture = current) record(capture, Op::glDisable, cap);
+    }
+
+    inline void glDrawArrays(GLenum mode, GLint first, GLsizei count)
+    {
+        ::glDrawArrays(mode, first, count);
+        if (Capture *capture = current) record(capture, Op::glDrawArrays, mode, first, count);
+    }
+
+    inline void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+    {
+        ::glDrawElements(mode, count, type, indices);
+        if (Capture *capture = current) record(capture, Op::glDrawElements, mode, count, type, indices);
+    }
+
+    inline void glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices,
+                                         GLint basevertex)
+    {
+        ::glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+        if (Capture *capture = current) {
+            record(capture, Op::glDrawElementsBaseVertex, mode, count, type, indices, basevertex);
+        }
+    }
+
+    inline void glDrawTransformFeedback(GLenum mode, GLuint id)
+    {
+        ::glDrawTransformFeedback(mode, id);
+        if (Capture *capture = current) record(capture, Op::glDrawTransformFeedback, mode, id);
+    }
+
+    inline void glEnable(GLenum cap)
+    {
+        ::glEnable(cap);
+        if (Capture *capture = current) record(capture, Op::glEnable, cap);
+    }
+
+    inline void glEnableVertexAttribArray(GLuint index)
+    {
+        ::glEnableVertexAttribArray(index);
+        if (Capture *capture = current) record(capture, Op::glEnableVertexAttribArray, index);
+    }
+
+    inline void glEndConditionalRender()
+    {
+        ::glEndConditionalRender();
+        if (Capture *capture = current) record(capture, Op::glEndConditionalRender);
+    }
+
+    inline void glEndQuery(GLenum target)
+    {
+        ::glEndQuery(target);
+        if (Capture *capture = current) record(capture, Op::glEndQuery, target);
+    }
+
+    inline void glEndTransformFeedback()
+    {
+        ::glEndTransformFeedback();
+        if (Capture *capture = current) record(capture, Op::glEndTransformFeedback);
+    }
+
+    inline GLsync glFenceSync(GLenum condition, GLbitfield flags)
+    {
+        GLsync sync = ::glFenceSync(condition, flags);
+        if (Capture *capture = current) record(capture, Op::glFenceSync, condition, flags, (const void*) sync);
+        return sync;
+    }
+
+    inline void glGenBuffers(GLsizei n, GLuint *buffers)
+    {
+        ::glGenBuffers(n, buffers);
+        if (Capture *capture = current) record_names(capture, Op::glGenBuffers, n, buffers);
+    }
+
+    inline void glGenQueries(GLsizei n, GLuint *ids)
+    {
+        ::glGenQueries(n, ids);
+        if (Capture *capture = current) record_names(capture, Op::glGenQueries, n, ids);
+    }
+
+    inline void glGenTransformFeedbacks(GLsizei n, GLuint *ids)
+    {
+        ::glGenTransformFeedbacks(n, ids);
+        if (Capture *capture = current) record_names(capture, Op::glGenTransformFeedbacks, n, ids);
+    }
+
+    inline void glGenVertexArrays(GLsizei n, GLuint *arrays)
+    {
+        ::glGenVertexArrays(n, arrays);
+        if (Capture *capture = current) record_names(capture, Op::glGenVertexArrays, n, arrays);
+    }
+
+    inline GLint glGetAttribLocation(GLuint program, const GLchar *name)
+    {
+        const GLint location = ::glGetAttribLocation(program, name);
+        if (Capture *capture = current) {
+            record(capture, Op::glGetAttribLocation, program);
+            put_string(capture, name, -1);
+        }
+        return location;
+    }
+
+    inline GLenum glGetError()
+    {
+        const GLenum error = ::glGetError();
+        if (Capture *capture = current) record(capture, Op::glGetError);
+        return error;
+    }
+
+    // The queries are replayed too: they are what makes a frame wait
+    // for the GPU
+    inline void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+    {
+        ::glGetProgramInfoLog(program, bufSize, length, infoLog);
+        if (Capture *capture = current) record(capture, Op::glGetProgramInfoLog, program, bufSize);
+    }
+
+    inline void glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+    {
+        ::glGetProgramiv(program, pname, params);
+        if (Capture *capture = current) record(capture, Op::glGetProgramiv, program, pname);
+    }
+
+    inline void glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+    {
+        ::glGetQueryObjectui64v(id, pname, params);
+        if (Capture *capture = current) record(capture, Op::glGetQueryObjectui64v, id, pname);
+    }
+
+    inline void glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+    {
+        ::glGetQueryObjectuiv(id, pname, params);
+        if (Capture *capture = current) record(capture, Op::glGetQueryObjectuiv, id, pname);
+    }
+
+    inline void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+    {
+        ::glGetShaderInfoLog(shader, bufSize, length, infoLog);
+        if (Capture *capture = current) record(capture, Op::glGetShaderInfoLog, shader, bufSize);
+    }
+
+    inline void glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+    {
+        ::glGetShaderiv(shader, pname, params);
+        if (Capture *capture = current) record(capture, Op::glGetShaderiv, shader, pname);
+    }
+
+    inline const GLubyte *glGetString(GLenum name)
+    {
+        const GLubyte *string = ::glGetString(name);
+        if (Capture *capture = current) record(capture, Op::glGetString, name);
+        return string;
+    }
+
+    inline void glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
+    {
+        ::glGetSynciv(sync, pname, count, length, values);
+        if (Capture *capture = current) record(capture, Op::glGetSynciv, (const void*) sync, pname, count);
+    }
+
+    // With the location it returned: the replay maps it to the one its
+    // driver returns
+    inline GLint glGetUniformLocation(GLuint program, const GLchar *name)
+    {
+        const GLint location = ::glGetUniformLocation(program, name);
+        if (Capture *capture = current) {
+            record(capture, Op::glGetUniformLocation, program, location);
+            put_string(capture, name, -1);
+        }
+        return location;
+    }
+
+    inline void glLinkProgram(GLuint program)
+    {
+        ::glLinkProgram(program);
+        if (Capture *capture = current) record(capture, Op::glLinkProgram, program);
+    }
+
+    inline void glPrimitiveRestartIndex(GLuint index)
+    {
+        ::glPrimitiveRestartIndex(index);
+        if (Capture *capture = current) record(capture, Op::glPrimitiveRestartIndex, index);
+    }
+
+    inline void glShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length)
+    {
+        ::glShaderSource(shader, count, string, length);
+        if (Capture *capture = current) {
+            record(capture, Op::glShaderSource, shader, count);
+            for (GLsizei i = 0; i < count; ++i) put_string(capture, string[i], length ? length[i] : -1);
+        }
+    }
+
+    inline void glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const *varyings,
+                                            GLenum bufferMode)
+    {
+        ::glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+        if (Capture *capture = current) {
+            record(capture, Op::glTransformFeedbackVaryings, program, bufferMode, count);
+            for (GLsizei i = 0; i < count; ++i) put_string(capture, varyings[i], -1);
+        }
+    }
+
+    inline void glUniform1f(GLint location, GLfloat v0)
+    {
+        ::glUniform1f(location, v0);
+        if (Capture *capture = current) record(capture, Op::glUniform1f, location, v0);
+    }
+
+    inline void glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+    {
+        ::glUniform2f(location, v0, v1);
+        if (Capture *capture = current) record(capture, Op::glUniform2f, location, v0, v1);
+    }
+
+    inline void glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+    {
+        ::glUniform3f(location, v0, v1, v2);
+        if (Capture *capture = current) record(capture, Op::glUniform3f, location, v0, v1, v2);
+    }
+
+    inline void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+    {
+        ::glUniform4f(location, v0, v1, v2, v3);
+        if (Capture *capture = current) record(capture, Op::glUniform4f, location, v0, v1, v2, v3);
+    }
+
+    inline void glUniform1i(GLint location, GLint v0)
+    {
+        ::glUniform1i(location, v0);
+        if (Capture *capture = current) record(capture, Op::glUniform1i, location, v0);
+    }
+
+    inline void glUniform2i(GLint location, GLint v0, GLint v1)
+    {
+        ::glUniform2i(location, v0, v1);
+        if (Capture *capture = current) record(capture, Op::glUniform2i, location, v0, v1);
+    }
+
+    inline void glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+    {
+        ::glUniform3i(location, v0, v1, v2);
+        if (Capture *capture = current) record(capture, Op::glUniform3i, location, v0, v1, v2);
+    }
+
+    inline void glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+    {
+        ::glUniform4i(location, v0, v1, v2, v3);
+        if (Capture *capture = current) record(capture, Op::glUniform4i, location, v0, v1, v2, v3);
+    }
+
+    inline void glUniform1ui(GLint location, GLuint v0)
+    {
+        ::glUniform1ui(location, v0);
+        if (Capture *capture = current) record(capture, Op::glUniform1ui, location, v0);
+    }
+
+    // The arrays are recorded as their bytes, `components` values per
+    // element
+    template <typename T>
+    void record_values(Capture *capture, Op op, GLint location, GLsizei count, size_t components,
+                       const T *values)
+    {
+        record(capture, op, location, count);
+        put_bytes(capture, values, (size_t) count * components * sizeof(T));
+    }
+
+    inline void glUniform1fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        ::glUniform1fv(location, count, value);
+        if (Capture *capture = current) record_values(capture, Op::glUniform1fv, location, count, 1, value);
+    }
+
+    inline void glUniform2fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        ::glUniform2fv(location, count, value);
+        if (Capture *capture = current) record_values(capture, Op::glUniform2fv, location, count, 2, value);
+    }
+
+    inline void glUniform3fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        ::glUniform3fv(location, count, value);
+        if (Capture *capture = current) record_values(capture, Op::glUniform3fv, location, count, 3, value);
+    }
+
+    inline void glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        ::glUniform4fv(location, count, value);
+        if (Capture *capture = current) record_values(capture, Op::glUniform4fv, location, count, 4, value);
+    }
+
+    inline void glUniform1iv(GLint location, GLsizei count, const GLint *value)
+    {
+        ::glUniform1iv(location, count, value);
+        if (Capture *capture = current) record_values(capture, Op::glUniform1iv, location, count, 1, value);
+    }
+
+    inline void glUniform2iv(GLint location, GLsizei count, const GLint *value)
+    {
+        ::glUniform2iv(location, count, value);
+        if (Capture *capture = current) record_values(capture, Op::glUniform2iv, location, count, 2, value);
+    }
+
+    inline void glUniform3iv(GLint location, GLsizei count, const GLint *value)
+    {
+        ::glUniform3iv(location, count, value);
+        if (Capture *capture = current) record_values(capture, Op::glUniform3iv, location, count, 3, value);
+    }
+
+    inline void glUniform4iv(GLint location, GLsizei count, const GLint *value)
+    {
+        ::glUniform4iv(location, count, value);
+        if (Capture *capture = current) record_values(capture, Op::glUniform4iv, location, count, 4, value);
+    }
+
+    inline void glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
+    {
+        ::glUniform1uiv(location, count, value);
+        if (Capture *capture = current) record_values(capture, Op::glUniform1uiv, location, count, 1, value);
+    }
+
+    inline void glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        ::glUniformMatrix2fv(location, count, transpose, value);
+        if (Capture *capture = current) {
+            record(capture, Op::glUniformMatrix2fv, location, count, transpose);
+            put_bytes(capture, value, (size_t) count * 4 * sizeof(GLfloat));
+        }
+    }
+
+    inline void glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        ::glUniformMatrix3fv(location, count, transpose, value);
+        if (Capture *capture = current) {
+            record(capture, Op::glUniformMatrix3fv, location, count, transpose);
+            put_bytes(capture, value, (size_t) count * 9 * sizeof(GLfloat));
+        }
+    }
+
+    inline void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        ::glUniformMatrix4fv(location, count, transpose, value);
+        if (Capture *capture = current) {
+            record(capture, Op::glUniformMatrix4fv, location, count, transpose);
+            put_bytes(capture, value, (size_t) count * 16 * sizeof(GLfloat));
+        }
+    }
+
+    inline void glUseProgram(GLuint program)
+    {
+        ::glUseProgram(program);
+        if (Capture *capture = current) record(capture, Op::glUseProgram, program);
+    }
+
+    inline void glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        ::glVertexAttribIPointer(index, size, type, stride, pointer);
+        if (Capture *capture = current) {
+            record(capture, Op::glVertexAttribIPointer, index, size, type, stride, pointer);
+        }
+    }
+
+    inline void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized,
+                                      GLsizei stride, const void *pointer)
+    {
+        ::glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+        if (Capture *capture = current) {
+            record(capture, Op::glVertexAttribPointer, index, size, type, normalized, stride, pointer);
+        }
+    }
+
+    inline void glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        ::glWaitSync(sync, flags, timeout);
+        if (Capture *capture = current) {
+            record(capture, Op::glWaitSync, (const void*) sync, flags, (uint64_t) timeout);
+        }
+    }
+}
+
+#define glAttachShader gl_capture::glAttachShader
+#define glBeginConditionalRender gl_capture::glBeginConditionalRender
+#define glBeginQuery gl_capture::glBeginQuery
+#define glBeginTransformFeedback gl_capture::glBeginTransformFeedback
+#define glBindAttribLocation gl_capture::glBindAttribLocation
+#define glBindBuffer gl_capture::glBindBuffer
+#define glBindBufferBase gl_capture::glBindBufferBase
+#define glBindTransformFeedback gl_capture::glBindTransformFeedback
+#define glBindVertexArray gl_capture::glBindVertexArray
+#define glBufferData gl_capture::glBufferData
+#define glClear gl_capture::glClear
+#define glClearColor gl_capture::glClearColor
+#define glClientWaitSync gl_capture::glClientWaitSync
+#define glColorMask gl_capture::glColorMask
+#define glCompileShader gl_capture::glCompileShader
+#define glCreateProgram gl_capture::glCreateProgram
+#define glCreateShader gl_capture::glCreateShader
+#define glDebugMessageControl gl_capture::glDebugMessageControl
+#define glDebugMessageInsert gl_capture::glDebugMessageInsert
+#define glDeleteBuffers gl_capture::glDeleteBuffers
+#define glDeleteProgram gl_capture::glDeleteProgram
+#define glDeleteQueries gl_capture::glDeleteQueries
+#define glDeleteShader gl_capture::glDeleteShader
+#define glDeleteSync gl_capture::glDeleteSync
+#define glDeleteTransformFeedbacks gl_capture::glDeleteTransformFeedbacks
+#define glDeleteVertexArrays gl_capture::glDeleteVertexArrays
+#define glDepthMask gl_capture::glDepthMask
+#define glDisable gl_capture::glDisable
+#define glDrawArrays gl_capture::glDrawArrays
+#define glDrawElements gl_capture::glDrawElements
+#define glDrawElementsBaseVertex gl_capture::glDrawElementsBaseVertex
+#define glDrawTransformFeedback gl_capture::glDrawTransformFeedback
+#define glEnable gl_capture::glEnable
+#define glEnableVertexAttribArray gl_capture::glEnableVertexAttribArray
+#define glEndConditionalRender gl_capture::glEndConditionalRender
+#define glEndQuery gl_capture::glEndQuery
+#define glEndTransformFeedback gl_capture::glEndTransformFeedback
+#define glFenceSync gl_capture::glFenceSync
+#define glGenBuffers gl_capture::glGenBuffers
+#define glGenQueries gl_capture::glGenQueries
+#define glGenTransformFeedbacks gl_capture::glGenTransformFeedbacks
+#define glGenVertexArrays gl_capture::glGenVertexArrays
+#define glGetAttribLocation gl_capture::glGetAttribLocation
+#define glGetError gl_capture::glGetError
+#define glGetProgramInfoLog gl_capture::glGetProgramInfoLog
+#define glGetProgramiv gl_capture::glGetProgramiv
+#define glGetQueryObjectui64v gl_capture::glGetQueryObjectui64v
+#define glGetQueryObjectuiv gl_capture::glGetQueryObjectuiv
+#define glGetShaderInfoLog gl_capture::glGetShaderInfoLog
+#define glGetShaderiv gl_capture::glGetShaderiv
+#define glGetString gl_capture::glGetString
+#define glGetSynciv gl_capture::glGetSynciv
+#define glGetUniformLocation gl_capture::glGetUniformLocation
+#define glLinkProgram gl_capture::glLinkProgram
+#define glPrimitiveRestartIndex gl_capture::glPrimitiveRestartIndex
+#define glShaderSource gl_capture::glShaderSource
+#define glTransformFeedbackVaryings gl_capture::glTransformFeedbackVaryings
+#define glUniform1f gl_capture::glUniform1f
+#define glUniform1fv gl_capture::glUniform1fv
+#define glUniform1i gl_capture::glUniform1i
+#define glUniform1iv gl_capture::glUniform1iv
+#define glUniform1ui gl_capture::glUniform1ui
+#define glUniform1uiv gl_capture::glUniform1uiv
+#define glUniform2f gl_capture::glUniform2f
+#define glUniform2fv gl_capture::glUniform2fv
+#define glUniform2i gl_capture::glUniform2i
+#define glUniform2iv gl_capture::glUniform2iv
+#define glUniform3f gl_capture::glUniform3f
+#define glUniform3fv gl_capture::glUniform3fv
+#define glUniform3i gl_capture::glUniform3i
+#define glUniform3iv gl_capture::glUniform3iv
+#define glUniform4f gl_capture::glUniform4f
+#define glUniform4fv gl_capture::glUniform4fv
+#define glUniform4i gl_capture::glUniform4i
+#define glUniform4iv gl_capture::glUniform4iv
+#define glUniformMatrix2fv gl_capture::glUniformMatrix2fv
+#define glUniformMatrix3fv gl_capture::glUniformMatrix3fv
+#define glUniformMatrix4fv gl_capture::glUniformMatrix4fv
+#define glUseProgram gl_capture::glUseProgram
+#define glVertexAttribIPointer gl_capture::glVertexAttribIPointer
+#define glVertexAttribPointer gl_capture::glVertexAttribPointer
+#define glWaitSync gl_capture::glWaitSync
+#endif  // GL_HPP_CAPTURE
+
+#endif  // GL_CAPTURE_HPP
@@ -0,0 +1,341 @@
+#ifndef GL_DEBUG_HPP
+#define GL_DEBUG_HPP
+
+// Debug output that stays cheap when the driver is chatty.
+//
+// The messages below the minimum severity are disabled with
+// debugMessageControl, so the driver drops them before they are even
+// formatted. The callback only copies what is left into a lock-free
+// ring and returns: no lock, no allocation and no I/O on the driver
+// threads. A background thread drains the ring, prints every distinct
+// message once and counts the repeats, and prints at most
+// `max_per_second` messages a second, counting the rest.
+//
+//     gl_debug::Log log = {};
+//     gl_debug::start(&log, gl::Debug_Severity::MEDIUM);
+//     ... render ...
+//     gl_debug::stop(&log);
+//     gl_debug::Stats stats = gl_debug::stats(log);
+//
+// The ring never blocks either: when the driver outruns the drain
+// thread the messages that do not fit are counted as dropped.
+//
+// Needs GL 4.3 or KHR_debug. Include it after the GL headers and gl.hpp.
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace gl_debug
+{
+    // Longer messages are truncated
+    const size_t MESSAGE_SIZE = 256;
+
+    // How often the drain thread looks into the ring
+    const std::chrono::milliseconds DRAIN_INTERVAL(10);
+
+    struct Message
+    {
+        gl::Debug_Source source;
+        gl::Debug_Type type;
+        gl::Debug_Severity severity;
+        GLuint id;
+        // Null-terminated
+        char text[MESSAGE_SIZE];
+    };
+
+    // A bounded multi-producer queue with a sequence number per cell
+    // (D. Vyukov's): the cell at position `pos` is free for the writer
+    // that claims `pos` when its sequence is `pos`, and holds a message
+    // for the reader when it is `pos + 1`.
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        Message message;
+    };
+
+    struct Stats
+    {
+        // Messages the callback got, the driver filtered the rest out
+        size_t received;
+        // The ring was full
+        size_t dropped;
+        size_t printed;
+        // Seen before, only counted
+        size_t duplicates;
+        // Over max_per_second, only counted
+        size_t rate_limited;
+    };
+
+    struct Seen
+    {
+        Message message;
+        size_t repeats;
+    };
+
+    struct Log
+    {
+        std::unique_ptr<Cell[]> cells;
+        size_t mask;
+        // The next position to write, claimed by the driver threads
+        alignas(64) std::atomic<size_t> head;
+        // The next position to read, only touched by the drain thread
+        alignas(64) size_t tail;
+
+        std::atomic<size_t> received;
+        std::atomic<size_t> dropped;
+        std::atomic<size_t> printed;
+        std::atomic<size_t> duplicates;
+        std::atomic<size_t> rate_limited;
+
+        // Only touched by the drain thread
+        FILE *out;
+        size_t max_per_second;
+        std::unordered_map<std::string, Seen> seen;
+        std::chrono::steady_clock::time_point window_start;
+        size_t window_printed;
+        size_t window_limited;
+
+        std::thread thread;
+        std::atomic<bool> stopping;
+    };
+
+    inline const char *source_name(gl::Debug_Source source)
+    {
+        switch (source) {
+        case gl::Debug_Source::API: return "api";
+        case gl::Debug_Source::WINDOW_SYSTEM: return "window system";
+        case gl::Debug_Source::SHADER_COMPILER: return "shader compiler";
+        case gl::Debug_Source::THIRD_PARTY: return "third party";
+        case gl::Debug_Source::APPLICATION: return "application";
+        case gl::Debug_Source::OTHER: return "other";
+        case gl::Debug_Source::DONT_CARE: break;
+        }
+        return "?";
+    }
+
+    inline const char *type_name(gl::Debug_Type type)
+    {
+        switch (type) {
+        case gl::Debug_Type::ERROR: return "error";
+        case gl::Debug_Type::DEPRECATED_BEHAVIOR: return "deprecated";
+        case gl::Debug_Type::UNDEFINED_BEHAVIOR: return "undefined behavior";
+        case gl::Debug_Type::PORTABILITY: return "portability";
+        case gl::Debug_Type::PERFORMANCE: return "performance";
+        case gl::Debug_Type::MARKER: return "marker";
+        case gl::Debug_Type::PUSH_GROUP: return "push group";
+        case gl::Debug_Type::POP_GROUP: return "pop group";
+        case gl::Debug_Type::OTHER: return "other";
+        case gl::Debug_Type::DONT_CARE: break;
+        }
+        return "?";
+    }
+
+    inline const char *severity_name(gl::Debug_Severity severity)
+    {
+        switch (severity) {
+        case gl::Debug_Severity::HIGH: return "high";
+        case gl::Debug_Severity::MEDIUM: return "medium";
+        case gl::Debug_Severity::LOW: return "low";
+        case gl::Debug_Severity::NOTIFICATION: return "notification";
+        case gl::Debug_Severity::DONT_CARE: break;
+        }
+        return "?";
+    }
+
+    // Disables every message below `min_severity` inside the driver
+    inline void filter(gl::Debug_Severity min_severity)
+    {
+        const gl::Debug_Severity severities[] = {
+            gl::Debug_Severity::HIGH,
+            gl::Debug_Severity::MEDIUM,
+            gl::Debug_Severity::LOW,
+            gl::Debug_Severity::NOTIFICATION,
+        };
+
+        gl::debugMessageControl(gl::Debug_Source::DONT_CARE, gl::Debug_Type::DONT_CARE,
+                                gl::Debug_Severity::DONT_CARE, false);
+        for (auto severity : severities) {
+            gl::debugMessageControl(gl::Debug_Source::DONT_CARE, gl::Debug_Type::DONT_CARE, severity, true);
+            if (severity == min_severity) break;
+        }
+    }
+
+    // The debug callback, on whatever thread the driver calls it from
+    inline void receive(gl::Debug_Source source, gl::Debug_Type type, GLuint id, gl::Debug_Severity severity,
+                        GLsizei length, const GLchar *text, const void *user_param)
+    {
+        Log *log = static_cast<Log*>(const_cast<void*>(user_param));
+        log->received.fetch_add(1, std::memory_order_relaxed);
+
+        Cell *cell = nullptr;
+        size_t pos = log->head.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &log->cells[pos & log->mask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<ptrdiff_t>(sequence - pos);
+            if (diff == 0) {
+                if (log->head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                // Still holds the message of the previous lap
+                log->dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                pos = log->head.load(std::memory_order_relaxed);
+            }
+        }
+
+        Message *message = &cell->message;
+        message->source = source;
+        message->type = type;
+        message->severity = severity;
+        message->id = id;
+        const size_t size = length < 0 ? strlen(text) : static_cast<size_t>(length);
+        const size_t copied = size < MESSAGE_SIZE - 1 ? size : MESSAGE_SIZE - 1;
+        memcpy(message->text, text, copied);
+        message->text[copied] = '\0';
+
+        cell->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    // Only on the drain thread
+    inline bool pop(Log *log, Message *message)
+    {
+        Cell *cell = &log->cells[log->tail & log->mask];
+        if (cell->sequence.load(std::memory_order_acquire) != log->tail + 1) return false;
+
+        *message = cell->message;
+        cell->sequence.store(log->tail + log->mask + 1, std::memory_order_release);
+        log->tail += 1;
+        return true;
+    }
+
+    inline void print(Log *log, const Message &message)
+    {
+        fprintf(log->out, "GL %s %s %s %u: %s\n",
+                source_name(message.source), type_name(message.type), severity_name(message.severity),
+                message.id, message.text);
+    }
+
+    // Reports the messages the last window held back
+    inline void close_window(Log *log)
+    {
+        if (log->window_limited > 0) {
+            fprintf(log->out, "GL debug: %zu more messages in the last second were not printed\n",
+                    log->window_limited);
+        }
+        log->window_start = std::chrono::steady_clock::now();
+        log->window_printed = 0;
+        log->window_limited = 0;
+    }
+
+    inline void handle(Log *log, const Message &message)
+    {
+        std::string key(reinterpret_cast<const char*>(&message.id), sizeof(message.id));
+        key += static_cast<char>(message.source);
+        key += static_cast<char>(message.type);
+        key += static_cast<char>(message.severity);
+        key += message.text;
+
+        auto it = log->seen.find(key);
+        if (it != log->seen.end()) {
+            it->second.repeats += 1;
+            log->duplicates.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        log->seen.emplace(std::move(key), Seen {message, 0});
+
+        if (std::chrono::steady_clock::now() - log->window_start >= std::chrono::seconds(1)) {
+            close_window(log);
+        }
+        if (log->window_printed >= log->max_per_second) {
+            log->window_limited += 1;
+            log->rate_limited.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        print(log, message);
+        log->window_printed += 1;
+        log->printed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    inline void drain(Log *log)
+    {
+        Message message;
+        while (pop(log, &message)) handle(log, message);
+    }
+
+    inline void drain_thread(Log *log)
+    {
+        while (!log->stopping.load(std::memory_order_acquire)) {
+            drain(log);
+            std::this_thread::sleep_for(DRAIN_INTERVAL);
+        }
+        drain(log);
+    }
+
+    // Installs the callback on the current context and enables
+    // DEBUG_OUTPUT. `capacity` is rounded up to a power of two.
+    inline void start(Log *log,
+                      gl::Debug_Severity min_severity = gl::Debug_Severity::MEDIUM,
+                      size_t max_per_second = 20,
+                      FILE *out = stderr,
+                      size_t capacity = 1024)
+    {
+        size_t size = 1;
+        while (size < capacity) size *= 2;
+        log->cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) {
+            log->cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        log->mask = size - 1;
+        log->out = out;
+        log->max_per_second = max_per_second;
+        log->window_start = std::chrono::steady_clock::now();
+        log->thread = std::thread(drain_thread, log);
+
+        filter(min_severity);
+        gl::debugMessageCallback<receive>(log);
+        gl::enable(gl::Capability::DEBUG_OUTPUT);
+    }
+
+    // Removes the callback, prints what is left in the ring and how many
+    // times every repeated message came again
+    inline void stop(Log *log)
+    {
+        gl::disable(gl::Capability::DEBUG_OUTPUT);
+        gl::debugMessageCallback(nullptr);
+
+        if (log->thread.joinable()) {
+            log->stopping.store(true, std::memory_order_release);
+            log->thread.join();
+        }
+        close_window(log);
+
+        for (const auto &seen : log->seen) {
+            if (seen.second.repeats == 0) continue;
+            fprintf(log->out, "GL debug: %zu more times: ", seen.second.repeats);
+            print(log, seen.second.message);
+        }
+    }
+
+    // From any thread
+    inline Stats stats(const Log &log)
+    {
+        Stats result = {};
+        result.received = log.received.load(std::memory_order_relaxed);
+        result.dropped = log.dropped.load(std::memory_order_relaxed);
+        result.printed = log.printed.load(std::memory_order_relaxed);
+        result.duplicates = log.duplicates.load(std::memory_order_relaxed);
+        result.rate_limited = log.rate_limited.load(std::memory_order_relaxed);
+        return result;
+    }
+}
+
+#endif  // GL_DEBUG_HPP
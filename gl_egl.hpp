@@ -0,0 +1,113 @@
+#ifndef GL_EGL_HPP
+#define GL_EGL_HPP
+
+// Headless OpenGL context through EGL_MESA_platform_surfaceless. No
+// window system is needed, so it works on render farm nodes and CI
+// machines (with Mesa llvmpipe if there is no GPU). Rendering goes
+// into framebuffer objects since there is no default framebuffer.
+//
+// Shared contexts see the objects of the context they were created
+// with, so worker threads can create them in the background (see
+// gl_worker.hpp). Every context is current on at most one thread.
+//
+// Include it after the GL headers and gl.hpp. Link with
+// `pkg-config --libs egl opengl`.
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+namespace gl_egl
+{
+    struct Context
+    {
+        EGLDisplay display;
+        EGLContext context;
+    };
+
+    // EGL_KHR_no_config_context: surfaceless contexts do not need a config
+    inline EGLContext create_context(EGLDisplay display, EGLContext share, EGLint major, EGLint minor)
+    {
+        const EGLint attribs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, major,
+            EGL_CONTEXT_MINOR_VERSION, minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+            EGL_NONE
+        };
+        return eglCreateContext(display, EGL_NO_CONFIG_KHR, share, attribs);
+    }
+
+    inline Maybe<Context> create_headless_context(EGLint major, EGLint minor)
+    {
+        auto getPlatformDisplay =
+            reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+                eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (!getPlatformDisplay) return {};
+
+        EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        if (display == EGL_NO_DISPLAY) return {};
+
+        if (!eglInitialize(display, NULL, NULL)) return {};
+
+        if (!eglBindAPI(EGL_OPENGL_API)) {
+            eglTerminate(display);
+            return {};
+        }
+
+        EGLContext context = create_context(display, EGL_NO_CONTEXT, major, minor);
+        if (context == EGL_NO_CONTEXT) {
+            eglTerminate(display);
+            return {};
+        }
+
+        if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+            eglDestroyContext(display, context);
+            eglTerminate(display);
+            return {};
+        }
+
+        return {true, {display, context}};
+    }
+
+    inline void destroy_context(Context context)
+    {
+        eglMakeCurrent(context.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(context.display, context.context);
+        eglTerminate(context.display);
+    }
+
+    // Shares the objects of `share`. It is not made current: that is up
+    // to the thread that is going to use it.
+    inline Maybe<Context> create_shared_context(Context share, EGLint major, EGLint minor)
+    {
+        EGLContext context = create_context(share.display, share.context, major, minor);
+        if (context == EGL_NO_CONTEXT) return {};
+        return {true, {share.display, context}};
+    }
+
+    // Release it on its thread first. Destroy the shared contexts before
+    // the context they share with.
+    inline void destroy_shared_context(Context context)
+    {
+        eglDestroyContext(context.display, context.context);
+    }
+
+    inline bool make_current(Context context)
+    {
+        return eglMakeCurrent(context.display, EGL_NO_SURFACE, EGL_NO_SURFACE, context.context);
+    }
+
+    // Makes no context current on the calling thread
+    inline void release_current(Context context)
+    {
+        eglMakeCurrent(context.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    }
+
+    // Current contexts are per thread, so asserting this before the GL
+    // calls catches the ones made on the wrong thread
+    inline bool is_current(Context context)
+    {
+        return eglGetCurrentContext() == context.context;
+    }
+}
+
+#endif  // GL_EGL_HPP
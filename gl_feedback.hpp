@@ -0,0 +1,154 @@
+#ifndef GL_FEEDBACK_HPP
+#define GL_FEEDBACK_HPP
+
+// Ping-pong buffers for simulations that live on the GPU: every step
+// runs a vertex shader over the vertices of one buffer and captures
+// its outputs into the other one with transform feedback, so the state
+// is never read back or uploaded again.
+//
+//     const GLchar *const varyings[] = {"out_position", "out_velocity"};
+//     gl::transformFeedbackVaryings(step_program, varyings,
+//                                   gl::Transform_Feedback_Buffer_Mode::INTERLEAVED_ATTRIBS);
+//     gl::linkProgram(step_program);
+//
+//     auto particles = gl_feedback::create_ping_pong(size, initial, count, [&](gl::Buffer) {
+//         ... vertexAttribPointer of the layout the varyings write ...
+//     });
+//     while (running) {
+//         gl::useProgram(step_program);
+//         gl_feedback::step(&particles);
+//         gl::useProgram(render_program);
+//         gl_feedback::draw(particles, gl::Draw_Mode::POINTS);
+//     }
+//     gl_feedback::destroy(&particles);
+//
+// The varyings are captured interleaved into binding point 0, in the
+// same layout the attributes read them. With GL 4.0 transform feedback
+// objects the draws take their vertex count from the last capture, so
+// a geometry shader may also add or drop vertices.
+//
+// Include it after the GL headers and gl.hpp.
+
+#include <cstdio>
+
+namespace gl_feedback
+{
+    // Transform feedback objects and drawTransformFeedback are GL 4.0
+    inline bool has_feedback_objects()
+    {
+        auto version = reinterpret_cast<const char*>(gl::getString(gl::String_Name::VERSION));
+        int major = 0;
+        return version && sscanf(version, "%d", &major) == 1 && major >= 4;
+    }
+
+    struct Ping_Pong
+    {
+        gl::Buffer buffers[2];
+        // vertex_arrays[i] reads buffers[i]
+        gl::Vertex_Array vertex_arrays[2];
+        // feedbacks[i] captures into buffers[i]
+        bool feedback_objects;
+        gl::Transform_Feedback feedbacks[2];
+        // The buffer with the latest state
+        size_t current;
+        GLsizei vertex_count;
+        // Whether the current buffer was captured by a step, which is
+        // when its feedback object knows how many vertices it holds
+        bool captured;
+    };
+
+    // `setup_attributes(buffer)` is called once per buffer with the
+    // buffer bound to ARRAY in the vertex array that reads it
+    template <typename Setup>
+    Ping_Pong create_ping_pong(GLsizeiptr size, const GLvoid *initial, GLsizei vertex_count,
+                               Setup setup_attributes, bool feedback_objects = has_feedback_objects())
+    {
+        Ping_Pong result = {};
+        result.vertex_count = vertex_count;
+        result.feedback_objects = feedback_objects;
+
+        for (size_t i = 0; i < 2; ++i) {
+            result.buffers[i] = gl::genBuffer();
+            result.vertex_arrays[i] = gl::genVertexArray();
+            gl::bindVertexArray(result.vertex_arrays[i]);
+            gl::bindBuffer(gl::Buffer_Target::ARRAY, result.buffers[i]);
+            gl::bufferData(gl::Buffer_Target::ARRAY, size, i == 0 ? initial : nullptr,
+                           gl::Buffer_Usage::DYNAMIC_COPY);
+            setup_attributes(result.buffers[i]);
+
+            if (feedback_objects) {
+                result.feedbacks[i] = gl::genTransformFeedback();
+                gl::bindTransformFeedback(result.feedbacks[i]);
+                gl::bindBufferBase(gl::Indexed_Buffer_Target::TRANSFORM_FEEDBACK, 0, result.buffers[i]);
+            }
+        }
+
+        if (feedback_objects) gl::bindTransformFeedback({0});
+        gl::bindVertexArray({0});
+
+        return result;
+    }
+
+    inline void destroy(Ping_Pong *ping_pong)
+    {
+        for (size_t i = 0; i < 2; ++i) {
+            if (ping_pong->feedback_objects) gl::deleteObject(ping_pong->feedbacks[i]);
+            gl::deleteObject(ping_pong->vertex_arrays[i]);
+            gl::deleteObject(ping_pong->buffers[i]);
+        }
+        *ping_pong = {};
+    }
+
+    // Draws the vertices of the current buffer with the vertex array
+    // that reads it already bound
+    inline void draw_current(const Ping_Pong &ping_pong, gl::Draw_Mode mode)
+    {
+        if (ping_pong.feedback_objects && ping_pong.captured) {
+            gl::drawTransformFeedback(mode, ping_pong.feedbacks[ping_pong.current]);
+        } else {
+            gl::drawArrays(mode, 0, ping_pong.vertex_count);
+        }
+    }
+
+    // Runs the program in use over the current buffer into the other
+    // one, which becomes current. Nothing is rasterized.
+    inline void step(Ping_Pong *ping_pong)
+    {
+        const size_t target = 1 - ping_pong->current;
+
+        gl::enable(gl::Capability::RASTERIZER_DISCARD);
+        gl::bindVertexArray(ping_pong->vertex_arrays[ping_pong->current]);
+        if (ping_pong->feedback_objects) {
+            gl::bindTransformFeedback(ping_pong->feedbacks[target]);
+        } else {
+            gl::bindBufferBase(gl::Indexed_Buffer_Target::TRANSFORM_FEEDBACK, 0, ping_pong->buffers[target]);
+        }
+
+        gl::beginTransformFeedback(gl::Transform_Feedback_Primitive_Mode::POINTS);
+        draw_current(*ping_pong, gl::Draw_Mode::POINTS);
+        gl::endTransformFeedback();
+
+        // The buffer is read as vertices next, it must not stay bound
+        // for capture
+        if (ping_pong->feedback_objects) {
+            gl::bindTransformFeedback({0});
+        } else {
+            gl::bindBufferBase(gl::Indexed_Buffer_Target::TRANSFORM_FEEDBACK, 0, {0});
+        }
+        gl::bindVertexArray({0});
+        gl::disable(gl::Capability::RASTERIZER_DISCARD);
+
+        ping_pong->current = target;
+        ping_pong->captured = true;
+    }
+
+    // Draws the current state with the program in use
+    inline void draw(const Ping_Pong &ping_pong, gl::Draw_Mode mode)
+    {
+        gl::bindVertexArray(ping_pong.vertex_arrays[ping_pong.current]);
+        draw_current(ping_pong, mode);
+        gl::bindVertexArray({0});
+    }
+}
+
+#endif  // GL_FEEDBACK_HPP
@@ -0,0 +1,177 @@
+#ifndef GL_FRAME_HPP
+#define GL_FRAME_HPP
+
+// Frame loop helper: measures how long every frame actually takes,
+// optionally paces the loop by sleeping until the deadline of the next
+// frame instead of sleeping for a fixed amount, and keeps rolling
+// frame time statistics with hitch detection.
+//
+//     gl_frame::Loop loop = gl_frame::make_loop(1.0 / 60.0);
+//     while (running) {
+//         gl_frame::begin(&loop);
+//         ... build the frame ...
+//         gl::uniform(u_time, (float) gl_frame::late_latch(&loop));
+//         ... draw ...
+//         gl_frame::end(&loop);
+//     }
+//     gl_frame::Report report = gl_frame::report(loop.stats);
+//
+// Does not depend on gl.hpp, only on POSIX clocks.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <ctime>
+
+namespace gl_frame
+{
+    inline double now_secs()
+    {
+        struct timespec ts = {};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+    }
+
+    inline void sleep_until(double deadline)
+    {
+        struct timespec ts = {};
+        ts.tv_sec = (time_t) deadline;
+        ts.tv_nsec = (long) ((deadline - (double) ts.tv_sec) * 1e9);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {}
+    }
+
+    // Percentiles are computed over the last STATS_WINDOW frames
+    const size_t STATS_WINDOW = 512;
+
+    // Frames longer than HITCH_FACTOR times the budget (or the running
+    // average when the loop is not paced) are counted as hitches
+    const double HITCH_FACTOR = 2.0;
+
+    struct Stats
+    {
+        double window[STATS_WINDOW];
+        size_t count;           // total frames recorded
+        size_t hitches;         // total hitches detected
+        double average;         // exponential moving average of the frame time
+        double max;
+        double last_hitch;      // frame time of the latest hitch
+        size_t last_hitch_frame;
+    };
+
+    // Everything that is worth sending to telemetry, in seconds
+    struct Report
+    {
+        size_t frames;
+        size_t hitches;
+        double p50;
+        double p95;
+        double p99;
+        double max;
+        double average;
+    };
+
+    // Returns true if the frame was a hitch. `budget` is 0 for
+    // unpaced loops.
+    inline bool record(Stats *stats, double frame_time, double budget)
+    {
+        const double baseline = budget > 0.0 ? budget : stats->average;
+        const bool hitch = stats->count > 0 && frame_time > HITCH_FACTOR * baseline;
+        if (hitch) {
+            stats->hitches += 1;
+            stats->last_hitch = frame_time;
+            stats->last_hitch_frame = stats->count;
+        }
+
+        stats->average = stats->count == 0
+            ? frame_time
+            : stats->average + (frame_time - stats->average) / 16.0;
+        stats->max = std::max(stats->max, frame_time);
+        stats->window[stats->count % STATS_WINDOW] = frame_time;
+        stats->count += 1;
+
+        return hitch;
+    }
+
+    inline Report report(const Stats &stats)
+    {
+        Report result = {};
+        result.frames = stats.count;
+        result.hitches = stats.hitches;
+        result.max = stats.max;
+        result.average = stats.average;
+
+        const size_t n = std::min(stats.count, STATS_WINDOW);
+        if (n == 0) return result;
+
+        double sorted[STATS_WINDOW];
+        std::copy(stats.window, stats.window + n, sorted);
+        std::sort(sorted, sorted + n);
+        auto at = [&](double p) { return sorted[(size_t) (p * (double) (n - 1) + 0.5)]; };
+        result.p50 = at(0.50);
+        result.p95 = at(0.95);
+        result.p99 = at(0.99);
+
+        return result;
+    }
+
+    struct Loop
+    {
+        double budget;          // target frame time, 0 to run unpaced
+        double start;           // when the loop was created
+        double frame_start;     // when the current frame began
+        double frame_time;      // measured duration of the previous frame
+        double deadline;        // when the current frame should be done
+        Stats stats;
+    };
+
+    inline Loop make_loop(double budget)
+    {
+        Loop loop = {};
+        loop.budget = budget;
+        loop.start = now_secs();
+        loop.frame_start = loop.start;
+        loop.deadline = loop.start;
+        return loop;
+    }
+
+    // Seconds since the loop was created, latched at the beginning of
+    // the frame
+    inline double begin(Loop *loop)
+    {
+        loop->frame_start = now_secs();
+        loop->deadline += loop->budget;
+        return loop->frame_start - loop->start;
+    }
+
+    // Seconds since the loop was created, sampled right now. Call it as
+    // late as possible, right before the draw calls that depend on it,
+    // so the animation matches the moment the frame hits the screen
+    // as closely as possible.
+    inline double late_latch(const Loop *loop)
+    {
+        return now_secs() - loop->start;
+    }
+
+    // Records the frame time and, if the loop is paced, sleeps until
+    // the deadline of the frame. Returns true if the frame was a hitch.
+    inline bool end(Loop *loop)
+    {
+        const double now = now_secs();
+        loop->frame_time = now - loop->frame_start;
+        const bool hitch = record(&loop->stats, loop->frame_time, loop->budget);
+
+        if (loop->budget > 0.0) {
+            if (now < loop->deadline) {
+                sleep_until(loop->deadline);
+            } else if (now - loop->deadline > loop->budget) {
+                // Too far behind to catch up: do not try to make up for
+                // the missed frames with a burst of unpaced ones
+                loop->deadline = now;
+            }
+        }
+
+        return hitch;
+    }
+}
+
+#endif  // GL_FRAME_HPP
@@ -0,0 +1,478 @@
+#ifndef GL_INDICES_HPP
+#define GL_INDICES_HPP
+
+// Index buffer optimizations for indexed triangle lists:
+//
+// - optimize_vertex_cache() reorders the triangles so the vertices
+//   that were just transformed are reused as much as possible by the
+//   post-transform vertex cache (Tom Forsyth's "Linear-Speed Vertex
+//   Cache Optimisation").
+// - optimize_vertex_fetch() renumbers the vertices in the order the
+//   triangles first use them, and remap_vertices() moves the vertex
+//   data accordingly, so the vertex fetch walks memory forwards.
+// - acmr() measures the average number of vertices transformed per
+//   triangle with a FIFO cache model: 3.0 is the worst, ~0.5 is about
+//   the best a regular grid can do.
+//
+//     gl_indices::optimize_vertex_cache(indices.data(), indices.size(), vertex_count, indices.data());
+//     std::vector<uint32_t> remap(vertex_count);
+//     gl_indices::optimize_vertex_fetch(indices.data(), indices.size(), vertex_count, remap.data());
+//     gl_indices::remap_vertices(vertices, sizeof(Vertex), vertex_count, remap.data(), new_vertices);
+//
+// build_triangles() and build_strips() then turn the 32-bit indices
+// into the narrowest Element_Index_Type that holds them, split in
+// ranges of 16-bit indices drawn with a base vertex when the memory
+// saved is worth the extra draw calls. Strips are stitched with
+// primitive restart, so any number of them draw in one call:
+//
+//     auto buffer = gl_indices::build_triangles(indices.data(), indices.size());
+//     gl::bindBuffer(gl::Buffer_Target::ELEMENT_ARRAY, index_buffer);
+//     gl::bufferData(gl::Buffer_Target::ELEMENT_ARRAY, buffer.data.size(), buffer.data.data(), ...);
+//     gl_indices::draw(buffer);
+//
+// Include it after the GL headers and gl.hpp.
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace gl_indices
+{
+    const uint32_t NONE = UINT32_MAX;
+
+    // Average Cache Miss Ratio: vertex shader runs per triangle for a
+    // FIFO cache of `cache_size` entries, the model most GPUs are
+    // closest to.
+    inline double acmr(const uint32_t *indices, size_t count, size_t vertex_count, size_t cache_size)
+    {
+        if (count < 3) return 0.0;
+
+        // The time every vertex entered the cache, it is still in it if
+        // that was less than cache_size misses ago
+        std::vector<size_t> entered(vertex_count, 0);
+        size_t misses = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t v = indices[i];
+            assert(v < vertex_count);
+            if (entered[v] == 0 || misses - entered[v] >= cache_size) {
+                misses += 1;
+                entered[v] = misses;
+            }
+        }
+
+        return (double) misses / (double) (count / 3);
+    }
+
+    // The constants of Forsyth's article
+    const size_t FORSYTH_CACHE_SIZE = 32;
+    const float FORSYTH_CACHE_DECAY_POWER = 1.5f;
+    const float FORSYTH_LAST_TRIANGLE_SCORE = 0.75f;
+    const float FORSYTH_VALENCE_BOOST_SCALE = 2.0f;
+    const float FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+    // Valences above it get the same boost
+    const size_t FORSYTH_MAX_VALENCE = 64;
+
+    struct Forsyth_Tables
+    {
+        float cache[FORSYTH_CACHE_SIZE];
+        float valence[FORSYTH_MAX_VALENCE + 1];
+    };
+
+    inline const Forsyth_Tables &forsyth_tables()
+    {
+        static const Forsyth_Tables tables = [] {
+            Forsyth_Tables t = {};
+            for (size_t i = 0; i < FORSYTH_CACHE_SIZE; ++i) {
+                if (i < 3) {
+                    // The vertices of the last triangle: a triangle
+                    // that only shares them is a strip in disguise,
+                    // which does not do better than a fresh start
+                    t.cache[i] = FORSYTH_LAST_TRIANGLE_SCORE;
+                } else {
+                    const float scale = 1.0f / (float) (FORSYTH_CACHE_SIZE - 3);
+                    t.cache[i] = std::pow(1.0f - (float) (i - 3) * scale, FORSYTH_CACHE_DECAY_POWER);
+                }
+            }
+            for (size_t i = 1; i <= FORSYTH_MAX_VALENCE; ++i) {
+                // Few triangles left: get rid of the vertex soon
+                t.valence[i] = FORSYTH_VALENCE_BOOST_SCALE * std::pow((float) i, -FORSYTH_VALENCE_BOOST_POWER);
+            }
+            return t;
+        }();
+        return tables;
+    }
+
+    inline float forsyth_score(int cache_position, size_t valence)
+    {
+        if (valence == 0) return -1.0f;
+
+        const Forsyth_Tables &tables = forsyth_tables();
+        const float cache = cache_position < 0 ? 0.0f : tables.cache[cache_position];
+        return cache + tables.valence[std::min(valence, FORSYTH_MAX_VALENCE)];
+    }
+
+    // Writes the triangles of the `count` indices to `out` in an order
+    // friendly to the post-transform vertex cache. `out` may be
+    // `indices`.
+    inline void optimize_vertex_cache(const uint32_t *indices, size_t count, size_t vertex_count, uint32_t *out)
+    {
+        assert(count % 3 == 0);
+        const size_t triangle_count = count / 3;
+        if (triangle_count == 0) return;
+
+        // The triangles of every vertex: triangles[offsets[v]..offsets[v] + valence[v]]
+        // The emitted triangles are removed from the lists.
+        std::vector<uint32_t> valence(vertex_count, 0);
+        for (size_t i = 0; i < count; ++i) valence[indices[i]] += 1;
+
+        std::vector<uint32_t> offsets(vertex_count, 0);
+        for (size_t v = 1; v < vertex_count; ++v) offsets[v] = offsets[v - 1] + valence[v - 1];
+
+        std::vector<uint32_t> triangles(count);
+        {
+            std::vector<uint32_t> filled(vertex_count, 0);
+            for (size_t i = 0; i < count; ++i) {
+                const uint32_t v = indices[i];
+                triangles[offsets[v] + filled[v]++] = (uint32_t) (i / 3);
+            }
+        }
+
+        std::vector<int> cache_position(vertex_count, -1);
+        std::vector<float> vertex_score(vertex_count);
+        for (size_t v = 0; v < vertex_count; ++v) vertex_score[v] = forsyth_score(-1, valence[v]);
+
+        std::vector<float> triangle_score(triangle_count);
+        for (size_t t = 0; t < triangle_count; ++t) {
+            triangle_score[t] = vertex_score[indices[3 * t]]
+                + vertex_score[indices[3 * t + 1]]
+                + vertex_score[indices[3 * t + 2]];
+        }
+
+        std::vector<bool> emitted(triangle_count, false);
+        std::vector<uint32_t> result;
+        result.reserve(count);
+
+        // The 3 vertices of the new triangle go in front of the cache,
+        // so it holds up to 3 more of them before the tail is trimmed
+        uint32_t cache[FORSYTH_CACHE_SIZE + 3];
+        size_t cache_count = 0;
+        uint32_t new_cache[FORSYTH_CACHE_SIZE + 3];
+
+        uint32_t best = 0;
+        size_t scan = 0;
+        for (size_t emitted_count = 0; emitted_count < triangle_count; ++emitted_count) {
+            if (best == NONE) {
+                // Nothing in the cache leads anywhere: start over from
+                // the next triangle left, the input order is as good a
+                // guess as any
+                while (emitted[scan]) scan += 1;
+                best = (uint32_t) scan;
+            }
+
+            const uint32_t *tri = &indices[3 * best];
+            result.insert(result.end(), tri, tri + 3);
+            emitted[best] = true;
+
+            // Take the triangle out of the lists of its vertices
+            for (int k = 0; k < 3; ++k) {
+                const uint32_t v = tri[k];
+                uint32_t *list = &triangles[offsets[v]];
+                uint32_t *end = list + valence[v];
+                *std::find(list, end, best) = *(end - 1);
+                valence[v] -= 1;
+            }
+
+            // The new cache: the triangle first, then the rest in order
+            size_t new_count = 0;
+            for (int k = 0; k < 3; ++k) new_cache[new_count++] = tri[k];
+            for (size_t i = 0; i < cache_count; ++i) {
+                const uint32_t v = cache[i];
+                if (v != tri[0] && v != tri[1] && v != tri[2]) new_cache[new_count++] = v;
+            }
+
+            // Rescore what was and is in the cache, and find the best
+            // triangle around it
+            best = NONE;
+            float best_score = -1.0f;
+            for (size_t i = 0; i < new_count; ++i) {
+                const uint32_t v = new_cache[i];
+                const int position = i < FORSYTH_CACHE_SIZE ? (int) i : -1;
+                cache_position[v] = position;
+
+                const float score = forsyth_score(position, valence[v]);
+                const float delta = score - vertex_score[v];
+                vertex_score[v] = score;
+
+                for (uint32_t j = 0; j < valence[v]; ++j) {
+                    const uint32_t t = triangles[offsets[v] + j];
+                    triangle_score[t] += delta;
+                    if (triangle_score[t] > best_score) {
+                        best_score = triangle_score[t];
+                        best = t;
+                    }
+                }
+            }
+
+            cache_count = std::min(new_count, FORSYTH_CACHE_SIZE);
+            memcpy(cache, new_cache, cache_count * sizeof(cache[0]));
+        }
+
+        memcpy(out, result.data(), count * sizeof(out[0]));
+    }
+
+    // Renumbers the vertices in the order the indices first use them,
+    // in place. remap[old] is the new index of every vertex; the ones
+    // no index uses go last.
+    inline void optimize_vertex_fetch(uint32_t *indices, size_t count, size_t vertex_count, uint32_t *remap)
+    {
+        std::fill(remap, remap + vertex_count, NONE);
+
+        uint32_t next = 0;
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t &v = indices[i];
+            if (remap[v] == NONE) remap[v] = next++;
+            v = remap[v];
+        }
+
+        for (size_t v = 0; v < vertex_count; ++v) {
+            if (remap[v] == NONE) remap[v] = next++;
+        }
+    }
+
+    // out[remap[i]] = in[i] for vertices of `vertex_size` bytes. `out`
+    // must not overlap `in`.
+    inline void remap_vertices(const void *in, size_t vertex_size, size_t vertex_count,
+                               const uint32_t *remap, void *out)
+    {
+        auto src = static_cast<const unsigned char*>(in);
+        auto dst = static_cast<unsigned char*>(out);
+        for (size_t v = 0; v < vertex_count; ++v) {
+            memcpy(dst + (size_t) remap[v] * vertex_size, src + v * vertex_size, vertex_size);
+        }
+    }
+
+    inline size_t index_size(gl::Element_Index_Type type)
+    {
+        switch (type) {
+        case gl::Element_Index_Type::UNSIGNED_BYTE:  return 1;
+        case gl::Element_Index_Type::UNSIGNED_SHORT: return 2;
+        case gl::Element_Index_Type::UNSIGNED_INT:   return 4;
+        }
+        return 4;
+    }
+
+    // The largest value of the type, the same restart index as
+    // GL_PRIMITIVE_RESTART_FIXED_INDEX
+    inline GLuint restart_index(gl::Element_Index_Type type)
+    {
+        return (GLuint) (UINT32_MAX >> (32 - 8 * index_size(type)));
+    }
+
+    // The narrowest type that holds every index up to `max_index`,
+    // and the restart index on top when `primitive_restart`
+    inline gl::Element_Index_Type narrowest_type(uint32_t max_index, bool primitive_restart)
+    {
+        const uint32_t reserved = primitive_restart ? 1 : 0;
+        if (max_index + reserved <= UINT8_MAX) return gl::Element_Index_Type::UNSIGNED_BYTE;
+        if (max_index + reserved <= UINT16_MAX) return gl::Element_Index_Type::UNSIGNED_SHORT;
+        return gl::Element_Index_Type::UNSIGNED_INT;
+    }
+
+    struct Draw
+    {
+        gl::Draw_Mode mode;
+        gl::Element_Index_Type type;
+        GLsizei count;
+        // In bytes from the start of the index buffer
+        size_t offset;
+        GLint base_vertex;
+    };
+
+    struct Index_Buffer
+    {
+        // Every draw starts at an offset aligned to its index size
+        std::vector<unsigned char> data;
+        std::vector<Draw> draws;
+        bool primitive_restart;
+        // The size of the same indices as 32-bit ones, restarts excluded
+        size_t uint_bytes;
+    };
+
+    // Every draw call a split adds must save at least that many bytes
+    // of indices
+    const size_t MIN_SPLIT_SAVINGS = 16 * 1024;
+
+    // A run of indices that has to stay in one draw: a triangle or a
+    // whole strip
+    struct Piece
+    {
+        const uint32_t *indices;
+        size_t count;
+        uint32_t min;
+        uint32_t max;
+    };
+
+    inline Piece make_piece(const uint32_t *indices, size_t count)
+    {
+        Piece piece = {indices, count, UINT32_MAX, 0};
+        for (size_t i = 0; i < count; ++i) {
+            piece.min = std::min(piece.min, indices[i]);
+            piece.max = std::max(piece.max, indices[i]);
+        }
+        return piece;
+    }
+
+    // Appends one draw of the pieces, relative to their smallest index
+    inline void push_draw(Index_Buffer *buffer, gl::Draw_Mode mode, const Piece *pieces, size_t count)
+    {
+        uint32_t min = UINT32_MAX, max = 0;
+        for (size_t i = 0; i < count; ++i) {
+            min = std::min(min, pieces[i].min);
+            max = std::max(max, pieces[i].max);
+        }
+        assert(min <= (uint32_t) INT32_MAX);
+
+        const auto type = narrowest_type(max - min, buffer->primitive_restart);
+        const size_t size = index_size(type);
+        const GLuint restart = restart_index(type);
+
+        buffer->data.resize((buffer->data.size() + size - 1) / size * size);
+        Draw draw = {mode, type, 0, buffer->data.size(), (GLint) min};
+
+        for (size_t i = 0; i < count; ++i) {
+            const size_t written = buffer->data.size();
+            const size_t restarts = buffer->primitive_restart && i > 0 ? 1 : 0;
+            buffer->data.resize(written + (restarts + pieces[i].count) * size);
+            unsigned char *out = &buffer->data[written];
+
+            if (restarts) {
+                memcpy(out, &restart, size);
+                out += size;
+            }
+            for (size_t j = 0; j < pieces[i].count; ++j) {
+                const uint32_t index = pieces[i].indices[j] - min;
+                // Little-endian, like every machine GL runs on
+                memcpy(out, &index, size);
+                out += size;
+            }
+            draw.count += (GLsizei) (restarts + pieces[i].count);
+        }
+
+        buffer->draws.push_back(draw);
+    }
+
+    inline Index_Buffer build(gl::Draw_Mode mode, const std::vector<Piece> &pieces,
+                              bool primitive_restart, size_t min_split_savings)
+    {
+        Index_Buffer buffer = {};
+        buffer.primitive_restart = primitive_restart;
+        if (pieces.empty()) return buffer;
+
+        uint32_t min = UINT32_MAX, max = 0;
+        size_t index_count = 0;
+        for (const auto &piece : pieces) {
+            min = std::min(min, piece.min);
+            max = std::max(max, piece.max);
+            index_count += piece.count;
+        }
+        buffer.uint_bytes = index_count * sizeof(uint32_t);
+
+        // Greedy ranges of 16-bit indices, which is where the savings
+        // are. The vertex fetch order of optimize_vertex_fetch() keeps
+        // the ranges of neighbouring triangles close.
+        std::vector<size_t> splits;
+        if (narrowest_type(max - min, primitive_restart) == gl::Element_Index_Type::UNSIGNED_INT) {
+            const uint32_t limit = UINT16_MAX - (primitive_restart ? 1 : 0);
+            uint32_t range_min = UINT32_MAX, range_max = 0;
+            for (size_t i = 0; i < pieces.size(); ++i) {
+                const uint32_t new_min = std::min(range_min, pieces[i].min);
+                const uint32_t new_max = std::max(range_max, pieces[i].max);
+                if (new_max - new_min > limit) {
+                    if (pieces[i].max - pieces[i].min > limit) {
+                        // The piece alone does not fit, no split helps
+                        splits.clear();
+                        break;
+                    }
+                    splits.push_back(i);
+                    range_min = pieces[i].min;
+                    range_max = pieces[i].max;
+                } else {
+                    range_min = new_min;
+                    range_max = new_max;
+                }
+            }
+
+            // From 4 to 2 bytes per index, the restarts aside
+            const size_t savings = index_count * 2;
+            if (savings < splits.size() * min_split_savings) splits.clear();
+        }
+
+        size_t first = 0;
+        for (size_t split : splits) {
+            push_draw(&buffer, mode, &pieces[first], split - first);
+            first = split;
+        }
+        push_draw(&buffer, mode, &pieces[first], pieces.size() - first);
+
+        return buffer;
+    }
+
+    inline Index_Buffer build_triangles(const uint32_t *indices, size_t count,
+                                        size_t min_split_savings = MIN_SPLIT_SAVINGS)
+    {
+        assert(count % 3 == 0);
+        std::vector<Piece> pieces;
+        pieces.reserve(count / 3);
+        for (size_t i = 0; i < count; i += 3) pieces.push_back(make_piece(&indices[i], 3));
+        return build(gl::Draw_Mode::TRIANGLES, pieces, false, min_split_savings);
+    }
+
+    struct Strip
+    {
+        const uint32_t *indices;
+        size_t count;
+    };
+
+    // Stitches the strips with primitive restart
+    inline Index_Buffer build_strips(const Strip *strips, size_t strip_count,
+                                     size_t min_split_savings = MIN_SPLIT_SAVINGS)
+    {
+        std::vector<Piece> pieces;
+        pieces.reserve(strip_count);
+        for (size_t i = 0; i < strip_count; ++i) {
+            if (strips[i].count > 0) pieces.push_back(make_piece(strips[i].indices, strips[i].count));
+        }
+        return build(gl::Draw_Mode::TRIANGLE_STRIP, pieces, true, min_split_savings);
+    }
+
+    // Issues the draws of `buffer`, which has to be uploaded to the
+    // bound ELEMENT_ARRAY buffer. Primitive restart is disabled again
+    // after them.
+    inline void draw(const Index_Buffer &buffer)
+    {
+        if (buffer.primitive_restart) gl::enable(gl::Capability::PRIMITIVE_RESTART);
+
+        Maybe<gl::Element_Index_Type> restart_type = {};
+        for (const auto &draw : buffer.draws) {
+            if (buffer.primitive_restart && !(restart_type.has_value && restart_type.unwrap == draw.type)) {
+                gl::primitiveRestartIndex(restart_index(draw.type));
+                restart_type = {true, draw.type};
+            }
+
+            const GLvoid *offset = reinterpret_cast<const GLvoid*>(draw.offset);
+            if (draw.base_vertex == 0) {
+                gl::drawElements(draw.mode, draw.count, draw.type, offset);
+            } else {
+                gl::drawElementsBaseVertex(draw.mode, draw.count, draw.type, offset, draw.base_vertex);
+            }
+        }
+
+        if (buffer.primitive_restart) gl::disable(gl::Capability::PRIMITIVE_RESTART);
+    }
+}
+
+#endif  // GL_INDICES_HPP
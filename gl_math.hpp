@@ -0,0 +1,348 @@
+#ifndef GL_MATH_HPP
+#define GL_MATH_HPP
+
+// Vectors and matrices for the data that goes to GL, with SSE/AVX or
+// NEON kernels for the hot paths: matrix products, batched vertex
+// transforms and inverses. Without any of them it falls back to
+// plain C++.
+//
+// The types are uploadable as they are:
+// - Vec4 and Mat4 are a gl::Vec4f and a gl::Mat4f (column-major) with
+//   a 16-byte alignment, so gl::uniform() takes them, arrays of them
+//   included, and they match std140 vec4 and mat4.
+// - Vec3 and Mat3 are padded to 16 bytes per vector/column like std140
+//   vec3 array elements and mat3. gl::uniform() takes them through a
+//   conversion to gl::Vec3f/gl::Mat3f, which drops the padding.
+//
+// Include it after the GL headers and gl.hpp.
+
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE__) || defined(_M_X64)
+#    include <xmmintrin.h>
+#    if defined(__AVX__)
+#        include <immintrin.h>
+#    endif
+#    define GL_MATH_SSE
+#elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#    define GL_MATH_NEON
+#endif
+
+namespace gl_math
+{
+#if defined(GL_MATH_SSE) && defined(__AVX__)
+    const char *const SIMD = "AVX";
+#elif defined(GL_MATH_SSE)
+    const char *const SIMD = "SSE";
+#elif defined(GL_MATH_NEON)
+    const char *const SIMD = "NEON";
+#else
+    const char *const SIMD = "none";
+#endif
+
+    struct alignas(16) Vec4: public gl::Vec4f {};
+
+    struct alignas(16) Vec3
+    {
+        GLfloat x, y, z;
+        GLfloat pad;
+
+        operator gl::Vec3f() const { return {x, y, z}; }
+    };
+
+    struct alignas(16) Mat4: public gl::Mat4f {};
+
+    struct alignas(16) Mat3
+    {
+        GLfloat m[3 * 4];       // 3 columns of 4, the last one unused
+
+        operator gl::Mat3f() const
+        {
+            return {{m[0], m[1], m[2], m[4], m[5], m[6], m[8], m[9], m[10]}};
+        }
+    };
+
+    static_assert(sizeof(Vec4) == sizeof(gl::Vec4f), "Vec4 must be uploadable as a gl::Vec4f");
+    static_assert(sizeof(Mat4) == sizeof(gl::Mat4f), "Mat4 must be uploadable as a gl::Mat4f");
+    static_assert(sizeof(Vec3) == 16, "Vec3 must have the std140 array stride");
+    static_assert(sizeof(Mat3) == 48, "Mat3 must have the std140 layout");
+
+    // 4 floats in a register, and the few operations the kernels need
+
+#if defined(GL_MATH_SSE)
+    using F4 = __m128;
+
+    inline F4 f4_load(const GLfloat *p) { return _mm_load_ps(p); }
+    inline void f4_store(GLfloat *p, F4 a) { _mm_store_ps(p, a); }
+    inline F4 f4_splat(GLfloat x) { return _mm_set1_ps(x); }
+    inline F4 f4_add(F4 a, F4 b) { return _mm_add_ps(a, b); }
+    inline F4 f4_sub(F4 a, F4 b) { return _mm_sub_ps(a, b); }
+    inline F4 f4_mul(F4 a, F4 b) { return _mm_mul_ps(a, b); }
+
+    // a * b + c
+    inline F4 f4_madd(F4 a, F4 b, F4 c)
+    {
+#    if defined(__FMA__)
+        return _mm_fmadd_ps(a, b, c);
+#    else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+#    endif
+    }
+
+    // Lane I in all 4 lanes
+    template <int I>
+    inline F4 f4_lane(F4 a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(I, I, I, I)); }
+#elif defined(GL_MATH_NEON)
+    using F4 = float32x4_t;
+
+    inline F4 f4_load(const GLfloat *p) { return vld1q_f32(p); }
+    inline void f4_store(GLfloat *p, F4 a) { vst1q_f32(p, a); }
+    inline F4 f4_splat(GLfloat x) { return vdupq_n_f32(x); }
+    inline F4 f4_add(F4 a, F4 b) { return vaddq_f32(a, b); }
+    inline F4 f4_sub(F4 a, F4 b) { return vsubq_f32(a, b); }
+    inline F4 f4_mul(F4 a, F4 b) { return vmulq_f32(a, b); }
+
+    inline F4 f4_madd(F4 a, F4 b, F4 c)
+    {
+#    if defined(__aarch64__)
+        return vfmaq_f32(c, a, b);
+#    else
+        return vmlaq_f32(c, a, b);
+#    endif
+    }
+
+    template <int I>
+    inline F4 f4_lane(F4 a) { return vdupq_n_f32(vgetq_lane_f32(a, I)); }
+#else
+    struct F4
+    {
+        GLfloat v[4];
+    };
+
+    inline F4 f4_load(const GLfloat *p) { return {{p[0], p[1], p[2], p[3]}}; }
+    inline void f4_store(GLfloat *p, F4 a) { for (int i = 0; i < 4; ++i) p[i] = a.v[i]; }
+    inline F4 f4_splat(GLfloat x) { return {{x, x, x, x}}; }
+
+    inline F4 f4_add(F4 a, F4 b)
+    {
+        return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+    }
+
+    inline F4 f4_sub(F4 a, F4 b)
+    {
+        return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+    }
+
+    inline F4 f4_mul(F4 a, F4 b)
+    {
+        return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+    }
+
+    inline F4 f4_madd(F4 a, F4 b, F4 c) { return f4_add(f4_mul(a, b), c); }
+
+    template <int I>
+    inline F4 f4_lane(F4 a) { return f4_splat(a.v[I]); }
+#endif
+
+    inline F4 f4_load(const Vec4 &a) { return f4_load(reinterpret_cast<const GLfloat*>(&a)); }
+    inline F4 f4_load(const Vec3 &a) { return f4_load(&a.x); }
+
+    inline Vec4 to_vec4(F4 a)
+    {
+        Vec4 result;
+        f4_store(reinterpret_cast<GLfloat*>(&result), a);
+        return result;
+    }
+
+    inline Vec3 to_vec3(F4 a)
+    {
+        Vec3 result;
+        f4_store(&result.x, a);
+        result.pad = 0.0f;
+        return result;
+    }
+
+    inline Mat4 mat4_identity()
+    {
+        return {1, 0, 0, 0,
+                0, 1, 0, 0,
+                0, 0, 1, 0,
+                0, 0, 0, 1};
+    }
+
+    inline Mat3 mat3_identity()
+    {
+        return {{1, 0, 0, 0,
+                 0, 1, 0, 0,
+                 0, 0, 1, 0}};
+    }
+
+    inline Mat4 mat4_translation(Vec3 t)
+    {
+        return {1,   0,   0,   0,
+                0,   1,   0,   0,
+                0,   0,   1,   0,
+                t.x, t.y, t.z, 1};
+    }
+
+    inline Mat4 mat4_scale(Vec3 s)
+    {
+        return {s.x, 0,   0,   0,
+                0,   s.y, 0,   0,
+                0,   0,   s.z, 0,
+                0,   0,   0,   1};
+    }
+
+    // The columns of `m` weighted by the lanes of `v`
+    inline F4 mul_columns4(const GLfloat *m, F4 v)
+    {
+        F4 r = f4_mul(f4_load(m + 0), f4_lane<0>(v));
+        r = f4_madd(f4_load(m + 4), f4_lane<1>(v), r);
+        r = f4_madd(f4_load(m + 8), f4_lane<2>(v), r);
+        r = f4_madd(f4_load(m + 12), f4_lane<3>(v), r);
+        return r;
+    }
+
+    inline F4 mul_columns3(const GLfloat *m, F4 v)
+    {
+        F4 r = f4_mul(f4_load(m + 0), f4_lane<0>(v));
+        r = f4_madd(f4_load(m + 4), f4_lane<1>(v), r);
+        r = f4_madd(f4_load(m + 8), f4_lane<2>(v), r);
+        return r;
+    }
+
+    inline Vec4 operator*(const Mat4 &m, const Vec4 &v)
+    {
+        return to_vec4(mul_columns4(m.m, f4_load(v)));
+    }
+
+    inline Vec3 operator*(const Mat3 &m, const Vec3 &v)
+    {
+        return to_vec3(mul_columns3(m.m, f4_load(v)));
+    }
+
+    inline Mat4 operator*(const Mat4 &a, const Mat4 &b)
+    {
+        Mat4 result;
+        for (int j = 0; j < 4; ++j) {
+            f4_store(result.m + 4 * j, mul_columns4(a.m, f4_load(b.m + 4 * j)));
+        }
+        return result;
+    }
+
+    inline Mat3 operator*(const Mat3 &a, const Mat3 &b)
+    {
+        Mat3 result;
+        for (int j = 0; j < 3; ++j) {
+            f4_store(result.m + 4 * j, mul_columns3(a.m, f4_load(b.m + 4 * j)));
+        }
+        return result;
+    }
+
+    // out[i] = m * in[i]. `in` and `out` may be the same array.
+    inline void transform(const Mat4 &m, const Vec4 *in, Vec4 *out, size_t count)
+    {
+        size_t i = 0;
+        auto src = reinterpret_cast<const GLfloat*>(in);
+        auto dst = reinterpret_cast<GLfloat*>(out);
+
+#if defined(GL_MATH_SSE) && defined(__AVX__)
+        // Two vertices per iteration, one in each 128-bit lane
+        const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m + 0));
+        const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m + 4));
+        const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m + 8));
+        const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m + 12));
+        for (; i + 2 <= count; i += 2) {
+            const __m256 v = _mm256_loadu_ps(src + 4 * i);
+#    if defined(__FMA__)
+            __m256 r = _mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00));
+            r = _mm256_fmadd_ps(c1, _mm256_permute_ps(v, 0x55), r);
+            r = _mm256_fmadd_ps(c2, _mm256_permute_ps(v, 0xAA), r);
+            r = _mm256_fmadd_ps(c3, _mm256_permute_ps(v, 0xFF), r);
+#    else
+            __m256 r = _mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00));
+            r = _mm256_add_ps(_mm256_mul_ps(c1, _mm256_permute_ps(v, 0x55)), r);
+            r = _mm256_add_ps(_mm256_mul_ps(c2, _mm256_permute_ps(v, 0xAA)), r);
+            r = _mm256_add_ps(_mm256_mul_ps(c3, _mm256_permute_ps(v, 0xFF)), r);
+#    endif
+            _mm256_storeu_ps(dst + 4 * i, r);
+        }
+#endif
+
+        for (; i < count; ++i) {
+            f4_store(dst + 4 * i, mul_columns4(m.m, f4_load(src + 4 * i)));
+        }
+    }
+
+    // Gauss-Jordan elimination with partial pivoting, done with column
+    // operations so every step is a vector operation on the columns:
+    // whatever turns `a` into the identity turns `e` into its inverse.
+    template <int N>
+    inline bool invert_columns(GLfloat (*a)[4], GLfloat (*e)[4])
+    {
+        int order[N];
+        for (int j = 0; j < N; ++j) order[j] = j;
+
+        for (int i = 0; i < N; ++i) {
+            int pivot = i;
+            for (int j = i + 1; j < N; ++j) {
+                if (std::fabs(a[order[j]][i]) > std::fabs(a[order[pivot]][i])) pivot = j;
+            }
+            const int tmp = order[i];
+            order[i] = order[pivot];
+            order[pivot] = tmp;
+
+            GLfloat *ai = a[order[i]];
+            GLfloat *ei = e[order[i]];
+            if (std::fabs(ai[i]) < FLT_MIN) return false;
+
+            const F4 scale = f4_splat(1.0f / ai[i]);
+            const F4 ai4 = f4_mul(f4_load(ai), scale);
+            const F4 ei4 = f4_mul(f4_load(ei), scale);
+            f4_store(ai, ai4);
+            f4_store(ei, ei4);
+
+            for (int j = 0; j < N; ++j) {
+                if (j == i) continue;
+                GLfloat *aj = a[order[j]];
+                GLfloat *ej = e[order[j]];
+                const F4 f = f4_splat(aj[i]);
+                f4_store(aj, f4_sub(f4_load(aj), f4_mul(ai4, f)));
+                f4_store(ej, f4_sub(f4_load(ej), f4_mul(ei4, f)));
+            }
+        }
+
+        // The column operations are right multiplications, so column
+        // order[j] of `e` is column j of the inverse
+        alignas(16) GLfloat result[N][4];
+        for (int j = 0; j < N; ++j) f4_store(result[j], f4_load(e[order[j]]));
+        for (int j = 0; j < N; ++j) f4_store(e[j], f4_load(result[j]));
+        return true;
+    }
+
+    // Nothing if `m` is singular
+    inline Maybe<Mat4> inverse(const Mat4 &m)
+    {
+        alignas(16) GLfloat a[4][4];
+        Maybe<Mat4> result = {true, mat4_identity()};
+        for (int j = 0; j < 4; ++j) f4_store(a[j], f4_load(m.m + 4 * j));
+
+        result.has_value = invert_columns<4>(a, reinterpret_cast<GLfloat (*)[4]>(result.unwrap.m));
+        return result;
+    }
+
+    inline Maybe<Mat3> inverse(const Mat3 &m)
+    {
+        alignas(16) GLfloat a[3][4];
+        Maybe<Mat3> result = {true, mat3_identity()};
+        for (int j = 0; j < 3; ++j) f4_store(a[j], f4_load(m.m + 4 * j));
+
+        result.has_value = invert_columns<3>(a, reinterpret_cast<GLfloat (*)[4]>(result.unwrap.m));
+        return result;
+    }
+}
+
+#endif  // GL_MATH_HPP
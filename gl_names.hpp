@@ -0,0 +1,12051 @@
+#ifndef GL_NAMES_HPP_
+#define GL_NAMES_HPP_
+
+// Generated by tools/spec from gl.xml. Do not edit by hand.
+//
+// Every table maps the values of an enum group to their names. The
+// size of a table is chosen so `value % size` never collides, which
+// makes gl::names::name_of() a single constexpr array access. Include
+// this after gl.hpp to also get to_string() for its enum classes.
+
+#include <cstddef>
+
+namespace gl {
+namespace names {
+    struct Entry
+    {
+        unsigned long long value;
+        const char *name;
+    };
+
+    // Returns nullptr if the value does not belong to the group
+    template <size_t N>
+    constexpr const char *name_of(const Entry (&table)[N], unsigned long long value)
+    {
+        const Entry &entry = table[value % N];
+        return entry.name && entry.value == value ? entry.name : nullptr;
+    }
+
+    inline constexpr Entry AccumOp[5] = {
+        {260ULL, "GL_ADD"},
+        {256ULL, "GL_ACCUM"},
+        {257ULL, "GL_LOAD"},
+        {258ULL, "GL_RETURN"},
+        {259ULL, "GL_MULT"},
+    };
+
+    inline constexpr Entry AlphaFunction[8] = {
+        {512ULL, "GL_NEVER"},
+        {513ULL, "GL_LESS"},
+        {514ULL, "GL_EQUAL"},
+        {515ULL, "GL_LEQUAL"},
+        {516ULL, "GL_GREATER"},
+        {517ULL, "GL_NOTEQUAL"},
+        {518ULL, "GL_GEQUAL"},
+        {519ULL, "GL_ALWAYS"},
+    };
+
+    inline constexpr Entry ArrayObjectPNameATI[2] = {
+        {34660ULL, "GL_OBJECT_BUFFER_SIZE_ATI"},
+        {34661ULL, "GL_OBJECT_BUFFER_USAGE_ATI"},
+    };
+
+    inline constexpr Entry ArrayObjectUsageATI[2] = {
+        {34656ULL, "GL_STATIC_ATI"},
+        {34657ULL, "GL_DYNAMIC_ATI"},
+    };
+
+    inline constexpr Entry AtomicCounterBufferPName[15] = {
+        {37575ULL, "GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_VERTEX_SHADER"},
+        {37576ULL, "GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_TESS_CONTROL_SHADER"},
+        {37577ULL, "GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_TESS_EVALUATION_SHADER"},
+        {37578ULL, "GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_GEOMETRY_SHADER"},
+        {37579ULL, "GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_FRAGMENT_SHADER"},
+        {0, nullptr},
+        {37101ULL, "GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_COMPUTE_SHADER"},
+        {0, nullptr},
+        {0, nullptr},
+        {37569ULL, "GL_ATOMIC_COUNTER_BUFFER_BINDING"},
+        {0, nullptr},
+        {0, nullptr},
+        {37572ULL, "GL_ATOMIC_COUNTER_BUFFER_DATA_SIZE"},
+        {37573ULL, "GL_ATOMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTERS"},
+        {37574ULL, "GL_ATOMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTER_INDICES"},
+    };
+
+    inline constexpr Entry AttribMask[37] = {
+        {0, nullptr},
+        {1ULL, "GL_CURRENT_BIT"},
+        {2ULL, "GL_POINT_BIT"},
+        {0, nullptr},
+        {4ULL, "GL_LINE_BIT"},
+        {0, nullptr},
+        {4294967295ULL, "GL_ALL_ATTRIB_BITS"},
+        {0, nullptr},
+        {8ULL, "GL_POLYGON_BIT"},
+        {65536ULL, "GL_EVAL_BIT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2048ULL, "GL_VIEWPORT_BIT"},
+        {0, nullptr},
+        {8192ULL, "GL_ENABLE_BIT"},
+        {16ULL, "GL_POLYGON_STIPPLE_BIT"},
+        {128ULL, "GL_FOG_BIT"},
+        {131072ULL, "GL_LIST_BIT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32768ULL, "GL_HINT_BIT"},
+        {536870912ULL, "GL_MULTISAMPLE_BIT"},
+        {1024ULL, "GL_STENCIL_BUFFER_BIT"},
+        {4096ULL, "GL_TRANSFORM_BIT"},
+        {64ULL, "GL_LIGHTING_BIT"},
+        {0, nullptr},
+        {0, nullptr},
+        {16384ULL, "GL_COLOR_BUFFER_BIT"},
+        {512ULL, "GL_ACCUM_BUFFER_BIT"},
+        {32ULL, "GL_PIXEL_MODE_BIT"},
+        {0, nullptr},
+        {256ULL, "GL_DEPTH_BUFFER_BIT"},
+        {524288ULL, "GL_SCISSOR_BIT"},
+        {262144ULL, "GL_TEXTURE_BIT"},
+    };
+
+    inline constexpr Entry AttributeType[230] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35664ULL, "GL_FLOAT_VEC2"},
+        {35665ULL, "GL_FLOAT_VEC3"},
+        {35666ULL, "GL_FLOAT_VEC4"},
+        {35667ULL, "GL_INT_VEC2"},
+        {35668ULL, "GL_INT_VEC3"},
+        {35669ULL, "GL_INT_VEC4"},
+        {35670ULL, "GL_BOOL"},
+        {35671ULL, "GL_BOOL_VEC2"},
+        {35672ULL, "GL_BOOL_VEC3"},
+        {35673ULL, "GL_BOOL_VEC4"},
+        {35674ULL, "GL_FLOAT_MAT2"},
+        {35675ULL, "GL_FLOAT_MAT3"},
+        {35676ULL, "GL_FLOAT_MAT4"},
+        {35677ULL, "GL_SAMPLER_1D"},
+        {35678ULL, "GL_SAMPLER_2D"},
+        {35679ULL, "GL_SAMPLER_3D"},
+        {35680ULL, "GL_SAMPLER_CUBE"},
+        {35681ULL, "GL_SAMPLER_1D_SHADOW"},
+        {35682ULL, "GL_SAMPLER_2D_SHADOW"},
+        {35683ULL, "GL_SAMPLER_2D_RECT"},
+        {35684ULL, "GL_SAMPLER_2D_RECT_SHADOW"},
+        {35685ULL, "GL_FLOAT_MAT2x3"},
+        {35686ULL, "GL_FLOAT_MAT2x4"},
+        {35687ULL, "GL_FLOAT_MAT3x2"},
+        {35688ULL, "GL_FLOAT_MAT3x4"},
+        {35689ULL, "GL_FLOAT_MAT4x2"},
+        {35690ULL, "GL_FLOAT_MAT4x3"},
+        {36841ULL, "GL_INT64_VEC2_ARB"},
+        {36842ULL, "GL_INT64_VEC3_ARB"},
+        {36843ULL, "GL_INT64_VEC4_ARB"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36853ULL, "GL_UNSIGNED_INT64_VEC2_ARB"},
+        {36854ULL, "GL_UNSIGNED_INT64_VEC3_ARB"},
+        {36855ULL, "GL_UNSIGNED_INT64_VEC4_ARB"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36860ULL, "GL_DOUBLE_VEC2"},
+        {36861ULL, "GL_DOUBLE_VEC3"},
+        {36862ULL, "GL_DOUBLE_VEC4"},
+        {0, nullptr},
+        {5124ULL, "GL_INT"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5126ULL, "GL_FLOAT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {5130ULL, "GL_DOUBLE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {5134ULL, "GL_INT64_NV"},
+        {5135ULL, "GL_UNSIGNED_INT64_NV"},
+        {36876ULL, "GL_SAMPLER_CUBE_MAP_ARRAY"},
+        {36877ULL, "GL_SAMPLER_CUBE_MAP_ARRAY_SHADOW"},
+        {36878ULL, "GL_INT_SAMPLER_CUBE_MAP_ARRAY"},
+        {36879ULL, "GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37128ULL, "GL_SAMPLER_2D_MULTISAMPLE"},
+        {37129ULL, "GL_INT_SAMPLER_2D_MULTISAMPLE"},
+        {37130ULL, "GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE"},
+        {37131ULL, "GL_SAMPLER_2D_MULTISAMPLE_ARRAY"},
+        {37132ULL, "GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY"},
+        {37133ULL, "GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36678ULL, "GL_DOUBLE_MAT2"},
+        {36679ULL, "GL_DOUBLE_MAT3"},
+        {36680ULL, "GL_DOUBLE_MAT4"},
+        {36681ULL, "GL_DOUBLE_MAT2x3"},
+        {36682ULL, "GL_DOUBLE_MAT2x4"},
+        {36683ULL, "GL_DOUBLE_MAT3x2"},
+        {36684ULL, "GL_DOUBLE_MAT3x4"},
+        {36685ULL, "GL_DOUBLE_MAT4x2"},
+        {36686ULL, "GL_DOUBLE_MAT4x3"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36940ULL, "GL_IMAGE_1D"},
+        {36941ULL, "GL_IMAGE_2D"},
+        {36942ULL, "GL_IMAGE_3D"},
+        {36943ULL, "GL_IMAGE_2D_RECT"},
+        {36944ULL, "GL_IMAGE_CUBE"},
+        {36945ULL, "GL_IMAGE_BUFFER"},
+        {36946ULL, "GL_IMAGE_1D_ARRAY"},
+        {36947ULL, "GL_IMAGE_2D_ARRAY"},
+        {36948ULL, "GL_IMAGE_CUBE_MAP_ARRAY"},
+        {36949ULL, "GL_IMAGE_2D_MULTISAMPLE"},
+        {36950ULL, "GL_IMAGE_2D_MULTISAMPLE_ARRAY"},
+        {36951ULL, "GL_INT_IMAGE_1D"},
+        {36952ULL, "GL_INT_IMAGE_2D"},
+        {36953ULL, "GL_INT_IMAGE_3D"},
+        {36954ULL, "GL_INT_IMAGE_2D_RECT"},
+        {36955ULL, "GL_INT_IMAGE_CUBE"},
+        {36956ULL, "GL_INT_IMAGE_BUFFER"},
+        {36957ULL, "GL_INT_IMAGE_1D_ARRAY"},
+        {36958ULL, "GL_INT_IMAGE_2D_ARRAY"},
+        {36959ULL, "GL_INT_IMAGE_CUBE_MAP_ARRAY"},
+        {36960ULL, "GL_INT_IMAGE_2D_MULTISAMPLE"},
+        {36961ULL, "GL_INT_IMAGE_2D_MULTISAMPLE_ARRAY"},
+        {36962ULL, "GL_UNSIGNED_INT_IMAGE_1D"},
+        {36963ULL, "GL_UNSIGNED_INT_IMAGE_2D"},
+        {36964ULL, "GL_UNSIGNED_INT_IMAGE_3D"},
+        {36965ULL, "GL_UNSIGNED_INT_IMAGE_2D_RECT"},
+        {36966ULL, "GL_UNSIGNED_INT_IMAGE_CUBE"},
+        {36967ULL, "GL_UNSIGNED_INT_IMAGE_BUFFER"},
+        {36968ULL, "GL_UNSIGNED_INT_IMAGE_1D_ARRAY"},
+        {36969ULL, "GL_UNSIGNED_INT_IMAGE_2D_ARRAY"},
+        {36970ULL, "GL_UNSIGNED_INT_IMAGE_CUBE_MAP_ARRAY"},
+        {36971ULL, "GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE"},
+        {36972ULL, "GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36290ULL, "GL_SAMPLER_BUFFER"},
+        {36291ULL, "GL_SAMPLER_1D_ARRAY_SHADOW"},
+        {36292ULL, "GL_SAMPLER_2D_ARRAY_SHADOW"},
+        {36293ULL, "GL_SAMPLER_CUBE_SHADOW"},
+        {36294ULL, "GL_UNSIGNED_INT_VEC2"},
+        {36295ULL, "GL_UNSIGNED_INT_VEC3"},
+        {36296ULL, "GL_UNSIGNED_INT_VEC4"},
+        {36297ULL, "GL_INT_SAMPLER_1D"},
+        {36298ULL, "GL_INT_SAMPLER_2D"},
+        {36299ULL, "GL_INT_SAMPLER_3D"},
+        {36300ULL, "GL_INT_SAMPLER_CUBE"},
+        {36301ULL, "GL_INT_SAMPLER_2D_RECT"},
+        {36302ULL, "GL_INT_SAMPLER_1D_ARRAY"},
+        {36303ULL, "GL_INT_SAMPLER_2D_ARRAY"},
+        {36304ULL, "GL_INT_SAMPLER_BUFFER"},
+        {36305ULL, "GL_UNSIGNED_INT_SAMPLER_1D"},
+        {36306ULL, "GL_UNSIGNED_INT_SAMPLER_2D"},
+        {36307ULL, "GL_UNSIGNED_INT_SAMPLER_3D"},
+        {36308ULL, "GL_UNSIGNED_INT_SAMPLER_CUBE"},
+        {36309ULL, "GL_UNSIGNED_INT_SAMPLER_2D_RECT"},
+        {36310ULL, "GL_UNSIGNED_INT_SAMPLER_1D_ARRAY"},
+        {36311ULL, "GL_UNSIGNED_INT_SAMPLER_2D_ARRAY"},
+        {36312ULL, "GL_UNSIGNED_INT_SAMPLER_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry BindTransformFeedbackTarget[1] = {
+        {36386ULL, "GL_TRANSFORM_FEEDBACK"},
+    };
+
+    inline constexpr Entry BinormalPointerTypeEXT[7] = {
+        {5124ULL, "GL_INT"},
+        {0, nullptr},
+        {5126ULL, "GL_FLOAT"},
+        {5120ULL, "GL_BYTE"},
+        {0, nullptr},
+        {5122ULL, "GL_SHORT"},
+        {5130ULL, "GL_DOUBLE"},
+    };
+
+    inline constexpr Entry BlendEquationModeEXT[14] = {
+        {32774ULL, "GL_FUNC_ADD"},
+        {32775ULL, "GL_MIN"},
+        {32776ULL, "GL_MAX"},
+        {0, nullptr},
+        {32778ULL, "GL_FUNC_SUBTRACT"},
+        {32779ULL, "GL_FUNC_REVERSE_SUBTRACT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33568ULL, "GL_ALPHA_MIN_SGIX"},
+        {33569ULL, "GL_ALPHA_MAX_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry BlendingFactor[39] = {
+        {0ULL, "GL_ZERO"},
+        {1ULL, "GL_ONE"},
+        {0, nullptr},
+        {0, nullptr},
+        {35065ULL, "GL_SRC1_COLOR"},
+        {35066ULL, "GL_ONE_MINUS_SRC1_COLOR"},
+        {35067ULL, "GL_ONE_MINUS_SRC1_ALPHA"},
+        {0, nullptr},
+        {0, nullptr},
+        {32769ULL, "GL_CONSTANT_COLOR"},
+        {32770ULL, "GL_ONE_MINUS_CONSTANT_COLOR"},
+        {32771ULL, "GL_CONSTANT_ALPHA"},
+        {32772ULL, "GL_ONE_MINUS_CONSTANT_ALPHA"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34185ULL, "GL_SRC1_ALPHA"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {768ULL, "GL_SRC_COLOR"},
+        {769ULL, "GL_ONE_MINUS_SRC_COLOR"},
+        {770ULL, "GL_SRC_ALPHA"},
+        {771ULL, "GL_ONE_MINUS_SRC_ALPHA"},
+        {772ULL, "GL_DST_ALPHA"},
+        {773ULL, "GL_ONE_MINUS_DST_ALPHA"},
+        {774ULL, "GL_DST_COLOR"},
+        {775ULL, "GL_ONE_MINUS_DST_COLOR"},
+        {776ULL, "GL_SRC_ALPHA_SATURATE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry BlitFramebufferFilter[2] = {
+        {9728ULL, "GL_NEAREST"},
+        {9729ULL, "GL_LINEAR"},
+    };
+
+    inline constexpr Entry Boolean[2] = {
+        {0ULL, "GL_FALSE"},
+        {1ULL, "GL_TRUE"},
+    };
+
+    inline constexpr Entry Buffer[3] = {
+        {6144ULL, "GL_COLOR"},
+        {6145ULL, "GL_DEPTH"},
+        {6146ULL, "GL_STENCIL"},
+    };
+
+    inline constexpr Entry BufferAccessARB[3] = {
+        {35001ULL, "GL_WRITE_ONLY"},
+        {35002ULL, "GL_READ_WRITE"},
+        {35000ULL, "GL_READ_ONLY"},
+    };
+
+    inline constexpr Entry BufferBitQCOM[37] = {
+        {0, nullptr},
+        {1ULL, "GL_COLOR_BUFFER_BIT0_QCOM"},
+        {2ULL, "GL_COLOR_BUFFER_BIT1_QCOM"},
+        {67108864ULL, "GL_MULTISAMPLE_BUFFER_BIT2_QCOM"},
+        {4ULL, "GL_COLOR_BUFFER_BIT2_QCOM"},
+        {8388608ULL, "GL_STENCIL_BUFFER_BIT7_QCOM"},
+        {134217728ULL, "GL_MULTISAMPLE_BUFFER_BIT3_QCOM"},
+        {0, nullptr},
+        {8ULL, "GL_COLOR_BUFFER_BIT3_QCOM"},
+        {65536ULL, "GL_STENCIL_BUFFER_BIT0_QCOM"},
+        {16777216ULL, "GL_MULTISAMPLE_BUFFER_BIT0_QCOM"},
+        {1073741824ULL, "GL_MULTISAMPLE_BUFFER_BIT6_QCOM"},
+        {268435456ULL, "GL_MULTISAMPLE_BUFFER_BIT4_QCOM"},
+        {2048ULL, "GL_DEPTH_BUFFER_BIT3_QCOM"},
+        {0, nullptr},
+        {8192ULL, "GL_DEPTH_BUFFER_BIT5_QCOM"},
+        {16ULL, "GL_COLOR_BUFFER_BIT4_QCOM"},
+        {128ULL, "GL_COLOR_BUFFER_BIT7_QCOM"},
+        {131072ULL, "GL_STENCIL_BUFFER_BIT1_QCOM"},
+        {0, nullptr},
+        {33554432ULL, "GL_MULTISAMPLE_BUFFER_BIT1_QCOM"},
+        {4194304ULL, "GL_STENCIL_BUFFER_BIT6_QCOM"},
+        {2147483648ULL, "GL_MULTISAMPLE_BUFFER_BIT7_QCOM"},
+        {32768ULL, "GL_DEPTH_BUFFER_BIT7_QCOM"},
+        {536870912ULL, "GL_MULTISAMPLE_BUFFER_BIT5_QCOM"},
+        {1024ULL, "GL_DEPTH_BUFFER_BIT2_QCOM"},
+        {4096ULL, "GL_DEPTH_BUFFER_BIT4_QCOM"},
+        {64ULL, "GL_COLOR_BUFFER_BIT6_QCOM"},
+        {0, nullptr},
+        {2097152ULL, "GL_STENCIL_BUFFER_BIT5_QCOM"},
+        {16384ULL, "GL_DEPTH_BUFFER_BIT6_QCOM"},
+        {512ULL, "GL_DEPTH_BUFFER_BIT1_QCOM"},
+        {32ULL, "GL_COLOR_BUFFER_BIT5_QCOM"},
+        {1048576ULL, "GL_STENCIL_BUFFER_BIT4_QCOM"},
+        {256ULL, "GL_DEPTH_BUFFER_BIT0_QCOM"},
+        {524288ULL, "GL_STENCIL_BUFFER_BIT3_QCOM"},
+        {262144ULL, "GL_STENCIL_BUFFER_BIT2_QCOM"},
+    };
+
+    inline constexpr Entry BufferPNameARB[13] = {
+        {0, nullptr},
+        {0, nullptr},
+        {34660ULL, "GL_BUFFER_SIZE"},
+        {34661ULL, "GL_BUFFER_USAGE"},
+        {0, nullptr},
+        {33311ULL, "GL_BUFFER_IMMUTABLE_STORAGE"},
+        {33312ULL, "GL_BUFFER_STORAGE_FLAGS"},
+        {35003ULL, "GL_BUFFER_ACCESS"},
+        {35004ULL, "GL_BUFFER_MAPPED"},
+        {0, nullptr},
+        {37151ULL, "GL_BUFFER_ACCESS_FLAGS"},
+        {37152ULL, "GL_BUFFER_MAP_LENGTH"},
+        {37153ULL, "GL_BUFFER_MAP_OFFSET"},
+    };
+
+    inline constexpr Entry BufferPointerNameARB[1] = {
+        {35005ULL, "GL_BUFFER_MAP_POINTER"},
+    };
+
+    inline constexpr Entry BufferStorageMask[19] = {
+        {0, nullptr},
+        {1ULL, "GL_MAP_READ_BIT"},
+        {2ULL, "GL_MAP_WRITE_BIT"},
+        {8192ULL, "GL_EXTERNAL_STORAGE_BIT_NVX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {64ULL, "GL_MAP_PERSISTENT_BIT"},
+        {0, nullptr},
+        {256ULL, "GL_DYNAMIC_STORAGE_BIT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {128ULL, "GL_MAP_COHERENT_BIT"},
+        {2048ULL, "GL_PER_GPU_STORAGE_BIT_NV"},
+        {0, nullptr},
+        {1024ULL, "GL_SPARSE_STORAGE_BIT_ARB"},
+        {512ULL, "GL_CLIENT_STORAGE_BIT"},
+    };
+
+    inline constexpr Entry BufferStorageTarget[29] = {
+        {0, nullptr},
+        {37266ULL, "GL_QUERY_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36662ULL, "GL_COPY_READ_BUFFER"},
+        {36663ULL, "GL_COPY_WRITE_BUFFER"},
+        {0, nullptr},
+        {35882ULL, "GL_TEXTURE_BUFFER"},
+        {0, nullptr},
+        {37102ULL, "GL_DISPATCH_INDIRECT_BUFFER"},
+        {37074ULL, "GL_SHADER_STORAGE_BUFFER"},
+        {37568ULL, "GL_ATOMIC_COUNTER_BUFFER"},
+        {0, nullptr},
+        {36671ULL, "GL_DRAW_INDIRECT_BUFFER"},
+        {0, nullptr},
+        {34962ULL, "GL_ARRAY_BUFFER"},
+        {34963ULL, "GL_ELEMENT_ARRAY_BUFFER"},
+        {35051ULL, "GL_PIXEL_PACK_BUFFER"},
+        {35052ULL, "GL_PIXEL_UNPACK_BUFFER"},
+        {0, nullptr},
+        {35982ULL, "GL_TRANSFORM_FEEDBACK_BUFFER"},
+        {35345ULL, "GL_UNIFORM_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry BufferTargetARB[29] = {
+        {0, nullptr},
+        {37266ULL, "GL_QUERY_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {33006ULL, "GL_PARAMETER_BUFFER"},
+        {0, nullptr},
+        {36662ULL, "GL_COPY_READ_BUFFER"},
+        {36663ULL, "GL_COPY_WRITE_BUFFER"},
+        {0, nullptr},
+        {35882ULL, "GL_TEXTURE_BUFFER"},
+        {0, nullptr},
+        {37102ULL, "GL_DISPATCH_INDIRECT_BUFFER"},
+        {37074ULL, "GL_SHADER_STORAGE_BUFFER"},
+        {37568ULL, "GL_ATOMIC_COUNTER_BUFFER"},
+        {0, nullptr},
+        {36671ULL, "GL_DRAW_INDIRECT_BUFFER"},
+        {0, nullptr},
+        {34962ULL, "GL_ARRAY_BUFFER"},
+        {34963ULL, "GL_ELEMENT_ARRAY_BUFFER"},
+        {35051ULL, "GL_PIXEL_PACK_BUFFER"},
+        {35052ULL, "GL_PIXEL_UNPACK_BUFFER"},
+        {0, nullptr},
+        {35982ULL, "GL_TRANSFORM_FEEDBACK_BUFFER"},
+        {35345ULL, "GL_UNIFORM_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry BufferUsageARB[11] = {
+        {35046ULL, "GL_STATIC_COPY"},
+        {0, nullptr},
+        {35048ULL, "GL_DYNAMIC_DRAW"},
+        {35049ULL, "GL_DYNAMIC_READ"},
+        {35050ULL, "GL_DYNAMIC_COPY"},
+        {35040ULL, "GL_STREAM_DRAW"},
+        {35041ULL, "GL_STREAM_READ"},
+        {35042ULL, "GL_STREAM_COPY"},
+        {0, nullptr},
+        {35044ULL, "GL_STATIC_DRAW"},
+        {35045ULL, "GL_STATIC_READ"},
+    };
+
+    inline constexpr Entry CheckFramebufferStatusTarget[3] = {
+        {36009ULL, "GL_DRAW_FRAMEBUFFER"},
+        {36160ULL, "GL_FRAMEBUFFER"},
+        {36008ULL, "GL_READ_FRAMEBUFFER"},
+    };
+
+    inline constexpr Entry ClampColorModeARB[7] = {
+        {0ULL, "GL_FALSE"},
+        {1ULL, "GL_TRUE"},
+        {0, nullptr},
+        {35101ULL, "GL_FIXED_ONLY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry ClampColorTargetARB[3] = {
+        {35100ULL, "GL_CLAMP_READ_COLOR"},
+        {35098ULL, "GL_CLAMP_VERTEX_COLOR_ARB"},
+        {35099ULL, "GL_CLAMP_FRAGMENT_COLOR_ARB"},
+    };
+
+    inline constexpr Entry ClearBufferMask[11] = {
+        {0, nullptr},
+        {1024ULL, "GL_STENCIL_BUFFER_BIT"},
+        {0, nullptr},
+        {256ULL, "GL_DEPTH_BUFFER_BIT"},
+        {0, nullptr},
+        {16384ULL, "GL_COLOR_BUFFER_BIT"},
+        {512ULL, "GL_ACCUM_BUFFER_BIT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32768ULL, "GL_COVERAGE_BUFFER_BIT_NV"},
+    };
+
+    inline constexpr Entry ClientAttribMask[3] = {
+        {4294967295ULL, "GL_CLIENT_ALL_ATTRIB_BITS"},
+        {1ULL, "GL_CLIENT_PIXEL_STORE_BIT"},
+        {2ULL, "GL_CLIENT_VERTEX_ARRAY_BIT"},
+    };
+
+    inline constexpr Entry ClipControlDepth[2] = {
+        {37726ULL, "GL_NEGATIVE_ONE_TO_ONE"},
+        {37727ULL, "GL_ZERO_TO_ONE"},
+    };
+
+    inline constexpr Entry ClipControlOrigin[2] = {
+        {36002ULL, "GL_UPPER_LEFT"},
+        {36001ULL, "GL_LOWER_LEFT"},
+    };
+
+    inline constexpr Entry ClipPlaneName[8] = {
+        {12288ULL, "GL_CLIP_PLANE0"},
+        {12289ULL, "GL_CLIP_PLANE1"},
+        {12290ULL, "GL_CLIP_PLANE2"},
+        {12291ULL, "GL_CLIP_PLANE3"},
+        {12292ULL, "GL_CLIP_PLANE4"},
+        {12293ULL, "GL_CLIP_PLANE5"},
+        {12294ULL, "GL_CLIP_DISTANCE6"},
+        {12295ULL, "GL_CLIP_DISTANCE7"},
+    };
+
+    inline constexpr Entry ColorBuffer[61] = {
+        {0ULL, "GL_NONE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36064ULL, "GL_COLOR_ATTACHMENT0"},
+        {36065ULL, "GL_COLOR_ATTACHMENT1"},
+        {36066ULL, "GL_COLOR_ATTACHMENT2"},
+        {36067ULL, "GL_COLOR_ATTACHMENT3"},
+        {36068ULL, "GL_COLOR_ATTACHMENT4"},
+        {36069ULL, "GL_COLOR_ATTACHMENT5"},
+        {36070ULL, "GL_COLOR_ATTACHMENT6"},
+        {36071ULL, "GL_COLOR_ATTACHMENT7"},
+        {36072ULL, "GL_COLOR_ATTACHMENT8"},
+        {36073ULL, "GL_COLOR_ATTACHMENT9"},
+        {36074ULL, "GL_COLOR_ATTACHMENT10"},
+        {36075ULL, "GL_COLOR_ATTACHMENT11"},
+        {36076ULL, "GL_COLOR_ATTACHMENT12"},
+        {36077ULL, "GL_COLOR_ATTACHMENT13"},
+        {36078ULL, "GL_COLOR_ATTACHMENT14"},
+        {36079ULL, "GL_COLOR_ATTACHMENT15"},
+        {36080ULL, "GL_COLOR_ATTACHMENT16"},
+        {36081ULL, "GL_COLOR_ATTACHMENT17"},
+        {36082ULL, "GL_COLOR_ATTACHMENT18"},
+        {36083ULL, "GL_COLOR_ATTACHMENT19"},
+        {36084ULL, "GL_COLOR_ATTACHMENT20"},
+        {36085ULL, "GL_COLOR_ATTACHMENT21"},
+        {36086ULL, "GL_COLOR_ATTACHMENT22"},
+        {36087ULL, "GL_COLOR_ATTACHMENT23"},
+        {36088ULL, "GL_COLOR_ATTACHMENT24"},
+        {36089ULL, "GL_COLOR_ATTACHMENT25"},
+        {36090ULL, "GL_COLOR_ATTACHMENT26"},
+        {36091ULL, "GL_COLOR_ATTACHMENT27"},
+        {36092ULL, "GL_COLOR_ATTACHMENT28"},
+        {36093ULL, "GL_COLOR_ATTACHMENT29"},
+        {36094ULL, "GL_COLOR_ATTACHMENT30"},
+        {36095ULL, "GL_COLOR_ATTACHMENT31"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {1024ULL, "GL_FRONT_LEFT"},
+        {1025ULL, "GL_FRONT_RIGHT"},
+        {1026ULL, "GL_BACK_LEFT"},
+        {1027ULL, "GL_BACK_RIGHT"},
+        {1028ULL, "GL_FRONT"},
+        {1029ULL, "GL_BACK"},
+        {1030ULL, "GL_LEFT"},
+        {1031ULL, "GL_RIGHT"},
+        {1032ULL, "GL_FRONT_AND_BACK"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry ColorMaterialFace[5] = {
+        {0, nullptr},
+        {0, nullptr},
+        {1032ULL, "GL_FRONT_AND_BACK"},
+        {1028ULL, "GL_FRONT"},
+        {1029ULL, "GL_BACK"},
+    };
+
+    inline constexpr Entry ColorMaterialParameter[10] = {
+        {4610ULL, "GL_SPECULAR"},
+        {0, nullptr},
+        {5632ULL, "GL_EMISSION"},
+        {0, nullptr},
+        {5634ULL, "GL_AMBIENT_AND_DIFFUSE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {4608ULL, "GL_AMBIENT"},
+        {4609ULL, "GL_DIFFUSE"},
+    };
+
+    inline constexpr Entry ColorPointerType[6] = {
+        {0, nullptr},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5120ULL, "GL_BYTE"},
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {0, nullptr},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+    };
+
+    inline constexpr Entry ColorTableParameterPNameSGI[10] = {
+        {32990ULL, "GL_COLOR_TABLE_LUMINANCE_SIZE"},
+        {32991ULL, "GL_COLOR_TABLE_INTENSITY_SIZE"},
+        {32982ULL, "GL_COLOR_TABLE_SCALE"},
+        {32983ULL, "GL_COLOR_TABLE_BIAS"},
+        {32984ULL, "GL_COLOR_TABLE_FORMAT"},
+        {32985ULL, "GL_COLOR_TABLE_WIDTH"},
+        {32986ULL, "GL_COLOR_TABLE_RED_SIZE"},
+        {32987ULL, "GL_COLOR_TABLE_GREEN_SIZE"},
+        {32988ULL, "GL_COLOR_TABLE_BLUE_SIZE"},
+        {32989ULL, "GL_COLOR_TABLE_ALPHA_SIZE"},
+    };
+
+    inline constexpr Entry ColorTableTarget[3] = {
+        {32976ULL, "GL_COLOR_TABLE"},
+        {32977ULL, "GL_POST_CONVOLUTION_COLOR_TABLE"},
+        {32978ULL, "GL_POST_COLOR_MATRIX_COLOR_TABLE"},
+    };
+
+    inline constexpr Entry ColorTableTargetSGI[9] = {
+        {32976ULL, "GL_COLOR_TABLE"},
+        {32977ULL, "GL_POST_CONVOLUTION_COLOR_TABLE"},
+        {32978ULL, "GL_POST_COLOR_MATRIX_COLOR_TABLE"},
+        {32979ULL, "GL_PROXY_COLOR_TABLE"},
+        {32980ULL, "GL_PROXY_POST_CONVOLUTION_COLOR_TABLE"},
+        {32981ULL, "GL_PROXY_POST_COLOR_MATRIX_COLOR_TABLE"},
+        {0, nullptr},
+        {32956ULL, "GL_TEXTURE_COLOR_TABLE_SGI"},
+        {32957ULL, "GL_PROXY_TEXTURE_COLOR_TABLE_SGI"},
+    };
+
+    inline constexpr Entry CombinerBiasNV[2] = {
+        {0ULL, "GL_NONE"},
+        {34113ULL, "GL_BIAS_BY_NEGATIVE_ONE_HALF_NV"},
+    };
+
+    inline constexpr Entry CombinerComponentUsageNV[3] = {
+        {6405ULL, "GL_BLUE"},
+        {6406ULL, "GL_ALPHA"},
+        {6407ULL, "GL_RGB"},
+    };
+
+    inline constexpr Entry CombinerMappingNV[8] = {
+        {34104ULL, "GL_EXPAND_NORMAL_NV"},
+        {34105ULL, "GL_EXPAND_NEGATE_NV"},
+        {34106ULL, "GL_HALF_BIAS_NORMAL_NV"},
+        {34107ULL, "GL_HALF_BIAS_NEGATE_NV"},
+        {34108ULL, "GL_SIGNED_IDENTITY_NV"},
+        {34109ULL, "GL_SIGNED_NEGATE_NV"},
+        {34102ULL, "GL_UNSIGNED_IDENTITY_NV"},
+        {34103ULL, "GL_UNSIGNED_INVERT_NV"},
+    };
+
+    inline constexpr Entry CombinerParameterNV[3] = {
+        {34116ULL, "GL_COMBINER_COMPONENT_USAGE_NV"},
+        {34114ULL, "GL_COMBINER_INPUT_NV"},
+        {34115ULL, "GL_COMBINER_MAPPING_NV"},
+    };
+
+    inline constexpr Entry CombinerPortionNV[2] = {
+        {6406ULL, "GL_ALPHA"},
+        {6407ULL, "GL_RGB"},
+    };
+
+    inline constexpr Entry CombinerRegisterNV[13] = {
+        {0, nullptr},
+        {0, nullptr},
+        {33984ULL, "GL_TEXTURE0_ARB"},
+        {33985ULL, "GL_TEXTURE1_ARB"},
+        {0, nullptr},
+        {0, nullptr},
+        {34092ULL, "GL_PRIMARY_COLOR_NV"},
+        {34093ULL, "GL_SECONDARY_COLOR_NV"},
+        {34094ULL, "GL_SPARE0_NV"},
+        {34095ULL, "GL_SPARE1_NV"},
+        {34096ULL, "GL_DISCARD_NV"},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry CombinerScaleNV[12] = {
+        {0ULL, "GL_NONE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34110ULL, "GL_SCALE_BY_TWO_NV"},
+        {34111ULL, "GL_SCALE_BY_FOUR_NV"},
+        {34112ULL, "GL_SCALE_BY_ONE_HALF_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry CombinerStageNV[8] = {
+        {34128ULL, "GL_COMBINER0_NV"},
+        {34129ULL, "GL_COMBINER1_NV"},
+        {34130ULL, "GL_COMBINER2_NV"},
+        {34131ULL, "GL_COMBINER3_NV"},
+        {34132ULL, "GL_COMBINER4_NV"},
+        {34133ULL, "GL_COMBINER5_NV"},
+        {34134ULL, "GL_COMBINER6_NV"},
+        {34135ULL, "GL_COMBINER7_NV"},
+    };
+
+    inline constexpr Entry CombinerVariableNV[7] = {
+        {34083ULL, "GL_VARIABLE_A_NV"},
+        {34084ULL, "GL_VARIABLE_B_NV"},
+        {34085ULL, "GL_VARIABLE_C_NV"},
+        {34086ULL, "GL_VARIABLE_D_NV"},
+        {34087ULL, "GL_VARIABLE_E_NV"},
+        {34088ULL, "GL_VARIABLE_F_NV"},
+        {34089ULL, "GL_VARIABLE_G_NV"},
+    };
+
+    inline constexpr Entry CommandOpcodesNV[19] = {
+        {0ULL, "GL_TERMINATE_SEQUENCE_COMMAND_NV"},
+        {1ULL, "GL_NOP_COMMAND_NV"},
+        {2ULL, "GL_DRAW_ELEMENTS_COMMAND_NV"},
+        {3ULL, "GL_DRAW_ARRAYS_COMMAND_NV"},
+        {4ULL, "GL_DRAW_ELEMENTS_STRIP_COMMAND_NV"},
+        {5ULL, "GL_DRAW_ARRAYS_STRIP_COMMAND_NV"},
+        {6ULL, "GL_DRAW_ELEMENTS_INSTANCED_COMMAND_NV"},
+        {7ULL, "GL_DRAW_ARRAYS_INSTANCED_COMMAND_NV"},
+        {8ULL, "GL_ELEMENT_ADDRESS_COMMAND_NV"},
+        {9ULL, "GL_ATTRIBUTE_ADDRESS_COMMAND_NV"},
+        {10ULL, "GL_UNIFORM_ADDRESS_COMMAND_NV"},
+        {11ULL, "GL_BLEND_COLOR_COMMAND_NV"},
+        {12ULL, "GL_STENCIL_REF_COMMAND_NV"},
+        {13ULL, "GL_LINE_WIDTH_COMMAND_NV"},
+        {14ULL, "GL_POLYGON_OFFSET_COMMAND_NV"},
+        {15ULL, "GL_ALPHA_REF_COMMAND_NV"},
+        {16ULL, "GL_VIEWPORT_COMMAND_NV"},
+        {17ULL, "GL_SCISSOR_COMMAND_NV"},
+        {18ULL, "GL_FRONT_FACE_COMMAND_NV"},
+    };
+
+    inline constexpr Entry ConditionalRenderMode[8] = {
+        {36376ULL, "GL_QUERY_NO_WAIT_INVERTED"},
+        {36377ULL, "GL_QUERY_BY_REGION_WAIT_INVERTED"},
+        {36378ULL, "GL_QUERY_BY_REGION_NO_WAIT_INVERTED"},
+        {36371ULL, "GL_QUERY_WAIT"},
+        {36372ULL, "GL_QUERY_NO_WAIT"},
+        {36373ULL, "GL_QUERY_BY_REGION_WAIT"},
+        {36374ULL, "GL_QUERY_BY_REGION_NO_WAIT"},
+        {36375ULL, "GL_QUERY_WAIT_INVERTED"},
+    };
+
+    inline constexpr Entry ContextFlagMask[9] = {
+        {0, nullptr},
+        {1ULL, "GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT"},
+        {2ULL, "GL_CONTEXT_FLAG_DEBUG_BIT"},
+        {0, nullptr},
+        {4ULL, "GL_CONTEXT_FLAG_ROBUST_ACCESS_BIT"},
+        {0, nullptr},
+        {0, nullptr},
+        {16ULL, "GL_CONTEXT_FLAG_PROTECTED_CONTENT_BIT_EXT"},
+        {8ULL, "GL_CONTEXT_FLAG_NO_ERROR_BIT"},
+    };
+
+    inline constexpr Entry ContextProfileMask[2] = {
+        {2ULL, "GL_CONTEXT_COMPATIBILITY_PROFILE_BIT"},
+        {1ULL, "GL_CONTEXT_CORE_PROFILE_BIT"},
+    };
+
+    inline constexpr Entry ConvolutionBorderModeEXT[1] = {
+        {32790ULL, "GL_REDUCE"},
+    };
+
+    inline constexpr Entry ConvolutionParameterEXT[3] = {
+        {32787ULL, "GL_CONVOLUTION_BORDER_MODE"},
+        {32788ULL, "GL_CONVOLUTION_FILTER_SCALE"},
+        {32789ULL, "GL_CONVOLUTION_FILTER_BIAS"},
+    };
+
+    inline constexpr Entry ConvolutionTarget[2] = {
+        {32784ULL, "GL_CONVOLUTION_1D"},
+        {32785ULL, "GL_CONVOLUTION_2D"},
+    };
+
+    inline constexpr Entry ConvolutionTargetEXT[2] = {
+        {32784ULL, "GL_CONVOLUTION_1D"},
+        {32785ULL, "GL_CONVOLUTION_2D"},
+    };
+
+    inline constexpr Entry CopyBufferSubDataTarget[29] = {
+        {0, nullptr},
+        {37266ULL, "GL_QUERY_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36662ULL, "GL_COPY_READ_BUFFER"},
+        {36663ULL, "GL_COPY_WRITE_BUFFER"},
+        {0, nullptr},
+        {35882ULL, "GL_TEXTURE_BUFFER"},
+        {0, nullptr},
+        {37102ULL, "GL_DISPATCH_INDIRECT_BUFFER"},
+        {37074ULL, "GL_SHADER_STORAGE_BUFFER"},
+        {37568ULL, "GL_ATOMIC_COUNTER_BUFFER"},
+        {0, nullptr},
+        {36671ULL, "GL_DRAW_INDIRECT_BUFFER"},
+        {0, nullptr},
+        {34962ULL, "GL_ARRAY_BUFFER"},
+        {34963ULL, "GL_ELEMENT_ARRAY_BUFFER"},
+        {35051ULL, "GL_PIXEL_PACK_BUFFER"},
+        {35052ULL, "GL_PIXEL_UNPACK_BUFFER"},
+        {0, nullptr},
+        {35982ULL, "GL_TRANSFORM_FEEDBACK_BUFFER"},
+        {35345ULL, "GL_UNIFORM_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry CopyImageSubDataTarget[24] = {
+        {3552ULL, "GL_TEXTURE_1D"},
+        {3553ULL, "GL_TEXTURE_2D"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34037ULL, "GL_TEXTURE_RECTANGLE"},
+        {0, nullptr},
+        {0, nullptr},
+        {35864ULL, "GL_TEXTURE_1D_ARRAY"},
+        {36873ULL, "GL_TEXTURE_CUBE_MAP_ARRAY"},
+        {35866ULL, "GL_TEXTURE_2D_ARRAY"},
+        {34067ULL, "GL_TEXTURE_CUBE_MAP"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37120ULL, "GL_TEXTURE_2D_MULTISAMPLE"},
+        {36161ULL, "GL_RENDERBUFFER"},
+        {37122ULL, "GL_TEXTURE_2D_MULTISAMPLE_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32879ULL, "GL_TEXTURE_3D"},
+    };
+
+    inline constexpr Entry CullFaceMode[5] = {
+        {0, nullptr},
+        {0, nullptr},
+        {1032ULL, "GL_FRONT_AND_BACK"},
+        {1028ULL, "GL_FRONT"},
+        {1029ULL, "GL_BACK"},
+    };
+
+    inline constexpr Entry CullParameterEXT[2] = {
+        {33196ULL, "GL_CULL_VERTEX_OBJECT_POSITION_EXT"},
+        {33195ULL, "GL_CULL_VERTEX_EYE_POSITION_EXT"},
+    };
+
+    inline constexpr Entry DataTypeEXT[3] = {
+        {34752ULL, "GL_MATRIX_EXT"},
+        {34750ULL, "GL_SCALAR_EXT"},
+        {34751ULL, "GL_VECTOR_EXT"},
+    };
+
+    inline constexpr Entry DebugSeverity[7] = {
+        {37191ULL, "GL_DEBUG_SEVERITY_MEDIUM"},
+        {37192ULL, "GL_DEBUG_SEVERITY_LOW"},
+        {0, nullptr},
+        {0, nullptr},
+        {33387ULL, "GL_DEBUG_SEVERITY_NOTIFICATION"},
+        {4352ULL, "GL_DONT_CARE"},
+        {37190ULL, "GL_DEBUG_SEVERITY_HIGH"},
+    };
+
+    inline constexpr Entry DebugSource[11] = {
+        {33352ULL, "GL_DEBUG_SOURCE_SHADER_COMPILER"},
+        {33353ULL, "GL_DEBUG_SOURCE_THIRD_PARTY"},
+        {33354ULL, "GL_DEBUG_SOURCE_APPLICATION"},
+        {33355ULL, "GL_DEBUG_SOURCE_OTHER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {4352ULL, "GL_DONT_CARE"},
+        {0, nullptr},
+        {33350ULL, "GL_DEBUG_SOURCE_API"},
+        {33351ULL, "GL_DEBUG_SOURCE_WINDOW_SYSTEM"},
+    };
+
+    inline constexpr Entry DebugType[17] = {
+        {4352ULL, "GL_DONT_CARE"},
+        {0, nullptr},
+        {33356ULL, "GL_DEBUG_TYPE_ERROR"},
+        {33357ULL, "GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR"},
+        {33358ULL, "GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR"},
+        {33359ULL, "GL_DEBUG_TYPE_PORTABILITY"},
+        {33360ULL, "GL_DEBUG_TYPE_PERFORMANCE"},
+        {33361ULL, "GL_DEBUG_TYPE_OTHER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33384ULL, "GL_DEBUG_TYPE_MARKER"},
+        {33385ULL, "GL_DEBUG_TYPE_PUSH_GROUP"},
+        {33386ULL, "GL_DEBUG_TYPE_POP_GROUP"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry DepthFunction[8] = {
+        {512ULL, "GL_NEVER"},
+        {513ULL, "GL_LESS"},
+        {514ULL, "GL_EQUAL"},
+        {515ULL, "GL_LEQUAL"},
+        {516ULL, "GL_GREATER"},
+        {517ULL, "GL_NOTEQUAL"},
+        {518ULL, "GL_GEQUAL"},
+        {519ULL, "GL_ALWAYS"},
+    };
+
+    inline constexpr Entry DrawBufferMode[61] = {
+        {0ULL, "GL_NONE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36064ULL, "GL_COLOR_ATTACHMENT0"},
+        {36065ULL, "GL_COLOR_ATTACHMENT1"},
+        {36066ULL, "GL_COLOR_ATTACHMENT2"},
+        {36067ULL, "GL_COLOR_ATTACHMENT3"},
+        {36068ULL, "GL_COLOR_ATTACHMENT4"},
+        {36069ULL, "GL_COLOR_ATTACHMENT5"},
+        {36070ULL, "GL_COLOR_ATTACHMENT6"},
+        {36071ULL, "GL_COLOR_ATTACHMENT7"},
+        {36072ULL, "GL_COLOR_ATTACHMENT8"},
+        {36073ULL, "GL_COLOR_ATTACHMENT9"},
+        {36074ULL, "GL_COLOR_ATTACHMENT10"},
+        {36075ULL, "GL_COLOR_ATTACHMENT11"},
+        {36076ULL, "GL_COLOR_ATTACHMENT12"},
+        {36077ULL, "GL_COLOR_ATTACHMENT13"},
+        {36078ULL, "GL_COLOR_ATTACHMENT14"},
+        {36079ULL, "GL_COLOR_ATTACHMENT15"},
+        {36080ULL, "GL_COLOR_ATTACHMENT16"},
+        {36081ULL, "GL_COLOR_ATTACHMENT17"},
+        {36082ULL, "GL_COLOR_ATTACHMENT18"},
+        {36083ULL, "GL_COLOR_ATTACHMENT19"},
+        {36084ULL, "GL_COLOR_ATTACHMENT20"},
+        {36085ULL, "GL_COLOR_ATTACHMENT21"},
+        {36086ULL, "GL_COLOR_ATTACHMENT22"},
+        {36087ULL, "GL_COLOR_ATTACHMENT23"},
+        {36088ULL, "GL_COLOR_ATTACHMENT24"},
+        {36089ULL, "GL_COLOR_ATTACHMENT25"},
+        {36090ULL, "GL_COLOR_ATTACHMENT26"},
+        {36091ULL, "GL_COLOR_ATTACHMENT27"},
+        {36092ULL, "GL_COLOR_ATTACHMENT28"},
+        {36093ULL, "GL_COLOR_ATTACHMENT29"},
+        {36094ULL, "GL_COLOR_ATTACHMENT30"},
+        {36095ULL, "GL_COLOR_ATTACHMENT31"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {1024ULL, "GL_FRONT_LEFT"},
+        {1025ULL, "GL_FRONT_RIGHT"},
+        {1026ULL, "GL_BACK_LEFT"},
+        {1027ULL, "GL_BACK_RIGHT"},
+        {1028ULL, "GL_FRONT"},
+        {1029ULL, "GL_BACK"},
+        {1030ULL, "GL_LEFT"},
+        {1031ULL, "GL_RIGHT"},
+        {1032ULL, "GL_FRONT_AND_BACK"},
+        {1033ULL, "GL_AUX0"},
+        {1034ULL, "GL_AUX1"},
+        {1035ULL, "GL_AUX2"},
+        {1036ULL, "GL_AUX3"},
+    };
+
+    inline constexpr Entry DrawBufferModeATI[16] = {
+        {36064ULL, "GL_COLOR_ATTACHMENT0_NV"},
+        {36065ULL, "GL_COLOR_ATTACHMENT1_NV"},
+        {36066ULL, "GL_COLOR_ATTACHMENT2_NV"},
+        {36067ULL, "GL_COLOR_ATTACHMENT3_NV"},
+        {36068ULL, "GL_COLOR_ATTACHMENT4_NV"},
+        {36069ULL, "GL_COLOR_ATTACHMENT5_NV"},
+        {36070ULL, "GL_COLOR_ATTACHMENT6_NV"},
+        {36071ULL, "GL_COLOR_ATTACHMENT7_NV"},
+        {36072ULL, "GL_COLOR_ATTACHMENT8_NV"},
+        {36073ULL, "GL_COLOR_ATTACHMENT9_NV"},
+        {36074ULL, "GL_COLOR_ATTACHMENT10_NV"},
+        {36075ULL, "GL_COLOR_ATTACHMENT11_NV"},
+        {36076ULL, "GL_COLOR_ATTACHMENT12_NV"},
+        {36077ULL, "GL_COLOR_ATTACHMENT13_NV"},
+        {36078ULL, "GL_COLOR_ATTACHMENT14_NV"},
+        {36079ULL, "GL_COLOR_ATTACHMENT15_NV"},
+    };
+
+    inline constexpr Entry DrawElementsType[3] = {
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+    };
+
+    inline constexpr Entry ElementPointerTypeATI[3] = {
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+    };
+
+    inline constexpr Entry EnableCap[1065] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33076ULL, "GL_TEXTURE_4D_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33081ULL, "GL_PIXEL_TEX_GEN_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36281ULL, "GL_FRAMEBUFFER_SRGB"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33096ULL, "GL_SPRITE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {10753ULL, "GL_POLYGON_OFFSET_POINT"},
+        {10754ULL, "GL_POLYGON_OFFSET_LINE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33149ULL, "GL_REFERENCE_PLANE_SGIX"},
+        {0, nullptr},
+        {33151ULL, "GL_IR_INSTRUMENT1_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33155ULL, "GL_CALLIGRAPHIC_FRAGMENT_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33163ULL, "GL_FRAMEZOOM_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33176ULL, "GL_FOG_OFFSET_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36433ULL, "GL_SAMPLE_MASK"},
+        {0, nullptr},
+        {38565ULL, "GL_SHADING_RATE_PRESERVE_ASPECT_RATIO_QCOM"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33275ULL, "GL_SHARED_TEXTURE_PALETTE_EXT"},
+        {3456ULL, "GL_AUTO_NORMAL"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3472ULL, "GL_MAP1_COLOR_4"},
+        {3473ULL, "GL_MAP1_INDEX"},
+        {3474ULL, "GL_MAP1_NORMAL"},
+        {3475ULL, "GL_MAP1_TEXTURE_COORD_1"},
+        {3476ULL, "GL_MAP1_TEXTURE_COORD_2"},
+        {3477ULL, "GL_MAP1_TEXTURE_COORD_3"},
+        {3478ULL, "GL_MAP1_TEXTURE_COORD_4"},
+        {3479ULL, "GL_MAP1_VERTEX_3"},
+        {3480ULL, "GL_MAP1_VERTEX_4"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34370ULL, "GL_PROGRAM_POINT_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34383ULL, "GL_DEPTH_CLAMP"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3504ULL, "GL_MAP2_COLOR_4"},
+        {3505ULL, "GL_MAP2_INDEX"},
+        {3506ULL, "GL_MAP2_NORMAL"},
+        {3507ULL, "GL_MAP2_TEXTURE_COORD_1"},
+        {3508ULL, "GL_MAP2_TEXTURE_COORD_2"},
+        {3509ULL, "GL_MAP2_TEXTURE_COORD_3"},
+        {3510ULL, "GL_MAP2_TEXTURE_COORD_4"},
+        {3511ULL, "GL_MAP2_VERTEX_3"},
+        {3512ULL, "GL_MAP2_VERTEX_4"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37600ULL, "GL_DEBUG_OUTPUT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33346ULL, "GL_DEBUG_OUTPUT_SYNCHRONOUS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3552ULL, "GL_TEXTURE_1D"},
+        {3553ULL, "GL_TEXTURE_2D"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {16384ULL, "GL_LIGHT0"},
+        {16385ULL, "GL_LIGHT1"},
+        {16386ULL, "GL_LIGHT2"},
+        {16387ULL, "GL_LIGHT3"},
+        {16388ULL, "GL_LIGHT4"},
+        {16389ULL, "GL_LIGHT5"},
+        {16390ULL, "GL_LIGHT6"},
+        {16391ULL, "GL_LIGHT7"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36765ULL, "GL_PRIMITIVE_RESTART"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33580ULL, "GL_ASYNC_HISTOGRAM_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {12288ULL, "GL_CLIP_PLANE0"},
+        {12289ULL, "GL_CLIP_PLANE1"},
+        {12290ULL, "GL_CLIP_PLANE2"},
+        {12291ULL, "GL_CLIP_PLANE3"},
+        {12292ULL, "GL_CLIP_PLANE4"},
+        {12293ULL, "GL_CLIP_PLANE5"},
+        {12294ULL, "GL_CLIP_DISTANCE6"},
+        {12295ULL, "GL_CLIP_DISTANCE7"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33619ULL, "GL_PIXEL_TEXTURE_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33628ULL, "GL_ASYNC_TEX_IMAGE_SGIX"},
+        {33629ULL, "GL_ASYNC_DRAW_PIXELS_SGIX"},
+        {33630ULL, "GL_ASYNC_READ_PIXELS_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2832ULL, "GL_POINT_SMOOTH"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2848ULL, "GL_LINE_SMOOTH"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2852ULL, "GL_LINE_STIPPLE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35894ULL, "GL_SAMPLE_SHADING"},
+        {0, nullptr},
+        {2881ULL, "GL_POLYGON_SMOOTH"},
+        {2882ULL, "GL_POLYGON_STIPPLE"},
+        {0, nullptr},
+        {2884ULL, "GL_CULL_FACE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2896ULL, "GL_LIGHTING"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2903ULL, "GL_COLOR_MATERIAL"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33792ULL, "GL_FRAGMENT_LIGHTING_SGIX"},
+        {33793ULL, "GL_FRAGMENT_COLOR_MATERIAL_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2912ULL, "GL_FOG"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33804ULL, "GL_FRAGMENT_LIGHT0_SGIX"},
+        {33805ULL, "GL_FRAGMENT_LIGHT1_SGIX"},
+        {33806ULL, "GL_FRAGMENT_LIGHT2_SGIX"},
+        {33807ULL, "GL_FRAGMENT_LIGHT3_SGIX"},
+        {33808ULL, "GL_FRAGMENT_LIGHT4_SGIX"},
+        {33809ULL, "GL_FRAGMENT_LIGHT5_SGIX"},
+        {33810ULL, "GL_FRAGMENT_LIGHT6_SGIX"},
+        {33811ULL, "GL_FRAGMENT_LIGHT7_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {2929ULL, "GL_DEPTH_TEST"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34895ULL, "GL_TEXTURE_CUBE_MAP_SEAMLESS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2960ULL, "GL_STENCIL_TEST"},
+        {0, nullptr},
+        {35977ULL, "GL_RASTERIZER_DISCARD"},
+        {0, nullptr},
+        {32784ULL, "GL_CONVOLUTION_1D_EXT"},
+        {32785ULL, "GL_CONVOLUTION_2D_EXT"},
+        {32786ULL, "GL_SEPARABLE_2D_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2977ULL, "GL_NORMALIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32804ULL, "GL_HISTOGRAM_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32814ULL, "GL_MINMAX_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32823ULL, "GL_POLYGON_OFFSET_FILL"},
+        {0, nullptr},
+        {0, nullptr},
+        {32826ULL, "GL_RESCALE_NORMAL_EXT"},
+        {0, nullptr},
+        {3008ULL, "GL_ALPHA_TEST"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3024ULL, "GL_DITHER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3042ULL, "GL_BLEND"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3057ULL, "GL_INDEX_LOGIC_OP"},
+        {3058ULL, "GL_COLOR_LOGIC_OP"},
+        {32879ULL, "GL_TEXTURE_3D_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32884ULL, "GL_VERTEX_ARRAY"},
+        {32885ULL, "GL_NORMAL_ARRAY"},
+        {32886ULL, "GL_COLOR_ARRAY"},
+        {32887ULL, "GL_INDEX_ARRAY"},
+        {32888ULL, "GL_TEXTURE_COORD_ARRAY"},
+        {32889ULL, "GL_EDGE_FLAG_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3089ULL, "GL_SCISSOR_TEST"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32916ULL, "GL_INTERLACE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32925ULL, "GL_MULTISAMPLE"},
+        {32926ULL, "GL_SAMPLE_ALPHA_TO_COVERAGE"},
+        {32927ULL, "GL_SAMPLE_ALPHA_TO_ONE"},
+        {32928ULL, "GL_SAMPLE_COVERAGE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32956ULL, "GL_TEXTURE_COLOR_TABLE_SGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32976ULL, "GL_COLOR_TABLE_SGI"},
+        {32977ULL, "GL_POST_CONVOLUTION_COLOR_TABLE_SGI"},
+        {32978ULL, "GL_POST_COLOR_MATRIX_COLOR_TABLE_SGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3168ULL, "GL_TEXTURE_GEN_S"},
+        {3169ULL, "GL_TEXTURE_GEN_T"},
+        {3170ULL, "GL_TEXTURE_GEN_R"},
+        {3171ULL, "GL_TEXTURE_GEN_Q"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36201ULL, "GL_PRIMITIVE_RESTART_FIXED_INDEX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry ErrorCode[15] = {
+        {0ULL, "GL_NO_ERROR"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32869ULL, "GL_TEXTURE_TOO_LARGE_EXT"},
+        {1280ULL, "GL_INVALID_ENUM"},
+        {1281ULL, "GL_INVALID_VALUE"},
+        {1282ULL, "GL_INVALID_OPERATION"},
+        {1283ULL, "GL_STACK_OVERFLOW"},
+        {1284ULL, "GL_STACK_UNDERFLOW"},
+        {1285ULL, "GL_OUT_OF_MEMORY"},
+        {1286ULL, "GL_INVALID_FRAMEBUFFER_OPERATION"},
+        {32817ULL, "GL_TABLE_TOO_LARGE"},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry EvalMapsModeNV[1] = {
+        {6914ULL, "GL_FILL_NV"},
+    };
+
+    inline constexpr Entry EvalTargetNV[2] = {
+        {34496ULL, "GL_EVAL_2D_NV"},
+        {34497ULL, "GL_EVAL_TRIANGULAR_2D_NV"},
+    };
+
+    inline constexpr Entry ExternalHandleType[15] = {
+        {38280ULL, "GL_HANDLE_TYPE_OPAQUE_WIN32_KMT_EXT"},
+        {38281ULL, "GL_HANDLE_TYPE_D3D12_TILEPOOL_EXT"},
+        {38282ULL, "GL_HANDLE_TYPE_D3D12_RESOURCE_EXT"},
+        {38283ULL, "GL_HANDLE_TYPE_D3D11_IMAGE_EXT"},
+        {38284ULL, "GL_HANDLE_TYPE_D3D11_IMAGE_KMT_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {38292ULL, "GL_HANDLE_TYPE_D3D12_FENCE_EXT"},
+        {38278ULL, "GL_HANDLE_TYPE_OPAQUE_FD_EXT"},
+        {38279ULL, "GL_HANDLE_TYPE_OPAQUE_WIN32_EXT"},
+    };
+
+    inline constexpr Entry FeedBackToken[8] = {
+        {1792ULL, "GL_PASS_THROUGH_TOKEN"},
+        {1793ULL, "GL_POINT_TOKEN"},
+        {1794ULL, "GL_LINE_TOKEN"},
+        {1795ULL, "GL_POLYGON_TOKEN"},
+        {1796ULL, "GL_BITMAP_TOKEN"},
+        {1797ULL, "GL_DRAW_PIXEL_TOKEN"},
+        {1798ULL, "GL_COPY_PIXEL_TOKEN"},
+        {1799ULL, "GL_LINE_RESET_TOKEN"},
+    };
+
+    inline constexpr Entry FeedbackType[5] = {
+        {1540ULL, "GL_4D_COLOR_TEXTURE"},
+        {1536ULL, "GL_2D"},
+        {1537ULL, "GL_3D"},
+        {1538ULL, "GL_3D_COLOR"},
+        {1539ULL, "GL_3D_COLOR_TEXTURE"},
+    };
+
+    inline constexpr Entry FenceConditionNV[1] = {
+        {34034ULL, "GL_ALL_COMPLETED_NV"},
+    };
+
+    inline constexpr Entry FenceParameterNameNV[2] = {
+        {34036ULL, "GL_FENCE_CONDITION_NV"},
+        {34035ULL, "GL_FENCE_STATUS_NV"},
+    };
+
+    inline constexpr Entry FfdMaskSGIX[2] = {
+        {2ULL, "GL_GEOMETRY_DEFORMATION_BIT_SGIX"},
+        {1ULL, "GL_TEXTURE_DEFORMATION_BIT_SGIX"},
+    };
+
+    inline constexpr Entry FfdTargetSGIX[2] = {
+        {33172ULL, "GL_GEOMETRY_DEFORMATION_SGIX"},
+        {33173ULL, "GL_TEXTURE_DEFORMATION_SGIX"},
+    };
+
+    inline constexpr Entry FogCoordinatePointerType[3] = {
+        {5130ULL, "GL_DOUBLE"},
+        {0, nullptr},
+        {5126ULL, "GL_FLOAT"},
+    };
+
+    inline constexpr Entry FogMode[11] = {
+        {33066ULL, "GL_FOG_FUNC_SGIS"},
+        {0, nullptr},
+        {2048ULL, "GL_EXP"},
+        {2049ULL, "GL_EXP2"},
+        {0, nullptr},
+        {9729ULL, "GL_LINEAR"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry FogPName[6] = {
+        {2916ULL, "GL_FOG_END"},
+        {2917ULL, "GL_FOG_MODE"},
+        {33872ULL, "GL_FOG_COORD_SRC"},
+        {2913ULL, "GL_FOG_INDEX"},
+        {2914ULL, "GL_FOG_DENSITY"},
+        {2915ULL, "GL_FOG_START"},
+    };
+
+    inline constexpr Entry FogParameter[9] = {
+        {2916ULL, "GL_FOG_END"},
+        {2917ULL, "GL_FOG_MODE"},
+        {2918ULL, "GL_FOG_COLOR"},
+        {33177ULL, "GL_FOG_OFFSET_VALUE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {2913ULL, "GL_FOG_INDEX"},
+        {2914ULL, "GL_FOG_DENSITY"},
+        {2915ULL, "GL_FOG_START"},
+    };
+
+    inline constexpr Entry FogPointerTypeEXT[3] = {
+        {5130ULL, "GL_DOUBLE"},
+        {0, nullptr},
+        {5126ULL, "GL_FLOAT"},
+    };
+
+    inline constexpr Entry FogPointerTypeIBM[3] = {
+        {5130ULL, "GL_DOUBLE"},
+        {0, nullptr},
+        {5126ULL, "GL_FLOAT"},
+    };
+
+    inline constexpr Entry FoveationConfigBitQCOM[4] = {
+        {4ULL, "GL_FOVEATION_SUBSAMPLED_LAYOUT_METHOD_BIT_QCOM"},
+        {1ULL, "GL_FOVEATION_ENABLE_BIT_QCOM"},
+        {2ULL, "GL_FOVEATION_SCALED_BIN_METHOD_BIT_QCOM"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry FragmentLightModelParameterSGIX[4] = {
+        {33800ULL, "GL_FRAGMENT_LIGHT_MODEL_LOCAL_VIEWER_SGIX"},
+        {33801ULL, "GL_FRAGMENT_LIGHT_MODEL_TWO_SIDE_SGIX"},
+        {33802ULL, "GL_FRAGMENT_LIGHT_MODEL_AMBIENT_SGIX"},
+        {33803ULL, "GL_FRAGMENT_LIGHT_MODEL_NORMAL_INTERPOLATION_SGIX"},
+    };
+
+    inline constexpr Entry FragmentLightNameSGIX[8] = {
+        {33808ULL, "GL_FRAGMENT_LIGHT4_SGIX"},
+        {33809ULL, "GL_FRAGMENT_LIGHT5_SGIX"},
+        {33810ULL, "GL_FRAGMENT_LIGHT6_SGIX"},
+        {33811ULL, "GL_FRAGMENT_LIGHT7_SGIX"},
+        {33804ULL, "GL_FRAGMENT_LIGHT0_SGIX"},
+        {33805ULL, "GL_FRAGMENT_LIGHT1_SGIX"},
+        {33806ULL, "GL_FRAGMENT_LIGHT2_SGIX"},
+        {33807ULL, "GL_FRAGMENT_LIGHT3_SGIX"},
+    };
+
+    inline constexpr Entry FragmentLightParameterSGIX[10] = {
+        {4610ULL, "GL_SPECULAR"},
+        {4611ULL, "GL_POSITION"},
+        {4612ULL, "GL_SPOT_DIRECTION"},
+        {4613ULL, "GL_SPOT_EXPONENT"},
+        {4614ULL, "GL_SPOT_CUTOFF"},
+        {4615ULL, "GL_CONSTANT_ATTENUATION"},
+        {4616ULL, "GL_LINEAR_ATTENUATION"},
+        {4617ULL, "GL_QUADRATIC_ATTENUATION"},
+        {4608ULL, "GL_AMBIENT"},
+        {4609ULL, "GL_DIFFUSE"},
+    };
+
+    inline constexpr Entry FragmentOpATI[12] = {
+        {35172ULL, "GL_MUL_ATI"},
+        {35173ULL, "GL_SUB_ATI"},
+        {35174ULL, "GL_DOT3_ATI"},
+        {35175ULL, "GL_DOT4_ATI"},
+        {35176ULL, "GL_MAD_ATI"},
+        {35177ULL, "GL_LERP_ATI"},
+        {35178ULL, "GL_CND_ATI"},
+        {35179ULL, "GL_CND0_ATI"},
+        {35180ULL, "GL_DOT2_ADD_ATI"},
+        {35169ULL, "GL_MOV_ATI"},
+        {0, nullptr},
+        {35171ULL, "GL_ADD_ATI"},
+    };
+
+    inline constexpr Entry FragmentShaderColorModMaskATI[5] = {
+        {0, nullptr},
+        {0, nullptr},
+        {2ULL, "GL_COMP_BIT_ATI"},
+        {8ULL, "GL_BIAS_BIT_ATI"},
+        {4ULL, "GL_NEGATE_BIT_ATI"},
+    };
+
+    inline constexpr Entry FragmentShaderDestMaskATI[4] = {
+        {4ULL, "GL_BLUE_BIT_ATI"},
+        {1ULL, "GL_RED_BIT_ATI"},
+        {2ULL, "GL_GREEN_BIT_ATI"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry FragmentShaderDestModMaskATI[11] = {
+        {0, nullptr},
+        {1ULL, "GL_2X_BIT_ATI"},
+        {2ULL, "GL_4X_BIT_ATI"},
+        {0, nullptr},
+        {4ULL, "GL_8X_BIT_ATI"},
+        {16ULL, "GL_QUARTER_BIT_ATI"},
+        {0, nullptr},
+        {0, nullptr},
+        {8ULL, "GL_HALF_BIT_ATI"},
+        {64ULL, "GL_SATURATE_BIT_ATI"},
+        {32ULL, "GL_EIGHTH_BIT_ATI"},
+    };
+
+    inline constexpr Entry FramebufferAttachment[65] = {
+        {36075ULL, "GL_COLOR_ATTACHMENT11"},
+        {36076ULL, "GL_COLOR_ATTACHMENT12"},
+        {36077ULL, "GL_COLOR_ATTACHMENT13"},
+        {36078ULL, "GL_COLOR_ATTACHMENT14"},
+        {36079ULL, "GL_COLOR_ATTACHMENT15"},
+        {36080ULL, "GL_COLOR_ATTACHMENT16"},
+        {36081ULL, "GL_COLOR_ATTACHMENT17"},
+        {36082ULL, "GL_COLOR_ATTACHMENT18"},
+        {36083ULL, "GL_COLOR_ATTACHMENT19"},
+        {36084ULL, "GL_COLOR_ATTACHMENT20"},
+        {36085ULL, "GL_COLOR_ATTACHMENT21"},
+        {36086ULL, "GL_COLOR_ATTACHMENT22"},
+        {36087ULL, "GL_COLOR_ATTACHMENT23"},
+        {36088ULL, "GL_COLOR_ATTACHMENT24"},
+        {36089ULL, "GL_COLOR_ATTACHMENT25"},
+        {36090ULL, "GL_COLOR_ATTACHMENT26"},
+        {36091ULL, "GL_COLOR_ATTACHMENT27"},
+        {36092ULL, "GL_COLOR_ATTACHMENT28"},
+        {36093ULL, "GL_COLOR_ATTACHMENT29"},
+        {36094ULL, "GL_COLOR_ATTACHMENT30"},
+        {36095ULL, "GL_COLOR_ATTACHMENT31"},
+        {36096ULL, "GL_DEPTH_ATTACHMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36128ULL, "GL_STENCIL_ATTACHMENT"},
+        {36064ULL, "GL_COLOR_ATTACHMENT0"},
+        {36065ULL, "GL_COLOR_ATTACHMENT1"},
+        {36066ULL, "GL_COLOR_ATTACHMENT2"},
+        {36067ULL, "GL_COLOR_ATTACHMENT3"},
+        {36068ULL, "GL_COLOR_ATTACHMENT4"},
+        {36069ULL, "GL_COLOR_ATTACHMENT5"},
+        {36070ULL, "GL_COLOR_ATTACHMENT6"},
+        {36071ULL, "GL_COLOR_ATTACHMENT7"},
+        {36072ULL, "GL_COLOR_ATTACHMENT8"},
+        {36073ULL, "GL_COLOR_ATTACHMENT9"},
+        {36074ULL, "GL_COLOR_ATTACHMENT10"},
+    };
+
+    inline constexpr Entry FramebufferAttachmentParameterName[65] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37183ULL, "GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_SCALE_IMG"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33296ULL, "GL_FRAMEBUFFER_ATTACHMENT_COLOR_ENCODING"},
+        {33297ULL, "GL_FRAMEBUFFER_ATTACHMENT_COMPONENT_TYPE"},
+        {33298ULL, "GL_FRAMEBUFFER_ATTACHMENT_RED_SIZE"},
+        {33299ULL, "GL_FRAMEBUFFER_ATTACHMENT_GREEN_SIZE"},
+        {33300ULL, "GL_FRAMEBUFFER_ATTACHMENT_BLUE_SIZE"},
+        {33301ULL, "GL_FRAMEBUFFER_ATTACHMENT_ALPHA_SIZE"},
+        {33302ULL, "GL_FRAMEBUFFER_ATTACHMENT_DEPTH_SIZE"},
+        {33303ULL, "GL_FRAMEBUFFER_ATTACHMENT_STENCIL_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {38448ULL, "GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_NUM_VIEWS_OVR"},
+        {0, nullptr},
+        {38450ULL, "GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_BASE_VIEW_INDEX_OVR"},
+        {0, nullptr},
+        {0, nullptr},
+        {36048ULL, "GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE"},
+        {36049ULL, "GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME"},
+        {36050ULL, "GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LEVEL"},
+        {36051ULL, "GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_CUBE_MAP_FACE"},
+        {36052ULL, "GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LAYER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36263ULL, "GL_FRAMEBUFFER_ATTACHMENT_LAYERED"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36204ULL, "GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_SAMPLES_EXT"},
+    };
+
+    inline constexpr Entry FramebufferFetchNoncoherent[1] = {
+        {38562ULL, "GL_FRAMEBUFFER_FETCH_NONCOHERENT_QCOM"},
+    };
+
+    inline constexpr Entry FramebufferParameterName[5] = {
+        {37650ULL, "GL_FRAMEBUFFER_DEFAULT_LAYERS"},
+        {37651ULL, "GL_FRAMEBUFFER_DEFAULT_SAMPLES"},
+        {37652ULL, "GL_FRAMEBUFFER_DEFAULT_FIXED_SAMPLE_LOCATIONS"},
+        {37648ULL, "GL_FRAMEBUFFER_DEFAULT_WIDTH"},
+        {37649ULL, "GL_FRAMEBUFFER_DEFAULT_HEIGHT"},
+    };
+
+    inline constexpr Entry FramebufferStatus[20] = {
+        {36060ULL, "GL_FRAMEBUFFER_INCOMPLETE_READ_BUFFER"},
+        {36061ULL, "GL_FRAMEBUFFER_UNSUPPORTED"},
+        {36182ULL, "GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE"},
+        {0, nullptr},
+        {36264ULL, "GL_FRAMEBUFFER_INCOMPLETE_LAYER_TARGETS"},
+        {33305ULL, "GL_FRAMEBUFFER_UNDEFINED"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36053ULL, "GL_FRAMEBUFFER_COMPLETE"},
+        {36054ULL, "GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT"},
+        {36055ULL, "GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36059ULL, "GL_FRAMEBUFFER_INCOMPLETE_DRAW_BUFFER"},
+    };
+
+    inline constexpr Entry FramebufferTarget[3] = {
+        {36009ULL, "GL_DRAW_FRAMEBUFFER"},
+        {36160ULL, "GL_FRAMEBUFFER"},
+        {36008ULL, "GL_READ_FRAMEBUFFER"},
+    };
+
+    inline constexpr Entry FrontFaceDirection[2] = {
+        {2304ULL, "GL_CW"},
+        {2305ULL, "GL_CCW"},
+    };
+
+    inline constexpr Entry GetColorTableParameterPNameSGI[10] = {
+        {32990ULL, "GL_COLOR_TABLE_LUMINANCE_SIZE"},
+        {32991ULL, "GL_COLOR_TABLE_INTENSITY_SIZE"},
+        {32982ULL, "GL_COLOR_TABLE_SCALE"},
+        {32983ULL, "GL_COLOR_TABLE_BIAS"},
+        {32984ULL, "GL_COLOR_TABLE_FORMAT"},
+        {32985ULL, "GL_COLOR_TABLE_WIDTH"},
+        {32986ULL, "GL_COLOR_TABLE_RED_SIZE"},
+        {32987ULL, "GL_COLOR_TABLE_GREEN_SIZE"},
+        {32988ULL, "GL_COLOR_TABLE_BLUE_SIZE"},
+        {32989ULL, "GL_COLOR_TABLE_ALPHA_SIZE"},
+    };
+
+    inline constexpr Entry GetConvolutionParameter[12] = {
+        {33108ULL, "GL_CONVOLUTION_BORDER_COLOR"},
+        {0, nullptr},
+        {0, nullptr},
+        {32787ULL, "GL_CONVOLUTION_BORDER_MODE"},
+        {32788ULL, "GL_CONVOLUTION_FILTER_SCALE"},
+        {32789ULL, "GL_CONVOLUTION_FILTER_BIAS"},
+        {0, nullptr},
+        {32791ULL, "GL_CONVOLUTION_FORMAT"},
+        {32792ULL, "GL_CONVOLUTION_WIDTH"},
+        {32793ULL, "GL_CONVOLUTION_HEIGHT"},
+        {32794ULL, "GL_MAX_CONVOLUTION_WIDTH"},
+        {32795ULL, "GL_MAX_CONVOLUTION_HEIGHT"},
+    };
+
+    inline constexpr Entry GetFramebufferParameter[14] = {
+        {3122ULL, "GL_DOUBLEBUFFER"},
+        {3123ULL, "GL_STEREO"},
+        {37648ULL, "GL_FRAMEBUFFER_DEFAULT_WIDTH"},
+        {37649ULL, "GL_FRAMEBUFFER_DEFAULT_HEIGHT"},
+        {37650ULL, "GL_FRAMEBUFFER_DEFAULT_LAYERS"},
+        {37651ULL, "GL_FRAMEBUFFER_DEFAULT_SAMPLES"},
+        {37652ULL, "GL_FRAMEBUFFER_DEFAULT_FIXED_SAMPLE_LOCATIONS"},
+        {0, nullptr},
+        {32936ULL, "GL_SAMPLE_BUFFERS"},
+        {32937ULL, "GL_SAMPLES"},
+        {35738ULL, "GL_IMPLEMENTATION_COLOR_READ_TYPE"},
+        {35739ULL, "GL_IMPLEMENTATION_COLOR_READ_FORMAT"},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry GetHistogramParameterPNameEXT[8] = {
+        {32808ULL, "GL_HISTOGRAM_RED_SIZE"},
+        {32809ULL, "GL_HISTOGRAM_GREEN_SIZE"},
+        {32810ULL, "GL_HISTOGRAM_BLUE_SIZE"},
+        {32811ULL, "GL_HISTOGRAM_ALPHA_SIZE"},
+        {32812ULL, "GL_HISTOGRAM_LUMINANCE_SIZE"},
+        {32813ULL, "GL_HISTOGRAM_SINK"},
+        {32806ULL, "GL_HISTOGRAM_WIDTH"},
+        {32807ULL, "GL_HISTOGRAM_FORMAT"},
+    };
+
+    inline constexpr Entry GetMapQuery[3] = {
+        {2562ULL, "GL_DOMAIN"},
+        {2560ULL, "GL_COEFF"},
+        {2561ULL, "GL_ORDER"},
+    };
+
+    inline constexpr Entry GetMinmaxParameterPNameEXT[2] = {
+        {32816ULL, "GL_MINMAX_SINK"},
+        {32815ULL, "GL_MINMAX_FORMAT"},
+    };
+
+    inline constexpr Entry GetMultisamplePNameNV[2] = {
+        {36432ULL, "GL_SAMPLE_POSITION"},
+        {37697ULL, "GL_PROGRAMMABLE_SAMPLE_LOCATION_ARB"},
+    };
+
+    inline constexpr Entry GetPName[4541] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36345ULL, "GL_NUM_SHADER_BINARY_FORMATS"},
+        {36346ULL, "GL_SHADER_COMPILER"},
+        {36347ULL, "GL_MAX_VERTEX_UNIFORM_VECTORS"},
+        {36348ULL, "GL_MAX_VARYING_VECTORS"},
+        {36349ULL, "GL_MAX_FRAGMENT_UNIFORM_VECTORS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36392ULL, "GL_TIMESTAMP"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36431ULL, "GL_PROVOKING_VERTEX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36441ULL, "GL_MAX_SAMPLE_MASK_WORDS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36489ULL, "GL_MAX_TESS_CONTROL_UNIFORM_BLOCKS"},
+        {36490ULL, "GL_MAX_TESS_EVALUATION_UNIFORM_BLOCKS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36766ULL, "GL_PRIMITIVE_RESTART_INDEX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37052ULL, "GL_MIN_MAP_BUFFER_ALIGNMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37075ULL, "GL_SHADER_STORAGE_BUFFER_BINDING"},
+        {37076ULL, "GL_SHADER_STORAGE_BUFFER_START"},
+        {37077ULL, "GL_SHADER_STORAGE_BUFFER_SIZE"},
+        {37078ULL, "GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS"},
+        {37079ULL, "GL_MAX_GEOMETRY_SHADER_STORAGE_BLOCKS"},
+        {37080ULL, "GL_MAX_TESS_CONTROL_SHADER_STORAGE_BLOCKS"},
+        {37081ULL, "GL_MAX_TESS_EVALUATION_SHADER_STORAGE_BLOCKS"},
+        {37082ULL, "GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS"},
+        {37083ULL, "GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS"},
+        {37084ULL, "GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS"},
+        {37085ULL, "GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS"},
+        {0, nullptr},
+        {37087ULL, "GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37099ULL, "GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37103ULL, "GL_DISPATCH_INDIRECT_BUFFER_BINDING"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37124ULL, "GL_TEXTURE_BINDING_2D_MULTISAMPLE"},
+        {37125ULL, "GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37134ULL, "GL_MAX_COLOR_TEXTURE_SAMPLES"},
+        {37135ULL, "GL_MAX_DEPTH_TEXTURE_SAMPLES"},
+        {37136ULL, "GL_MAX_INTEGER_SAMPLES"},
+        {37137ULL, "GL_MAX_SERVER_WAIT_TIMEOUT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37154ULL, "GL_MAX_VERTEX_OUTPUT_COMPONENTS"},
+        {37155ULL, "GL_MAX_GEOMETRY_INPUT_COMPONENTS"},
+        {37156ULL, "GL_MAX_GEOMETRY_OUTPUT_COMPONENTS"},
+        {37157ULL, "GL_MAX_FRAGMENT_INPUT_COMPONENTS"},
+        {37158ULL, "GL_CONTEXT_PROFILE_MASK"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37279ULL, "GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37307ULL, "GL_MAX_COMPUTE_UNIFORM_BLOCKS"},
+        {37308ULL, "GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS"},
+        {0, nullptr},
+        {37310ULL, "GL_MAX_COMPUTE_WORK_GROUP_COUNT"},
+        {37311ULL, "GL_MAX_COMPUTE_WORK_GROUP_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {32773ULL, "GL_BLEND_COLOR"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32777ULL, "GL_BLEND_EQUATION_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32782ULL, "GL_PACK_CMYK_HINT_EXT"},
+        {32783ULL, "GL_UNPACK_CMYK_HINT_EXT"},
+        {32784ULL, "GL_CONVOLUTION_1D_EXT"},
+        {32785ULL, "GL_CONVOLUTION_2D_EXT"},
+        {32786ULL, "GL_SEPARABLE_2D_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32796ULL, "GL_POST_CONVOLUTION_RED_SCALE_EXT"},
+        {32797ULL, "GL_POST_CONVOLUTION_GREEN_SCALE_EXT"},
+        {32798ULL, "GL_POST_CONVOLUTION_BLUE_SCALE_EXT"},
+        {32799ULL, "GL_POST_CONVOLUTION_ALPHA_SCALE_EXT"},
+        {32800ULL, "GL_POST_CONVOLUTION_RED_BIAS_EXT"},
+        {32801ULL, "GL_POST_CONVOLUTION_GREEN_BIAS_EXT"},
+        {32802ULL, "GL_POST_CONVOLUTION_BLUE_BIAS_EXT"},
+        {32803ULL, "GL_POST_CONVOLUTION_ALPHA_BIAS_EXT"},
+        {32804ULL, "GL_HISTOGRAM_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32814ULL, "GL_MINMAX_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32823ULL, "GL_POLYGON_OFFSET_FILL"},
+        {32824ULL, "GL_POLYGON_OFFSET_FACTOR"},
+        {32825ULL, "GL_POLYGON_OFFSET_BIAS_EXT"},
+        {32826ULL, "GL_RESCALE_NORMAL_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32872ULL, "GL_TEXTURE_BINDING_1D"},
+        {32873ULL, "GL_TEXTURE_BINDING_2D"},
+        {32874ULL, "GL_TEXTURE_BINDING_3D"},
+        {32875ULL, "GL_PACK_SKIP_IMAGES"},
+        {32876ULL, "GL_PACK_IMAGE_HEIGHT"},
+        {32877ULL, "GL_UNPACK_SKIP_IMAGES"},
+        {32878ULL, "GL_UNPACK_IMAGE_HEIGHT"},
+        {32879ULL, "GL_TEXTURE_3D_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32883ULL, "GL_MAX_3D_TEXTURE_SIZE"},
+        {32884ULL, "GL_VERTEX_ARRAY"},
+        {32885ULL, "GL_NORMAL_ARRAY"},
+        {32886ULL, "GL_COLOR_ARRAY"},
+        {32887ULL, "GL_INDEX_ARRAY"},
+        {32888ULL, "GL_TEXTURE_COORD_ARRAY"},
+        {32889ULL, "GL_EDGE_FLAG_ARRAY"},
+        {32890ULL, "GL_VERTEX_ARRAY_SIZE"},
+        {32891ULL, "GL_VERTEX_ARRAY_TYPE"},
+        {32892ULL, "GL_VERTEX_ARRAY_STRIDE"},
+        {32893ULL, "GL_VERTEX_ARRAY_COUNT_EXT"},
+        {32894ULL, "GL_NORMAL_ARRAY_TYPE"},
+        {32895ULL, "GL_NORMAL_ARRAY_STRIDE"},
+        {32896ULL, "GL_NORMAL_ARRAY_COUNT_EXT"},
+        {32897ULL, "GL_COLOR_ARRAY_SIZE"},
+        {32898ULL, "GL_COLOR_ARRAY_TYPE"},
+        {32899ULL, "GL_COLOR_ARRAY_STRIDE"},
+        {32900ULL, "GL_COLOR_ARRAY_COUNT_EXT"},
+        {32901ULL, "GL_INDEX_ARRAY_TYPE"},
+        {32902ULL, "GL_INDEX_ARRAY_STRIDE"},
+        {32903ULL, "GL_INDEX_ARRAY_COUNT_EXT"},
+        {32904ULL, "GL_TEXTURE_COORD_ARRAY_SIZE"},
+        {32905ULL, "GL_TEXTURE_COORD_ARRAY_TYPE"},
+        {32906ULL, "GL_TEXTURE_COORD_ARRAY_STRIDE"},
+        {32907ULL, "GL_TEXTURE_COORD_ARRAY_COUNT_EXT"},
+        {32908ULL, "GL_EDGE_FLAG_ARRAY_STRIDE"},
+        {32909ULL, "GL_EDGE_FLAG_ARRAY_COUNT_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32916ULL, "GL_INTERLACE_SGIX"},
+        {0, nullptr},
+        {32918ULL, "GL_DETAIL_TEXTURE_2D_BINDING_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32925ULL, "GL_MULTISAMPLE_SGIS"},
+        {32926ULL, "GL_SAMPLE_ALPHA_TO_MASK_SGIS"},
+        {32927ULL, "GL_SAMPLE_ALPHA_TO_ONE_SGIS"},
+        {32928ULL, "GL_SAMPLE_MASK_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32936ULL, "GL_SAMPLE_BUFFERS"},
+        {32937ULL, "GL_SAMPLES"},
+        {32938ULL, "GL_SAMPLE_COVERAGE_VALUE"},
+        {32939ULL, "GL_SAMPLE_COVERAGE_INVERT"},
+        {32940ULL, "GL_SAMPLE_PATTERN_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32945ULL, "GL_COLOR_MATRIX_SGI"},
+        {32946ULL, "GL_COLOR_MATRIX_STACK_DEPTH_SGI"},
+        {32947ULL, "GL_MAX_COLOR_MATRIX_STACK_DEPTH_SGI"},
+        {32948ULL, "GL_POST_COLOR_MATRIX_RED_SCALE_SGI"},
+        {32949ULL, "GL_POST_COLOR_MATRIX_GREEN_SCALE_SGI"},
+        {32950ULL, "GL_POST_COLOR_MATRIX_BLUE_SCALE_SGI"},
+        {32951ULL, "GL_POST_COLOR_MATRIX_ALPHA_SCALE_SGI"},
+        {32952ULL, "GL_POST_COLOR_MATRIX_RED_BIAS_SGI"},
+        {32953ULL, "GL_POST_COLOR_MATRIX_GREEN_BIAS_SGI"},
+        {32954ULL, "GL_POST_COLOR_MATRIX_BLUE_BIAS_SGI"},
+        {32955ULL, "GL_POST_COLOR_MATRIX_ALPHA_BIAS_SGI"},
+        {32956ULL, "GL_TEXTURE_COLOR_TABLE_SGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32968ULL, "GL_BLEND_DST_RGB"},
+        {32969ULL, "GL_BLEND_SRC_RGB"},
+        {32970ULL, "GL_BLEND_DST_ALPHA"},
+        {32971ULL, "GL_BLEND_SRC_ALPHA"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32976ULL, "GL_COLOR_TABLE_SGI"},
+        {32977ULL, "GL_POST_CONVOLUTION_COLOR_TABLE_SGI"},
+        {32978ULL, "GL_POST_COLOR_MATRIX_COLOR_TABLE_SGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33000ULL, "GL_MAX_ELEMENTS_VERTICES"},
+        {33001ULL, "GL_MAX_ELEMENTS_INDICES"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37586ULL, "GL_MAX_VERTEX_ATOMIC_COUNTERS"},
+        {37587ULL, "GL_MAX_TESS_CONTROL_ATOMIC_COUNTERS"},
+        {37588ULL, "GL_MAX_TESS_EVALUATION_ATOMIC_COUNTERS"},
+        {37589ULL, "GL_MAX_GEOMETRY_ATOMIC_COUNTERS"},
+        {37590ULL, "GL_MAX_FRAGMENT_ATOMIC_COUNTERS"},
+        {37591ULL, "GL_MAX_COMBINED_ATOMIC_COUNTERS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33062ULL, "GL_POINT_SIZE_MIN_SGIS"},
+        {33063ULL, "GL_POINT_SIZE_MAX_SGIS"},
+        {33064ULL, "GL_POINT_FADE_THRESHOLD_SIZE"},
+        {33065ULL, "GL_DISTANCE_ATTENUATION_SGIS"},
+        {0, nullptr},
+        {33067ULL, "GL_FOG_FUNC_POINTS_SGIS"},
+        {33068ULL, "GL_MAX_FOG_FUNC_POINTS_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33072ULL, "GL_PACK_SKIP_VOLUMES_SGIS"},
+        {33073ULL, "GL_PACK_IMAGE_DEPTH_SGIS"},
+        {33074ULL, "GL_UNPACK_SKIP_VOLUMES_SGIS"},
+        {33075ULL, "GL_UNPACK_IMAGE_DEPTH_SGIS"},
+        {33076ULL, "GL_TEXTURE_4D_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33080ULL, "GL_MAX_4D_TEXTURE_SIZE_SGIS"},
+        {33081ULL, "GL_PIXEL_TEX_GEN_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33086ULL, "GL_PIXEL_TILE_BEST_ALIGNMENT_SGIX"},
+        {33087ULL, "GL_PIXEL_TILE_CACHE_INCREMENT_SGIX"},
+        {33088ULL, "GL_PIXEL_TILE_WIDTH_SGIX"},
+        {33089ULL, "GL_PIXEL_TILE_HEIGHT_SGIX"},
+        {33090ULL, "GL_PIXEL_TILE_GRID_WIDTH_SGIX"},
+        {33091ULL, "GL_PIXEL_TILE_GRID_HEIGHT_SGIX"},
+        {33092ULL, "GL_PIXEL_TILE_GRID_DEPTH_SGIX"},
+        {33093ULL, "GL_PIXEL_TILE_CACHE_SIZE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {33096ULL, "GL_SPRITE_SGIX"},
+        {33097ULL, "GL_SPRITE_MODE_SGIX"},
+        {33098ULL, "GL_SPRITE_AXIS_SGIX"},
+        {33099ULL, "GL_SPRITE_TRANSLATION_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33103ULL, "GL_TEXTURE_4D_BINDING_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37653ULL, "GL_MAX_FRAMEBUFFER_WIDTH"},
+        {37654ULL, "GL_MAX_FRAMEBUFFER_HEIGHT"},
+        {37655ULL, "GL_MAX_FRAMEBUFFER_LAYERS"},
+        {37656ULL, "GL_MAX_FRAMEBUFFER_SAMPLES"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33143ULL, "GL_MAX_CLIPMAP_DEPTH_SGIX"},
+        {33144ULL, "GL_MAX_CLIPMAP_VIRTUAL_DEPTH_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {33147ULL, "GL_POST_TEXTURE_FILTER_BIAS_RANGE_SGIX"},
+        {33148ULL, "GL_POST_TEXTURE_FILTER_SCALE_RANGE_SGIX"},
+        {33149ULL, "GL_REFERENCE_PLANE_SGIX"},
+        {33150ULL, "GL_REFERENCE_PLANE_EQUATION_SGIX"},
+        {33151ULL, "GL_IR_INSTRUMENT1_SGIX"},
+        {0, nullptr},
+        {33153ULL, "GL_INSTRUMENT_MEASUREMENTS_SGIX"},
+        {0, nullptr},
+        {33155ULL, "GL_CALLIGRAPHIC_FRAGMENT_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33163ULL, "GL_FRAMEZOOM_SGIX"},
+        {33164ULL, "GL_FRAMEZOOM_FACTOR_SGIX"},
+        {33165ULL, "GL_MAX_FRAMEZOOM_FACTOR_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33170ULL, "GL_GENERATE_MIPMAP_HINT_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33174ULL, "GL_DEFORMATIONS_MASK_SGIX"},
+        {0, nullptr},
+        {33176ULL, "GL_FOG_OFFSET_SGIX"},
+        {33177ULL, "GL_FOG_OFFSET_VALUE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33272ULL, "GL_LIGHT_MODEL_COLOR_CONTROL"},
+        {0, nullptr},
+        {0, nullptr},
+        {33275ULL, "GL_SHARED_TEXTURE_PALETTE_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33307ULL, "GL_MAJOR_VERSION"},
+        {33308ULL, "GL_MINOR_VERSION"},
+        {33309ULL, "GL_NUM_EXTENSIONS"},
+        {33310ULL, "GL_CONTEXT_FLAGS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33370ULL, "GL_PROGRAM_PIPELINE_BINDING"},
+        {33371ULL, "GL_MAX_VIEWPORTS"},
+        {33372ULL, "GL_VIEWPORT_SUBPIXEL_BITS"},
+        {33373ULL, "GL_VIEWPORT_BOUNDS_RANGE"},
+        {33374ULL, "GL_LAYER_PROVOKING_VERTEX"},
+        {33375ULL, "GL_VIEWPORT_INDEX_PROVOKING_VERTEX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33379ULL, "GL_MAX_COMPUTE_UNIFORM_COMPONENTS"},
+        {33380ULL, "GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS"},
+        {33381ULL, "GL_MAX_COMPUTE_ATOMIC_COUNTERS"},
+        {33382ULL, "GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33388ULL, "GL_MAX_DEBUG_GROUP_STACK_DEPTH"},
+        {33389ULL, "GL_DEBUG_GROUP_STACK_DEPTH"},
+        {33390ULL, "GL_MAX_UNIFORM_LOCATIONS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {10752ULL, "GL_POLYGON_OFFSET_UNITS"},
+        {10753ULL, "GL_POLYGON_OFFSET_POINT"},
+        {10754ULL, "GL_POLYGON_OFFSET_LINE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33494ULL, "GL_VERTEX_BINDING_DIVISOR"},
+        {33495ULL, "GL_VERTEX_BINDING_OFFSET"},
+        {33496ULL, "GL_VERTEX_BINDING_STRIDE"},
+        {33497ULL, "GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET"},
+        {33498ULL, "GL_MAX_VERTEX_ATTRIB_BINDINGS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33512ULL, "GL_MAX_LABEL_LENGTH"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33558ULL, "GL_CONVOLUTION_HINT_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33577ULL, "GL_ASYNC_MARKER_SGIX"},
+        {0, nullptr},
+        {33579ULL, "GL_PIXEL_TEX_GEN_MODE_SGIX"},
+        {33580ULL, "GL_ASYNC_HISTOGRAM_SGIX"},
+        {33581ULL, "GL_MAX_ASYNC_HISTOGRAM_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33619ULL, "GL_PIXEL_TEXTURE_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33628ULL, "GL_ASYNC_TEX_IMAGE_SGIX"},
+        {33629ULL, "GL_ASYNC_DRAW_PIXELS_SGIX"},
+        {33630ULL, "GL_ASYNC_READ_PIXELS_SGIX"},
+        {33631ULL, "GL_MAX_ASYNC_TEX_IMAGE_SGIX"},
+        {33632ULL, "GL_MAX_ASYNC_DRAW_PIXELS_SGIX"},
+        {33633ULL, "GL_MAX_ASYNC_READ_PIXELS_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {38294ULL, "GL_NUM_DEVICE_UUIDS_EXT"},
+        {38295ULL, "GL_DEVICE_UUID_EXT"},
+        {38296ULL, "GL_DRIVER_UUID_EXT"},
+        {38297ULL, "GL_DEVICE_LUID_EXT"},
+        {38298ULL, "GL_DEVICE_NODE_MASK_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33774ULL, "GL_VERTEX_PRECLIP_SGIX"},
+        {33775ULL, "GL_VERTEX_PRECLIP_HINT_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33792ULL, "GL_FRAGMENT_LIGHTING_SGIX"},
+        {33793ULL, "GL_FRAGMENT_COLOR_MATERIAL_SGIX"},
+        {33794ULL, "GL_FRAGMENT_COLOR_MATERIAL_FACE_SGIX"},
+        {33795ULL, "GL_FRAGMENT_COLOR_MATERIAL_PARAMETER_SGIX"},
+        {33796ULL, "GL_MAX_FRAGMENT_LIGHTS_SGIX"},
+        {33797ULL, "GL_MAX_ACTIVE_LIGHTS_SGIX"},
+        {0, nullptr},
+        {33799ULL, "GL_LIGHT_ENV_MODE_SGIX"},
+        {33800ULL, "GL_FRAGMENT_LIGHT_MODEL_LOCAL_VIEWER_SGIX"},
+        {33801ULL, "GL_FRAGMENT_LIGHT_MODEL_TWO_SIDE_SGIX"},
+        {33802ULL, "GL_FRAGMENT_LIGHT_MODEL_AMBIENT_SGIX"},
+        {33803ULL, "GL_FRAGMENT_LIGHT_MODEL_NORMAL_INTERPOLATION_SGIX"},
+        {33804ULL, "GL_FRAGMENT_LIGHT0_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33838ULL, "GL_PACK_RESAMPLE_SGIX"},
+        {33839ULL, "GL_UNPACK_RESAMPLE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33901ULL, "GL_ALIASED_POINT_SIZE_RANGE"},
+        {33902ULL, "GL_ALIASED_LINE_WIDTH_RANGE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34016ULL, "GL_ACTIVE_TEXTURE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {38564ULL, "GL_SHADING_RATE_QCOM"},
+        {34024ULL, "GL_MAX_RENDERBUFFER_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34031ULL, "GL_TEXTURE_COMPRESSION_HINT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34038ULL, "GL_TEXTURE_BINDING_RECTANGLE"},
+        {0, nullptr},
+        {34040ULL, "GL_MAX_RECTANGLE_TEXTURE_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34045ULL, "GL_MAX_TEXTURE_LOD_BIAS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34068ULL, "GL_TEXTURE_BINDING_CUBE_MAP"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34076ULL, "GL_MAX_CUBE_MAP_TEXTURE_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34208ULL, "GL_PACK_SUBSAMPLE_RATE_SGIX"},
+        {34209ULL, "GL_UNPACK_SUBSAMPLE_RATE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34229ULL, "GL_VERTEX_ARRAY_BINDING"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34370ULL, "GL_PROGRAM_POINT_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34466ULL, "GL_NUM_COMPRESSED_TEXTURE_FORMATS"},
+        {34467ULL, "GL_COMPRESSED_TEXTURE_FORMATS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {16384ULL, "GL_LIGHT0"},
+        {16385ULL, "GL_LIGHT1"},
+        {16386ULL, "GL_LIGHT2"},
+        {16387ULL, "GL_LIGHT3"},
+        {16388ULL, "GL_LIGHT4"},
+        {16389ULL, "GL_LIGHT5"},
+        {16390ULL, "GL_LIGHT6"},
+        {16391ULL, "GL_LIGHT7"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2816ULL, "GL_CURRENT_COLOR"},
+        {2817ULL, "GL_CURRENT_INDEX"},
+        {2818ULL, "GL_CURRENT_NORMAL"},
+        {2819ULL, "GL_CURRENT_TEXTURE_COORDS"},
+        {2820ULL, "GL_CURRENT_RASTER_COLOR"},
+        {2821ULL, "GL_CURRENT_RASTER_INDEX"},
+        {2822ULL, "GL_CURRENT_RASTER_TEXTURE_COORDS"},
+        {2823ULL, "GL_CURRENT_RASTER_POSITION"},
+        {2824ULL, "GL_CURRENT_RASTER_POSITION_VALID"},
+        {2825ULL, "GL_CURRENT_RASTER_DISTANCE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2832ULL, "GL_POINT_SMOOTH"},
+        {2833ULL, "GL_POINT_SIZE"},
+        {2834ULL, "GL_POINT_SIZE_RANGE"},
+        {2835ULL, "GL_POINT_SIZE_GRANULARITY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2848ULL, "GL_LINE_SMOOTH"},
+        {2849ULL, "GL_LINE_WIDTH"},
+        {2850ULL, "GL_LINE_WIDTH_RANGE"},
+        {2851ULL, "GL_LINE_WIDTH_GRANULARITY"},
+        {2852ULL, "GL_LINE_STIPPLE"},
+        {2853ULL, "GL_LINE_STIPPLE_PATTERN"},
+        {2854ULL, "GL_LINE_STIPPLE_REPEAT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2864ULL, "GL_LIST_MODE"},
+        {2865ULL, "GL_MAX_LIST_NESTING"},
+        {2866ULL, "GL_LIST_BASE"},
+        {2867ULL, "GL_LIST_INDEX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2880ULL, "GL_POLYGON_MODE"},
+        {2881ULL, "GL_POLYGON_SMOOTH"},
+        {2882ULL, "GL_POLYGON_STIPPLE"},
+        {2883ULL, "GL_EDGE_FLAG"},
+        {2884ULL, "GL_CULL_FACE"},
+        {2885ULL, "GL_CULL_FACE_MODE"},
+        {2886ULL, "GL_FRONT_FACE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2896ULL, "GL_LIGHTING"},
+        {2897ULL, "GL_LIGHT_MODEL_LOCAL_VIEWER"},
+        {2898ULL, "GL_LIGHT_MODEL_TWO_SIDE"},
+        {2899ULL, "GL_LIGHT_MODEL_AMBIENT"},
+        {2900ULL, "GL_SHADE_MODEL"},
+        {2901ULL, "GL_COLOR_MATERIAL_FACE"},
+        {2902ULL, "GL_COLOR_MATERIAL_PARAMETER"},
+        {2903ULL, "GL_COLOR_MATERIAL"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2912ULL, "GL_FOG"},
+        {2913ULL, "GL_FOG_INDEX"},
+        {2914ULL, "GL_FOG_DENSITY"},
+        {2915ULL, "GL_FOG_START"},
+        {2916ULL, "GL_FOG_END"},
+        {2917ULL, "GL_FOG_MODE"},
+        {2918ULL, "GL_FOG_COLOR"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2928ULL, "GL_DEPTH_RANGE"},
+        {2929ULL, "GL_DEPTH_TEST"},
+        {2930ULL, "GL_DEPTH_WRITEMASK"},
+        {2931ULL, "GL_DEPTH_CLEAR_VALUE"},
+        {2932ULL, "GL_DEPTH_FUNC"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2944ULL, "GL_ACCUM_CLEAR_VALUE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2960ULL, "GL_STENCIL_TEST"},
+        {2961ULL, "GL_STENCIL_CLEAR_VALUE"},
+        {2962ULL, "GL_STENCIL_FUNC"},
+        {2963ULL, "GL_STENCIL_VALUE_MASK"},
+        {2964ULL, "GL_STENCIL_FAIL"},
+        {2965ULL, "GL_STENCIL_PASS_DEPTH_FAIL"},
+        {2966ULL, "GL_STENCIL_PASS_DEPTH_PASS"},
+        {2967ULL, "GL_STENCIL_REF"},
+        {2968ULL, "GL_STENCIL_WRITEMASK"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2976ULL, "GL_MATRIX_MODE"},
+        {2977ULL, "GL_NORMALIZE"},
+        {2978ULL, "GL_VIEWPORT"},
+        {2979ULL, "GL_MODELVIEW_STACK_DEPTH"},
+        {2980ULL, "GL_PROJECTION_STACK_DEPTH"},
+        {2981ULL, "GL_TEXTURE_STACK_DEPTH"},
+        {2982ULL, "GL_MODELVIEW_MATRIX"},
+        {2983ULL, "GL_PROJECTION_MATRIX"},
+        {2984ULL, "GL_TEXTURE_MATRIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2992ULL, "GL_ATTRIB_STACK_DEPTH"},
+        {2993ULL, "GL_CLIENT_ATTRIB_STACK_DEPTH"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3008ULL, "GL_ALPHA_TEST"},
+        {3009ULL, "GL_ALPHA_TEST_FUNC"},
+        {3010ULL, "GL_ALPHA_TEST_REF"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3024ULL, "GL_DITHER"},
+        {0, nullptr},
+        {0, nullptr},
+        {34814ULL, "GL_NUM_PROGRAM_BINARY_FORMATS"},
+        {34815ULL, "GL_PROGRAM_BINARY_FORMATS"},
+        {34816ULL, "GL_STENCIL_BACK_FUNC"},
+        {34817ULL, "GL_STENCIL_BACK_FAIL"},
+        {34818ULL, "GL_STENCIL_BACK_PASS_DEPTH_FAIL"},
+        {34819ULL, "GL_STENCIL_BACK_PASS_DEPTH_PASS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3040ULL, "GL_BLEND_DST"},
+        {3041ULL, "GL_BLEND_SRC"},
+        {3042ULL, "GL_BLEND"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3056ULL, "GL_LOGIC_OP_MODE"},
+        {3057ULL, "GL_LOGIC_OP"},
+        {3058ULL, "GL_COLOR_LOGIC_OP"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34852ULL, "GL_MAX_DRAW_BUFFERS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3072ULL, "GL_AUX_BUFFERS"},
+        {3073ULL, "GL_DRAW_BUFFER"},
+        {3074ULL, "GL_READ_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3088ULL, "GL_SCISSOR_BOX"},
+        {3089ULL, "GL_SCISSOR_TEST"},
+        {34877ULL, "GL_BLEND_EQUATION_ALPHA"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3104ULL, "GL_INDEX_CLEAR_VALUE"},
+        {3105ULL, "GL_INDEX_WRITEMASK"},
+        {3106ULL, "GL_COLOR_CLEAR_VALUE"},
+        {3107ULL, "GL_COLOR_WRITEMASK"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3120ULL, "GL_INDEX_MODE"},
+        {3121ULL, "GL_RGBA_MODE"},
+        {3122ULL, "GL_DOUBLEBUFFER"},
+        {3123ULL, "GL_STEREO"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34921ULL, "GL_MAX_VERTEX_ATTRIBS"},
+        {0, nullptr},
+        {3136ULL, "GL_RENDER_MODE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34930ULL, "GL_MAX_TEXTURE_IMAGE_UNITS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3152ULL, "GL_PERSPECTIVE_CORRECTION_HINT"},
+        {3153ULL, "GL_POINT_SMOOTH_HINT"},
+        {3154ULL, "GL_LINE_SMOOTH_HINT"},
+        {3155ULL, "GL_POLYGON_SMOOTH_HINT"},
+        {3156ULL, "GL_FOG_HINT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3168ULL, "GL_TEXTURE_GEN_S"},
+        {3169ULL, "GL_TEXTURE_GEN_T"},
+        {3170ULL, "GL_TEXTURE_GEN_R"},
+        {3171ULL, "GL_TEXTURE_GEN_Q"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34964ULL, "GL_ARRAY_BUFFER_BINDING"},
+        {34965ULL, "GL_ELEMENT_ARRAY_BUFFER_BINDING"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {12288ULL, "GL_CLIP_PLANE0"},
+        {12289ULL, "GL_CLIP_PLANE1"},
+        {12290ULL, "GL_CLIP_PLANE2"},
+        {12291ULL, "GL_CLIP_PLANE3"},
+        {12292ULL, "GL_CLIP_PLANE4"},
+        {12293ULL, "GL_CLIP_PLANE5"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3248ULL, "GL_PIXEL_MAP_I_TO_I_SIZE"},
+        {3249ULL, "GL_PIXEL_MAP_S_TO_S_SIZE"},
+        {3250ULL, "GL_PIXEL_MAP_I_TO_R_SIZE"},
+        {3251ULL, "GL_PIXEL_MAP_I_TO_G_SIZE"},
+        {3252ULL, "GL_PIXEL_MAP_I_TO_B_SIZE"},
+        {3253ULL, "GL_PIXEL_MAP_I_TO_A_SIZE"},
+        {3254ULL, "GL_PIXEL_MAP_R_TO_R_SIZE"},
+        {3255ULL, "GL_PIXEL_MAP_G_TO_G_SIZE"},
+        {3256ULL, "GL_PIXEL_MAP_B_TO_B_SIZE"},
+        {3257ULL, "GL_PIXEL_MAP_A_TO_A_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35053ULL, "GL_PIXEL_PACK_BUFFER_BINDING"},
+        {0, nullptr},
+        {35055ULL, "GL_PIXEL_UNPACK_BUFFER_BINDING"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35068ULL, "GL_MAX_DUAL_SOURCE_DRAW_BUFFERS"},
+        {0, nullptr},
+        {0, nullptr},
+        {35071ULL, "GL_MAX_ARRAY_TEXTURE_LAYERS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35076ULL, "GL_MIN_PROGRAM_TEXEL_OFFSET"},
+        {35077ULL, "GL_MAX_PROGRAM_TEXEL_OFFSET"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35097ULL, "GL_SAMPLER_BINDING"},
+        {0, nullptr},
+        {3312ULL, "GL_UNPACK_SWAP_BYTES"},
+        {3313ULL, "GL_UNPACK_LSB_FIRST"},
+        {3314ULL, "GL_UNPACK_ROW_LENGTH"},
+        {3315ULL, "GL_UNPACK_SKIP_ROWS"},
+        {3316ULL, "GL_UNPACK_SKIP_PIXELS"},
+        {3317ULL, "GL_UNPACK_ALIGNMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3328ULL, "GL_PACK_SWAP_BYTES"},
+        {3329ULL, "GL_PACK_LSB_FIRST"},
+        {3330ULL, "GL_PACK_ROW_LENGTH"},
+        {3331ULL, "GL_PACK_SKIP_ROWS"},
+        {3332ULL, "GL_PACK_SKIP_PIXELS"},
+        {3333ULL, "GL_PACK_ALIGNMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3344ULL, "GL_MAP_COLOR"},
+        {3345ULL, "GL_MAP_STENCIL"},
+        {3346ULL, "GL_INDEX_SHIFT"},
+        {3347ULL, "GL_INDEX_OFFSET"},
+        {3348ULL, "GL_RED_SCALE"},
+        {3349ULL, "GL_RED_BIAS"},
+        {3350ULL, "GL_ZOOM_X"},
+        {3351ULL, "GL_ZOOM_Y"},
+        {3352ULL, "GL_GREEN_SCALE"},
+        {3353ULL, "GL_GREEN_BIAS"},
+        {3354ULL, "GL_BLUE_SCALE"},
+        {3355ULL, "GL_BLUE_BIAS"},
+        {3356ULL, "GL_ALPHA_SCALE"},
+        {3357ULL, "GL_ALPHA_BIAS"},
+        {3358ULL, "GL_DEPTH_SCALE"},
+        {3359ULL, "GL_DEPTH_BIAS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3376ULL, "GL_MAX_EVAL_ORDER"},
+        {3377ULL, "GL_MAX_LIGHTS"},
+        {3378ULL, "GL_MAX_CLIP_PLANES"},
+        {3379ULL, "GL_MAX_TEXTURE_SIZE"},
+        {3380ULL, "GL_MAX_PIXEL_MAP_TABLE"},
+        {3381ULL, "GL_MAX_ATTRIB_STACK_DEPTH"},
+        {3382ULL, "GL_MAX_MODELVIEW_STACK_DEPTH"},
+        {3383ULL, "GL_MAX_NAME_STACK_DEPTH"},
+        {3384ULL, "GL_MAX_PROJECTION_STACK_DEPTH"},
+        {3385ULL, "GL_MAX_TEXTURE_STACK_DEPTH"},
+        {3386ULL, "GL_MAX_VIEWPORT_DIMS"},
+        {3387ULL, "GL_MAX_CLIENT_ATTRIB_STACK_DEPTH"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3408ULL, "GL_SUBPIXEL_BITS"},
+        {3409ULL, "GL_INDEX_BITS"},
+        {3410ULL, "GL_RED_BITS"},
+        {3411ULL, "GL_GREEN_BITS"},
+        {3412ULL, "GL_BLUE_BITS"},
+        {3413ULL, "GL_ALPHA_BITS"},
+        {3414ULL, "GL_DEPTH_BITS"},
+        {3415ULL, "GL_STENCIL_BITS"},
+        {3416ULL, "GL_ACCUM_RED_BITS"},
+        {3417ULL, "GL_ACCUM_GREEN_BITS"},
+        {3418ULL, "GL_ACCUM_BLUE_BITS"},
+        {3419ULL, "GL_ACCUM_ALPHA_BITS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3440ULL, "GL_NAME_STACK_DEPTH"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3456ULL, "GL_AUTO_NORMAL"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3472ULL, "GL_MAP1_COLOR_4"},
+        {3473ULL, "GL_MAP1_INDEX"},
+        {3474ULL, "GL_MAP1_NORMAL"},
+        {3475ULL, "GL_MAP1_TEXTURE_COORD_1"},
+        {3476ULL, "GL_MAP1_TEXTURE_COORD_2"},
+        {3477ULL, "GL_MAP1_TEXTURE_COORD_3"},
+        {3478ULL, "GL_MAP1_TEXTURE_COORD_4"},
+        {3479ULL, "GL_MAP1_VERTEX_3"},
+        {3480ULL, "GL_MAP1_VERTEX_4"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3504ULL, "GL_MAP2_COLOR_4"},
+        {3505ULL, "GL_MAP2_INDEX"},
+        {3506ULL, "GL_MAP2_NORMAL"},
+        {3507ULL, "GL_MAP2_TEXTURE_COORD_1"},
+        {3508ULL, "GL_MAP2_TEXTURE_COORD_2"},
+        {3509ULL, "GL_MAP2_TEXTURE_COORD_3"},
+        {3510ULL, "GL_MAP2_TEXTURE_COORD_4"},
+        {3511ULL, "GL_MAP2_VERTEX_3"},
+        {3512ULL, "GL_MAP2_VERTEX_4"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3536ULL, "GL_MAP1_GRID_DOMAIN"},
+        {3537ULL, "GL_MAP1_GRID_SEGMENTS"},
+        {3538ULL, "GL_MAP2_GRID_DOMAIN"},
+        {3539ULL, "GL_MAP2_GRID_SEGMENTS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3552ULL, "GL_TEXTURE_1D"},
+        {3553ULL, "GL_TEXTURE_2D"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3569ULL, "GL_FEEDBACK_BUFFER_SIZE"},
+        {3570ULL, "GL_FEEDBACK_BUFFER_TYPE"},
+        {0, nullptr},
+        {3572ULL, "GL_SELECTION_BUFFER_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35368ULL, "GL_UNIFORM_BUFFER_BINDING"},
+        {35369ULL, "GL_UNIFORM_BUFFER_START"},
+        {35370ULL, "GL_UNIFORM_BUFFER_SIZE"},
+        {35371ULL, "GL_MAX_VERTEX_UNIFORM_BLOCKS"},
+        {35372ULL, "GL_MAX_GEOMETRY_UNIFORM_BLOCKS"},
+        {35373ULL, "GL_MAX_FRAGMENT_UNIFORM_BLOCKS"},
+        {35374ULL, "GL_MAX_COMBINED_UNIFORM_BLOCKS"},
+        {35375ULL, "GL_MAX_UNIFORM_BUFFER_BINDINGS"},
+        {35376ULL, "GL_MAX_UNIFORM_BLOCK_SIZE"},
+        {35377ULL, "GL_MAX_COMBINED_VERTEX_UNIFORM_COMPONENTS"},
+        {35378ULL, "GL_MAX_COMBINED_GEOMETRY_UNIFORM_COMPONENTS"},
+        {35379ULL, "GL_MAX_COMBINED_FRAGMENT_UNIFORM_COMPONENTS"},
+        {35380ULL, "GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35657ULL, "GL_MAX_FRAGMENT_UNIFORM_COMPONENTS"},
+        {35658ULL, "GL_MAX_VERTEX_UNIFORM_COMPONENTS"},
+        {35659ULL, "GL_MAX_VARYING_FLOATS"},
+        {35660ULL, "GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS"},
+        {35661ULL, "GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35723ULL, "GL_FRAGMENT_SHADER_DERIVATIVE_HINT"},
+        {0, nullptr},
+        {35725ULL, "GL_CURRENT_PROGRAM"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35738ULL, "GL_IMPLEMENTATION_COLOR_READ_TYPE"},
+        {35739ULL, "GL_IMPLEMENTATION_COLOR_READ_FORMAT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35868ULL, "GL_TEXTURE_BINDING_1D_ARRAY"},
+        {35869ULL, "GL_TEXTURE_BINDING_2D_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35881ULL, "GL_MAX_GEOMETRY_TEXTURE_IMAGE_UNITS"},
+        {0, nullptr},
+        {35883ULL, "GL_MAX_TEXTURE_BUFFER_SIZE"},
+        {35884ULL, "GL_TEXTURE_BINDING_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35972ULL, "GL_TRANSFORM_FEEDBACK_BUFFER_START"},
+        {35973ULL, "GL_TRANSFORM_FEEDBACK_BUFFER_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35983ULL, "GL_TRANSFORM_FEEDBACK_BUFFER_BINDING"},
+        {35984ULL, "GL_MOTION_ESTIMATION_SEARCH_BLOCK_X_QCOM"},
+        {35985ULL, "GL_MOTION_ESTIMATION_SEARCH_BLOCK_Y_QCOM"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36003ULL, "GL_STENCIL_BACK_REF"},
+        {36004ULL, "GL_STENCIL_BACK_VALUE_MASK"},
+        {36005ULL, "GL_STENCIL_BACK_WRITEMASK"},
+        {36006ULL, "GL_DRAW_FRAMEBUFFER_BINDING"},
+        {36007ULL, "GL_RENDERBUFFER_BINDING"},
+        {0, nullptr},
+        {0, nullptr},
+        {36010ULL, "GL_READ_FRAMEBUFFER_BINDING"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36203ULL, "GL_MAX_ELEMENT_INDEX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36319ULL, "GL_MAX_GEOMETRY_UNIFORM_COMPONENTS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry GetPixelMap[10] = {
+        {3190ULL, "GL_PIXEL_MAP_R_TO_R"},
+        {3191ULL, "GL_PIXEL_MAP_G_TO_G"},
+        {3192ULL, "GL_PIXEL_MAP_B_TO_B"},
+        {3193ULL, "GL_PIXEL_MAP_A_TO_A"},
+        {3184ULL, "GL_PIXEL_MAP_I_TO_I"},
+        {3185ULL, "GL_PIXEL_MAP_S_TO_S"},
+        {3186ULL, "GL_PIXEL_MAP_I_TO_R"},
+        {3187ULL, "GL_PIXEL_MAP_I_TO_G"},
+        {3188ULL, "GL_PIXEL_MAP_I_TO_B"},
+        {3189ULL, "GL_PIXEL_MAP_I_TO_A"},
+    };
+
+    inline constexpr Entry GetPointervPName[25] = {
+        {0, nullptr},
+        {0, nullptr},
+        {33152ULL, "GL_INSTRUMENT_BUFFER_POINTER_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32910ULL, "GL_VERTEX_ARRAY_POINTER"},
+        {32911ULL, "GL_NORMAL_ARRAY_POINTER"},
+        {32912ULL, "GL_COLOR_ARRAY_POINTER"},
+        {32913ULL, "GL_INDEX_ARRAY_POINTER"},
+        {32914ULL, "GL_TEXTURE_COORD_ARRAY_POINTER"},
+        {32915ULL, "GL_EDGE_FLAG_ARRAY_POINTER"},
+        {0, nullptr},
+        {0, nullptr},
+        {3568ULL, "GL_FEEDBACK_BUFFER_POINTER"},
+        {0, nullptr},
+        {0, nullptr},
+        {3571ULL, "GL_SELECTION_BUFFER_POINTER"},
+        {0, nullptr},
+        {33348ULL, "GL_DEBUG_CALLBACK_FUNCTION"},
+        {33349ULL, "GL_DEBUG_CALLBACK_USER_PARAM"},
+    };
+
+    inline constexpr Entry GetTexBumpParameterATI[4] = {
+        {34680ULL, "GL_BUMP_TEX_UNITS_ATI"},
+        {34677ULL, "GL_BUMP_ROT_MATRIX_ATI"},
+        {34678ULL, "GL_BUMP_ROT_MATRIX_SIZE_ATI"},
+        {34679ULL, "GL_BUMP_NUM_TEX_UNITS_ATI"},
+    };
+
+    inline constexpr Entry GetTextureParameter[164] = {
+        {4100ULL, "GL_TEXTURE_BORDER_COLOR"},
+        {4101ULL, "GL_TEXTURE_BORDER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33137ULL, "GL_TEXTURE_CLIPMAP_CENTER_SGIX"},
+        {33138ULL, "GL_TEXTURE_CLIPMAP_FRAME_SGIX"},
+        {33139ULL, "GL_TEXTURE_CLIPMAP_OFFSET_SGIX"},
+        {33140ULL, "GL_TEXTURE_CLIPMAP_VIRTUAL_DEPTH_SGIX"},
+        {33141ULL, "GL_TEXTURE_CLIPMAP_LOD_OFFSET_SGIX"},
+        {33142ULL, "GL_TEXTURE_CLIPMAP_DEPTH_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {33145ULL, "GL_POST_TEXTURE_FILTER_BIAS_SGIX"},
+        {33146ULL, "GL_POST_TEXTURE_FILTER_SCALE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {33641ULL, "GL_TEXTURE_MAX_CLAMP_S_SGIX"},
+        {33642ULL, "GL_TEXTURE_MAX_CLAMP_T_SGIX"},
+        {33643ULL, "GL_TEXTURE_MAX_CLAMP_R_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33166ULL, "GL_TEXTURE_LOD_BIAS_S_SGIX"},
+        {33167ULL, "GL_TEXTURE_LOD_BIAS_T_SGIX"},
+        {33168ULL, "GL_TEXTURE_LOD_BIAS_R_SGIX"},
+        {33169ULL, "GL_GENERATE_MIPMAP_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33178ULL, "GL_TEXTURE_COMPARE_SGIX"},
+        {33179ULL, "GL_TEXTURE_COMPARE_OPERATOR_SGIX"},
+        {33180ULL, "GL_TEXTURE_LEQUAL_R_SGIX"},
+        {33181ULL, "GL_TEXTURE_GEQUAL_R_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32860ULL, "GL_TEXTURE_RED_SIZE"},
+        {32861ULL, "GL_TEXTURE_GREEN_SIZE"},
+        {32862ULL, "GL_TEXTURE_BLUE_SIZE"},
+        {32863ULL, "GL_TEXTURE_ALPHA_SIZE"},
+        {32864ULL, "GL_TEXTURE_LUMINANCE_SIZE"},
+        {32865ULL, "GL_TEXTURE_INTENSITY_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32870ULL, "GL_TEXTURE_PRIORITY"},
+        {32871ULL, "GL_TEXTURE_RESIDENT"},
+        {10240ULL, "GL_TEXTURE_MAG_FILTER"},
+        {10241ULL, "GL_TEXTURE_MIN_FILTER"},
+        {10242ULL, "GL_TEXTURE_WRAP_S"},
+        {10243ULL, "GL_TEXTURE_WRAP_T"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32881ULL, "GL_TEXTURE_DEPTH_EXT"},
+        {32882ULL, "GL_TEXTURE_WRAP_R_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33060ULL, "GL_DUAL_TEXTURE_SELECT_SGIS"},
+        {33061ULL, "GL_QUAD_TEXTURE_SELECT_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33078ULL, "GL_TEXTURE_4DSIZE_SGIS"},
+        {33079ULL, "GL_TEXTURE_WRAP_Q_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {33082ULL, "GL_TEXTURE_MIN_LOD_SGIS"},
+        {33083ULL, "GL_TEXTURE_MAX_LOD_SGIS"},
+        {33084ULL, "GL_TEXTURE_BASE_LEVEL_SGIS"},
+        {33085ULL, "GL_TEXTURE_MAX_LEVEL_SGIS"},
+        {32922ULL, "GL_DETAIL_TEXTURE_LEVEL_SGIS"},
+        {32923ULL, "GL_DETAIL_TEXTURE_MODE_SGIS"},
+        {32924ULL, "GL_DETAIL_TEXTURE_FUNC_POINTS_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33095ULL, "GL_TEXTURE_FILTER4_SIZE_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36714ULL, "GL_TEXTURE_UNNORMALIZED_COORDINATES_ARM"},
+        {0, nullptr},
+        {32944ULL, "GL_SHARPEN_TEXTURE_FUNC_POINTS_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32959ULL, "GL_SHADOW_AMBIENT_SGIX"},
+        {4096ULL, "GL_TEXTURE_WIDTH"},
+        {4097ULL, "GL_TEXTURE_HEIGHT"},
+        {0, nullptr},
+        {4099ULL, "GL_TEXTURE_COMPONENTS"},
+    };
+
+    inline constexpr Entry GetVariantValueEXT[4] = {
+        {34788ULL, "GL_VARIANT_VALUE_EXT"},
+        {34789ULL, "GL_VARIANT_DATATYPE_EXT"},
+        {34790ULL, "GL_VARIANT_ARRAY_STRIDE_EXT"},
+        {34791ULL, "GL_VARIANT_ARRAY_TYPE_EXT"},
+    };
+
+    inline constexpr Entry GlslTypeToken[230] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35664ULL, "GL_FLOAT_VEC2"},
+        {35665ULL, "GL_FLOAT_VEC3"},
+        {35666ULL, "GL_FLOAT_VEC4"},
+        {35667ULL, "GL_INT_VEC2"},
+        {35668ULL, "GL_INT_VEC3"},
+        {35669ULL, "GL_INT_VEC4"},
+        {35670ULL, "GL_BOOL"},
+        {35671ULL, "GL_BOOL_VEC2"},
+        {35672ULL, "GL_BOOL_VEC3"},
+        {35673ULL, "GL_BOOL_VEC4"},
+        {35674ULL, "GL_FLOAT_MAT2"},
+        {35675ULL, "GL_FLOAT_MAT3"},
+        {35676ULL, "GL_FLOAT_MAT4"},
+        {35677ULL, "GL_SAMPLER_1D"},
+        {35678ULL, "GL_SAMPLER_2D"},
+        {35679ULL, "GL_SAMPLER_3D"},
+        {35680ULL, "GL_SAMPLER_CUBE"},
+        {35681ULL, "GL_SAMPLER_1D_SHADOW"},
+        {35682ULL, "GL_SAMPLER_2D_SHADOW"},
+        {35683ULL, "GL_SAMPLER_2D_RECT"},
+        {35684ULL, "GL_SAMPLER_2D_RECT_SHADOW"},
+        {35685ULL, "GL_FLOAT_MAT2x3"},
+        {35686ULL, "GL_FLOAT_MAT2x4"},
+        {35687ULL, "GL_FLOAT_MAT3x2"},
+        {35688ULL, "GL_FLOAT_MAT3x4"},
+        {35689ULL, "GL_FLOAT_MAT4x2"},
+        {35690ULL, "GL_FLOAT_MAT4x3"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36860ULL, "GL_DOUBLE_VEC2"},
+        {36861ULL, "GL_DOUBLE_VEC3"},
+        {36862ULL, "GL_DOUBLE_VEC4"},
+        {0, nullptr},
+        {5124ULL, "GL_INT"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5126ULL, "GL_FLOAT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {5130ULL, "GL_DOUBLE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36876ULL, "GL_SAMPLER_CUBE_MAP_ARRAY"},
+        {36877ULL, "GL_SAMPLER_CUBE_MAP_ARRAY_SHADOW"},
+        {36878ULL, "GL_INT_SAMPLER_CUBE_MAP_ARRAY"},
+        {36879ULL, "GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37128ULL, "GL_SAMPLER_2D_MULTISAMPLE"},
+        {37129ULL, "GL_INT_SAMPLER_2D_MULTISAMPLE"},
+        {37130ULL, "GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE"},
+        {37131ULL, "GL_SAMPLER_2D_MULTISAMPLE_ARRAY"},
+        {37132ULL, "GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY"},
+        {37133ULL, "GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY"},
+        {0, nullptr},
+        {37595ULL, "GL_UNSIGNED_INT_ATOMIC_COUNTER"},
+        {0, nullptr},
+        {0, nullptr},
+        {36678ULL, "GL_DOUBLE_MAT2"},
+        {36679ULL, "GL_DOUBLE_MAT3"},
+        {36680ULL, "GL_DOUBLE_MAT4"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36940ULL, "GL_IMAGE_1D"},
+        {36941ULL, "GL_IMAGE_2D"},
+        {36942ULL, "GL_IMAGE_3D"},
+        {36943ULL, "GL_IMAGE_2D_RECT"},
+        {36944ULL, "GL_IMAGE_CUBE"},
+        {36945ULL, "GL_IMAGE_BUFFER"},
+        {36946ULL, "GL_IMAGE_1D_ARRAY"},
+        {36947ULL, "GL_IMAGE_2D_ARRAY"},
+        {36948ULL, "GL_IMAGE_CUBE_MAP_ARRAY"},
+        {36949ULL, "GL_IMAGE_2D_MULTISAMPLE"},
+        {36950ULL, "GL_IMAGE_2D_MULTISAMPLE_ARRAY"},
+        {36951ULL, "GL_INT_IMAGE_1D"},
+        {36952ULL, "GL_INT_IMAGE_2D"},
+        {36953ULL, "GL_INT_IMAGE_3D"},
+        {36954ULL, "GL_INT_IMAGE_2D_RECT"},
+        {36955ULL, "GL_INT_IMAGE_CUBE"},
+        {36956ULL, "GL_INT_IMAGE_BUFFER"},
+        {36957ULL, "GL_INT_IMAGE_1D_ARRAY"},
+        {36958ULL, "GL_INT_IMAGE_2D_ARRAY"},
+        {36959ULL, "GL_INT_IMAGE_CUBE_MAP_ARRAY"},
+        {36960ULL, "GL_INT_IMAGE_2D_MULTISAMPLE"},
+        {36961ULL, "GL_INT_IMAGE_2D_MULTISAMPLE_ARRAY"},
+        {36962ULL, "GL_UNSIGNED_INT_IMAGE_1D"},
+        {36963ULL, "GL_UNSIGNED_INT_IMAGE_2D"},
+        {36964ULL, "GL_UNSIGNED_INT_IMAGE_3D"},
+        {36965ULL, "GL_UNSIGNED_INT_IMAGE_2D_RECT"},
+        {36966ULL, "GL_UNSIGNED_INT_IMAGE_CUBE"},
+        {36967ULL, "GL_UNSIGNED_INT_IMAGE_BUFFER"},
+        {36968ULL, "GL_UNSIGNED_INT_IMAGE_1D_ARRAY"},
+        {36969ULL, "GL_UNSIGNED_INT_IMAGE_2D_ARRAY"},
+        {36970ULL, "GL_UNSIGNED_INT_IMAGE_CUBE_MAP_ARRAY"},
+        {36971ULL, "GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE"},
+        {36972ULL, "GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36288ULL, "GL_SAMPLER_1D_ARRAY"},
+        {36289ULL, "GL_SAMPLER_2D_ARRAY"},
+        {36290ULL, "GL_SAMPLER_BUFFER"},
+        {36291ULL, "GL_SAMPLER_1D_ARRAY_SHADOW"},
+        {36292ULL, "GL_SAMPLER_2D_ARRAY_SHADOW"},
+        {36293ULL, "GL_SAMPLER_CUBE_SHADOW"},
+        {36294ULL, "GL_UNSIGNED_INT_VEC2"},
+        {36295ULL, "GL_UNSIGNED_INT_VEC3"},
+        {36296ULL, "GL_UNSIGNED_INT_VEC4"},
+        {36297ULL, "GL_INT_SAMPLER_1D"},
+        {36298ULL, "GL_INT_SAMPLER_2D"},
+        {36299ULL, "GL_INT_SAMPLER_3D"},
+        {36300ULL, "GL_INT_SAMPLER_CUBE"},
+        {36301ULL, "GL_INT_SAMPLER_2D_RECT"},
+        {36302ULL, "GL_INT_SAMPLER_1D_ARRAY"},
+        {36303ULL, "GL_INT_SAMPLER_2D_ARRAY"},
+        {36304ULL, "GL_INT_SAMPLER_BUFFER"},
+        {36305ULL, "GL_UNSIGNED_INT_SAMPLER_1D"},
+        {36306ULL, "GL_UNSIGNED_INT_SAMPLER_2D"},
+        {36307ULL, "GL_UNSIGNED_INT_SAMPLER_3D"},
+        {36308ULL, "GL_UNSIGNED_INT_SAMPLER_CUBE"},
+        {36309ULL, "GL_UNSIGNED_INT_SAMPLER_2D_RECT"},
+        {36310ULL, "GL_UNSIGNED_INT_SAMPLER_1D_ARRAY"},
+        {36311ULL, "GL_UNSIGNED_INT_SAMPLER_2D_ARRAY"},
+        {36312ULL, "GL_UNSIGNED_INT_SAMPLER_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry GraphicsResetStatus[6] = {
+        {0ULL, "GL_NO_ERROR"},
+        {0, nullptr},
+        {0, nullptr},
+        {33363ULL, "GL_GUILTY_CONTEXT_RESET"},
+        {33364ULL, "GL_INNOCENT_CONTEXT_RESET"},
+        {33365ULL, "GL_UNKNOWN_CONTEXT_RESET"},
+    };
+
+    inline constexpr Entry HintMode[3] = {
+        {4353ULL, "GL_FASTEST"},
+        {4354ULL, "GL_NICEST"},
+        {4352ULL, "GL_DONT_CARE"},
+    };
+
+    inline constexpr Entry HintTarget[179] = {
+        {107042ULL, "GL_WIDE_LINE_HINT_PGI"},
+        {107043ULL, "GL_BACK_NORMALS_HINT_PGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {107050ULL, "GL_VERTEX_DATA_HINT_PGI"},
+        {107051ULL, "GL_VERTEX_CONSISTENT_HINT_PGI"},
+        {107052ULL, "GL_MATERIAL_SIDE_HINT_PGI"},
+        {107053ULL, "GL_MAX_VERTEX_HINT_PGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34031ULL, "GL_TEXTURE_COMPRESSION_HINT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32782ULL, "GL_PACK_CMYK_HINT_EXT"},
+        {32783ULL, "GL_UNPACK_CMYK_HINT_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34225ULL, "GL_TRANSFORM_HINT_APPLE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34236ULL, "GL_TEXTURE_STORAGE_HINT_APPLE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33170ULL, "GL_GENERATE_MIPMAP_HINT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33003ULL, "GL_PHONG_HINT_WIN"},
+        {0, nullptr},
+        {34079ULL, "GL_VERTEX_ARRAY_STORAGE_HINT_APPLE"},
+        {0, nullptr},
+        {0, nullptr},
+        {33008ULL, "GL_CLIP_VOLUME_CLIPPING_HINT_EXT"},
+        {33367ULL, "GL_PROGRAM_BINARY_RETRIEVABLE_HINT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33558ULL, "GL_CONVOLUTION_HINT_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36784ULL, "GL_BINNING_CONTROL_HINT_QCOM"},
+        {34100ULL, "GL_MULTISAMPLE_FILTER_HINT_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33570ULL, "GL_SCALEBIAS_HINT_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35723ULL, "GL_FRAGMENT_SHADER_DERIVATIVE_HINT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3152ULL, "GL_PERSPECTIVE_CORRECTION_HINT"},
+        {3153ULL, "GL_POINT_SMOOTH_HINT"},
+        {3154ULL, "GL_LINE_SMOOTH_HINT"},
+        {3155ULL, "GL_POLYGON_SMOOTH_HINT"},
+        {3156ULL, "GL_FOG_HINT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33774ULL, "GL_VERTEX_PRECLIP_SGIX"},
+        {33775ULL, "GL_VERTEX_PRECLIP_HINT_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33070ULL, "GL_TEXTURE_MULTI_BUFFER_HINT_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {107000ULL, "GL_PREFER_DOUBLEBUFFER_HINT_PGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {107005ULL, "GL_CONSERVE_MEMORY_HINT_PGI"},
+        {107006ULL, "GL_RECLAIM_MEMORY_HINT_PGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {107011ULL, "GL_NATIVE_GRAPHICS_BEGIN_HINT_PGI"},
+        {107012ULL, "GL_NATIVE_GRAPHICS_END_HINT_PGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33627ULL, "GL_LINE_QUALITY_HINT_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {107020ULL, "GL_ALWAYS_FAST_HINT_PGI"},
+        {107021ULL, "GL_ALWAYS_SOFT_HINT_PGI"},
+        {107022ULL, "GL_ALLOW_DRAW_OBJ_HINT_PGI"},
+        {107023ULL, "GL_ALLOW_DRAW_WIN_HINT_PGI"},
+        {107024ULL, "GL_ALLOW_DRAW_FRG_HINT_PGI"},
+        {107025ULL, "GL_ALLOW_DRAW_MEM_HINT_PGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {107030ULL, "GL_STRICT_DEPTHFUNC_HINT_PGI"},
+        {107031ULL, "GL_STRICT_LIGHTING_HINT_PGI"},
+        {107032ULL, "GL_STRICT_SCISSOR_HINT_PGI"},
+        {107033ULL, "GL_FULL_STIPPLE_HINT_PGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {107040ULL, "GL_CLIP_NEAR_HINT_PGI"},
+        {107041ULL, "GL_CLIP_FAR_HINT_PGI"},
+    };
+
+    inline constexpr Entry HintTargetPGI[4] = {
+        {107052ULL, "GL_MATERIAL_SIDE_HINT_PGI"},
+        {107053ULL, "GL_MAX_VERTEX_HINT_PGI"},
+        {107050ULL, "GL_VERTEX_DATA_HINT_PGI"},
+        {107051ULL, "GL_VERTEX_CONSISTENT_HINT_PGI"},
+    };
+
+    inline constexpr Entry HistogramTargetEXT[2] = {
+        {32804ULL, "GL_HISTOGRAM"},
+        {32805ULL, "GL_PROXY_HISTOGRAM"},
+    };
+
+    inline constexpr Entry ImageTransformPNameHP[10] = {
+        {33110ULL, "GL_IMAGE_SCALE_Y_HP"},
+        {33111ULL, "GL_IMAGE_TRANSLATE_X_HP"},
+        {33112ULL, "GL_IMAGE_TRANSLATE_Y_HP"},
+        {33113ULL, "GL_IMAGE_ROTATE_ANGLE_HP"},
+        {33114ULL, "GL_IMAGE_ROTATE_ORIGIN_X_HP"},
+        {33115ULL, "GL_IMAGE_ROTATE_ORIGIN_Y_HP"},
+        {33116ULL, "GL_IMAGE_MAG_FILTER_HP"},
+        {33117ULL, "GL_IMAGE_MIN_FILTER_HP"},
+        {33118ULL, "GL_IMAGE_CUBIC_WEIGHT_HP"},
+        {33109ULL, "GL_IMAGE_SCALE_X_HP"},
+    };
+
+    inline constexpr Entry ImageTransformTargetHP[1] = {
+        {33121ULL, "GL_IMAGE_TRANSFORM_2D_HP"},
+    };
+
+    inline constexpr Entry IndexFunctionEXT[8] = {
+        {512ULL, "GL_NEVER"},
+        {513ULL, "GL_LESS"},
+        {514ULL, "GL_EQUAL"},
+        {515ULL, "GL_LEQUAL"},
+        {516ULL, "GL_GREATER"},
+        {517ULL, "GL_NOTEQUAL"},
+        {518ULL, "GL_GEQUAL"},
+        {519ULL, "GL_ALWAYS"},
+    };
+
+    inline constexpr Entry IndexMaterialParameterEXT[1] = {
+        {3347ULL, "GL_INDEX_OFFSET"},
+    };
+
+    inline constexpr Entry IndexPointerType[5] = {
+        {5130ULL, "GL_DOUBLE"},
+        {5126ULL, "GL_FLOAT"},
+        {5122ULL, "GL_SHORT"},
+        {0, nullptr},
+        {5124ULL, "GL_INT"},
+    };
+
+    inline constexpr Entry InterleavedArrayFormat[14] = {
+        {10794ULL, "GL_T2F_C3F_V3F"},
+        {10795ULL, "GL_T2F_N3F_V3F"},
+        {10796ULL, "GL_T2F_C4F_N3F_V3F"},
+        {10797ULL, "GL_T4F_C4F_N3F_V4F"},
+        {10784ULL, "GL_V2F"},
+        {10785ULL, "GL_V3F"},
+        {10786ULL, "GL_C4UB_V2F"},
+        {10787ULL, "GL_C4UB_V3F"},
+        {10788ULL, "GL_C3F_V3F"},
+        {10789ULL, "GL_N3F_V3F"},
+        {10790ULL, "GL_C4F_N3F_V3F"},
+        {10791ULL, "GL_T2F_V3F"},
+        {10792ULL, "GL_T4F_V4F"},
+        {10793ULL, "GL_T2F_C4UB_V3F"},
+    };
+
+    inline constexpr Entry InternalFormat[879] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37808ULL, "GL_COMPRESSED_RGBA_ASTC_4x4"},
+        {37809ULL, "GL_COMPRESSED_RGBA_ASTC_5x4"},
+        {37810ULL, "GL_COMPRESSED_RGBA_ASTC_5x5"},
+        {37811ULL, "GL_COMPRESSED_RGBA_ASTC_6x5"},
+        {37812ULL, "GL_COMPRESSED_RGBA_ASTC_6x6"},
+        {37813ULL, "GL_COMPRESSED_RGBA_ASTC_8x5"},
+        {37814ULL, "GL_COMPRESSED_RGBA_ASTC_8x6"},
+        {37815ULL, "GL_COMPRESSED_RGBA_ASTC_8x8"},
+        {37816ULL, "GL_COMPRESSED_RGBA_ASTC_10x5"},
+        {37817ULL, "GL_COMPRESSED_RGBA_ASTC_10x6"},
+        {37818ULL, "GL_COMPRESSED_RGBA_ASTC_10x8"},
+        {37819ULL, "GL_COMPRESSED_RGBA_ASTC_10x10"},
+        {37820ULL, "GL_COMPRESSED_RGBA_ASTC_12x10"},
+        {37821ULL, "GL_COMPRESSED_RGBA_ASTC_12x12"},
+        {0, nullptr},
+        {0, nullptr},
+        {37824ULL, "GL_COMPRESSED_RGBA_ASTC_3x3x3_OES"},
+        {37825ULL, "GL_COMPRESSED_RGBA_ASTC_4x3x3_OES"},
+        {37826ULL, "GL_COMPRESSED_RGBA_ASTC_4x4x3_OES"},
+        {37827ULL, "GL_COMPRESSED_RGBA_ASTC_4x4x4_OES"},
+        {37828ULL, "GL_COMPRESSED_RGBA_ASTC_5x4x4_OES"},
+        {37829ULL, "GL_COMPRESSED_RGBA_ASTC_5x5x4_OES"},
+        {37830ULL, "GL_COMPRESSED_RGBA_ASTC_5x5x5_OES"},
+        {37831ULL, "GL_COMPRESSED_RGBA_ASTC_6x5x5_OES"},
+        {37832ULL, "GL_COMPRESSED_RGBA_ASTC_6x6x5_OES"},
+        {37833ULL, "GL_COMPRESSED_RGBA_ASTC_6x6x6_OES"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37840ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4"},
+        {37841ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4"},
+        {37842ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5"},
+        {37843ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5"},
+        {37844ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6"},
+        {37845ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5"},
+        {37846ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6"},
+        {37847ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8"},
+        {37848ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5"},
+        {37849ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6"},
+        {37850ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8"},
+        {37851ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10"},
+        {37852ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10"},
+        {37853ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12"},
+        {36975ULL, "GL_RGB10_A2UI"},
+        {0, nullptr},
+        {37856ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_3x3x3_OES"},
+        {37857ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x3x3_OES"},
+        {37858ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4x3_OES"},
+        {37859ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4x4_OES"},
+        {37860ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4x4_OES"},
+        {37861ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5x4_OES"},
+        {37862ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5x5_OES"},
+        {37863ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5x5_OES"},
+        {37864ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6x5_OES"},
+        {37865ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6x6_OES"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36166ULL, "GL_STENCIL_INDEX1"},
+        {36167ULL, "GL_STENCIL_INDEX4"},
+        {36168ULL, "GL_STENCIL_INDEX8"},
+        {36169ULL, "GL_STENCIL_INDEX16"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36208ULL, "GL_RGBA32UI"},
+        {36209ULL, "GL_RGB32UI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36214ULL, "GL_RGBA16UI"},
+        {36215ULL, "GL_RGB16UI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36220ULL, "GL_RGBA8UI"},
+        {36221ULL, "GL_RGB8UI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36226ULL, "GL_RGBA32I"},
+        {36227ULL, "GL_RGB32I"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36232ULL, "GL_RGBA16I"},
+        {36233ULL, "GL_RGB16I"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36238ULL, "GL_RGBA8I"},
+        {36239ULL, "GL_RGB8I"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {10768ULL, "GL_R3_G3_B2"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36267ULL, "GL_DEPTH_COMPONENT32F_NV"},
+        {36268ULL, "GL_DEPTH32F_STENCIL8_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36283ULL, "GL_COMPRESSED_RED_RGTC1"},
+        {36284ULL, "GL_COMPRESSED_SIGNED_RED_RGTC1"},
+        {36285ULL, "GL_COMPRESSED_RG_RGTC2"},
+        {36286ULL, "GL_COMPRESSED_SIGNED_RG_RGTC2"},
+        {6401ULL, "GL_STENCIL_INDEX"},
+        {6402ULL, "GL_DEPTH_COMPONENT"},
+        {6403ULL, "GL_RED"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {6407ULL, "GL_RGB"},
+        {6408ULL, "GL_RGBA"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32827ULL, "GL_ALPHA4"},
+        {32828ULL, "GL_ALPHA8"},
+        {32829ULL, "GL_ALPHA12"},
+        {32830ULL, "GL_ALPHA16"},
+        {32831ULL, "GL_LUMINANCE4"},
+        {32832ULL, "GL_LUMINANCE8"},
+        {32833ULL, "GL_LUMINANCE12"},
+        {32834ULL, "GL_LUMINANCE16"},
+        {32835ULL, "GL_LUMINANCE4_ALPHA4"},
+        {32836ULL, "GL_LUMINANCE6_ALPHA2"},
+        {32837ULL, "GL_LUMINANCE8_ALPHA8"},
+        {32838ULL, "GL_LUMINANCE12_ALPHA4"},
+        {32839ULL, "GL_LUMINANCE12_ALPHA12"},
+        {32840ULL, "GL_LUMINANCE16_ALPHA16"},
+        {32841ULL, "GL_INTENSITY"},
+        {32842ULL, "GL_INTENSITY4"},
+        {32843ULL, "GL_INTENSITY8"},
+        {32844ULL, "GL_INTENSITY12"},
+        {32845ULL, "GL_INTENSITY16"},
+        {32846ULL, "GL_RGB2_EXT"},
+        {32847ULL, "GL_RGB4"},
+        {32848ULL, "GL_RGB5"},
+        {32849ULL, "GL_RGB8"},
+        {32850ULL, "GL_RGB10"},
+        {32851ULL, "GL_RGB12"},
+        {32852ULL, "GL_RGB16"},
+        {0, nullptr},
+        {32854ULL, "GL_RGBA4"},
+        {32855ULL, "GL_RGB5_A1"},
+        {32856ULL, "GL_RGBA8"},
+        {32857ULL, "GL_RGB10_A2"},
+        {32858ULL, "GL_RGBA12"},
+        {32859ULL, "GL_RGBA16"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34640ULL, "GL_DEPTH_STENCIL_MESA"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33776ULL, "GL_COMPRESSED_RGB_S3TC_DXT1_EXT"},
+        {33777ULL, "GL_COMPRESSED_RGBA_S3TC_DXT1_EXT"},
+        {33778ULL, "GL_COMPRESSED_RGBA_S3TC_DXT3_EXT"},
+        {33779ULL, "GL_COMPRESSED_RGBA_S3TC_DXT5_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36492ULL, "GL_COMPRESSED_RGBA_BPTC_UNORM"},
+        {36493ULL, "GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM"},
+        {36494ULL, "GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT"},
+        {36495ULL, "GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33040ULL, "GL_DUAL_ALPHA4_SGIS"},
+        {33041ULL, "GL_DUAL_ALPHA8_SGIS"},
+        {33042ULL, "GL_DUAL_ALPHA12_SGIS"},
+        {33043ULL, "GL_DUAL_ALPHA16_SGIS"},
+        {33044ULL, "GL_DUAL_LUMINANCE4_SGIS"},
+        {33045ULL, "GL_DUAL_LUMINANCE8_SGIS"},
+        {33046ULL, "GL_DUAL_LUMINANCE12_SGIS"},
+        {33047ULL, "GL_DUAL_LUMINANCE16_SGIS"},
+        {33048ULL, "GL_DUAL_INTENSITY4_SGIS"},
+        {33049ULL, "GL_DUAL_INTENSITY8_SGIS"},
+        {33050ULL, "GL_DUAL_INTENSITY12_SGIS"},
+        {33051ULL, "GL_DUAL_INTENSITY16_SGIS"},
+        {33052ULL, "GL_DUAL_LUMINANCE_ALPHA4_SGIS"},
+        {33053ULL, "GL_DUAL_LUMINANCE_ALPHA8_SGIS"},
+        {33054ULL, "GL_QUAD_ALPHA4_SGIS"},
+        {33055ULL, "GL_QUAD_ALPHA8_SGIS"},
+        {33056ULL, "GL_QUAD_LUMINANCE4_SGIS"},
+        {33057ULL, "GL_QUAD_LUMINANCE8_SGIS"},
+        {33058ULL, "GL_QUAD_INTENSITY4_SGIS"},
+        {33059ULL, "GL_QUAD_INTENSITY8_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34836ULL, "GL_RGBA32F"},
+        {34837ULL, "GL_RGB32F"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34842ULL, "GL_RGBA16F"},
+        {34843ULL, "GL_RGB16F"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37488ULL, "GL_COMPRESSED_R11_EAC"},
+        {37489ULL, "GL_COMPRESSED_SIGNED_R11_EAC"},
+        {37490ULL, "GL_COMPRESSED_RG11_EAC"},
+        {37491ULL, "GL_COMPRESSED_SIGNED_RG11_EAC"},
+        {37492ULL, "GL_COMPRESSED_RGB8_ETC2"},
+        {37493ULL, "GL_COMPRESSED_SRGB8_ETC2"},
+        {37494ULL, "GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2"},
+        {37495ULL, "GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2"},
+        {37496ULL, "GL_COMPRESSED_RGBA8_ETC2_EAC"},
+        {37497ULL, "GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34029ULL, "GL_COMPRESSED_RGB"},
+        {34030ULL, "GL_COMPRESSED_RGBA"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34041ULL, "GL_DEPTH_STENCIL"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33189ULL, "GL_DEPTH_COMPONENT16"},
+        {33190ULL, "GL_DEPTH_COMPONENT24_ARB"},
+        {33191ULL, "GL_DEPTH_COMPONENT32_ARB"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36756ULL, "GL_R8_SNORM"},
+        {36757ULL, "GL_RG8_SNORM"},
+        {36758ULL, "GL_RGB8_SNORM"},
+        {36759ULL, "GL_RGBA8_SNORM"},
+        {36760ULL, "GL_R16_SNORM"},
+        {36761ULL, "GL_RG16_SNORM"},
+        {36762ULL, "GL_RGB16_SNORM"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35898ULL, "GL_R11F_G11F_B10F"},
+        {0, nullptr},
+        {0, nullptr},
+        {35901ULL, "GL_RGB9_E5"},
+        {0, nullptr},
+        {0, nullptr},
+        {35904ULL, "GL_SRGB"},
+        {35905ULL, "GL_SRGB8"},
+        {35906ULL, "GL_SRGB_ALPHA"},
+        {35907ULL, "GL_SRGB8_ALPHA8"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35912ULL, "GL_COMPRESSED_SRGB"},
+        {35913ULL, "GL_COMPRESSED_SRGB_ALPHA"},
+        {0, nullptr},
+        {0, nullptr},
+        {35916ULL, "GL_COMPRESSED_SRGB_S3TC_DXT1_EXT"},
+        {35917ULL, "GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT"},
+        {35918ULL, "GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT"},
+        {35919ULL, "GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35056ULL, "GL_DEPTH24_STENCIL8"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33317ULL, "GL_COMPRESSED_RED"},
+        {33318ULL, "GL_COMPRESSED_RG"},
+        {33319ULL, "GL_RG"},
+        {0, nullptr},
+        {33321ULL, "GL_R8"},
+        {33322ULL, "GL_R16"},
+        {33323ULL, "GL_RG8"},
+        {33324ULL, "GL_RG16"},
+        {33325ULL, "GL_R16F"},
+        {33326ULL, "GL_R32F"},
+        {33327ULL, "GL_RG16F"},
+        {33328ULL, "GL_RG32F"},
+        {33329ULL, "GL_R8I"},
+        {33330ULL, "GL_R8UI"},
+        {33331ULL, "GL_R16I"},
+        {33332ULL, "GL_R16UI"},
+        {33333ULL, "GL_R32I"},
+        {33334ULL, "GL_R32UI"},
+        {33335ULL, "GL_RG8I"},
+        {33336ULL, "GL_RG8UI"},
+        {33337ULL, "GL_RG16I"},
+        {33338ULL, "GL_RG16UI"},
+        {33339ULL, "GL_RG32I"},
+        {33340ULL, "GL_RG32UI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36012ULL, "GL_DEPTH_COMPONENT32F"},
+        {36013ULL, "GL_DEPTH32F_STENCIL8"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry InternalFormatPName[184] = {
+        {0, nullptr},
+        {32937ULL, "GL_SAMPLES"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37733ULL, "GL_CLEAR_TEXTURE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37760ULL, "GL_NUM_SAMPLE_COUNTS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33169ULL, "GL_GENERATE_MIPMAP"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34465ULL, "GL_TEXTURE_COMPRESSED"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37063ULL, "GL_IMAGE_FORMAT_COMPATIBILITY_TYPE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33391ULL, "GL_INTERNALFORMAT_SUPPORTED"},
+        {33392ULL, "GL_INTERNALFORMAT_PREFERRED"},
+        {33393ULL, "GL_INTERNALFORMAT_RED_SIZE"},
+        {33394ULL, "GL_INTERNALFORMAT_GREEN_SIZE"},
+        {33395ULL, "GL_INTERNALFORMAT_BLUE_SIZE"},
+        {33396ULL, "GL_INTERNALFORMAT_ALPHA_SIZE"},
+        {33397ULL, "GL_INTERNALFORMAT_DEPTH_SIZE"},
+        {33398ULL, "GL_INTERNALFORMAT_STENCIL_SIZE"},
+        {33399ULL, "GL_INTERNALFORMAT_SHARED_SIZE"},
+        {33400ULL, "GL_INTERNALFORMAT_RED_TYPE"},
+        {33401ULL, "GL_INTERNALFORMAT_GREEN_TYPE"},
+        {33402ULL, "GL_INTERNALFORMAT_BLUE_TYPE"},
+        {33403ULL, "GL_INTERNALFORMAT_ALPHA_TYPE"},
+        {33404ULL, "GL_INTERNALFORMAT_DEPTH_TYPE"},
+        {33405ULL, "GL_INTERNALFORMAT_STENCIL_TYPE"},
+        {33406ULL, "GL_MAX_WIDTH"},
+        {33407ULL, "GL_MAX_HEIGHT"},
+        {33408ULL, "GL_MAX_DEPTH"},
+        {33409ULL, "GL_MAX_LAYERS"},
+        {0, nullptr},
+        {33411ULL, "GL_COLOR_COMPONENTS"},
+        {0, nullptr},
+        {0, nullptr},
+        {33414ULL, "GL_COLOR_RENDERABLE"},
+        {33415ULL, "GL_DEPTH_RENDERABLE"},
+        {33416ULL, "GL_STENCIL_RENDERABLE"},
+        {33417ULL, "GL_FRAMEBUFFER_RENDERABLE"},
+        {33418ULL, "GL_FRAMEBUFFER_RENDERABLE_LAYERED"},
+        {33419ULL, "GL_FRAMEBUFFER_BLEND"},
+        {33420ULL, "GL_READ_PIXELS"},
+        {33421ULL, "GL_READ_PIXELS_FORMAT"},
+        {33422ULL, "GL_READ_PIXELS_TYPE"},
+        {33423ULL, "GL_TEXTURE_IMAGE_FORMAT"},
+        {33424ULL, "GL_TEXTURE_IMAGE_TYPE"},
+        {33425ULL, "GL_GET_TEXTURE_IMAGE_FORMAT"},
+        {33426ULL, "GL_GET_TEXTURE_IMAGE_TYPE"},
+        {33427ULL, "GL_MIPMAP"},
+        {0, nullptr},
+        {33429ULL, "GL_AUTO_GENERATE_MIPMAP"},
+        {33430ULL, "GL_COLOR_ENCODING"},
+        {33431ULL, "GL_SRGB_READ"},
+        {33432ULL, "GL_SRGB_WRITE"},
+        {0, nullptr},
+        {33434ULL, "GL_FILTER"},
+        {33435ULL, "GL_VERTEX_TEXTURE"},
+        {33436ULL, "GL_TESS_CONTROL_TEXTURE"},
+        {33437ULL, "GL_TESS_EVALUATION_TEXTURE"},
+        {33438ULL, "GL_GEOMETRY_TEXTURE"},
+        {33439ULL, "GL_FRAGMENT_TEXTURE"},
+        {33440ULL, "GL_COMPUTE_TEXTURE"},
+        {33441ULL, "GL_TEXTURE_SHADOW"},
+        {33442ULL, "GL_TEXTURE_GATHER"},
+        {33443ULL, "GL_TEXTURE_GATHER_SHADOW"},
+        {33444ULL, "GL_SHADER_IMAGE_LOAD"},
+        {33445ULL, "GL_SHADER_IMAGE_STORE"},
+        {33446ULL, "GL_SHADER_IMAGE_ATOMIC"},
+        {33447ULL, "GL_IMAGE_TEXEL_SIZE"},
+        {33448ULL, "GL_IMAGE_COMPATIBILITY_CLASS"},
+        {33449ULL, "GL_IMAGE_PIXEL_FORMAT"},
+        {33450ULL, "GL_IMAGE_PIXEL_TYPE"},
+        {0, nullptr},
+        {33452ULL, "GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_TEST"},
+        {33453ULL, "GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_TEST"},
+        {33454ULL, "GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_WRITE"},
+        {33455ULL, "GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_WRITE"},
+        {0, nullptr},
+        {33457ULL, "GL_TEXTURE_COMPRESSED_BLOCK_WIDTH"},
+        {33458ULL, "GL_TEXTURE_COMPRESSED_BLOCK_HEIGHT"},
+        {33459ULL, "GL_TEXTURE_COMPRESSED_BLOCK_SIZE"},
+        {33460ULL, "GL_CLEAR_BUFFER"},
+        {33461ULL, "GL_TEXTURE_VIEW"},
+        {33462ULL, "GL_VIEW_COMPATIBILITY_CLASS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry InvalidateFramebufferAttachment[65] = {
+        {36075ULL, "GL_COLOR_ATTACHMENT11"},
+        {36076ULL, "GL_COLOR_ATTACHMENT12"},
+        {36077ULL, "GL_COLOR_ATTACHMENT13"},
+        {36078ULL, "GL_COLOR_ATTACHMENT14"},
+        {36079ULL, "GL_COLOR_ATTACHMENT15"},
+        {36080ULL, "GL_COLOR_ATTACHMENT16"},
+        {36081ULL, "GL_COLOR_ATTACHMENT17"},
+        {36082ULL, "GL_COLOR_ATTACHMENT18"},
+        {36083ULL, "GL_COLOR_ATTACHMENT19"},
+        {36084ULL, "GL_COLOR_ATTACHMENT20"},
+        {36085ULL, "GL_COLOR_ATTACHMENT21"},
+        {36086ULL, "GL_COLOR_ATTACHMENT22"},
+        {36087ULL, "GL_COLOR_ATTACHMENT23"},
+        {36088ULL, "GL_COLOR_ATTACHMENT24"},
+        {36089ULL, "GL_COLOR_ATTACHMENT25"},
+        {36090ULL, "GL_COLOR_ATTACHMENT26"},
+        {36091ULL, "GL_COLOR_ATTACHMENT27"},
+        {36092ULL, "GL_COLOR_ATTACHMENT28"},
+        {36093ULL, "GL_COLOR_ATTACHMENT29"},
+        {36094ULL, "GL_COLOR_ATTACHMENT30"},
+        {36095ULL, "GL_COLOR_ATTACHMENT31"},
+        {36096ULL, "GL_DEPTH_ATTACHMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33306ULL, "GL_DEPTH_STENCIL_ATTACHMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {6144ULL, "GL_COLOR"},
+        {6145ULL, "GL_DEPTH"},
+        {6146ULL, "GL_STENCIL"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36128ULL, "GL_STENCIL_ATTACHMENT_EXT"},
+        {36064ULL, "GL_COLOR_ATTACHMENT0"},
+        {36065ULL, "GL_COLOR_ATTACHMENT1"},
+        {36066ULL, "GL_COLOR_ATTACHMENT2"},
+        {36067ULL, "GL_COLOR_ATTACHMENT3"},
+        {36068ULL, "GL_COLOR_ATTACHMENT4"},
+        {36069ULL, "GL_COLOR_ATTACHMENT5"},
+        {36070ULL, "GL_COLOR_ATTACHMENT6"},
+        {36071ULL, "GL_COLOR_ATTACHMENT7"},
+        {36072ULL, "GL_COLOR_ATTACHMENT8"},
+        {36073ULL, "GL_COLOR_ATTACHMENT9"},
+        {36074ULL, "GL_COLOR_ATTACHMENT10"},
+    };
+
+    inline constexpr Entry LightEnvModeSGIX[3] = {
+        {8448ULL, "GL_MODULATE"},
+        {7681ULL, "GL_REPLACE"},
+        {260ULL, "GL_ADD"},
+    };
+
+    inline constexpr Entry LightEnvParameterSGIX[1] = {
+        {33799ULL, "GL_LIGHT_ENV_MODE_SGIX"},
+    };
+
+    inline constexpr Entry LightModelColorControl[2] = {
+        {33274ULL, "GL_SEPARATE_SPECULAR_COLOR"},
+        {33273ULL, "GL_SINGLE_COLOR"},
+    };
+
+    inline constexpr Entry LightModelParameter[4] = {
+        {33272ULL, "GL_LIGHT_MODEL_COLOR_CONTROL"},
+        {2897ULL, "GL_LIGHT_MODEL_LOCAL_VIEWER"},
+        {2898ULL, "GL_LIGHT_MODEL_TWO_SIDE"},
+        {2899ULL, "GL_LIGHT_MODEL_AMBIENT"},
+    };
+
+    inline constexpr Entry LightName[21] = {
+        {33810ULL, "GL_FRAGMENT_LIGHT6_SGIX"},
+        {33811ULL, "GL_FRAGMENT_LIGHT7_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {16384ULL, "GL_LIGHT0"},
+        {16385ULL, "GL_LIGHT1"},
+        {16386ULL, "GL_LIGHT2"},
+        {16387ULL, "GL_LIGHT3"},
+        {16388ULL, "GL_LIGHT4"},
+        {16389ULL, "GL_LIGHT5"},
+        {16390ULL, "GL_LIGHT6"},
+        {16391ULL, "GL_LIGHT7"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33804ULL, "GL_FRAGMENT_LIGHT0_SGIX"},
+        {33805ULL, "GL_FRAGMENT_LIGHT1_SGIX"},
+        {33806ULL, "GL_FRAGMENT_LIGHT2_SGIX"},
+        {33807ULL, "GL_FRAGMENT_LIGHT3_SGIX"},
+        {33808ULL, "GL_FRAGMENT_LIGHT4_SGIX"},
+        {33809ULL, "GL_FRAGMENT_LIGHT5_SGIX"},
+    };
+
+    inline constexpr Entry LightParameter[7] = {
+        {4613ULL, "GL_SPOT_EXPONENT"},
+        {4614ULL, "GL_SPOT_CUTOFF"},
+        {4615ULL, "GL_CONSTANT_ATTENUATION"},
+        {4616ULL, "GL_LINEAR_ATTENUATION"},
+        {4617ULL, "GL_QUADRATIC_ATTENUATION"},
+        {4611ULL, "GL_POSITION"},
+        {4612ULL, "GL_SPOT_DIRECTION"},
+    };
+
+    inline constexpr Entry LightTextureModeEXT[7] = {
+        {0, nullptr},
+        {33874ULL, "GL_FRAGMENT_DEPTH_EXT"},
+        {33609ULL, "GL_FRAGMENT_MATERIAL_EXT"},
+        {33610ULL, "GL_FRAGMENT_NORMAL_EXT"},
+        {0, nullptr},
+        {33612ULL, "GL_FRAGMENT_COLOR_EXT"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry LightTexturePNameEXT[2] = {
+        {33614ULL, "GL_SHADOW_ATTENUATION_EXT"},
+        {33613ULL, "GL_ATTENUATION_EXT"},
+    };
+
+    inline constexpr Entry ListMode[2] = {
+        {4864ULL, "GL_COMPILE"},
+        {4865ULL, "GL_COMPILE_AND_EXECUTE"},
+    };
+
+    inline constexpr Entry ListNameType[10] = {
+        {5120ULL, "GL_BYTE"},
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5122ULL, "GL_SHORT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+        {5124ULL, "GL_INT"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5126ULL, "GL_FLOAT"},
+        {5127ULL, "GL_2_BYTES"},
+        {5128ULL, "GL_3_BYTES"},
+        {5129ULL, "GL_4_BYTES"},
+    };
+
+    inline constexpr Entry ListParameterName[1] = {
+        {33154ULL, "GL_LIST_PRIORITY_SGIX"},
+    };
+
+    inline constexpr Entry LogicOp[16] = {
+        {5376ULL, "GL_CLEAR"},
+        {5377ULL, "GL_AND"},
+        {5378ULL, "GL_AND_REVERSE"},
+        {5379ULL, "GL_COPY"},
+        {5380ULL, "GL_AND_INVERTED"},
+        {5381ULL, "GL_NOOP"},
+        {5382ULL, "GL_XOR"},
+        {5383ULL, "GL_OR"},
+        {5384ULL, "GL_NOR"},
+        {5385ULL, "GL_EQUIV"},
+        {5386ULL, "GL_INVERT"},
+        {5387ULL, "GL_OR_REVERSE"},
+        {5388ULL, "GL_COPY_INVERTED"},
+        {5389ULL, "GL_OR_INVERTED"},
+        {5390ULL, "GL_NAND"},
+        {5391ULL, "GL_SET"},
+    };
+
+    inline constexpr Entry MapAttribParameterNV[2] = {
+        {34500ULL, "GL_MAP_ATTRIB_V_ORDER_NV"},
+        {34499ULL, "GL_MAP_ATTRIB_U_ORDER_NV"},
+    };
+
+    inline constexpr Entry MapBufferAccessMask[11] = {
+        {0, nullptr},
+        {1ULL, "GL_MAP_READ_BIT"},
+        {2ULL, "GL_MAP_WRITE_BIT"},
+        {0, nullptr},
+        {4ULL, "GL_MAP_INVALIDATE_RANGE_BIT"},
+        {16ULL, "GL_MAP_FLUSH_EXPLICIT_BIT"},
+        {0, nullptr},
+        {128ULL, "GL_MAP_COHERENT_BIT"},
+        {8ULL, "GL_MAP_INVALIDATE_BUFFER_BIT"},
+        {64ULL, "GL_MAP_PERSISTENT_BIT"},
+        {32ULL, "GL_MAP_UNSYNCHRONIZED_BIT"},
+    };
+
+    inline constexpr Entry MapParameterNV[1] = {
+        {34498ULL, "GL_MAP_TESSELLATION_NV"},
+    };
+
+    inline constexpr Entry MapQuery[3] = {
+        {2562ULL, "GL_DOMAIN"},
+        {2560ULL, "GL_COEFF"},
+        {2561ULL, "GL_ORDER"},
+    };
+
+    inline constexpr Entry MapTarget[41] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33172ULL, "GL_GEOMETRY_DEFORMATION_SGIX"},
+        {33173ULL, "GL_TEXTURE_DEFORMATION_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3504ULL, "GL_MAP2_COLOR_4"},
+        {3505ULL, "GL_MAP2_INDEX"},
+        {3506ULL, "GL_MAP2_NORMAL"},
+        {3507ULL, "GL_MAP2_TEXTURE_COORD_1"},
+        {3508ULL, "GL_MAP2_TEXTURE_COORD_2"},
+        {3509ULL, "GL_MAP2_TEXTURE_COORD_3"},
+        {3510ULL, "GL_MAP2_TEXTURE_COORD_4"},
+        {3511ULL, "GL_MAP2_VERTEX_3"},
+        {3512ULL, "GL_MAP2_VERTEX_4"},
+        {3472ULL, "GL_MAP1_COLOR_4"},
+        {3473ULL, "GL_MAP1_INDEX"},
+        {3474ULL, "GL_MAP1_NORMAL"},
+        {3475ULL, "GL_MAP1_TEXTURE_COORD_1"},
+        {3476ULL, "GL_MAP1_TEXTURE_COORD_2"},
+        {3477ULL, "GL_MAP1_TEXTURE_COORD_3"},
+        {3478ULL, "GL_MAP1_TEXTURE_COORD_4"},
+        {3479ULL, "GL_MAP1_VERTEX_3"},
+        {3480ULL, "GL_MAP1_VERTEX_4"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry MapTextureFormatINTEL[3] = {
+        {0ULL, "GL_LAYOUT_DEFAULT_INTEL"},
+        {1ULL, "GL_LAYOUT_LINEAR_INTEL"},
+        {2ULL, "GL_LAYOUT_LINEAR_CPU_CACHED_INTEL"},
+    };
+
+    inline constexpr Entry MapTypeNV[3] = {
+        {5130ULL, "GL_DOUBLE"},
+        {0, nullptr},
+        {5126ULL, "GL_FLOAT"},
+    };
+
+    inline constexpr Entry MaterialFace[5] = {
+        {0, nullptr},
+        {0, nullptr},
+        {1032ULL, "GL_FRONT_AND_BACK"},
+        {1028ULL, "GL_FRONT"},
+        {1029ULL, "GL_BACK"},
+    };
+
+    inline constexpr Entry MaterialParameter[10] = {
+        {4610ULL, "GL_SPECULAR"},
+        {0, nullptr},
+        {5632ULL, "GL_EMISSION"},
+        {5633ULL, "GL_SHININESS"},
+        {5634ULL, "GL_AMBIENT_AND_DIFFUSE"},
+        {5635ULL, "GL_COLOR_INDEXES"},
+        {0, nullptr},
+        {0, nullptr},
+        {4608ULL, "GL_AMBIENT"},
+        {4609ULL, "GL_DIFFUSE"},
+    };
+
+    inline constexpr Entry MatrixIndexPointerTypeARB[3] = {
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+    };
+
+    inline constexpr Entry MatrixMode[3] = {
+        {5889ULL, "GL_PROJECTION"},
+        {5890ULL, "GL_TEXTURE"},
+        {5888ULL, "GL_MODELVIEW"},
+    };
+
+    inline constexpr Entry MemoryBarrierMask[19] = {
+        {0, nullptr},
+        {1ULL, "GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT"},
+        {2ULL, "GL_ELEMENT_ARRAY_BARRIER_BIT"},
+        {8192ULL, "GL_SHADER_STORAGE_BARRIER_BIT"},
+        {4ULL, "GL_UNIFORM_BARRIER_BIT"},
+        {4294967295ULL, "GL_ALL_BARRIER_BITS"},
+        {16384ULL, "GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT"},
+        {64ULL, "GL_COMMAND_BARRIER_BIT"},
+        {8ULL, "GL_TEXTURE_FETCH_BARRIER_BIT"},
+        {256ULL, "GL_TEXTURE_UPDATE_BARRIER_BIT"},
+        {0, nullptr},
+        {4096ULL, "GL_ATOMIC_COUNTER_BARRIER_BIT"},
+        {32768ULL, "GL_QUERY_BUFFER_BARRIER_BIT"},
+        {32ULL, "GL_SHADER_IMAGE_ACCESS_BARRIER_BIT"},
+        {128ULL, "GL_PIXEL_BUFFER_BARRIER_BIT"},
+        {2048ULL, "GL_TRANSFORM_FEEDBACK_BARRIER_BIT"},
+        {16ULL, "GL_SHADER_GLOBAL_ACCESS_BARRIER_BIT_NV"},
+        {1024ULL, "GL_FRAMEBUFFER_BARRIER_BIT"},
+        {512ULL, "GL_BUFFER_UPDATE_BARRIER_BIT"},
+    };
+
+    inline constexpr Entry MemoryObjectParameterName[3] = {
+        {0, nullptr},
+        {38299ULL, "GL_PROTECTED_MEMORY_OBJECT_EXT"},
+        {38273ULL, "GL_DEDICATED_MEMORY_OBJECT_EXT"},
+    };
+
+    inline constexpr Entry MeshMode1[2] = {
+        {6912ULL, "GL_POINT"},
+        {6913ULL, "GL_LINE"},
+    };
+
+    inline constexpr Entry MeshMode2[3] = {
+        {6912ULL, "GL_POINT"},
+        {6913ULL, "GL_LINE"},
+        {6914ULL, "GL_FILL"},
+    };
+
+    inline constexpr Entry MinmaxTargetEXT[1] = {
+        {32814ULL, "GL_MINMAX"},
+    };
+
+    inline constexpr Entry NormalPointerType[7] = {
+        {5124ULL, "GL_INT"},
+        {0, nullptr},
+        {5126ULL, "GL_FLOAT"},
+        {5120ULL, "GL_BYTE"},
+        {0, nullptr},
+        {5122ULL, "GL_SHORT"},
+        {5130ULL, "GL_DOUBLE"},
+    };
+
+    inline constexpr Entry ObjectIdentifier[19] = {
+        {5890ULL, "GL_TEXTURE"},
+        {36386ULL, "GL_TRANSFORM_FEEDBACK"},
+        {0, nullptr},
+        {36160ULL, "GL_FRAMEBUFFER"},
+        {36161ULL, "GL_RENDERBUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {33504ULL, "GL_BUFFER"},
+        {33505ULL, "GL_SHADER"},
+        {33506ULL, "GL_PROGRAM"},
+        {33507ULL, "GL_QUERY"},
+        {33508ULL, "GL_PROGRAM_PIPELINE"},
+        {0, nullptr},
+        {33510ULL, "GL_SAMPLER"},
+        {32884ULL, "GL_VERTEX_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry ObjectTypeAPPLE[2] = {
+        {35338ULL, "GL_DRAW_PIXELS_APPLE"},
+        {35339ULL, "GL_FENCE_APPLE"},
+    };
+
+    inline constexpr Entry OcclusionQueryEventMaskAMD[5] = {
+        {4294967295ULL, "GL_QUERY_ALL_EVENT_BITS_AMD"},
+        {1ULL, "GL_QUERY_DEPTH_PASS_EVENT_BIT_AMD"},
+        {2ULL, "GL_QUERY_DEPTH_FAIL_EVENT_BIT_AMD"},
+        {8ULL, "GL_QUERY_DEPTH_BOUNDS_FAIL_EVENT_BIT_AMD"},
+        {4ULL, "GL_QUERY_STENCIL_FAIL_EVENT_BIT_AMD"},
+    };
+
+    inline constexpr Entry OcclusionQueryParameterNameNV[2] = {
+        {34918ULL, "GL_PIXEL_COUNT_NV"},
+        {34919ULL, "GL_PIXEL_COUNT_AVAILABLE_NV"},
+    };
+
+    inline constexpr Entry PNTrianglesPNameATI[3] = {
+        {34803ULL, "GL_PN_TRIANGLES_NORMAL_MODE_ATI"},
+        {34804ULL, "GL_PN_TRIANGLES_TESSELATION_LEVEL_ATI"},
+        {34802ULL, "GL_PN_TRIANGLES_POINT_MODE_ATI"},
+    };
+
+    inline constexpr Entry ParameterRangeEXT[2] = {
+        {34784ULL, "GL_NORMALIZED_RANGE_EXT"},
+        {34785ULL, "GL_FULL_RANGE_EXT"},
+    };
+
+    inline constexpr Entry PatchParameterName[3] = {
+        {36468ULL, "GL_PATCH_DEFAULT_OUTER_LEVEL"},
+        {36466ULL, "GL_PATCH_VERTICES"},
+        {36467ULL, "GL_PATCH_DEFAULT_INNER_LEVEL"},
+    };
+
+    inline constexpr Entry PathColor[4] = {
+        {34092ULL, "GL_PRIMARY_COLOR_NV"},
+        {34093ULL, "GL_SECONDARY_COLOR_NV"},
+        {0, nullptr},
+        {34167ULL, "GL_PRIMARY_COLOR"},
+    };
+
+    inline constexpr Entry PathColorFormat[15] = {
+        {0ULL, "GL_NONE"},
+        {6406ULL, "GL_ALPHA"},
+        {6407ULL, "GL_RGB"},
+        {6408ULL, "GL_RGBA"},
+        {6409ULL, "GL_LUMINANCE"},
+        {6410ULL, "GL_LUMINANCE_ALPHA"},
+        {32841ULL, "GL_INTENSITY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry PathCoordType[64] = {
+        {0ULL, "GL_CLOSE_PATH_NV"},
+        {0, nullptr},
+        {2ULL, "GL_MOVE_TO_NV"},
+        {3ULL, "GL_RELATIVE_MOVE_TO_NV"},
+        {4ULL, "GL_LINE_TO_NV"},
+        {5ULL, "GL_RELATIVE_LINE_TO_NV"},
+        {6ULL, "GL_HORIZONTAL_LINE_TO_NV"},
+        {7ULL, "GL_RELATIVE_HORIZONTAL_LINE_TO_NV"},
+        {8ULL, "GL_VERTICAL_LINE_TO_NV"},
+        {9ULL, "GL_RELATIVE_VERTICAL_LINE_TO_NV"},
+        {10ULL, "GL_QUADRATIC_CURVE_TO_NV"},
+        {11ULL, "GL_RELATIVE_QUADRATIC_CURVE_TO_NV"},
+        {12ULL, "GL_CUBIC_CURVE_TO_NV"},
+        {13ULL, "GL_RELATIVE_CUBIC_CURVE_TO_NV"},
+        {14ULL, "GL_SMOOTH_QUADRATIC_CURVE_TO_NV"},
+        {15ULL, "GL_RELATIVE_SMOOTH_QUADRATIC_CURVE_TO_NV"},
+        {16ULL, "GL_SMOOTH_CUBIC_CURVE_TO_NV"},
+        {17ULL, "GL_RELATIVE_SMOOTH_CUBIC_CURVE_TO_NV"},
+        {18ULL, "GL_SMALL_CCW_ARC_TO_NV"},
+        {19ULL, "GL_RELATIVE_SMALL_CCW_ARC_TO_NV"},
+        {20ULL, "GL_SMALL_CW_ARC_TO_NV"},
+        {21ULL, "GL_RELATIVE_SMALL_CW_ARC_TO_NV"},
+        {22ULL, "GL_LARGE_CCW_ARC_TO_NV"},
+        {23ULL, "GL_RELATIVE_LARGE_CCW_ARC_TO_NV"},
+        {24ULL, "GL_LARGE_CW_ARC_TO_NV"},
+        {25ULL, "GL_RELATIVE_LARGE_CW_ARC_TO_NV"},
+        {26ULL, "GL_CONIC_CURVE_TO_NV"},
+        {27ULL, "GL_RELATIVE_CONIC_CURVE_TO_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {232ULL, "GL_ROUNDED_RECT_NV"},
+        {233ULL, "GL_RELATIVE_ROUNDED_RECT_NV"},
+        {234ULL, "GL_ROUNDED_RECT2_NV"},
+        {235ULL, "GL_RELATIVE_ROUNDED_RECT2_NV"},
+        {236ULL, "GL_ROUNDED_RECT4_NV"},
+        {237ULL, "GL_RELATIVE_ROUNDED_RECT4_NV"},
+        {238ULL, "GL_ROUNDED_RECT8_NV"},
+        {239ULL, "GL_RELATIVE_ROUNDED_RECT8_NV"},
+        {240ULL, "GL_RESTART_PATH_NV"},
+        {0, nullptr},
+        {242ULL, "GL_DUP_FIRST_CUBIC_CURVE_TO_NV"},
+        {0, nullptr},
+        {244ULL, "GL_DUP_LAST_CUBIC_CURVE_TO_NV"},
+        {0, nullptr},
+        {246ULL, "GL_RECT_NV"},
+        {247ULL, "GL_RELATIVE_RECT_NV"},
+        {248ULL, "GL_CIRCULAR_CCW_ARC_TO_NV"},
+        {0, nullptr},
+        {250ULL, "GL_CIRCULAR_CW_ARC_TO_NV"},
+        {0, nullptr},
+        {252ULL, "GL_CIRCULAR_TANGENT_ARC_TO_NV"},
+        {0, nullptr},
+        {254ULL, "GL_ARC_TO_NV"},
+        {255ULL, "GL_RELATIVE_ARC_TO_NV"},
+    };
+
+    inline constexpr Entry PathCoverMode[4] = {
+        {37020ULL, "GL_BOUNDING_BOX_OF_BOUNDING_BOXES_NV"},
+        {37005ULL, "GL_BOUNDING_BOX_NV"},
+        {36994ULL, "GL_PATH_FILL_COVER_MODE_NV"},
+        {37003ULL, "GL_CONVEX_HULL_NV"},
+    };
+
+    inline constexpr Entry PathElementType[2] = {
+        {37018ULL, "GL_UTF8_NV"},
+        {37019ULL, "GL_UTF16_NV"},
+    };
+
+    inline constexpr Entry PathFillMode[7] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {5386ULL, "GL_INVERT"},
+        {36992ULL, "GL_PATH_FILL_MODE_NV"},
+        {37000ULL, "GL_COUNT_UP_NV"},
+        {37001ULL, "GL_COUNT_DOWN_NV"},
+    };
+
+    inline constexpr Entry PathFontStyle[3] = {
+        {0ULL, "GL_NONE"},
+        {1ULL, "GL_BOLD_BIT_NV"},
+        {2ULL, "GL_ITALIC_BIT_NV"},
+    };
+
+    inline constexpr Entry PathFontTarget[3] = {
+        {36978ULL, "GL_STANDARD_FONT_NAME_NV"},
+        {36979ULL, "GL_SYSTEM_FONT_NAME_NV"},
+        {36980ULL, "GL_FILE_NAME_NV"},
+    };
+
+    inline constexpr Entry PathGenMode[15] = {
+        {0ULL, "GL_NONE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {9216ULL, "GL_EYE_LINEAR"},
+        {9217ULL, "GL_OBJECT_LINEAR"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34166ULL, "GL_CONSTANT"},
+        {37002ULL, "GL_PATH_OBJECT_BOUNDING_BOX_NV"},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry PathHandleMissingGlyphs[2] = {
+        {37034ULL, "GL_USE_MISSING_GLYPH_NV"},
+        {37033ULL, "GL_SKIP_MISSING_GLYPH_NV"},
+    };
+
+    inline constexpr Entry PathListMode[3] = {
+        {37038ULL, "GL_ADJACENT_PAIRS_NV"},
+        {37039ULL, "GL_FIRST_TO_REST_NV"},
+        {37037ULL, "GL_ACCUM_ADJACENT_PAIRS_NV"},
+    };
+
+    inline constexpr Entry PathMetricMask[37] = {
+        {0, nullptr},
+        {1ULL, "GL_GLYPH_WIDTH_BIT_NV"},
+        {2ULL, "GL_GLYPH_HEIGHT_BIT_NV"},
+        {67108864ULL, "GL_FONT_UNDERLINE_POSITION_BIT_NV"},
+        {4ULL, "GL_GLYPH_HORIZONTAL_BEARING_X_BIT_NV"},
+        {8388608ULL, "GL_FONT_HEIGHT_BIT_NV"},
+        {134217728ULL, "GL_FONT_UNDERLINE_THICKNESS_BIT_NV"},
+        {0, nullptr},
+        {8ULL, "GL_GLYPH_HORIZONTAL_BEARING_Y_BIT_NV"},
+        {65536ULL, "GL_FONT_X_MIN_BOUNDS_BIT_NV"},
+        {16777216ULL, "GL_FONT_MAX_ADVANCE_WIDTH_BIT_NV"},
+        {0, nullptr},
+        {268435456ULL, "GL_FONT_HAS_KERNING_BIT_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {16ULL, "GL_GLYPH_HORIZONTAL_BEARING_ADVANCE_BIT_NV"},
+        {128ULL, "GL_GLYPH_VERTICAL_BEARING_ADVANCE_BIT_NV"},
+        {131072ULL, "GL_FONT_Y_MIN_BOUNDS_BIT_NV"},
+        {0, nullptr},
+        {33554432ULL, "GL_FONT_MAX_ADVANCE_HEIGHT_BIT_NV"},
+        {4194304ULL, "GL_FONT_DESCENDER_BIT_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {536870912ULL, "GL_FONT_NUM_GLYPH_INDICES_BIT_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {64ULL, "GL_GLYPH_VERTICAL_BEARING_Y_BIT_NV"},
+        {0, nullptr},
+        {2097152ULL, "GL_FONT_ASCENDER_BIT_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {32ULL, "GL_GLYPH_VERTICAL_BEARING_X_BIT_NV"},
+        {1048576ULL, "GL_FONT_UNITS_PER_EM_BIT_NV"},
+        {256ULL, "GL_GLYPH_HAS_KERNING_BIT_NV"},
+        {524288ULL, "GL_FONT_Y_MAX_BOUNDS_BIT_NV"},
+        {262144ULL, "GL_FONT_X_MAX_BOUNDS_BIT_NV"},
+    };
+
+    inline constexpr Entry PathParameter[46] = {
+        {36984ULL, "GL_PATH_TERMINAL_END_CAP_NV"},
+        {36985ULL, "GL_PATH_JOIN_STYLE_NV"},
+        {36986ULL, "GL_PATH_MITER_LIMIT_NV"},
+        {36987ULL, "GL_PATH_DASH_CAPS_NV"},
+        {36988ULL, "GL_PATH_INITIAL_DASH_CAP_NV"},
+        {36989ULL, "GL_PATH_TERMINAL_DASH_CAP_NV"},
+        {36990ULL, "GL_PATH_DASH_OFFSET_NV"},
+        {36991ULL, "GL_PATH_CLIENT_LENGTH_NV"},
+        {36992ULL, "GL_PATH_FILL_MODE_NV"},
+        {36993ULL, "GL_PATH_FILL_MASK_NV"},
+        {36994ULL, "GL_PATH_FILL_COVER_MODE_NV"},
+        {36995ULL, "GL_PATH_STROKE_COVER_MODE_NV"},
+        {36996ULL, "GL_PATH_STROKE_MASK_NV"},
+        {0, nullptr},
+        {37044ULL, "GL_PATH_DASH_OFFSET_RESET_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37002ULL, "GL_PATH_OBJECT_BOUNDING_BOX_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37021ULL, "GL_PATH_COMMAND_COUNT_NV"},
+        {37022ULL, "GL_PATH_COORD_COUNT_NV"},
+        {37023ULL, "GL_PATH_DASH_ARRAY_COUNT_NV"},
+        {37024ULL, "GL_PATH_COMPUTED_LENGTH_NV"},
+        {37025ULL, "GL_PATH_FILL_BOUNDING_BOX_NV"},
+        {37026ULL, "GL_PATH_STROKE_BOUNDING_BOX_NV"},
+        {36981ULL, "GL_PATH_STROKE_WIDTH_NV"},
+        {36982ULL, "GL_PATH_END_CAPS_NV"},
+        {36983ULL, "GL_PATH_INITIAL_END_CAP_NV"},
+    };
+
+    inline constexpr Entry PathStringFormat[2] = {
+        {36976ULL, "GL_PATH_FORMAT_SVG_NV"},
+        {36977ULL, "GL_PATH_FORMAT_PS_NV"},
+    };
+
+    inline constexpr Entry PathTransformType[11] = {
+        {0ULL, "GL_NONE"},
+        {37016ULL, "GL_TRANSPOSE_AFFINE_3D_NV"},
+        {37006ULL, "GL_TRANSLATE_X_NV"},
+        {37007ULL, "GL_TRANSLATE_Y_NV"},
+        {37008ULL, "GL_TRANSLATE_2D_NV"},
+        {37009ULL, "GL_TRANSLATE_3D_NV"},
+        {37010ULL, "GL_AFFINE_2D_NV"},
+        {0, nullptr},
+        {37012ULL, "GL_AFFINE_3D_NV"},
+        {0, nullptr},
+        {37014ULL, "GL_TRANSPOSE_AFFINE_2D_NV"},
+    };
+
+    inline constexpr Entry PerformanceQueryCapsMaskINTEL[2] = {
+        {0ULL, "GL_PERFQUERY_SINGLE_CONTEXT_INTEL"},
+        {1ULL, "GL_PERFQUERY_GLOBAL_CONTEXT_INTEL"},
+    };
+
+    inline constexpr Entry PipelineParameterName[11] = {
+        {36487ULL, "GL_TESS_EVALUATION_SHADER"},
+        {36488ULL, "GL_TESS_CONTROL_SHADER"},
+        {36313ULL, "GL_GEOMETRY_SHADER"},
+        {35632ULL, "GL_FRAGMENT_SHADER"},
+        {35633ULL, "GL_VERTEX_SHADER"},
+        {0, nullptr},
+        {33369ULL, "GL_ACTIVE_PROGRAM"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35716ULL, "GL_INFO_LOG_LENGTH"},
+    };
+
+    inline constexpr Entry PixelCopyType[3] = {
+        {6144ULL, "GL_COLOR"},
+        {6145ULL, "GL_DEPTH"},
+        {6146ULL, "GL_STENCIL"},
+    };
+
+    inline constexpr Entry PixelDataRangeTargetNV[2] = {
+        {34936ULL, "GL_WRITE_PIXEL_DATA_RANGE_NV"},
+        {34937ULL, "GL_READ_PIXEL_DATA_RANGE_NV"},
+    };
+
+    inline constexpr Entry PixelFormat[100] = {
+        {6400ULL, "GL_COLOR_INDEX"},
+        {6401ULL, "GL_STENCIL_INDEX"},
+        {6402ULL, "GL_DEPTH_COMPONENT"},
+        {6403ULL, "GL_RED"},
+        {6404ULL, "GL_GREEN"},
+        {6405ULL, "GL_BLUE"},
+        {6406ULL, "GL_ALPHA"},
+        {6407ULL, "GL_RGB"},
+        {6408ULL, "GL_RGBA"},
+        {6409ULL, "GL_LUMINANCE"},
+        {6410ULL, "GL_LUMINANCE_ALPHA"},
+        {33211ULL, "GL_YCRCB_422_SGIX"},
+        {33212ULL, "GL_YCRCB_444_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33319ULL, "GL_RG"},
+        {33320ULL, "GL_RG_INTEGER"},
+        {0, nullptr},
+        {0, nullptr},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+        {0, nullptr},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34041ULL, "GL_DEPTH_STENCIL"},
+        {0, nullptr},
+        {0, nullptr},
+        {36244ULL, "GL_RED_INTEGER"},
+        {36245ULL, "GL_GREEN_INTEGER"},
+        {36246ULL, "GL_BLUE_INTEGER"},
+        {0, nullptr},
+        {36248ULL, "GL_RGB_INTEGER"},
+        {36249ULL, "GL_RGBA_INTEGER"},
+        {36250ULL, "GL_BGR_INTEGER"},
+        {36251ULL, "GL_BGRA_INTEGER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32768ULL, "GL_ABGR_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32780ULL, "GL_CMYK_EXT"},
+        {32781ULL, "GL_CMYKA_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32992ULL, "GL_BGR"},
+        {32993ULL, "GL_BGRA"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry PixelMap[10] = {
+        {3190ULL, "GL_PIXEL_MAP_R_TO_R"},
+        {3191ULL, "GL_PIXEL_MAP_G_TO_G"},
+        {3192ULL, "GL_PIXEL_MAP_B_TO_B"},
+        {3193ULL, "GL_PIXEL_MAP_A_TO_A"},
+        {3184ULL, "GL_PIXEL_MAP_I_TO_I"},
+        {3185ULL, "GL_PIXEL_MAP_S_TO_S"},
+        {3186ULL, "GL_PIXEL_MAP_I_TO_R"},
+        {3187ULL, "GL_PIXEL_MAP_I_TO_G"},
+        {3188ULL, "GL_PIXEL_MAP_I_TO_B"},
+        {3189ULL, "GL_PIXEL_MAP_I_TO_A"},
+    };
+
+    inline constexpr Entry PixelStoreParameter[61] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35204ULL, "GL_PACK_RESAMPLE_OML"},
+        {35205ULL, "GL_UNPACK_RESAMPLE_OML"},
+        {0, nullptr},
+        {33072ULL, "GL_PACK_SKIP_VOLUMES_SGIS"},
+        {33073ULL, "GL_PACK_IMAGE_DEPTH_SGIS"},
+        {33074ULL, "GL_UNPACK_SKIP_VOLUMES_SGIS"},
+        {33075ULL, "GL_UNPACK_IMAGE_DEPTH_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3312ULL, "GL_UNPACK_SWAP_BYTES"},
+        {3313ULL, "GL_UNPACK_LSB_FIRST"},
+        {3314ULL, "GL_UNPACK_ROW_LENGTH"},
+        {3315ULL, "GL_UNPACK_SKIP_ROWS"},
+        {3316ULL, "GL_UNPACK_SKIP_PIXELS"},
+        {3317ULL, "GL_UNPACK_ALIGNMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {33088ULL, "GL_PIXEL_TILE_WIDTH_SGIX"},
+        {33089ULL, "GL_PIXEL_TILE_HEIGHT_SGIX"},
+        {33090ULL, "GL_PIXEL_TILE_GRID_WIDTH_SGIX"},
+        {33091ULL, "GL_PIXEL_TILE_GRID_HEIGHT_SGIX"},
+        {33092ULL, "GL_PIXEL_TILE_GRID_DEPTH_SGIX"},
+        {33093ULL, "GL_PIXEL_TILE_CACHE_SIZE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {3328ULL, "GL_PACK_SWAP_BYTES"},
+        {3329ULL, "GL_PACK_LSB_FIRST"},
+        {3330ULL, "GL_PACK_ROW_LENGTH"},
+        {3331ULL, "GL_PACK_SKIP_ROWS"},
+        {3332ULL, "GL_PACK_SKIP_PIXELS"},
+        {3333ULL, "GL_PACK_ALIGNMENT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33838ULL, "GL_PACK_RESAMPLE_SGIX"},
+        {33839ULL, "GL_UNPACK_RESAMPLE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {34208ULL, "GL_PACK_SUBSAMPLE_RATE_SGIX"},
+        {34209ULL, "GL_UNPACK_SUBSAMPLE_RATE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32875ULL, "GL_PACK_SKIP_IMAGES"},
+        {32876ULL, "GL_PACK_IMAGE_HEIGHT"},
+        {32877ULL, "GL_UNPACK_SKIP_IMAGES"},
+        {32878ULL, "GL_UNPACK_IMAGE_HEIGHT"},
+    };
+
+    inline constexpr Entry PixelStoreResampleMode[5] = {
+        {33840ULL, "GL_RESAMPLE_DECIMATE_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {33843ULL, "GL_RESAMPLE_REPLICATE_SGIX"},
+        {33844ULL, "GL_RESAMPLE_ZERO_FILL_SGIX"},
+    };
+
+    inline constexpr Entry PixelStoreSubsampleRate[3] = {
+        {34212ULL, "GL_PIXEL_SUBSAMPLE_4242_SGIX"},
+        {34210ULL, "GL_PIXEL_SUBSAMPLE_4444_SGIX"},
+        {34211ULL, "GL_PIXEL_SUBSAMPLE_2424_SGIX"},
+    };
+
+    inline constexpr Entry PixelTexGenMode[15] = {
+        {0ULL, "GL_NONE"},
+        {0, nullptr},
+        {6407ULL, "GL_RGB"},
+        {6408ULL, "GL_RGBA"},
+        {6409ULL, "GL_LUMINANCE"},
+        {6410ULL, "GL_LUMINANCE_ALPHA"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33159ULL, "GL_PIXEL_TEX_GEN_ALPHA_REPLACE_SGIX"},
+        {33160ULL, "GL_PIXEL_TEX_GEN_ALPHA_NO_REPLACE_SGIX"},
+        {33161ULL, "GL_PIXEL_TEX_GEN_ALPHA_LS_SGIX"},
+        {33162ULL, "GL_PIXEL_TEX_GEN_ALPHA_MS_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry PixelTexGenModeSGIX[7] = {
+        {0, nullptr},
+        {0, nullptr},
+        {33161ULL, "GL_PIXEL_TEX_GEN_ALPHA_LS_SGIX"},
+        {33162ULL, "GL_PIXEL_TEX_GEN_ALPHA_MS_SGIX"},
+        {33156ULL, "GL_PIXEL_TEX_GEN_Q_CEILING_SGIX"},
+        {33157ULL, "GL_PIXEL_TEX_GEN_Q_ROUND_SGIX"},
+        {33158ULL, "GL_PIXEL_TEX_GEN_Q_FLOOR_SGIX"},
+    };
+
+    inline constexpr Entry PixelTexGenParameterNameSGIS[2] = {
+        {33620ULL, "GL_PIXEL_FRAGMENT_RGB_SOURCE_SGIS"},
+        {33621ULL, "GL_PIXEL_FRAGMENT_ALPHA_SOURCE_SGIS"},
+    };
+
+    inline constexpr Entry PixelTransferParameter[44] = {
+        {3344ULL, "GL_MAP_COLOR"},
+        {3345ULL, "GL_MAP_STENCIL"},
+        {3346ULL, "GL_INDEX_SHIFT"},
+        {3347ULL, "GL_INDEX_OFFSET"},
+        {3348ULL, "GL_RED_SCALE"},
+        {3349ULL, "GL_RED_BIAS"},
+        {0, nullptr},
+        {0, nullptr},
+        {3352ULL, "GL_GREEN_SCALE"},
+        {3353ULL, "GL_GREEN_BIAS"},
+        {3354ULL, "GL_BLUE_SCALE"},
+        {3355ULL, "GL_BLUE_BIAS"},
+        {3356ULL, "GL_ALPHA_SCALE"},
+        {3357ULL, "GL_ALPHA_BIAS"},
+        {3358ULL, "GL_DEPTH_SCALE"},
+        {3359ULL, "GL_DEPTH_BIAS"},
+        {32796ULL, "GL_POST_CONVOLUTION_RED_SCALE"},
+        {32797ULL, "GL_POST_CONVOLUTION_GREEN_SCALE"},
+        {32798ULL, "GL_POST_CONVOLUTION_BLUE_SCALE"},
+        {32799ULL, "GL_POST_CONVOLUTION_ALPHA_SCALE"},
+        {32800ULL, "GL_POST_CONVOLUTION_RED_BIAS"},
+        {32801ULL, "GL_POST_CONVOLUTION_GREEN_BIAS"},
+        {32802ULL, "GL_POST_CONVOLUTION_BLUE_BIAS"},
+        {32803ULL, "GL_POST_CONVOLUTION_ALPHA_BIAS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32948ULL, "GL_POST_COLOR_MATRIX_RED_SCALE"},
+        {32949ULL, "GL_POST_COLOR_MATRIX_GREEN_SCALE"},
+        {32950ULL, "GL_POST_COLOR_MATRIX_BLUE_SCALE"},
+        {32951ULL, "GL_POST_COLOR_MATRIX_ALPHA_SCALE"},
+        {32952ULL, "GL_POST_COLOR_MATRIX_RED_BIAS"},
+        {32953ULL, "GL_POST_COLOR_MATRIX_GREEN_BIAS"},
+        {32954ULL, "GL_POST_COLOR_MATRIX_BLUE_BIAS"},
+        {32955ULL, "GL_POST_COLOR_MATRIX_ALPHA_BIAS"},
+    };
+
+    inline constexpr Entry PixelTransformPNameEXT[3] = {
+        {33585ULL, "GL_PIXEL_MAG_FILTER_EXT"},
+        {33586ULL, "GL_PIXEL_MIN_FILTER_EXT"},
+        {33587ULL, "GL_PIXEL_CUBIC_WEIGHT_EXT"},
+    };
+
+    inline constexpr Entry PixelTransformTargetEXT[1] = {
+        {33584ULL, "GL_PIXEL_TRANSFORM_2D_EXT"},
+    };
+
+    inline constexpr Entry PixelType[33] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {5120ULL, "GL_BYTE"},
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5122ULL, "GL_SHORT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+        {5124ULL, "GL_INT"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5126ULL, "GL_FLOAT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32818ULL, "GL_UNSIGNED_BYTE_3_3_2"},
+        {32819ULL, "GL_UNSIGNED_SHORT_4_4_4_4"},
+        {32820ULL, "GL_UNSIGNED_SHORT_5_5_5_1"},
+        {32821ULL, "GL_UNSIGNED_INT_8_8_8_8"},
+        {32822ULL, "GL_UNSIGNED_INT_10_10_10_2"},
+        {0, nullptr},
+        {0, nullptr},
+        {6656ULL, "GL_BITMAP"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry PointParameterNameARB[3] = {
+        {33063ULL, "GL_POINT_SIZE_MAX_EXT"},
+        {33064ULL, "GL_POINT_FADE_THRESHOLD_SIZE"},
+        {33062ULL, "GL_POINT_SIZE_MIN_EXT"},
+    };
+
+    inline constexpr Entry PointParameterNameSGIS[4] = {
+        {33064ULL, "GL_POINT_FADE_THRESHOLD_SIZE"},
+        {33065ULL, "GL_DISTANCE_ATTENUATION_EXT"},
+        {33062ULL, "GL_POINT_SIZE_MIN"},
+        {33063ULL, "GL_POINT_SIZE_MAX"},
+    };
+
+    inline constexpr Entry PolygonMode[3] = {
+        {6912ULL, "GL_POINT"},
+        {6913ULL, "GL_LINE"},
+        {6914ULL, "GL_FILL"},
+    };
+
+    inline constexpr Entry PrecisionType[6] = {
+        {36336ULL, "GL_LOW_FLOAT"},
+        {36337ULL, "GL_MEDIUM_FLOAT"},
+        {36338ULL, "GL_HIGH_FLOAT"},
+        {36339ULL, "GL_LOW_INT"},
+        {36340ULL, "GL_MEDIUM_INT"},
+        {36341ULL, "GL_HIGH_INT"},
+    };
+
+    inline constexpr Entry PreserveModeATI[2] = {
+        {34658ULL, "GL_PRESERVE_ATI"},
+        {34659ULL, "GL_DISCARD_ATI"},
+    };
+
+    inline constexpr Entry PrimitiveType[15] = {
+        {0ULL, "GL_POINTS"},
+        {1ULL, "GL_LINES"},
+        {2ULL, "GL_LINE_LOOP"},
+        {3ULL, "GL_LINE_STRIP"},
+        {4ULL, "GL_TRIANGLES"},
+        {5ULL, "GL_TRIANGLE_STRIP"},
+        {6ULL, "GL_TRIANGLE_FAN"},
+        {7ULL, "GL_QUADS"},
+        {8ULL, "GL_QUAD_STRIP"},
+        {9ULL, "GL_POLYGON"},
+        {10ULL, "GL_LINES_ADJACENCY"},
+        {11ULL, "GL_LINE_STRIP_ADJACENCY"},
+        {12ULL, "GL_TRIANGLES_ADJACENCY"},
+        {13ULL, "GL_TRIANGLE_STRIP_ADJACENCY"},
+        {14ULL, "GL_PATCHES"},
+    };
+
+    inline constexpr Entry ProgramFormat[1] = {
+        {34933ULL, "GL_PROGRAM_FORMAT_ASCII_ARB"},
+    };
+
+    inline constexpr Entry ProgramInterface[25] = {
+        {0, nullptr},
+        {37601ULL, "GL_UNIFORM"},
+        {37602ULL, "GL_UNIFORM_BLOCK"},
+        {37603ULL, "GL_PROGRAM_INPUT"},
+        {37604ULL, "GL_PROGRAM_OUTPUT"},
+        {37605ULL, "GL_BUFFER_VARIABLE"},
+        {37606ULL, "GL_SHADER_STORAGE_BLOCK"},
+        {35982ULL, "GL_TRANSFORM_FEEDBACK_BUFFER"},
+        {37608ULL, "GL_VERTEX_SUBROUTINE"},
+        {37609ULL, "GL_TESS_CONTROL_SUBROUTINE"},
+        {37610ULL, "GL_TESS_EVALUATION_SUBROUTINE"},
+        {37611ULL, "GL_GEOMETRY_SUBROUTINE"},
+        {37612ULL, "GL_FRAGMENT_SUBROUTINE"},
+        {37613ULL, "GL_COMPUTE_SUBROUTINE"},
+        {37614ULL, "GL_VERTEX_SUBROUTINE_UNIFORM"},
+        {37615ULL, "GL_TESS_CONTROL_SUBROUTINE_UNIFORM"},
+        {37616ULL, "GL_TESS_EVALUATION_SUBROUTINE_UNIFORM"},
+        {37617ULL, "GL_GEOMETRY_SUBROUTINE_UNIFORM"},
+        {37618ULL, "GL_FRAGMENT_SUBROUTINE_UNIFORM"},
+        {37619ULL, "GL_COMPUTE_SUBROUTINE_UNIFORM"},
+        {37620ULL, "GL_TRANSFORM_FEEDBACK_VARYING"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry ProgramInterfacePName[4] = {
+        {37624ULL, "GL_MAX_NUM_COMPATIBLE_SUBROUTINES"},
+        {37621ULL, "GL_ACTIVE_RESOURCES"},
+        {37622ULL, "GL_MAX_NAME_LENGTH"},
+        {37623ULL, "GL_MAX_NUM_ACTIVE_VARIABLES"},
+    };
+
+    inline constexpr Entry ProgramParameterPName[2] = {
+        {33368ULL, "GL_PROGRAM_SEPARABLE"},
+        {33367ULL, "GL_PROGRAM_BINARY_RETRIEVABLE_HINT"},
+    };
+
+    inline constexpr Entry ProgramPropertyARB[58] = {
+        {0, nullptr},
+        {35381ULL, "GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH"},
+        {35382ULL, "GL_ACTIVE_UNIFORM_BLOCKS"},
+        {0, nullptr},
+        {35094ULL, "GL_GEOMETRY_VERTICES_OUT"},
+        {35095ULL, "GL_GEOMETRY_INPUT_TYPE"},
+        {35096ULL, "GL_GEOMETRY_OUTPUT_TYPE"},
+        {35967ULL, "GL_TRANSFORM_FEEDBACK_BUFFER_MODE"},
+        {0, nullptr},
+        {37593ULL, "GL_ACTIVE_ATOMIC_COUNTER_BUFFERS"},
+        {0, nullptr},
+        {35971ULL, "GL_TRANSFORM_FEEDBACK_VARYINGS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33383ULL, "GL_COMPUTE_WORK_GROUP_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35712ULL, "GL_DELETE_STATUS"},
+        {0, nullptr},
+        {35714ULL, "GL_LINK_STATUS"},
+        {35715ULL, "GL_VALIDATE_STATUS"},
+        {35716ULL, "GL_INFO_LOG_LENGTH"},
+        {35717ULL, "GL_ATTACHED_SHADERS"},
+        {35718ULL, "GL_ACTIVE_UNIFORMS"},
+        {35719ULL, "GL_ACTIVE_UNIFORM_MAX_LENGTH"},
+        {0, nullptr},
+        {35721ULL, "GL_ACTIVE_ATTRIBUTES"},
+        {35722ULL, "GL_ACTIVE_ATTRIBUTE_MAX_LENGTH"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35958ULL, "GL_TRANSFORM_FEEDBACK_VARYING_MAX_LENGTH"},
+        {34625ULL, "GL_PROGRAM_BINARY_LENGTH"},
+    };
+
+    inline constexpr Entry ProgramResourceProperty[49] = {
+        {37632ULL, "GL_IS_ROW_MAJOR"},
+        {37633ULL, "GL_ATOMIC_COUNTER_BUFFER_INDEX"},
+        {37634ULL, "GL_BUFFER_BINDING"},
+        {37635ULL, "GL_BUFFER_DATA_SIZE"},
+        {37636ULL, "GL_NUM_ACTIVE_VARIABLES"},
+        {37637ULL, "GL_ACTIVE_VARIABLES"},
+        {37638ULL, "GL_REFERENCED_BY_VERTEX_SHADER"},
+        {37639ULL, "GL_REFERENCED_BY_TESS_CONTROL_SHADER"},
+        {37640ULL, "GL_REFERENCED_BY_TESS_EVALUATION_SHADER"},
+        {37641ULL, "GL_REFERENCED_BY_GEOMETRY_SHADER"},
+        {37642ULL, "GL_REFERENCED_BY_FRAGMENT_SHADER"},
+        {37643ULL, "GL_REFERENCED_BY_COMPUTE_SHADER"},
+        {37644ULL, "GL_TOP_LEVEL_ARRAY_SIZE"},
+        {37645ULL, "GL_TOP_LEVEL_ARRAY_STRIDE"},
+        {37646ULL, "GL_LOCATION"},
+        {37647ULL, "GL_LOCATION_INDEX"},
+        {0, nullptr},
+        {0, nullptr},
+        {37601ULL, "GL_UNIFORM"},
+        {36426ULL, "GL_NUM_COMPATIBLE_SUBROUTINES"},
+        {36427ULL, "GL_COMPATIBLE_SUBROUTINES"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37607ULL, "GL_IS_PER_PATCH"},
+        {37706ULL, "GL_LOCATION_COMPONENT"},
+        {37707ULL, "GL_TRANSFORM_FEEDBACK_BUFFER_INDEX"},
+        {37708ULL, "GL_TRANSFORM_FEEDBACK_BUFFER_STRIDE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37625ULL, "GL_NAME_LENGTH"},
+        {37626ULL, "GL_TYPE"},
+        {37627ULL, "GL_ARRAY_SIZE"},
+        {37628ULL, "GL_OFFSET"},
+        {37629ULL, "GL_BLOCK_INDEX"},
+        {37630ULL, "GL_ARRAY_STRIDE"},
+        {37631ULL, "GL_MATRIX_STRIDE"},
+    };
+
+    inline constexpr Entry ProgramStagePName[6] = {
+        {0, nullptr},
+        {36325ULL, "GL_ACTIVE_SUBROUTINES"},
+        {36326ULL, "GL_ACTIVE_SUBROUTINE_UNIFORMS"},
+        {36423ULL, "GL_ACTIVE_SUBROUTINE_UNIFORM_LOCATIONS"},
+        {36424ULL, "GL_ACTIVE_SUBROUTINE_MAX_LENGTH"},
+        {36425ULL, "GL_ACTIVE_SUBROUTINE_UNIFORM_MAX_LENGTH"},
+    };
+
+    inline constexpr Entry ProgramStringProperty[1] = {
+        {34344ULL, "GL_PROGRAM_STRING_ARB"},
+    };
+
+    inline constexpr Entry ProgramTarget[18] = {
+        {0, nullptr},
+        {0, nullptr},
+        {35102ULL, "GL_TESS_CONTROL_PROGRAM_NV"},
+        {35103ULL, "GL_TESS_EVALUATION_PROGRAM_NV"},
+        {35878ULL, "GL_GEOMETRY_PROGRAM_NV"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34820ULL, "GL_FRAGMENT_PROGRAM_ARB"},
+        {0, nullptr},
+        {34336ULL, "GL_VERTEX_PROGRAM_ARB"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33280ULL, "GL_TEXT_FRAGMENT_SHADER_ATI"},
+        {37115ULL, "GL_COMPUTE_PROGRAM_NV"},
+    };
+
+    inline constexpr Entry QueryCounterTarget[1] = {
+        {36392ULL, "GL_TIMESTAMP"},
+    };
+
+    inline constexpr Entry QueryObjectParameterName[7] = {
+        {37268ULL, "GL_QUERY_RESULT_NO_WAIT"},
+        {0, nullptr},
+        {34918ULL, "GL_QUERY_RESULT"},
+        {34919ULL, "GL_QUERY_RESULT_AVAILABLE"},
+        {0, nullptr},
+        {33514ULL, "GL_QUERY_TARGET"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry QueryParameterName[2] = {
+        {34916ULL, "GL_QUERY_COUNTER_BITS"},
+        {34917ULL, "GL_CURRENT_QUERY"},
+    };
+
+    inline constexpr Entry QueryTarget[14] = {
+        {33516ULL, "GL_TRANSFORM_FEEDBACK_OVERFLOW"},
+        {0, nullptr},
+        {33518ULL, "GL_VERTICES_SUBMITTED"},
+        {33519ULL, "GL_PRIMITIVES_SUBMITTED"},
+        {33520ULL, "GL_VERTEX_SHADER_INVOCATIONS"},
+        {35887ULL, "GL_ANY_SAMPLES_PASSED"},
+        {0, nullptr},
+        {35007ULL, "GL_TIME_ELAPSED"},
+        {35092ULL, "GL_SAMPLES_PASSED"},
+        {35975ULL, "GL_PRIMITIVES_GENERATED"},
+        {35976ULL, "GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN"},
+        {0, nullptr},
+        {36202ULL, "GL_ANY_SAMPLES_PASSED_CONSERVATIVE"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry ReadBufferMode[44] = {
+        {0ULL, "GL_NONE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {1024ULL, "GL_FRONT_LEFT"},
+        {1025ULL, "GL_FRONT_RIGHT"},
+        {1026ULL, "GL_BACK_LEFT"},
+        {1027ULL, "GL_BACK_RIGHT"},
+        {1028ULL, "GL_FRONT"},
+        {1029ULL, "GL_BACK"},
+        {1030ULL, "GL_LEFT"},
+        {1031ULL, "GL_RIGHT"},
+        {0, nullptr},
+        {1033ULL, "GL_AUX0"},
+        {1034ULL, "GL_AUX1"},
+        {1035ULL, "GL_AUX2"},
+        {1036ULL, "GL_AUX3"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36064ULL, "GL_COLOR_ATTACHMENT0"},
+        {36065ULL, "GL_COLOR_ATTACHMENT1"},
+        {36066ULL, "GL_COLOR_ATTACHMENT2"},
+        {36067ULL, "GL_COLOR_ATTACHMENT3"},
+        {36068ULL, "GL_COLOR_ATTACHMENT4"},
+        {36069ULL, "GL_COLOR_ATTACHMENT5"},
+        {36070ULL, "GL_COLOR_ATTACHMENT6"},
+        {36071ULL, "GL_COLOR_ATTACHMENT7"},
+        {36072ULL, "GL_COLOR_ATTACHMENT8"},
+        {36073ULL, "GL_COLOR_ATTACHMENT9"},
+        {36074ULL, "GL_COLOR_ATTACHMENT10"},
+        {36075ULL, "GL_COLOR_ATTACHMENT11"},
+        {36076ULL, "GL_COLOR_ATTACHMENT12"},
+        {36077ULL, "GL_COLOR_ATTACHMENT13"},
+        {36078ULL, "GL_COLOR_ATTACHMENT14"},
+        {36079ULL, "GL_COLOR_ATTACHMENT15"},
+    };
+
+    inline constexpr Entry RenderbufferParameterName[23] = {
+        {36179ULL, "GL_RENDERBUFFER_ALPHA_SIZE"},
+        {36180ULL, "GL_RENDERBUFFER_DEPTH_SIZE"},
+        {36181ULL, "GL_RENDERBUFFER_STENCIL_SIZE"},
+        {37171ULL, "GL_RENDERBUFFER_SAMPLES_IMG"},
+        {0, nullptr},
+        {36368ULL, "GL_RENDERBUFFER_COLOR_SAMPLES_NV"},
+        {36162ULL, "GL_RENDERBUFFER_WIDTH"},
+        {36163ULL, "GL_RENDERBUFFER_HEIGHT"},
+        {36164ULL, "GL_RENDERBUFFER_INTERNAL_FORMAT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37298ULL, "GL_RENDERBUFFER_STORAGE_SAMPLES_AMD"},
+        {36011ULL, "GL_RENDERBUFFER_SAMPLES"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36176ULL, "GL_RENDERBUFFER_RED_SIZE"},
+        {36177ULL, "GL_RENDERBUFFER_GREEN_SIZE"},
+        {36178ULL, "GL_RENDERBUFFER_BLUE_SIZE"},
+    };
+
+    inline constexpr Entry RenderbufferTarget[1] = {
+        {36161ULL, "GL_RENDERBUFFER"},
+    };
+
+    inline constexpr Entry RenderingMode[3] = {
+        {7170ULL, "GL_SELECT"},
+        {7168ULL, "GL_RENDER"},
+        {7169ULL, "GL_FEEDBACK"},
+    };
+
+    inline constexpr Entry ReplacementCodeTypeSUN[3] = {
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+    };
+
+    inline constexpr Entry SamplePatternEXT[7] = {
+        {32935ULL, "GL_4PASS_3_EXT"},
+        {32929ULL, "GL_1PASS_EXT"},
+        {32930ULL, "GL_2PASS_0_EXT"},
+        {32931ULL, "GL_2PASS_1_EXT"},
+        {32932ULL, "GL_4PASS_0_EXT"},
+        {32933ULL, "GL_4PASS_1_EXT"},
+        {32934ULL, "GL_4PASS_2_EXT"},
+    };
+
+    inline constexpr Entry SamplePatternSGIS[7] = {
+        {32935ULL, "GL_4PASS_3_EXT"},
+        {32929ULL, "GL_1PASS_EXT"},
+        {32930ULL, "GL_2PASS_0_EXT"},
+        {32931ULL, "GL_2PASS_1_EXT"},
+        {32932ULL, "GL_4PASS_0_EXT"},
+        {32933ULL, "GL_4PASS_1_EXT"},
+        {32934ULL, "GL_4PASS_2_EXT"},
+    };
+
+    inline constexpr Entry SamplerParameterF[10] = {
+        {4100ULL, "GL_TEXTURE_BORDER_COLOR"},
+        {0, nullptr},
+        {33082ULL, "GL_TEXTURE_MIN_LOD"},
+        {33083ULL, "GL_TEXTURE_MAX_LOD"},
+        {36714ULL, "GL_TEXTURE_UNNORMALIZED_COORDINATES_ARM"},
+        {0, nullptr},
+        {34046ULL, "GL_TEXTURE_MAX_ANISOTROPY"},
+        {0, nullptr},
+        {0, nullptr},
+        {34049ULL, "GL_TEXTURE_LOD_BIAS"},
+    };
+
+    inline constexpr Entry SamplerParameterI[13] = {
+        {34892ULL, "GL_TEXTURE_COMPARE_MODE"},
+        {34893ULL, "GL_TEXTURE_COMPARE_FUNC"},
+        {36714ULL, "GL_TEXTURE_UNNORMALIZED_COORDINATES_ARM"},
+        {0, nullptr},
+        {0, nullptr},
+        {32882ULL, "GL_TEXTURE_WRAP_R"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {10240ULL, "GL_TEXTURE_MAG_FILTER"},
+        {10241ULL, "GL_TEXTURE_MIN_FILTER"},
+        {10242ULL, "GL_TEXTURE_WRAP_S"},
+        {10243ULL, "GL_TEXTURE_WRAP_T"},
+    };
+
+    inline constexpr Entry ScalarType[3] = {
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+    };
+
+    inline constexpr Entry SecondaryColorPointerTypeIBM[5] = {
+        {5130ULL, "GL_DOUBLE"},
+        {5126ULL, "GL_FLOAT"},
+        {5122ULL, "GL_SHORT"},
+        {0, nullptr},
+        {5124ULL, "GL_INT"},
+    };
+
+    inline constexpr Entry SemaphoreParameterName[1] = {
+        {38293ULL, "GL_D3D12_FENCE_VALUE_EXT"},
+    };
+
+    inline constexpr Entry SeparableTargetEXT[1] = {
+        {32786ULL, "GL_SEPARABLE_2D"},
+    };
+
+    inline constexpr Entry ShaderParameterName[6] = {
+        {35712ULL, "GL_DELETE_STATUS"},
+        {35713ULL, "GL_COMPILE_STATUS"},
+        {35720ULL, "GL_SHADER_SOURCE_LENGTH"},
+        {0, nullptr},
+        {35716ULL, "GL_INFO_LOG_LENGTH"},
+        {35663ULL, "GL_SHADER_TYPE"},
+    };
+
+    inline constexpr Entry ShaderType[12] = {
+        {0, nullptr},
+        {36313ULL, "GL_GEOMETRY_SHADER"},
+        {0, nullptr},
+        {0, nullptr},
+        {35632ULL, "GL_FRAGMENT_SHADER"},
+        {35633ULL, "GL_VERTEX_SHADER"},
+        {0, nullptr},
+        {36487ULL, "GL_TESS_EVALUATION_SHADER"},
+        {36488ULL, "GL_TESS_CONTROL_SHADER"},
+        {37305ULL, "GL_COMPUTE_SHADER"},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry ShadingModel[2] = {
+        {7424ULL, "GL_FLAT"},
+        {7425ULL, "GL_SMOOTH"},
+    };
+
+    inline constexpr Entry ShadingRateQCOM[9] = {
+        {38574ULL, "GL_SHADING_RATE_4X4_PIXELS_QCOM"},
+        {38566ULL, "GL_SHADING_RATE_1X1_PIXELS_QCOM"},
+        {38567ULL, "GL_SHADING_RATE_1X2_PIXELS_QCOM"},
+        {38568ULL, "GL_SHADING_RATE_2X1_PIXELS_QCOM"},
+        {38569ULL, "GL_SHADING_RATE_2X2_PIXELS_QCOM"},
+        {38570ULL, "GL_SHADING_RATE_1X4_PIXELS_QCOM"},
+        {38571ULL, "GL_SHADING_RATE_4X1_PIXELS_QCOM"},
+        {38572ULL, "GL_SHADING_RATE_4X2_PIXELS_QCOM"},
+        {38573ULL, "GL_SHADING_RATE_2X4_PIXELS_QCOM"},
+    };
+
+    inline constexpr Entry SpriteParameterNameSGIX[1] = {
+        {33097ULL, "GL_SPRITE_MODE_SGIX"},
+    };
+
+    inline constexpr Entry StencilFaceDirection[5] = {
+        {0, nullptr},
+        {0, nullptr},
+        {1032ULL, "GL_FRONT_AND_BACK"},
+        {1028ULL, "GL_FRONT"},
+        {1029ULL, "GL_BACK"},
+    };
+
+    inline constexpr Entry StencilFunction[8] = {
+        {512ULL, "GL_NEVER"},
+        {513ULL, "GL_LESS"},
+        {514ULL, "GL_EQUAL"},
+        {515ULL, "GL_LEQUAL"},
+        {516ULL, "GL_GREATER"},
+        {517ULL, "GL_NOTEQUAL"},
+        {518ULL, "GL_GEQUAL"},
+        {519ULL, "GL_ALWAYS"},
+    };
+
+    inline constexpr Entry StencilOp[26] = {
+        {0ULL, "GL_ZERO"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {5386ULL, "GL_INVERT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {7680ULL, "GL_KEEP"},
+        {7681ULL, "GL_REPLACE"},
+        {7682ULL, "GL_INCR"},
+        {7683ULL, "GL_DECR"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34055ULL, "GL_INCR_WRAP"},
+        {34056ULL, "GL_DECR_WRAP"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry StringName[7] = {
+        {7938ULL, "GL_VERSION"},
+        {7939ULL, "GL_EXTENSIONS"},
+        {0, nullptr},
+        {35724ULL, "GL_SHADING_LANGUAGE_VERSION"},
+        {0, nullptr},
+        {7936ULL, "GL_VENDOR"},
+        {7937ULL, "GL_RENDERER"},
+    };
+
+    inline constexpr Entry SubgroupSupportedFeatures[11] = {
+        {0, nullptr},
+        {1ULL, "GL_SUBGROUP_FEATURE_BASIC_BIT_KHR"},
+        {2ULL, "GL_SUBGROUP_FEATURE_VOTE_BIT_KHR"},
+        {256ULL, "GL_SUBGROUP_FEATURE_PARTITIONED_BIT_NV"},
+        {4ULL, "GL_SUBGROUP_FEATURE_ARITHMETIC_BIT_KHR"},
+        {16ULL, "GL_SUBGROUP_FEATURE_SHUFFLE_BIT_KHR"},
+        {0, nullptr},
+        {128ULL, "GL_SUBGROUP_FEATURE_QUAD_BIT_KHR"},
+        {8ULL, "GL_SUBGROUP_FEATURE_BALLOT_BIT_KHR"},
+        {64ULL, "GL_SUBGROUP_FEATURE_CLUSTERED_BIT_KHR"},
+        {32ULL, "GL_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT_KHR"},
+    };
+
+    inline constexpr Entry SubroutineParameterName[4] = {
+        {35384ULL, "GL_UNIFORM_SIZE"},
+        {35385ULL, "GL_UNIFORM_NAME_LENGTH"},
+        {36426ULL, "GL_NUM_COMPATIBLE_SUBROUTINES"},
+        {36427ULL, "GL_COMPATIBLE_SUBROUTINES"},
+    };
+
+    inline constexpr Entry SwizzleOpATI[4] = {
+        {35192ULL, "GL_SWIZZLE_STR_DR_ATI"},
+        {35193ULL, "GL_SWIZZLE_STQ_DQ_ATI"},
+        {35190ULL, "GL_SWIZZLE_STR_ATI"},
+        {35191ULL, "GL_SWIZZLE_STQ_ATI"},
+    };
+
+    inline constexpr Entry SyncCondition[1] = {
+        {37143ULL, "GL_SYNC_GPU_COMMANDS_COMPLETE"},
+    };
+
+    inline constexpr Entry SyncObjectMask[1] = {
+        {1ULL, "GL_SYNC_FLUSH_COMMANDS_BIT"},
+    };
+
+    inline constexpr Entry SyncParameterName[4] = {
+        {37140ULL, "GL_SYNC_STATUS"},
+        {37141ULL, "GL_SYNC_FLAGS"},
+        {37138ULL, "GL_OBJECT_TYPE"},
+        {37139ULL, "GL_SYNC_CONDITION"},
+    };
+
+    inline constexpr Entry SyncStatus[4] = {
+        {37148ULL, "GL_CONDITION_SATISFIED"},
+        {37149ULL, "GL_WAIT_FAILED"},
+        {37146ULL, "GL_ALREADY_SIGNALED"},
+        {37147ULL, "GL_TIMEOUT_EXPIRED"},
+    };
+
+    inline constexpr Entry TangentPointerTypeEXT[7] = {
+        {5124ULL, "GL_INT"},
+        {0, nullptr},
+        {5126ULL, "GL_FLOAT"},
+        {5120ULL, "GL_BYTE"},
+        {0, nullptr},
+        {5122ULL, "GL_SHORT"},
+        {5130ULL, "GL_DOUBLE"},
+    };
+
+    inline constexpr Entry TexBumpParameterATI[1] = {
+        {34677ULL, "GL_BUMP_ROT_MATRIX_ATI"},
+    };
+
+    inline constexpr Entry TexCoordPointerType[5] = {
+        {5130ULL, "GL_DOUBLE"},
+        {5126ULL, "GL_FLOAT"},
+        {5122ULL, "GL_SHORT"},
+        {0, nullptr},
+        {5124ULL, "GL_INT"},
+    };
+
+    inline constexpr Entry TextureCompareMode[3] = {
+        {0ULL, "GL_NONE"},
+        {34894ULL, "GL_COMPARE_R_TO_TEXTURE"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry TextureCoordName[4] = {
+        {8192ULL, "GL_S"},
+        {8193ULL, "GL_T"},
+        {8194ULL, "GL_R"},
+        {8195ULL, "GL_Q"},
+    };
+
+    inline constexpr Entry TextureEnvMode[11] = {
+        {8448ULL, "GL_MODULATE"},
+        {8449ULL, "GL_DECAL"},
+        {32958ULL, "GL_TEXTURE_ENV_BIAS_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3042ULL, "GL_BLEND"},
+        {260ULL, "GL_ADD"},
+        {0, nullptr},
+        {32866ULL, "GL_REPLACE_EXT"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry TextureEnvParameter[2] = {
+        {8704ULL, "GL_TEXTURE_ENV_MODE"},
+        {8705ULL, "GL_TEXTURE_ENV_COLOR"},
+    };
+
+    inline constexpr Entry TextureEnvTarget[1] = {
+        {8960ULL, "GL_TEXTURE_ENV"},
+    };
+
+    inline constexpr Entry TextureFilterFuncSGIS[1] = {
+        {33094ULL, "GL_FILTER4_SGIS"},
+    };
+
+    inline constexpr Entry TextureFilterSGIS[1] = {
+        {33094ULL, "GL_FILTER4_SGIS"},
+    };
+
+    inline constexpr Entry TextureGenMode[7] = {
+        {33264ULL, "GL_EYE_DISTANCE_TO_POINT_SGIS"},
+        {33265ULL, "GL_OBJECT_DISTANCE_TO_POINT_SGIS"},
+        {33266ULL, "GL_EYE_DISTANCE_TO_LINE_SGIS"},
+        {33267ULL, "GL_OBJECT_DISTANCE_TO_LINE_SGIS"},
+        {9216ULL, "GL_EYE_LINEAR"},
+        {9217ULL, "GL_OBJECT_LINEAR"},
+        {9218ULL, "GL_SPHERE_MAP"},
+    };
+
+    inline constexpr Entry TextureGenParameter[7] = {
+        {33271ULL, "GL_OBJECT_LINE_SGIS"},
+        {9472ULL, "GL_TEXTURE_GEN_MODE"},
+        {9473ULL, "GL_OBJECT_PLANE"},
+        {9474ULL, "GL_EYE_PLANE"},
+        {33268ULL, "GL_EYE_POINT_SGIS"},
+        {33269ULL, "GL_OBJECT_POINT_SGIS"},
+        {33270ULL, "GL_EYE_LINE_SGIS"},
+    };
+
+    inline constexpr Entry TextureLayout[10] = {
+        {38290ULL, "GL_LAYOUT_TRANSFER_SRC_EXT"},
+        {38291ULL, "GL_LAYOUT_TRANSFER_DST_EXT"},
+        {38192ULL, "GL_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_EXT"},
+        {38193ULL, "GL_LAYOUT_DEPTH_ATTACHMENT_STENCIL_READ_ONLY_EXT"},
+        {0, nullptr},
+        {38285ULL, "GL_LAYOUT_GENERAL_EXT"},
+        {38286ULL, "GL_LAYOUT_COLOR_ATTACHMENT_EXT"},
+        {38287ULL, "GL_LAYOUT_DEPTH_STENCIL_ATTACHMENT_EXT"},
+        {38288ULL, "GL_LAYOUT_DEPTH_STENCIL_READ_ONLY_EXT"},
+        {38289ULL, "GL_LAYOUT_SHADER_READ_ONLY_EXT"},
+    };
+
+    inline constexpr Entry TextureMagFilter[37] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33156ULL, "GL_PIXEL_TEX_GEN_Q_CEILING_SGIX"},
+        {33157ULL, "GL_PIXEL_TEX_GEN_Q_ROUND_SGIX"},
+        {33158ULL, "GL_PIXEL_TEX_GEN_Q_FLOOR_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32941ULL, "GL_LINEAR_SHARPEN_SGIS"},
+        {32942ULL, "GL_LINEAR_SHARPEN_ALPHA_SGIS"},
+        {32943ULL, "GL_LINEAR_SHARPEN_COLOR_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {33094ULL, "GL_FILTER4_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32919ULL, "GL_LINEAR_DETAIL_SGIS"},
+        {32920ULL, "GL_LINEAR_DETAIL_ALPHA_SGIS"},
+        {32921ULL, "GL_LINEAR_DETAIL_COLOR_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {9728ULL, "GL_NEAREST"},
+        {9729ULL, "GL_LINEAR"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry TextureMinFilter[24] = {
+        {9984ULL, "GL_NEAREST_MIPMAP_NEAREST"},
+        {9985ULL, "GL_LINEAR_MIPMAP_NEAREST"},
+        {9986ULL, "GL_NEAREST_MIPMAP_LINEAR"},
+        {9987ULL, "GL_LINEAR_MIPMAP_LINEAR"},
+        {0, nullptr},
+        {33869ULL, "GL_NEAREST_CLIPMAP_NEAREST_SGIX"},
+        {33870ULL, "GL_NEAREST_CLIPMAP_LINEAR_SGIX"},
+        {33871ULL, "GL_LINEAR_CLIPMAP_NEAREST_SGIX"},
+        {9728ULL, "GL_NEAREST"},
+        {9729ULL, "GL_LINEAR"},
+        {0, nullptr},
+        {0, nullptr},
+        {33156ULL, "GL_PIXEL_TEX_GEN_Q_CEILING_SGIX"},
+        {33157ULL, "GL_PIXEL_TEX_GEN_Q_ROUND_SGIX"},
+        {33158ULL, "GL_PIXEL_TEX_GEN_Q_FLOOR_SGIX"},
+        {0, nullptr},
+        {33136ULL, "GL_LINEAR_CLIPMAP_LINEAR_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33094ULL, "GL_FILTER4_SGIS"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry TextureNormalModeEXT[1] = {
+        {34222ULL, "GL_PERTURB_EXT"},
+    };
+
+    inline constexpr Entry TextureParameterName[327] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {38272ULL, "GL_TEXTURE_TILING_EXT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33060ULL, "GL_DUAL_TEXTURE_SELECT_SGIS"},
+        {33061ULL, "GL_QUAD_TEXTURE_SELECT_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34049ULL, "GL_TEXTURE_LOD_BIAS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33078ULL, "GL_TEXTURE_4DSIZE_SGIS"},
+        {33079ULL, "GL_TEXTURE_WRAP_Q_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {33082ULL, "GL_TEXTURE_MIN_LOD"},
+        {33083ULL, "GL_TEXTURE_MAX_LOD"},
+        {33084ULL, "GL_TEXTURE_BASE_LEVEL"},
+        {33085ULL, "GL_TEXTURE_MAX_LEVEL"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33095ULL, "GL_TEXTURE_FILTER4_SIZE_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36714ULL, "GL_TEXTURE_UNNORMALIZED_COORDINATES_ARM"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {10240ULL, "GL_TEXTURE_MAG_FILTER"},
+        {10241ULL, "GL_TEXTURE_MIN_FILTER"},
+        {10242ULL, "GL_TEXTURE_WRAP_S"},
+        {10243ULL, "GL_TEXTURE_WRAP_T"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33137ULL, "GL_TEXTURE_CLIPMAP_CENTER_SGIX"},
+        {33138ULL, "GL_TEXTURE_CLIPMAP_FRAME_SGIX"},
+        {33139ULL, "GL_TEXTURE_CLIPMAP_OFFSET_SGIX"},
+        {33140ULL, "GL_TEXTURE_CLIPMAP_VIRTUAL_DEPTH_SGIX"},
+        {33141ULL, "GL_TEXTURE_CLIPMAP_LOD_OFFSET_SGIX"},
+        {33142ULL, "GL_TEXTURE_CLIPMAP_DEPTH_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {33145ULL, "GL_POST_TEXTURE_FILTER_BIAS_SGIX"},
+        {33146ULL, "GL_POST_TEXTURE_FILTER_SCALE_SGIX"},
+        {0, nullptr},
+        {36418ULL, "GL_TEXTURE_SWIZZLE_R"},
+        {36419ULL, "GL_TEXTURE_SWIZZLE_G"},
+        {36420ULL, "GL_TEXTURE_SWIZZLE_B"},
+        {36421ULL, "GL_TEXTURE_SWIZZLE_A"},
+        {36422ULL, "GL_TEXTURE_SWIZZLE_RGBA"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33166ULL, "GL_TEXTURE_LOD_BIAS_S_SGIX"},
+        {33167ULL, "GL_TEXTURE_LOD_BIAS_T_SGIX"},
+        {33168ULL, "GL_TEXTURE_LOD_BIAS_R_SGIX"},
+        {33169ULL, "GL_GENERATE_MIPMAP"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37098ULL, "GL_DEPTH_STENCIL_TEXTURE_MODE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33178ULL, "GL_TEXTURE_COMPARE_SGIX"},
+        {33179ULL, "GL_TEXTURE_COMPARE_OPERATOR_SGIX"},
+        {33180ULL, "GL_TEXTURE_LEQUAL_R_SGIX"},
+        {33181ULL, "GL_TEXTURE_GEQUAL_R_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32860ULL, "GL_TEXTURE_RED_SIZE"},
+        {32861ULL, "GL_TEXTURE_GREEN_SIZE"},
+        {32862ULL, "GL_TEXTURE_BLUE_SIZE"},
+        {32863ULL, "GL_TEXTURE_ALPHA_SIZE"},
+        {32864ULL, "GL_TEXTURE_LUMINANCE_SIZE"},
+        {32865ULL, "GL_TEXTURE_INTENSITY_SIZE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32870ULL, "GL_TEXTURE_PRIORITY"},
+        {32871ULL, "GL_TEXTURE_RESIDENT"},
+        {4096ULL, "GL_TEXTURE_WIDTH"},
+        {4097ULL, "GL_TEXTURE_HEIGHT"},
+        {0, nullptr},
+        {4099ULL, "GL_TEXTURE_COMPONENTS"},
+        {4100ULL, "GL_TEXTURE_BORDER_COLOR"},
+        {4101ULL, "GL_TEXTURE_BORDER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32881ULL, "GL_TEXTURE_DEPTH_EXT"},
+        {32882ULL, "GL_TEXTURE_WRAP_R"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32922ULL, "GL_DETAIL_TEXTURE_LEVEL_SGIS"},
+        {32923ULL, "GL_DETAIL_TEXTURE_MODE_SGIS"},
+        {32924ULL, "GL_DETAIL_TEXTURE_FUNC_POINTS_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34892ULL, "GL_TEXTURE_COMPARE_MODE"},
+        {34893ULL, "GL_TEXTURE_COMPARE_FUNC"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32944ULL, "GL_SHARPEN_TEXTURE_FUNC_POINTS_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32959ULL, "GL_SHADOW_AMBIENT_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33641ULL, "GL_TEXTURE_MAX_CLAMP_S_SGIX"},
+        {33642ULL, "GL_TEXTURE_MAX_CLAMP_T_SGIX"},
+        {33643ULL, "GL_TEXTURE_MAX_CLAMP_R_SGIX"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry TextureStorageMaskAMD[1] = {
+        {1ULL, "GL_TEXTURE_STORAGE_SPARSE_BIT_AMD"},
+    };
+
+    inline constexpr Entry TextureSwizzle[8] = {
+        {0ULL, "GL_ZERO"},
+        {1ULL, "GL_ONE"},
+        {0, nullptr},
+        {6403ULL, "GL_RED"},
+        {6404ULL, "GL_GREEN"},
+        {6405ULL, "GL_BLUE"},
+        {6406ULL, "GL_ALPHA"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry TextureTarget[88] = {
+        {0, nullptr},
+        {36873ULL, "GL_TEXTURE_CUBE_MAP_ARRAY"},
+        {0, nullptr},
+        {36875ULL, "GL_PROXY_TEXTURE_CUBE_MAP_ARRAY"},
+        {0, nullptr},
+        {32917ULL, "GL_DETAIL_TEXTURE_2D_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34067ULL, "GL_TEXTURE_CUBE_MAP"},
+        {0, nullptr},
+        {34069ULL, "GL_TEXTURE_CUBE_MAP_POSITIVE_X"},
+        {34070ULL, "GL_TEXTURE_CUBE_MAP_NEGATIVE_X"},
+        {34071ULL, "GL_TEXTURE_CUBE_MAP_POSITIVE_Y"},
+        {34072ULL, "GL_TEXTURE_CUBE_MAP_NEGATIVE_Y"},
+        {34073ULL, "GL_TEXTURE_CUBE_MAP_POSITIVE_Z"},
+        {34074ULL, "GL_TEXTURE_CUBE_MAP_NEGATIVE_Z"},
+        {34075ULL, "GL_PROXY_TEXTURE_CUBE_MAP"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {3552ULL, "GL_TEXTURE_1D"},
+        {3553ULL, "GL_TEXTURE_2D"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32867ULL, "GL_PROXY_TEXTURE_1D"},
+        {32868ULL, "GL_PROXY_TEXTURE_2D"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35864ULL, "GL_TEXTURE_1D_ARRAY"},
+        {35865ULL, "GL_PROXY_TEXTURE_1D_ARRAY"},
+        {35866ULL, "GL_TEXTURE_2D_ARRAY"},
+        {35867ULL, "GL_PROXY_TEXTURE_2D_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {32879ULL, "GL_TEXTURE_3D"},
+        {32880ULL, "GL_PROXY_TEXTURE_3D"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35882ULL, "GL_TEXTURE_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {34037ULL, "GL_TEXTURE_RECTANGLE"},
+        {0, nullptr},
+        {34039ULL, "GL_PROXY_TEXTURE_RECTANGLE"},
+        {37120ULL, "GL_TEXTURE_2D_MULTISAMPLE"},
+        {37121ULL, "GL_PROXY_TEXTURE_2D_MULTISAMPLE"},
+        {37122ULL, "GL_TEXTURE_2D_MULTISAMPLE_ARRAY"},
+        {37123ULL, "GL_PROXY_TEXTURE_2D_MULTISAMPLE_ARRAY"},
+        {33076ULL, "GL_TEXTURE_4D_SGIS"},
+        {33077ULL, "GL_PROXY_TEXTURE_4D_SGIS"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry TextureUnit[32] = {
+        {33984ULL, "GL_TEXTURE0"},
+        {33985ULL, "GL_TEXTURE1"},
+        {33986ULL, "GL_TEXTURE2"},
+        {33987ULL, "GL_TEXTURE3"},
+        {33988ULL, "GL_TEXTURE4"},
+        {33989ULL, "GL_TEXTURE5"},
+        {33990ULL, "GL_TEXTURE6"},
+        {33991ULL, "GL_TEXTURE7"},
+        {33992ULL, "GL_TEXTURE8"},
+        {33993ULL, "GL_TEXTURE9"},
+        {33994ULL, "GL_TEXTURE10"},
+        {33995ULL, "GL_TEXTURE11"},
+        {33996ULL, "GL_TEXTURE12"},
+        {33997ULL, "GL_TEXTURE13"},
+        {33998ULL, "GL_TEXTURE14"},
+        {33999ULL, "GL_TEXTURE15"},
+        {34000ULL, "GL_TEXTURE16"},
+        {34001ULL, "GL_TEXTURE17"},
+        {34002ULL, "GL_TEXTURE18"},
+        {34003ULL, "GL_TEXTURE19"},
+        {34004ULL, "GL_TEXTURE20"},
+        {34005ULL, "GL_TEXTURE21"},
+        {34006ULL, "GL_TEXTURE22"},
+        {34007ULL, "GL_TEXTURE23"},
+        {34008ULL, "GL_TEXTURE24"},
+        {34009ULL, "GL_TEXTURE25"},
+        {34010ULL, "GL_TEXTURE26"},
+        {34011ULL, "GL_TEXTURE27"},
+        {34012ULL, "GL_TEXTURE28"},
+        {34013ULL, "GL_TEXTURE29"},
+        {34014ULL, "GL_TEXTURE30"},
+        {34015ULL, "GL_TEXTURE31"},
+    };
+
+    inline constexpr Entry TextureWrapMode[13] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {9987ULL, "GL_LINEAR_MIPMAP_LINEAR"},
+        {33648ULL, "GL_MIRRORED_REPEAT"},
+        {10496ULL, "GL_CLAMP"},
+        {10497ULL, "GL_REPEAT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {33069ULL, "GL_CLAMP_TO_BORDER"},
+        {0, nullptr},
+        {33071ULL, "GL_CLAMP_TO_EDGE"},
+    };
+
+    inline constexpr Entry TraceMaskMESA[9] = {
+        {0, nullptr},
+        {1ULL, "GL_TRACE_OPERATIONS_BIT_MESA"},
+        {2ULL, "GL_TRACE_PRIMITIVES_BIT_MESA"},
+        {0, nullptr},
+        {4ULL, "GL_TRACE_ARRAYS_BIT_MESA"},
+        {32ULL, "GL_TRACE_ERRORS_BIT_MESA"},
+        {65535ULL, "GL_TRACE_ALL_BITS_MESA"},
+        {16ULL, "GL_TRACE_PIXELS_BIT_MESA"},
+        {8ULL, "GL_TRACE_TEXTURES_BIT_MESA"},
+    };
+
+    inline constexpr Entry TransformFeedbackBufferMode[2] = {
+        {35980ULL, "GL_INTERLEAVED_ATTRIBS"},
+        {35981ULL, "GL_SEPARATE_ATTRIBS"},
+    };
+
+    inline constexpr Entry TransformFeedbackPName[7] = {
+        {35973ULL, "GL_TRANSFORM_FEEDBACK_BUFFER_SIZE"},
+        {36387ULL, "GL_TRANSFORM_FEEDBACK_PAUSED"},
+        {36388ULL, "GL_TRANSFORM_FEEDBACK_ACTIVE"},
+        {35983ULL, "GL_TRANSFORM_FEEDBACK_BUFFER_BINDING"},
+        {0, nullptr},
+        {0, nullptr},
+        {35972ULL, "GL_TRANSFORM_FEEDBACK_BUFFER_START"},
+    };
+
+    inline constexpr Entry TransformFeedbackTokenNV[5] = {
+        {18446744073709551610ULL, "GL_SKIP_COMPONENTS1_NV"},
+        {18446744073709551611ULL, "GL_SKIP_COMPONENTS2_NV"},
+        {18446744073709551612ULL, "GL_SKIP_COMPONENTS3_NV"},
+        {18446744073709551613ULL, "GL_SKIP_COMPONENTS4_NV"},
+        {18446744073709551614ULL, "GL_NEXT_BUFFER_NV"},
+    };
+
+    inline constexpr Entry TriangleListSUN[3] = {
+        {3ULL, "GL_REPLACE_OLDEST_SUN"},
+        {1ULL, "GL_RESTART_SUN"},
+        {2ULL, "GL_REPLACE_MIDDLE_SUN"},
+    };
+
+    inline constexpr Entry UniformBlockPName[18] = {
+        {0, nullptr},
+        {0, nullptr},
+        {37100ULL, "GL_UNIFORM_BLOCK_REFERENCED_BY_COMPUTE_SHADER"},
+        {35391ULL, "GL_UNIFORM_BLOCK_BINDING"},
+        {35392ULL, "GL_UNIFORM_BLOCK_DATA_SIZE"},
+        {35393ULL, "GL_UNIFORM_BLOCK_NAME_LENGTH"},
+        {35394ULL, "GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS"},
+        {35395ULL, "GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES"},
+        {35396ULL, "GL_UNIFORM_BLOCK_REFERENCED_BY_VERTEX_SHADER"},
+        {35397ULL, "GL_UNIFORM_BLOCK_REFERENCED_BY_GEOMETRY_SHADER"},
+        {35398ULL, "GL_UNIFORM_BLOCK_REFERENCED_BY_FRAGMENT_SHADER"},
+        {0, nullptr},
+        {34032ULL, "GL_UNIFORM_BLOCK_REFERENCED_BY_TESS_CONTROL_SHADER"},
+        {34033ULL, "GL_UNIFORM_BLOCK_REFERENCED_BY_TESS_EVALUATION_SHADER"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry UniformPName[14] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37594ULL, "GL_UNIFORM_ATOMIC_COUNTER_BUFFER_INDEX"},
+        {35383ULL, "GL_UNIFORM_TYPE"},
+        {35384ULL, "GL_UNIFORM_SIZE"},
+        {35385ULL, "GL_UNIFORM_NAME_LENGTH"},
+        {35386ULL, "GL_UNIFORM_BLOCK_INDEX"},
+        {35387ULL, "GL_UNIFORM_OFFSET"},
+        {35388ULL, "GL_UNIFORM_ARRAY_STRIDE"},
+        {35389ULL, "GL_UNIFORM_MATRIX_STRIDE"},
+        {35390ULL, "GL_UNIFORM_IS_ROW_MAJOR"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry UniformType[217] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36678ULL, "GL_DOUBLE_MAT2"},
+        {36679ULL, "GL_DOUBLE_MAT3"},
+        {36680ULL, "GL_DOUBLE_MAT4"},
+        {36681ULL, "GL_DOUBLE_MAT2x3"},
+        {36682ULL, "GL_DOUBLE_MAT2x4"},
+        {36683ULL, "GL_DOUBLE_MAT3x2"},
+        {36684ULL, "GL_DOUBLE_MAT3x4"},
+        {36685ULL, "GL_DOUBLE_MAT4x2"},
+        {36686ULL, "GL_DOUBLE_MAT4x3"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {37128ULL, "GL_SAMPLER_2D_MULTISAMPLE"},
+        {37129ULL, "GL_INT_SAMPLER_2D_MULTISAMPLE"},
+        {37130ULL, "GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE"},
+        {37131ULL, "GL_SAMPLER_2D_MULTISAMPLE_ARRAY"},
+        {37132ULL, "GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY"},
+        {37133ULL, "GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36288ULL, "GL_SAMPLER_1D_ARRAY"},
+        {36289ULL, "GL_SAMPLER_2D_ARRAY"},
+        {36290ULL, "GL_SAMPLER_BUFFER"},
+        {36291ULL, "GL_SAMPLER_1D_ARRAY_SHADOW"},
+        {36292ULL, "GL_SAMPLER_2D_ARRAY_SHADOW"},
+        {36293ULL, "GL_SAMPLER_CUBE_SHADOW"},
+        {36294ULL, "GL_UNSIGNED_INT_VEC2"},
+        {36295ULL, "GL_UNSIGNED_INT_VEC3"},
+        {36296ULL, "GL_UNSIGNED_INT_VEC4"},
+        {36297ULL, "GL_INT_SAMPLER_1D"},
+        {36298ULL, "GL_INT_SAMPLER_2D"},
+        {36299ULL, "GL_INT_SAMPLER_3D"},
+        {36300ULL, "GL_INT_SAMPLER_CUBE"},
+        {36301ULL, "GL_INT_SAMPLER_2D_RECT"},
+        {36302ULL, "GL_INT_SAMPLER_1D_ARRAY"},
+        {36303ULL, "GL_INT_SAMPLER_2D_ARRAY"},
+        {36304ULL, "GL_INT_SAMPLER_BUFFER"},
+        {36305ULL, "GL_UNSIGNED_INT_SAMPLER_1D"},
+        {36306ULL, "GL_UNSIGNED_INT_SAMPLER_2D"},
+        {36307ULL, "GL_UNSIGNED_INT_SAMPLER_3D"},
+        {36308ULL, "GL_UNSIGNED_INT_SAMPLER_CUBE"},
+        {36309ULL, "GL_UNSIGNED_INT_SAMPLER_2D_RECT"},
+        {36310ULL, "GL_UNSIGNED_INT_SAMPLER_1D_ARRAY"},
+        {36311ULL, "GL_UNSIGNED_INT_SAMPLER_2D_ARRAY"},
+        {36312ULL, "GL_UNSIGNED_INT_SAMPLER_BUFFER"},
+        {0, nullptr},
+        {0, nullptr},
+        {35664ULL, "GL_FLOAT_VEC2"},
+        {35665ULL, "GL_FLOAT_VEC3"},
+        {35666ULL, "GL_FLOAT_VEC4"},
+        {35667ULL, "GL_INT_VEC2"},
+        {35668ULL, "GL_INT_VEC3"},
+        {35669ULL, "GL_INT_VEC4"},
+        {35670ULL, "GL_BOOL"},
+        {35671ULL, "GL_BOOL_VEC2"},
+        {35672ULL, "GL_BOOL_VEC3"},
+        {35673ULL, "GL_BOOL_VEC4"},
+        {35674ULL, "GL_FLOAT_MAT2"},
+        {35675ULL, "GL_FLOAT_MAT3"},
+        {35676ULL, "GL_FLOAT_MAT4"},
+        {35677ULL, "GL_SAMPLER_1D"},
+        {35678ULL, "GL_SAMPLER_2D"},
+        {35679ULL, "GL_SAMPLER_3D"},
+        {35680ULL, "GL_SAMPLER_CUBE"},
+        {35681ULL, "GL_SAMPLER_1D_SHADOW"},
+        {35682ULL, "GL_SAMPLER_2D_SHADOW"},
+        {35683ULL, "GL_SAMPLER_2D_RECT"},
+        {35684ULL, "GL_SAMPLER_2D_RECT_SHADOW"},
+        {35685ULL, "GL_FLOAT_MAT2x3"},
+        {35686ULL, "GL_FLOAT_MAT2x4"},
+        {35687ULL, "GL_FLOAT_MAT3x2"},
+        {35688ULL, "GL_FLOAT_MAT3x4"},
+        {35689ULL, "GL_FLOAT_MAT4x2"},
+        {35690ULL, "GL_FLOAT_MAT4x3"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {5124ULL, "GL_INT"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5126ULL, "GL_FLOAT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {5130ULL, "GL_DOUBLE"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36860ULL, "GL_DOUBLE_VEC2"},
+        {36861ULL, "GL_DOUBLE_VEC3"},
+        {36862ULL, "GL_DOUBLE_VEC4"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {36876ULL, "GL_SAMPLER_CUBE_MAP_ARRAY"},
+        {36877ULL, "GL_SAMPLER_CUBE_MAP_ARRAY_SHADOW"},
+        {36878ULL, "GL_INT_SAMPLER_CUBE_MAP_ARRAY"},
+        {36879ULL, "GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry UseProgramStageMask[11] = {
+        {0, nullptr},
+        {1ULL, "GL_VERTEX_SHADER_BIT"},
+        {2ULL, "GL_FRAGMENT_SHADER_BIT"},
+        {4294967295ULL, "GL_ALL_SHADER_BITS"},
+        {4ULL, "GL_GEOMETRY_SHADER_BIT"},
+        {16ULL, "GL_TESS_EVALUATION_SHADER_BIT"},
+        {0, nullptr},
+        {128ULL, "GL_TASK_SHADER_BIT_NV"},
+        {8ULL, "GL_TESS_CONTROL_SHADER_BIT"},
+        {64ULL, "GL_MESH_SHADER_BIT_NV"},
+        {32ULL, "GL_COMPUTE_SHADER_BIT"},
+    };
+
+    inline constexpr Entry VariantCapEXT[1] = {
+        {34792ULL, "GL_VARIANT_ARRAY_EXT"},
+    };
+
+    inline constexpr Entry VertexArrayPName[22] = {
+        {0, nullptr},
+        {35069ULL, "GL_VERTEX_ATTRIB_ARRAY_INTEGER"},
+        {35070ULL, "GL_VERTEX_ATTRIB_ARRAY_DIVISOR"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34922ULL, "GL_VERTEX_ATTRIB_ARRAY_NORMALIZED"},
+        {33493ULL, "GL_VERTEX_ATTRIB_RELATIVE_OFFSET"},
+        {34638ULL, "GL_VERTEX_ATTRIB_ARRAY_LONG"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34338ULL, "GL_VERTEX_ATTRIB_ARRAY_ENABLED"},
+        {34339ULL, "GL_VERTEX_ATTRIB_ARRAY_SIZE"},
+        {34340ULL, "GL_VERTEX_ATTRIB_ARRAY_STRIDE"},
+        {34341ULL, "GL_VERTEX_ATTRIB_ARRAY_TYPE"},
+    };
+
+    inline constexpr Entry VertexArrayPNameAPPLE[3] = {
+        {34239ULL, "GL_STORAGE_SHARED_APPLE"},
+        {34228ULL, "GL_STORAGE_CLIENT_APPLE"},
+        {34238ULL, "GL_STORAGE_CACHED_APPLE"},
+    };
+
+    inline constexpr Entry VertexAttribEnum[15] = {
+        {35070ULL, "GL_VERTEX_ATTRIB_ARRAY_DIVISOR"},
+        {0, nullptr},
+        {34922ULL, "GL_VERTEX_ATTRIB_ARRAY_NORMALIZED"},
+        {34338ULL, "GL_VERTEX_ATTRIB_ARRAY_ENABLED"},
+        {34339ULL, "GL_VERTEX_ATTRIB_ARRAY_SIZE"},
+        {34340ULL, "GL_VERTEX_ATTRIB_ARRAY_STRIDE"},
+        {34341ULL, "GL_VERTEX_ATTRIB_ARRAY_TYPE"},
+        {34342ULL, "GL_CURRENT_VERTEX_ATTRIB"},
+        {0, nullptr},
+        {0, nullptr},
+        {34975ULL, "GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35069ULL, "GL_VERTEX_ATTRIB_ARRAY_INTEGER"},
+    };
+
+    inline constexpr Entry VertexAttribEnumNV[1] = {
+        {34372ULL, "GL_PROGRAM_PARAMETER_NV"},
+    };
+
+    inline constexpr Entry VertexAttribIType[6] = {
+        {5124ULL, "GL_INT"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5120ULL, "GL_BYTE"},
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5122ULL, "GL_SHORT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+    };
+
+    inline constexpr Entry VertexAttribLType[1] = {
+        {5130ULL, "GL_DOUBLE"},
+    };
+
+    inline constexpr Entry VertexAttribPointerPropertyARB[1] = {
+        {34373ULL, "GL_VERTEX_ATTRIB_ARRAY_POINTER"},
+    };
+
+    inline constexpr Entry VertexAttribPointerType[18] = {
+        {5130ULL, "GL_DOUBLE"},
+        {5131ULL, "GL_HALF_FLOAT"},
+        {5132ULL, "GL_FIXED"},
+        {36255ULL, "GL_INT_2_10_10_10_REV"},
+        {5134ULL, "GL_INT64_NV"},
+        {5135ULL, "GL_UNSIGNED_INT64_NV"},
+        {0, nullptr},
+        {35899ULL, "GL_UNSIGNED_INT_10F_11F_11F_REV"},
+        {5120ULL, "GL_BYTE"},
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5122ULL, "GL_SHORT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+        {5124ULL, "GL_INT"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5126ULL, "GL_FLOAT"},
+        {0, nullptr},
+        {33640ULL, "GL_UNSIGNED_INT_2_10_10_10_REV"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry VertexAttribPropertyARB[31] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34975ULL, "GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING"},
+        {35069ULL, "GL_VERTEX_ATTRIB_ARRAY_INTEGER"},
+        {35070ULL, "GL_VERTEX_ATTRIB_ARRAY_DIVISOR"},
+        {0, nullptr},
+        {34638ULL, "GL_VERTEX_ATTRIB_ARRAY_LONG"},
+        {33492ULL, "GL_VERTEX_ATTRIB_BINDING"},
+        {33493ULL, "GL_VERTEX_ATTRIB_RELATIVE_OFFSET"},
+        {0, nullptr},
+        {0, nullptr},
+        {34922ULL, "GL_VERTEX_ATTRIB_ARRAY_NORMALIZED"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {34338ULL, "GL_VERTEX_ATTRIB_ARRAY_ENABLED"},
+        {34339ULL, "GL_VERTEX_ATTRIB_ARRAY_SIZE"},
+        {34340ULL, "GL_VERTEX_ATTRIB_ARRAY_STRIDE"},
+        {34341ULL, "GL_VERTEX_ATTRIB_ARRAY_TYPE"},
+        {34342ULL, "GL_CURRENT_VERTEX_ATTRIB"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry VertexAttribType[18] = {
+        {5130ULL, "GL_DOUBLE"},
+        {5131ULL, "GL_HALF_FLOAT"},
+        {5132ULL, "GL_FIXED"},
+        {36255ULL, "GL_INT_2_10_10_10_REV"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {35899ULL, "GL_UNSIGNED_INT_10F_11F_11F_REV"},
+        {5120ULL, "GL_BYTE"},
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5122ULL, "GL_SHORT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+        {5124ULL, "GL_INT"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+        {5126ULL, "GL_FLOAT"},
+        {0, nullptr},
+        {33640ULL, "GL_UNSIGNED_INT_2_10_10_10_REV"},
+        {0, nullptr},
+    };
+
+    inline constexpr Entry VertexBufferObjectParameter[13] = {
+        {0, nullptr},
+        {0, nullptr},
+        {34660ULL, "GL_BUFFER_SIZE"},
+        {34661ULL, "GL_BUFFER_USAGE"},
+        {0, nullptr},
+        {33311ULL, "GL_BUFFER_IMMUTABLE_STORAGE"},
+        {33312ULL, "GL_BUFFER_STORAGE_FLAGS"},
+        {35003ULL, "GL_BUFFER_ACCESS"},
+        {35004ULL, "GL_BUFFER_MAPPED"},
+        {0, nullptr},
+        {37151ULL, "GL_BUFFER_ACCESS_FLAGS"},
+        {37152ULL, "GL_BUFFER_MAP_LENGTH"},
+        {37153ULL, "GL_BUFFER_MAP_OFFSET"},
+    };
+
+    inline constexpr Entry VertexBufferObjectUsage[11] = {
+        {35046ULL, "GL_STATIC_COPY"},
+        {0, nullptr},
+        {35048ULL, "GL_DYNAMIC_DRAW"},
+        {35049ULL, "GL_DYNAMIC_READ"},
+        {35050ULL, "GL_DYNAMIC_COPY"},
+        {35040ULL, "GL_STREAM_DRAW"},
+        {35041ULL, "GL_STREAM_READ"},
+        {35042ULL, "GL_STREAM_COPY"},
+        {0, nullptr},
+        {35044ULL, "GL_STATIC_DRAW"},
+        {35045ULL, "GL_STATIC_READ"},
+    };
+
+    inline constexpr Entry VertexHintsMaskPGI[37] = {
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {67108864ULL, "GL_MAT_SPECULAR_BIT_PGI"},
+        {4ULL, "GL_VERTEX23_BIT_PGI"},
+        {8388608ULL, "GL_MAT_EMISSION_BIT_PGI"},
+        {134217728ULL, "GL_NORMAL_BIT_PGI"},
+        {0, nullptr},
+        {8ULL, "GL_VERTEX4_BIT_PGI"},
+        {65536ULL, "GL_COLOR3_BIT_PGI"},
+        {16777216ULL, "GL_MAT_COLOR_INDEXES_BIT_PGI"},
+        {1073741824ULL, "GL_TEXCOORD3_BIT_PGI"},
+        {268435456ULL, "GL_TEXCOORD1_BIT_PGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {131072ULL, "GL_COLOR4_BIT_PGI"},
+        {0, nullptr},
+        {33554432ULL, "GL_MAT_SHININESS_BIT_PGI"},
+        {4194304ULL, "GL_MAT_DIFFUSE_BIT_PGI"},
+        {2147483648ULL, "GL_TEXCOORD4_BIT_PGI"},
+        {0, nullptr},
+        {536870912ULL, "GL_TEXCOORD2_BIT_PGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {2097152ULL, "GL_MAT_AMBIENT_AND_DIFFUSE_BIT_PGI"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {1048576ULL, "GL_MAT_AMBIENT_BIT_PGI"},
+        {0, nullptr},
+        {524288ULL, "GL_INDEX_BIT_PGI"},
+        {262144ULL, "GL_EDGEFLAG_BIT_PGI"},
+    };
+
+    inline constexpr Entry VertexPointerType[5] = {
+        {5130ULL, "GL_DOUBLE"},
+        {5126ULL, "GL_FLOAT"},
+        {5122ULL, "GL_SHORT"},
+        {0, nullptr},
+        {5124ULL, "GL_INT"},
+    };
+
+    inline constexpr Entry VertexProvokingMode[2] = {
+        {36430ULL, "GL_LAST_VERTEX_CONVENTION"},
+        {36429ULL, "GL_FIRST_VERTEX_CONVENTION"},
+    };
+
+    inline constexpr Entry VertexShaderCoordOutEXT[11] = {
+        {34782ULL, "GL_ONE_EXT"},
+        {34783ULL, "GL_NEGATIVE_ONE_EXT"},
+        {34773ULL, "GL_X_EXT"},
+        {34774ULL, "GL_Y_EXT"},
+        {34775ULL, "GL_Z_EXT"},
+        {34776ULL, "GL_W_EXT"},
+        {34777ULL, "GL_NEGATIVE_X_EXT"},
+        {34778ULL, "GL_NEGATIVE_Y_EXT"},
+        {34779ULL, "GL_NEGATIVE_Z_EXT"},
+        {34780ULL, "GL_NEGATIVE_W_EXT"},
+        {34781ULL, "GL_ZERO_EXT"},
+    };
+
+    inline constexpr Entry VertexShaderOpEXT[24] = {
+        {34704ULL, "GL_OP_ROUND_EXT"},
+        {34705ULL, "GL_OP_EXP_BASE_2_EXT"},
+        {34706ULL, "GL_OP_LOG_BASE_2_EXT"},
+        {34707ULL, "GL_OP_POWER_EXT"},
+        {34708ULL, "GL_OP_RECIP_EXT"},
+        {34709ULL, "GL_OP_RECIP_SQRT_EXT"},
+        {34710ULL, "GL_OP_SUB_EXT"},
+        {34711ULL, "GL_OP_CROSS_PRODUCT_EXT"},
+        {34712ULL, "GL_OP_MULTIPLY_MATRIX_EXT"},
+        {34713ULL, "GL_OP_MOV_EXT"},
+        {34690ULL, "GL_OP_INDEX_EXT"},
+        {34691ULL, "GL_OP_NEGATE_EXT"},
+        {34692ULL, "GL_OP_DOT3_EXT"},
+        {34693ULL, "GL_OP_DOT4_EXT"},
+        {34694ULL, "GL_OP_MUL_EXT"},
+        {34695ULL, "GL_OP_ADD_EXT"},
+        {34696ULL, "GL_OP_MADD_EXT"},
+        {34697ULL, "GL_OP_FRAC_EXT"},
+        {34698ULL, "GL_OP_MAX_EXT"},
+        {34699ULL, "GL_OP_MIN_EXT"},
+        {34700ULL, "GL_OP_SET_GE_EXT"},
+        {34701ULL, "GL_OP_SET_LT_EXT"},
+        {34702ULL, "GL_OP_CLAMP_EXT"},
+        {34703ULL, "GL_OP_FLOOR_EXT"},
+    };
+
+    inline constexpr Entry VertexShaderParameterEXT[2] = {
+        {34786ULL, "GL_CURRENT_VERTEX_EXT"},
+        {34787ULL, "GL_MVP_MATRIX_EXT"},
+    };
+
+    inline constexpr Entry VertexShaderStorageTypeEXT[4] = {
+        {34756ULL, "GL_LOCAL_EXT"},
+        {34753ULL, "GL_VARIANT_EXT"},
+        {34754ULL, "GL_INVARIANT_EXT"},
+        {34755ULL, "GL_LOCAL_CONSTANT_EXT"},
+    };
+
+    inline constexpr Entry VertexShaderTextureUnitParameter[2] = {
+        {2984ULL, "GL_TEXTURE_MATRIX"},
+        {2819ULL, "GL_CURRENT_TEXTURE_COORDS"},
+    };
+
+    inline constexpr Entry VertexShaderWriteMaskEXT[2] = {
+        {0ULL, "GL_FALSE"},
+        {1ULL, "GL_TRUE"},
+    };
+
+    inline constexpr Entry VertexStreamATI[8] = {
+        {34672ULL, "GL_VERTEX_STREAM4_ATI"},
+        {34673ULL, "GL_VERTEX_STREAM5_ATI"},
+        {34674ULL, "GL_VERTEX_STREAM6_ATI"},
+        {34675ULL, "GL_VERTEX_STREAM7_ATI"},
+        {34668ULL, "GL_VERTEX_STREAM0_ATI"},
+        {34669ULL, "GL_VERTEX_STREAM1_ATI"},
+        {34670ULL, "GL_VERTEX_STREAM2_ATI"},
+        {34671ULL, "GL_VERTEX_STREAM3_ATI"},
+    };
+
+    inline constexpr Entry VertexWeightPointerTypeEXT[1] = {
+        {5126ULL, "GL_FLOAT"},
+    };
+
+    inline constexpr Entry WeightPointerTypeARB[11] = {
+        {5126ULL, "GL_FLOAT"},
+        {0, nullptr},
+        {0, nullptr},
+        {0, nullptr},
+        {5130ULL, "GL_DOUBLE"},
+        {5120ULL, "GL_BYTE"},
+        {5121ULL, "GL_UNSIGNED_BYTE"},
+        {5122ULL, "GL_SHORT"},
+        {5123ULL, "GL_UNSIGNED_SHORT"},
+        {5124ULL, "GL_INT"},
+        {5125ULL, "GL_UNSIGNED_INT"},
+    };
+}  // namespace names
+
+#ifdef GL_HPP
+    constexpr const char *to_string(Shader_Type x)
+    {
+        return names::name_of(names::ShaderType, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Draw_Mode x)
+    {
+        return names::name_of(names::PrimitiveType, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Buffer_Target x)
+    {
+        return names::name_of(names::BufferTargetARB, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Buffer_Usage x)
+    {
+        return names::name_of(names::BufferUsageARB, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Indexed_Buffer_Target x)
+    {
+        return names::name_of(names::BufferTargetARB, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Attribute_Type x)
+    {
+        return names::name_of(names::VertexAttribPointerType, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Attribute_IType x)
+    {
+        return names::name_of(names::VertexAttribIType, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(String_Name x)
+    {
+        return names::name_of(names::StringName, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Element_Index_Type x)
+    {
+        return names::name_of(names::DrawElementsType, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Capability x)
+    {
+        return names::name_of(names::EnableCap, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Transform_Feedback_Buffer_Mode x)
+    {
+        return names::name_of(names::TransformFeedbackBufferMode, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Transform_Feedback_Primitive_Mode x)
+    {
+        return names::name_of(names::PrimitiveType, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Query_Target x)
+    {
+        return names::name_of(names::QueryTarget, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Conditional_Render_Mode x)
+    {
+        return names::name_of(names::ConditionalRenderMode, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Wait_Result x)
+    {
+        return names::name_of(names::SyncStatus, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Debug_Source x)
+    {
+        return names::name_of(names::DebugSource, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Debug_Type x)
+    {
+        return names::name_of(names::DebugType, static_cast<GLenum>(x));
+    }
+
+    constexpr const char *to_string(Debug_Severity x)
+    {
+        return names::name_of(names::DebugSeverity, static_cast<GLenum>(x));
+    }
+
+#endif  // GL_HPP
+}  // namespace gl
+
+#endif  // GL_NAMES_HPP_
@@ -0,0 +1,1314 @@
+#ifndef GL_NULL_HPP
+#define GL_NULL_HPP
+
+// Null backend for gl.hpp. It implements every OpenGL entry point
+// that gl.hpp calls in memory, without any driver or context, so the
+// wrappers (and whatever is built on top of them) can be benchmarked
+// and tested deterministically on any machine.
+//
+// Include it instead of the OpenGL headers and loader, before gl.hpp:
+//
+//     #include "gl_null.hpp"
+//     #include "gl.hpp"
+//
+// and do not link with libGL. The state of the "context" is available
+// as gl_null::context: object names, bindings, buffer contents,
+// uniform values and the number of calls of every entry point.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// Only the types and the constants. The prototypes are not declared
+// without GL_GLEXT_PROTOTYPES, so we are free to define them below.
+#include <GL/glcorearb.h>
+
+// Compatibility profile constants gl.hpp refers to
+#ifndef GL_ACCUM_BUFFER_BIT
+#    define GL_ACCUM_BUFFER_BIT 0x00000200
+#endif
+
+#define GL_NULL_ENTRY_POINTS(X)                 \
+    X(glAttachShader)                           \
+    X(glBeginConditionalRender)                 \
+    X(glBeginQuery)                             \
+    X(glBeginTransformFeedback)                 \
+    X(glBindAttribLocation)                     \
+    X(glBindBuffer)                             \
+    X(glBindBufferBase)                         \
+    X(glBindTransformFeedback)                  \
+    X(glBindVertexArray)                        \
+    X(glBufferData)                             \
+    X(glClear)                                  \
+    X(glClearColor)                             \
+    X(glClientWaitSync)                         \
+    X(glColorMask)                              \
+    X(glCompileShader)                          \
+    X(glCreateProgram)                          \
+    X(glCreateShader)                           \
+    X(glDebugMessageCallback)                   \
+    X(glDebugMessageControl)                    \
+    X(glDebugMessageInsert)                     \
+    X(glDeleteBuffers)                          \
+    X(glDeleteProgram)                          \
+    X(glDeleteQueries)                          \
+    X(glDeleteShader)                           \
+    X(glDeleteSync)                             \
+    X(glDeleteTransformFeedbacks)               \
+    X(glDeleteVertexArrays)                     \
+    X(glDepthMask)                              \
+    X(glDisable)                                \
+    X(glDrawArrays)                             \
+    X(glDrawElements)                           \
+    X(glDrawElementsBaseVertex)                 \
+    X(glDrawTransformFeedback)                  \
+    X(glEnable)                                 \
+    X(glEnableVertexAttribArray)                \
+    X(glEndConditionalRender)                   \
+    X(glEndQuery)                               \
+    X(glEndTransformFeedback)                   \
+    X(glFenceSync)                              \
+    X(glGenBuffers)                             \
+    X(glGenQueries)                             \
+    X(glGenTransformFeedbacks)                  \
+    X(glGenVertexArrays)                        \
+    X(glGetAttribLocation)                      \
+    X(glGetError)                               \
+    X(glGetProgramInfoLog)                      \
+    X(glGetProgramiv)                           \
+    X(glGetQueryObjectui64v)                    \
+    X(glGetQueryObjectuiv)                      \
+    X(glGetShaderInfoLog)                       \
+    X(glGetShaderiv)                            \
+    X(glGetString)                              \
+    X(glGetSynciv)                              \
+    X(glGetUniformLocation)                     \
+    X(glLinkProgram)                            \
+    X(glPrimitiveRestartIndex)                  \
+    X(glShaderSource)                           \
+    X(glTransformFeedbackVaryings)              \
+    X(glUniform1f)                              \
+    X(glUniform1fv)                             \
+    X(glUniform1i)                              \
+    X(glUniform1iv)                             \
+    X(glUniform1ui)                             \
+    X(glUniform1uiv)                            \
+    X(glUniform2f)                              \
+    X(glUniform2fv)                             \
+    X(glUniform2i)                              \
+    X(glUniform2iv)                             \
+    X(glUniform3f)                              \
+    X(glUniform3fv)                             \
+    X(glUniform3i)                              \
+    X(glUniform3iv)                             \
+    X(glUniform4f)                              \
+    X(glUniform4fv)                             \
+    X(glUniform4i)                              \
+    X(glUniform4iv)                             \
+    X(glUniformMatrix2fv)                       \
+    X(glUniformMatrix3fv)                       \
+    X(glUniformMatrix4fv)                       \
+    X(glUseProgram)                             \
+    X(glVertexAttribIPointer)                   \
+    X(glVertexAttribPointer)                    \
+    X(glWaitSync)
+
+namespace gl_null
+{
+    enum class Call
+    {
+#define GL_NULL_CALL_ENUM(name) name,
+        GL_NULL_ENTRY_POINTS(GL_NULL_CALL_ENUM)
+#undef GL_NULL_CALL_ENUM
+        COUNT
+    };
+
+    const char *const call_names[] = {
+#define GL_NULL_CALL_NAME(name) #name,
+        GL_NULL_ENTRY_POINTS(GL_NULL_CALL_NAME)
+#undef GL_NULL_CALL_NAME
+    };
+
+    struct Shader_Object
+    {
+        GLenum type;
+        std::string source;
+        bool compiled;
+    };
+
+    struct Program_Object
+    {
+        std::vector<GLuint> shaders;
+        bool linked;
+        std::map<std::string, GLint> uniform_locations;
+        std::map<std::string, GLuint> attribute_locations;
+        // The raw bytes of the last value uploaded to every location
+        std::map<GLint, std::vector<unsigned char>> uniform_values;
+        std::vector<std::string> feedback_varyings;
+        GLenum feedback_buffer_mode;
+    };
+
+    struct Buffer_Object
+    {
+        std::vector<unsigned char> data;
+        GLenum usage;
+    };
+
+    struct Vertex_Attrib
+    {
+        bool enabled;
+        bool integer;
+        GLint size;
+        GLenum type;
+        GLboolean normalized;
+        GLsizei stride;
+        const void *pointer;
+        GLuint buffer;
+    };
+
+    struct Vertex_Array_Object
+    {
+        std::map<GLuint, Vertex_Attrib> attribs;
+    };
+
+    struct Query_Object
+    {
+        GLenum target;
+        bool active;
+        // Nothing is rasterized: the samples that "pass" are the
+        // vertices drawn between glBeginQuery and glEndQuery
+        size_t vertices_at_begin;
+        GLuint64 result;
+    };
+
+    struct Transform_Feedback_Object
+    {
+        // The buffers of the indexed binding points
+        std::map<GLuint, GLuint> buffers;
+        bool active;
+        GLenum primitive_mode;
+    };
+
+    // A glDebugMessageControl call, GL_DONT_CARE matches anything
+    struct Debug_Rule
+    {
+        GLenum source;
+        GLenum type;
+        GLenum severity;
+        // Empty for all ids
+        std::vector<GLuint> ids;
+        GLboolean enabled;
+    };
+
+    struct Context
+    {
+        size_t calls[static_cast<size_t>(Call::COUNT)];
+        GLenum error;
+
+        // Shaders and programs share the same name space in GL
+        GLuint next_shader_or_program_name;
+        GLuint next_buffer_name;
+        GLuint next_vertex_array_name;
+        GLuint next_transform_feedback_name;
+        GLuint next_query_name;
+        GLuint next_sync_name;
+
+        std::map<GLuint, Shader_Object> shaders;
+        std::map<GLuint, Program_Object> programs;
+        std::map<GLuint, Buffer_Object> buffers;
+        std::map<GLuint, Vertex_Array_Object> vertex_arrays;
+        std::map<GLuint, Transform_Feedback_Object> transform_feedbacks;
+        std::map<GLuint, Query_Object> queries;
+        // There is no GPU to wait for: every fence is signaled as soon
+        // as it is created
+        std::set<GLuint> syncs;
+
+        GLuint current_program;
+        GLuint current_vertex_array;
+        GLuint current_transform_feedback;
+        std::map<GLenum, GLuint> buffer_bindings;
+        GLfloat clear_color[4];
+        std::set<GLenum> enabled;
+        GLuint primitive_restart_index;
+        GLboolean color_mask[4] = {GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE};
+        GLboolean depth_mask = GL_TRUE;
+        // The query of every target between glBeginQuery and glEndQuery
+        std::map<GLenum, GLuint> active_queries;
+        // 0 outside of glBeginConditionalRender
+        GLuint conditional_render_query;
+        GLDEBUGPROC debug_callback;
+        const void *debug_user_param;
+        // In order, the last one that matches a message decides
+        std::vector<Debug_Rule> debug_rules;
+
+        size_t draw_calls;
+        size_t vertices_drawn;
+        // Draws skipped by conditional rendering, not in draw_calls
+        size_t draws_discarded;
+        size_t bytes_uploaded;
+        // Debug messages that passed the filters
+        size_t debug_messages;
+
+        size_t count(Call call) const
+        {
+            return calls[static_cast<size_t>(call)];
+        }
+
+        size_t total_calls() const
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < static_cast<size_t>(Call::COUNT); ++i) {
+                result += calls[i];
+            }
+            return result;
+        }
+
+        void record(Call call)
+        {
+            calls[static_cast<size_t>(call)] += 1;
+        }
+
+        void fail(GLenum code)
+        {
+            // Like in GL only the first error is kept until glGetError()
+            if (error == GL_NO_ERROR) {
+                error = code;
+            }
+        }
+
+        void reset()
+        {
+            *this = Context();
+            vertex_arrays[0] = {};
+            transform_feedbacks[0] = {};
+        }
+    };
+
+    inline Context context = [] {
+        Context result = {};
+        result.vertex_arrays[0] = {};
+        result.transform_feedbacks[0] = {};
+        return result;
+    }();
+
+    inline GLuint bound_buffer(GLenum target)
+    {
+        auto it = context.buffer_bindings.find(target);
+        return it == context.buffer_bindings.end() ? 0 : it->second;
+    }
+
+    inline Program_Object *current_program()
+    {
+        auto it = context.programs.find(context.current_program);
+        return it == context.programs.end() ? nullptr : &it->second;
+    }
+
+    inline void set_uniform(GLint location, const void *data, size_t size)
+    {
+        auto program = current_program();
+        if (!program) {
+            context.fail(GL_INVALID_OPERATION);
+            return;
+        }
+
+        // Location -1 is silently ignored by GL
+        if (location < 0) return;
+
+        auto bytes = static_cast<const unsigned char*>(data);
+        program->uniform_values[location].assign(bytes, bytes + size);
+    }
+
+    inline void set_uniform_array(GLint location, GLsizei count, const void *data, size_t element_size)
+    {
+        if (count < 0) {
+            context.fail(GL_INVALID_VALUE);
+            return;
+        }
+        set_uniform(location, data, element_size * static_cast<size_t>(count));
+    }
+
+    // GLsync is an opaque pointer, the null context hands out names
+    // cast to pointers
+    inline GLuint sync_name(GLsync sync)
+    {
+        return static_cast<GLuint>(reinterpret_cast<uintptr_t>(sync));
+    }
+
+    inline bool valid_sync(GLsync sync)
+    {
+        return context.syncs.count(sync_name(sync)) > 0;
+    }
+
+    // Like in a debug context: nothing without GL_DEBUG_OUTPUT, and the
+    // messages of low severity are disabled until a rule enables them
+    inline bool debug_message_enabled(GLenum source, GLenum type, GLuint id, GLenum severity)
+    {
+        if (context.enabled.count(GL_DEBUG_OUTPUT) == 0) return false;
+        bool enabled = severity != GL_DEBUG_SEVERITY_LOW;
+        for (const auto &rule : context.debug_rules) {
+            if (rule.source != GL_DONT_CARE && rule.source != source) continue;
+            if (rule.type != GL_DONT_CARE && rule.type != type) continue;
+            if (rule.severity != GL_DONT_CARE && rule.severity != severity) continue;
+            if (!rule.ids.empty() && std::find(rule.ids.begin(), rule.ids.end(), id) == rule.ids.end()) continue;
+            enabled = rule.enabled;
+        }
+        return enabled;
+    }
+
+    // Whether conditional rendering discards the draws, after which
+    // they are counted in draws_discarded instead of draw_calls
+    inline bool render_discarded()
+    {
+        if (context.conditional_render_query == 0) return false;
+        if (context.queries[context.conditional_render_query].result != 0) return false;
+        context.draws_discarded += 1;
+        return true;
+    }
+
+    inline void write_info_log(GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+    {
+        // Everything always compiles and links, so the log is empty
+        if (length) *length = 0;
+        if (infoLog && bufSize > 0) *infoLog = '\0';
+    }
+}
+
+inline void glAttachShader(GLuint program, GLuint shader)
+{
+    using namespace gl_null;
+    context.record(Call::glAttachShader);
+    auto it = context.programs.find(program);
+    if (it == context.programs.end() || context.shaders.count(shader) == 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    it->second.shaders.push_back(shader);
+}
+
+inline void glBeginConditionalRender(GLuint id, GLenum)
+{
+    using namespace gl_null;
+    context.record(Call::glBeginConditionalRender);
+    auto it = context.queries.find(id);
+    if (context.conditional_render_query != 0 || it == context.queries.end() || it->second.active) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+    context.conditional_render_query = id;
+}
+
+inline void glBeginQuery(GLenum target, GLuint id)
+{
+    using namespace gl_null;
+    context.record(Call::glBeginQuery);
+    auto it = context.queries.find(id);
+    if (it == context.queries.end() || it->second.active || context.active_queries.count(target)) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+    it->second = {target, true, context.vertices_drawn, 0};
+    context.active_queries[target] = id;
+}
+
+inline void glBeginTransformFeedback(GLenum primitiveMode)
+{
+    using namespace gl_null;
+    context.record(Call::glBeginTransformFeedback);
+    auto &feedback = context.transform_feedbacks[context.current_transform_feedback];
+    if (feedback.active || current_program() == nullptr) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+    feedback.active = true;
+    feedback.primitive_mode = primitiveMode;
+}
+
+inline void glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+    using namespace gl_null;
+    context.record(Call::glBindAttribLocation);
+    auto it = context.programs.find(program);
+    if (it == context.programs.end()) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    it->second.attribute_locations[name] = index;
+}
+
+inline void glBindBuffer(GLenum target, GLuint buffer)
+{
+    using namespace gl_null;
+    context.record(Call::glBindBuffer);
+    if (buffer != 0 && context.buffers.count(buffer) == 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    context.buffer_bindings[target] = buffer;
+}
+
+inline void glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    using namespace gl_null;
+    context.record(Call::glBindBufferBase);
+    if (buffer != 0 && context.buffers.count(buffer) == 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    // Binds the generic binding point too, like GL
+    context.buffer_bindings[target] = buffer;
+    if (target == GL_TRANSFORM_FEEDBACK_BUFFER) {
+        context.transform_feedbacks[context.current_transform_feedback].buffers[index] = buffer;
+    }
+}
+
+inline void glBindTransformFeedback(GLenum, GLuint id)
+{
+    using namespace gl_null;
+    context.record(Call::glBindTransformFeedback);
+    if (context.transform_feedbacks.count(id) == 0
+        || context.transform_feedbacks[context.current_transform_feedback].active) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+    context.current_transform_feedback = id;
+}
+
+inline void glBindVertexArray(GLuint array)
+{
+    using namespace gl_null;
+    context.record(Call::glBindVertexArray);
+    if (context.vertex_arrays.count(array) == 0) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+    context.current_vertex_array = array;
+}
+
+inline void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    using namespace gl_null;
+    context.record(Call::glBufferData);
+    if (size < 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+
+    auto it = context.buffers.find(bound_buffer(target));
+    if (it == context.buffers.end()) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+
+    auto &buffer = it->second;
+    buffer.usage = usage;
+    buffer.data.resize(static_cast<size_t>(size));
+    if (data) {
+        memcpy(buffer.data.data(), data, static_cast<size_t>(size));
+        context.bytes_uploaded += static_cast<size_t>(size);
+    }
+}
+
+inline void glClear(GLbitfield)
+{
+    using namespace gl_null;
+    context.record(Call::glClear);
+}
+
+inline void glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    using namespace gl_null;
+    context.record(Call::glClearColor);
+    context.clear_color[0] = red;
+    context.clear_color[1] = green;
+    context.clear_color[2] = blue;
+    context.clear_color[3] = alpha;
+}
+
+inline GLenum glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64)
+{
+    using namespace gl_null;
+    context.record(Call::glClientWaitSync);
+    if (!valid_sync(sync) || (flags & ~GL_SYNC_FLUSH_COMMANDS_BIT) != 0) {
+        context.fail(GL_INVALID_VALUE);
+        return GL_WAIT_FAILED;
+    }
+    return GL_ALREADY_SIGNALED;
+}
+
+inline void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    using namespace gl_null;
+    context.record(Call::glColorMask);
+    context.color_mask[0] = red;
+    context.color_mask[1] = green;
+    context.color_mask[2] = blue;
+    context.color_mask[3] = alpha;
+}
+
+inline void glCompileShader(GLuint shader)
+{
+    using namespace gl_null;
+    context.record(Call::glCompileShader);
+    auto it = context.shaders.find(shader);
+    if (it == context.shaders.end()) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    it->second.compiled = true;
+}
+
+inline GLuint glCreateProgram(void)
+{
+    using namespace gl_null;
+    context.record(Call::glCreateProgram);
+    GLuint name = ++context.next_shader_or_program_name;
+    context.programs[name] = {};
+    return name;
+}
+
+inline GLuint glCreateShader(GLenum type)
+{
+    using namespace gl_null;
+    context.record(Call::glCreateShader);
+    GLuint name = ++context.next_shader_or_program_name;
+    context.shaders[name] = {type, {}, false};
+    return name;
+}
+
+inline void glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam)
+{
+    using namespace gl_null;
+    context.record(Call::glDebugMessageCallback);
+    context.debug_callback = callback;
+    context.debug_user_param = userParam;
+}
+
+inline void glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids,
+                                  GLboolean enabled)
+{
+    using namespace gl_null;
+    context.record(Call::glDebugMessageControl);
+    if (count < 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    if (count > 0 && (source == GL_DONT_CARE || type == GL_DONT_CARE || severity != GL_DONT_CARE)) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+    context.debug_rules.push_back({source, type, severity, std::vector<GLuint>(ids, ids + count), enabled});
+}
+
+inline void glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+                                 const GLchar *buf)
+{
+    using namespace gl_null;
+    context.record(Call::glDebugMessageInsert);
+    if (source != GL_DEBUG_SOURCE_APPLICATION && source != GL_DEBUG_SOURCE_THIRD_PARTY) {
+        context.fail(GL_INVALID_ENUM);
+        return;
+    }
+    if (length < 0) length = static_cast<GLsizei>(strlen(buf));
+    if (!debug_message_enabled(source, type, id, severity)) return;
+    context.debug_messages += 1;
+    if (context.debug_callback) {
+        const std::string message(buf, static_cast<size_t>(length));
+        context.debug_callback(source, type, id, severity, length, message.c_str(), context.debug_user_param);
+    }
+}
+
+inline void glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+    using namespace gl_null;
+    context.record(Call::glDeleteBuffers);
+    if (n < 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    for (GLsizei i = 0; i < n; ++i) {
+        context.buffers.erase(buffers[i]);
+        for (auto &binding: context.buffer_bindings) {
+            if (binding.second == buffers[i]) binding.second = 0;
+        }
+    }
+}
+
+inline void glDeleteProgram(GLuint program)
+{
+    using namespace gl_null;
+    context.record(Call::glDeleteProgram);
+    context.programs.erase(program);
+    if (context.current_program == program) context.current_program = 0;
+}
+
+inline void glDeleteQueries(GLsizei n, const GLuint *ids)
+{
+    using namespace gl_null;
+    context.record(Call::glDeleteQueries);
+    for (GLsizei i = 0; i < n; ++i) {
+        auto it = context.queries.find(ids[i]);
+        if (it == context.queries.end()) continue;
+        if (it->second.active) context.active_queries.erase(it->second.target);
+        context.queries.erase(it);
+    }
+}
+
+inline void glDeleteSync(GLsync sync)
+{
+    using namespace gl_null;
+    context.record(Call::glDeleteSync);
+    // Deleting 0 is silently ignored
+    if (!sync) return;
+    if (!valid_sync(sync)) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    context.syncs.erase(sync_name(sync));
+}
+
+inline void glDeleteShader(GLuint shader)
+{
+    using namespace gl_null;
+    context.record(Call::glDeleteShader);
+    context.shaders.erase(shader);
+}
+
+inline void glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
+{
+    using namespace gl_null;
+    context.record(Call::glDeleteTransformFeedbacks);
+    for (GLsizei i = 0; i < n; ++i) {
+        if (ids[i] == 0) continue;
+        context.transform_feedbacks.erase(ids[i]);
+        if (context.current_transform_feedback == ids[i]) context.current_transform_feedback = 0;
+    }
+}
+
+inline void glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+    using namespace gl_null;
+    context.record(Call::glDeleteVertexArrays);
+    for (GLsizei i = 0; i < n; ++i) {
+        if (arrays[i] == 0) continue;
+        context.vertex_arrays.erase(arrays[i]);
+        if (context.current_vertex_array == arrays[i]) context.current_vertex_array = 0;
+    }
+}
+
+inline void glDepthMask(GLboolean flag)
+{
+    using namespace gl_null;
+    context.record(Call::glDepthMask);
+    context.depth_mask = flag;
+}
+
+inline void glDisable(GLenum cap)
+{
+    using namespace gl_null;
+    context.record(Call::glDisable);
+    context.enabled.erase(cap);
+}
+
+inline void glDrawArrays(GLenum, GLint, GLsizei count)
+{
+    using namespace gl_null;
+    context.record(Call::glDrawArrays);
+    if (count < 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    if (render_discarded()) return;
+    context.draw_calls += 1;
+    context.vertices_drawn += static_cast<size_t>(count);
+}
+
+inline void glDrawElements(GLenum, GLsizei count, GLenum, const void *)
+{
+    using namespace gl_null;
+    context.record(Call::glDrawElements);
+    if (count < 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    if (render_discarded()) return;
+    context.draw_calls += 1;
+    context.vertices_drawn += static_cast<size_t>(count);
+}
+
+inline void glDrawElementsBaseVertex(GLenum, GLsizei count, GLenum, const void *, GLint)
+{
+    using namespace gl_null;
+    context.record(Call::glDrawElementsBaseVertex);
+    if (count < 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    if (render_discarded()) return;
+    context.draw_calls += 1;
+    context.vertices_drawn += static_cast<size_t>(count);
+}
+
+inline void glDrawTransformFeedback(GLenum, GLuint id)
+{
+    using namespace gl_null;
+    context.record(Call::glDrawTransformFeedback);
+    if (context.transform_feedbacks.count(id) == 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    if (render_discarded()) return;
+    // Nothing is ever captured, so nothing is drawn either
+    context.draw_calls += 1;
+}
+
+inline void glEnable(GLenum cap)
+{
+    using namespace gl_null;
+    context.record(Call::glEnable);
+    context.enabled.insert(cap);
+}
+
+inline void glEnableVertexAttribArray(GLuint index)
+{
+    using namespace gl_null;
+    context.record(Call::glEnableVertexAttribArray);
+    context.vertex_arrays[context.current_vertex_array].attribs[index].enabled = true;
+}
+
+inline void glEndConditionalRender(void)
+{
+    using namespace gl_null;
+    context.record(Call::glEndConditionalRender);
+    if (context.conditional_render_query == 0) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+    context.conditional_render_query = 0;
+}
+
+inline void glEndQuery(GLenum target)
+{
+    using namespace gl_null;
+    context.record(Call::glEndQuery);
+    auto active = context.active_queries.find(target);
+    if (active == context.active_queries.end()) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+
+    Query_Object &query = context.queries[active->second];
+    const GLuint64 vertices = context.vertices_drawn - query.vertices_at_begin;
+    switch (target) {
+    case GL_ANY_SAMPLES_PASSED:
+    case GL_ANY_SAMPLES_PASSED_CONSERVATIVE:
+        query.result = vertices > 0 ? 1 : 0;
+        break;
+    case GL_TIME_ELAPSED:
+        query.result = 0;
+        break;
+    default:
+        query.result = vertices;
+    }
+    query.active = false;
+    context.active_queries.erase(active);
+}
+
+inline void glEndTransformFeedback(void)
+{
+    using namespace gl_null;
+    context.record(Call::glEndTransformFeedback);
+    auto &feedback = context.transform_feedbacks[context.current_transform_feedback];
+    if (!feedback.active) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+    feedback.active = false;
+}
+
+inline GLsync glFenceSync(GLenum condition, GLbitfield flags)
+{
+    using namespace gl_null;
+    context.record(Call::glFenceSync);
+    if (condition != GL_SYNC_GPU_COMMANDS_COMPLETE) {
+        context.fail(GL_INVALID_ENUM);
+        return nullptr;
+    }
+    if (flags != 0) {
+        context.fail(GL_INVALID_VALUE);
+        return nullptr;
+    }
+    GLuint name = ++context.next_sync_name;
+    context.syncs.insert(name);
+    return reinterpret_cast<GLsync>(static_cast<uintptr_t>(name));
+}
+
+inline void glGenBuffers(GLsizei n, GLuint *buffers)
+{
+    using namespace gl_null;
+    context.record(Call::glGenBuffers);
+    for (GLsizei i = 0; i < n; ++i) {
+        buffers[i] = ++context.next_buffer_name;
+        context.buffers[buffers[i]] = {};
+    }
+}
+
+inline void glGenQueries(GLsizei n, GLuint *ids)
+{
+    using namespace gl_null;
+    context.record(Call::glGenQueries);
+    for (GLsizei i = 0; i < n; ++i) {
+        ids[i] = ++context.next_query_name;
+        context.queries[ids[i]] = {};
+    }
+}
+
+inline void glGenTransformFeedbacks(GLsizei n, GLuint *ids)
+{
+    using namespace gl_null;
+    context.record(Call::glGenTransformFeedbacks);
+    for (GLsizei i = 0; i < n; ++i) {
+        ids[i] = ++context.next_transform_feedback_name;
+        context.transform_feedbacks[ids[i]] = {};
+    }
+}
+
+inline void glGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+    using namespace gl_null;
+    context.record(Call::glGenVertexArrays);
+    for (GLsizei i = 0; i < n; ++i) {
+        arrays[i] = ++context.next_vertex_array_name;
+        context.vertex_arrays[arrays[i]] = {};
+    }
+}
+
+inline GLint glGetAttribLocation(GLuint program, const GLchar *name)
+{
+    using namespace gl_null;
+    context.record(Call::glGetAttribLocation);
+    auto it = context.programs.find(program);
+    if (it == context.programs.end() || !it->second.linked) {
+        context.fail(GL_INVALID_OPERATION);
+        return -1;
+    }
+
+    auto &locations = it->second.attribute_locations;
+    auto location = locations.find(name);
+    if (location == locations.end()) {
+        location = locations.emplace(name, static_cast<GLuint>(locations.size())).first;
+    }
+    return static_cast<GLint>(location->second);
+}
+
+inline GLenum glGetError(void)
+{
+    using namespace gl_null;
+    context.record(Call::glGetError);
+    GLenum result = context.error;
+    context.error = GL_NO_ERROR;
+    return result;
+}
+
+inline void glGetProgramInfoLog(GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    using namespace gl_null;
+    context.record(Call::glGetProgramInfoLog);
+    write_info_log(bufSize, length, infoLog);
+}
+
+inline void glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    using namespace gl_null;
+    context.record(Call::glGetProgramiv);
+    auto it = context.programs.find(program);
+    if (it == context.programs.end()) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+
+    switch (pname) {
+    case GL_LINK_STATUS:           *params = it->second.linked; break;
+    case GL_ATTACHED_SHADERS:      *params = static_cast<GLint>(it->second.shaders.size()); break;
+    case GL_INFO_LOG_LENGTH:       *params = 0; break;
+    // Null links never run in the background
+    case GL_COMPLETION_STATUS_KHR: *params = GL_TRUE; break;
+    default:                       context.fail(GL_INVALID_ENUM);
+    }
+}
+
+// Every result is available as soon as the query ends
+inline void glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+{
+    using namespace gl_null;
+    context.record(Call::glGetQueryObjectui64v);
+    auto it = context.queries.find(id);
+    if (it == context.queries.end() || it->second.active) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+    *params = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : it->second.result;
+}
+
+inline void glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+    using namespace gl_null;
+    context.record(Call::glGetQueryObjectuiv);
+    auto it = context.queries.find(id);
+    if (it == context.queries.end() || it->second.active) {
+        context.fail(GL_INVALID_OPERATION);
+        return;
+    }
+    *params = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : static_cast<GLuint>(it->second.result);
+}
+
+inline void glGetShaderInfoLog(GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    using namespace gl_null;
+    context.record(Call::glGetShaderInfoLog);
+    write_info_log(bufSize, length, infoLog);
+}
+
+inline void glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    using namespace gl_null;
+    context.record(Call::glGetShaderiv);
+    auto it = context.shaders.find(shader);
+    if (it == context.shaders.end()) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+
+    switch (pname) {
+    case GL_COMPILE_STATUS:        *params = it->second.compiled; break;
+    case GL_SHADER_TYPE:           *params = static_cast<GLint>(it->second.type); break;
+    case GL_SHADER_SOURCE_LENGTH:  *params = static_cast<GLint>(it->second.source.size()); break;
+    case GL_INFO_LOG_LENGTH:       *params = 0; break;
+    // Null compiles never run in the background
+    case GL_COMPLETION_STATUS_KHR: *params = GL_TRUE; break;
+    default:                       context.fail(GL_INVALID_ENUM);
+    }
+}
+
+inline const GLubyte *glGetString(GLenum name)
+{
+    using namespace gl_null;
+    context.record(Call::glGetString);
+    switch (name) {
+    case GL_VENDOR:                   return reinterpret_cast<const GLubyte*>("gl.hpp");
+    case GL_RENDERER:                 return reinterpret_cast<const GLubyte*>("gl.hpp null backend");
+    case GL_VERSION:                  return reinterpret_cast<const GLubyte*>("3.3 (null)");
+    case GL_SHADING_LANGUAGE_VERSION: return reinterpret_cast<const GLubyte*>("3.30 (null)");
+    case GL_EXTENSIONS:               return reinterpret_cast<const GLubyte*>("");
+    default:
+        context.fail(GL_INVALID_ENUM);
+        return nullptr;
+    }
+}
+
+inline void glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
+{
+    using namespace gl_null;
+    context.record(Call::glGetSynciv);
+    if (!valid_sync(sync)) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    GLint value = 0;
+    switch (pname) {
+    case GL_OBJECT_TYPE: value = GL_SYNC_FENCE; break;
+    case GL_SYNC_STATUS: value = GL_SIGNALED; break;
+    case GL_SYNC_CONDITION: value = GL_SYNC_GPU_COMMANDS_COMPLETE; break;
+    case GL_SYNC_FLAGS: value = 0; break;
+    default:
+        context.fail(GL_INVALID_ENUM);
+        return;
+    }
+    if (count < 1) {
+        if (length) *length = 0;
+        return;
+    }
+    values[0] = value;
+    if (length) *length = 1;
+}
+
+inline GLint glGetUniformLocation(GLuint program, const GLchar *name)
+{
+    using namespace gl_null;
+    context.record(Call::glGetUniformLocation);
+    auto it = context.programs.find(program);
+    if (it == context.programs.end() || !it->second.linked) {
+        context.fail(GL_INVALID_OPERATION);
+        return -1;
+    }
+
+    auto &locations = it->second.uniform_locations;
+    auto location = locations.find(name);
+    if (location == locations.end()) {
+        location = locations.emplace(name, static_cast<GLint>(locations.size())).first;
+    }
+    return location->second;
+}
+
+inline void glLinkProgram(GLuint program)
+{
+    using namespace gl_null;
+    context.record(Call::glLinkProgram);
+    auto it = context.programs.find(program);
+    if (it == context.programs.end()) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    it->second.linked = true;
+}
+
+inline void glPrimitiveRestartIndex(GLuint index)
+{
+    using namespace gl_null;
+    context.record(Call::glPrimitiveRestartIndex);
+    context.primitive_restart_index = index;
+}
+
+inline void glShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length)
+{
+    using namespace gl_null;
+    context.record(Call::glShaderSource);
+    auto it = context.shaders.find(shader);
+    if (it == context.shaders.end() || count < 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+
+    auto &source = it->second.source;
+    source.clear();
+    for (GLsizei i = 0; i < count; ++i) {
+        if (length && length[i] >= 0) {
+            source.append(string[i], static_cast<size_t>(length[i]));
+        } else {
+            source.append(string[i]);
+        }
+    }
+}
+
+inline void glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const *varyings,
+                                        GLenum bufferMode)
+{
+    using namespace gl_null;
+    context.record(Call::glTransformFeedbackVaryings);
+    auto it = context.programs.find(program);
+    if (it == context.programs.end() || count < 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    it->second.feedback_varyings.assign(varyings, varyings + count);
+    it->second.feedback_buffer_mode = bufferMode;
+}
+
+inline void glUniform1f(GLint location, GLfloat v0)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform1f);
+    set_uniform(location, &v0, sizeof(v0));
+}
+
+inline void glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform2f);
+    const GLfloat value[] = {v0, v1};
+    set_uniform(location, value, sizeof(value));
+}
+
+inline void glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform3f);
+    const GLfloat value[] = {v0, v1, v2};
+    set_uniform(location, value, sizeof(value));
+}
+
+inline void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform4f);
+    const GLfloat value[] = {v0, v1, v2, v3};
+    set_uniform(location, value, sizeof(value));
+}
+
+inline void glUniform1i(GLint location, GLint v0)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform1i);
+    set_uniform(location, &v0, sizeof(v0));
+}
+
+inline void glUniform2i(GLint location, GLint v0, GLint v1)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform2i);
+    const GLint value[] = {v0, v1};
+    set_uniform(location, value, sizeof(value));
+}
+
+inline void glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform3i);
+    const GLint value[] = {v0, v1, v2};
+    set_uniform(location, value, sizeof(value));
+}
+
+inline void glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform4i);
+    const GLint value[] = {v0, v1, v2, v3};
+    set_uniform(location, value, sizeof(value));
+}
+
+inline void glUniform1ui(GLint location, GLuint v0)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform1ui);
+    set_uniform(location, &v0, sizeof(v0));
+}
+
+inline void glUniform1fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform1fv);
+    set_uniform_array(location, count, value, sizeof(*value));
+}
+
+inline void glUniform2fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform2fv);
+    set_uniform_array(location, count, value, sizeof(*value) * 2);
+}
+
+inline void glUniform3fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform3fv);
+    set_uniform_array(location, count, value, sizeof(*value) * 3);
+}
+
+inline void glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform4fv);
+    set_uniform_array(location, count, value, sizeof(*value) * 4);
+}
+
+inline void glUniform1iv(GLint location, GLsizei count, const GLint *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform1iv);
+    set_uniform_array(location, count, value, sizeof(*value));
+}
+
+inline void glUniform2iv(GLint location, GLsizei count, const GLint *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform2iv);
+    set_uniform_array(location, count, value, sizeof(*value) * 2);
+}
+
+inline void glUniform3iv(GLint location, GLsizei count, const GLint *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform3iv);
+    set_uniform_array(location, count, value, sizeof(*value) * 3);
+}
+
+inline void glUniform4iv(GLint location, GLsizei count, const GLint *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform4iv);
+    set_uniform_array(location, count, value, sizeof(*value) * 4);
+}
+
+inline void glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniform1uiv);
+    set_uniform_array(location, count, value, sizeof(*value));
+}
+
+inline void glUniformMatrix2fv(GLint location, GLsizei count, GLboolean, const GLfloat *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniformMatrix2fv);
+    // The matrices are stored as they come, gl.hpp never transposes them
+    set_uniform_array(location, count, value, sizeof(*value) * 4);
+}
+
+inline void glUniformMatrix3fv(GLint location, GLsizei count, GLboolean, const GLfloat *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniformMatrix3fv);
+    // The matrices are stored as they come, gl.hpp never transposes them
+    set_uniform_array(location, count, value, sizeof(*value) * 9);
+}
+
+inline void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean, const GLfloat *value)
+{
+    using namespace gl_null;
+    context.record(Call::glUniformMatrix4fv);
+    // The matrices are stored as they come, gl.hpp never transposes them
+    set_uniform_array(location, count, value, sizeof(*value) * 16);
+}
+
+inline void glUseProgram(GLuint program)
+{
+    using namespace gl_null;
+    context.record(Call::glUseProgram);
+    if (program != 0 && context.programs.count(program) == 0) {
+        context.fail(GL_INVALID_VALUE);
+        return;
+    }
+    context.current_program = program;
+}
+
+inline void glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+    using namespace gl_null;
+    context.record(Call::glVertexAttribIPointer);
+    auto &attrib = context.vertex_arrays[context.current_vertex_array].attribs[index];
+    attrib.integer = true;
+    attrib.size = size;
+    attrib.type = type;
+    attrib.normalized = GL_FALSE;
+    attrib.stride = stride;
+    attrib.pointer = pointer;
+    attrib.buffer = bound_buffer(GL_ARRAY_BUFFER);
+}
+
+inline void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    using namespace gl_null;
+    context.record(Call::glVertexAttribPointer);
+    auto &attrib = context.vertex_arrays[context.current_vertex_array].attribs[index];
+    attrib.integer = false;
+    attrib.size = size;
+    attrib.type = type;
+    attrib.normalized = normalized;
+    attrib.stride = stride;
+    attrib.pointer = pointer;
+    attrib.buffer = bound_buffer(GL_ARRAY_BUFFER);
+}
+
+inline void glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    using namespace gl_null;
+    context.record(Call::glWaitSync);
+    if (!valid_sync(sync) || flags != 0 || timeout != GL_TIMEOUT_IGNORED) {
+        context.fail(GL_INVALID_VALUE);
+    }
+}
+
+#endif  // GL_NULL_HPP
@@ -0,0 +1,150 @@
+#ifndef GL_OCCLUSION_HPP
+#define GL_OCCLUSION_HPP
+
+// Occlusion culling decided on the GPU. Every frame the bounds of every
+// object are drawn inside an occlusion query, with color and depth
+// writes off, and the next frame draws the object inside a conditional
+// render on that query: when no sample of the bounds passed, the GPU
+// skips the draw without the CPU ever waiting for the result.
+//
+//     gl_occlusion::Culler culler = gl_occlusion::create_culler(objects_count);
+//     while (running) {
+//         gl_occlusion::begin_frame(&culler);
+//         ... draw the big occluders ...
+//         for (size_t i = 0; i < objects_count; ++i) {
+//             gl_occlusion::draw(&culler, i, [&] { ... the object ... }, [&] { ... its bounds ... });
+//         }
+//     }
+//     printf("%zu of %zu draws culled\n", culler.stats.culled, culler.stats.conditional_draws);
+//     gl_occlusion::destroy(&culler);
+//
+// The stats read the results of the queries only when they are reused
+// LATENCY frames later, and only when they are available by then, so
+// they never stall the pipeline either.
+//
+// Include it after the GL headers and gl.hpp.
+
+#include <vector>
+
+namespace gl_occlusion
+{
+    // The draws of `body` happen only if some sample passed `query`,
+    // a SAMPLES_PASSED or ANY_SAMPLES_PASSED query that has ended
+    template <typename Body>
+    void conditional_render(gl::Query query, gl::Conditional_Render_Mode mode, Body body)
+    {
+        gl::beginConditionalRender(query, mode);
+        body();
+        gl::endConditionalRender();
+    }
+
+    // The number of queries per object: the query of frame N decides
+    // the draw of frame N + 1 and is read for the stats at frame
+    // N + LATENCY, when it is long done
+    const size_t LATENCY = 3;
+
+    struct Stats
+    {
+        // Draws inside a conditional render
+        size_t conditional_draws;
+        // The ones of them the GPU skipped
+        size_t culled;
+        // The ones whose query was still not available for the stats
+        size_t unknown;
+    };
+
+    struct Object
+    {
+        gl::Query queries[LATENCY];
+        // The frame the query was begun in, 0 for never. Only the
+        // result of the last frame decides a draw.
+        size_t tested_in[LATENCY];
+        // The result decided a draw, so it goes to the stats
+        bool decided[LATENCY];
+    };
+
+    struct Culler
+    {
+        gl::Query_Target target;
+        // QUERY_NO_WAIT draws anyway when the result is late, instead of
+        // waiting for it
+        gl::Conditional_Render_Mode mode;
+        std::vector<Object> objects;
+        size_t frame;
+        Stats stats;
+    };
+
+    inline Culler create_culler(size_t objects_count,
+                                gl::Query_Target target = gl::Query_Target::ANY_SAMPLES_PASSED,
+                                gl::Conditional_Render_Mode mode = gl::Conditional_Render_Mode::QUERY_NO_WAIT)
+    {
+        Culler culler = {};
+        culler.target = target;
+        culler.mode = mode;
+        culler.objects.resize(objects_count);
+        for (auto &object : culler.objects) {
+            for (auto &query : object.queries) query = gl::genQuery();
+        }
+        return culler;
+    }
+
+    inline void destroy(Culler *culler)
+    {
+        for (auto &object : culler->objects) {
+            for (auto query : object.queries) gl::deleteObject(query);
+        }
+        *culler = {};
+    }
+
+    inline void begin_frame(Culler *culler)
+    {
+        culler->frame += 1;
+    }
+
+    // Counts the draw the old result of the query decided before the
+    // query is begun again
+    inline void retire(Culler *culler, Object *object, size_t slot)
+    {
+        if (!object->decided[slot]) return;
+        object->decided[slot] = false;
+
+        if (!gl::queryResultAvailable(object->queries[slot])) {
+            culler->stats.unknown += 1;
+        } else if (gl::queryResult(object->queries[slot]) == 0) {
+            culler->stats.culled += 1;
+        }
+    }
+
+    // Draws the object with `draw_object` unless its bounds were hidden
+    // last frame, then tests them for the next frame with
+    // `draw_bounds`. Color and depth writes are back on after the test.
+    template <typename Draw_Object, typename Draw_Bounds>
+    void draw(Culler *culler, size_t index, Draw_Object draw_object, Draw_Bounds draw_bounds)
+    {
+        Object *object = &culler->objects[index];
+        const size_t previous = (culler->frame + LATENCY - 1) % LATENCY;
+        const size_t current = culler->frame % LATENCY;
+
+        // Not tested last frame, nothing to decide with
+        if (object->tested_in[previous] != 0 && object->tested_in[previous] + 1 == culler->frame) {
+            conditional_render(object->queries[previous], culler->mode, draw_object);
+            object->decided[previous] = true;
+            culler->stats.conditional_draws += 1;
+        } else {
+            draw_object();
+        }
+
+        retire(culler, object, current);
+
+        gl::colorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        gl::depthMask(GL_FALSE);
+        gl::beginQuery(culler->target, object->queries[current]);
+        draw_bounds();
+        gl::endQuery(culler->target);
+        gl::depthMask(GL_TRUE);
+        gl::colorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        object->tested_in[current] = culler->frame;
+    }
+}
+
+#endif  // GL_OCCLUSION_HPP
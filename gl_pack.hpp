@@ -0,0 +1,477 @@
+#ifndef GL_PACK_HPP
+#define GL_PACK_HPP
+
+// Compact vertex formats: converters from floats to half floats,
+// normals to INT_2_10_10_10_REV and positions to normalized shorts,
+// and a mesh packer that picks the smallest format of every attribute
+// that stays within its error tolerance:
+//
+//     const gl_pack::Attribute attributes[] = {
+//         {position_location, gl_pack::Semantic::POSITION, positions, 3, 1e-3f},
+//         {normal_location,   gl_pack::Semantic::NORMAL,   normals,   3, 1e-2f},
+//         {uv_location,       gl_pack::Semantic::GENERIC,  uvs,       2, 1e-3f},
+//     };
+//     gl_pack::Packed_Mesh mesh = gl_pack::pack(attributes, 3, vertex_count);
+//     gl::bufferData(gl::Buffer_Target::ARRAY, mesh.data.size(), mesh.data.data(), ...);
+//     gl_pack::setup_attributes(mesh);
+//
+// Every attribute gets its own tightly packed stream in the buffer.
+// Quantized positions have to be mapped back in the vertex shader
+// with Packed_Attribute::dequantize_offset and dequantize_scale, e.g.
+// folded into the model matrix.
+//
+// The converters use SSE2 (and F16C for the half floats when it is
+// enabled), with plain C++ for the rest and on other machines.
+//
+// Include it after the GL headers and gl.hpp.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__)
+#    include <emmintrin.h>
+#    if defined(__F16C__)
+#        include <immintrin.h>
+#    endif
+#endif
+
+namespace gl_pack
+{
+    // Round to nearest even, like the F16C instructions. After
+    // float_to_half_fast3_rtne by Fabian Giesen (public domain).
+    inline GLhalf half_from_float(GLfloat f)
+    {
+        const uint32_t f32_infinity = 255u << 23;
+        const uint32_t f16_max = (127u + 16u) << 23;
+        const uint32_t min_normal = (127u - 14u) << 23;
+        const uint32_t subnormal_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        uint32_t u = 0;
+        memcpy(&u, &f, sizeof(u));
+        const uint32_t sign = u & 0x80000000u;
+        u ^= sign;
+
+        uint32_t h = 0;
+        if (u >= f16_max) {
+            h = u > f32_infinity ? 0x7E00 : 0x7C00;
+        } else if (u < min_normal) {
+            // The addition does the rounding of the subnormal mantissa
+            float magic = 0.0f, x = 0.0f;
+            memcpy(&magic, &subnormal_magic, sizeof(magic));
+            memcpy(&x, &u, sizeof(x));
+            x += magic;
+            memcpy(&u, &x, sizeof(u));
+            h = u - subnormal_magic;
+        } else {
+            const uint32_t mantissa_odd = (u >> 13) & 1;
+            u += ((15u - 127u) << 23) + 0xFFF + mantissa_odd;
+            h = u >> 13;
+        }
+
+        return static_cast<GLhalf>(h | (sign >> 16));
+    }
+
+    inline GLfloat half_to_float(GLhalf h)
+    {
+        const uint32_t sign = (uint32_t) (h & 0x8000) << 16;
+        const uint32_t exponent = (h >> 10) & 0x1F;
+        const uint32_t mantissa = h & 0x3FF;
+
+        GLfloat f = 0.0f;
+        if (exponent == 0) {
+            f = std::ldexp((GLfloat) mantissa, -24);
+        } else if (exponent == 31) {
+            f = mantissa ? NAN : INFINITY;
+        } else {
+            f = std::ldexp((GLfloat) (mantissa | 0x400), (int) exponent - 25);
+        }
+
+        uint32_t u = 0;
+        memcpy(&u, &f, sizeof(u));
+        u |= sign;
+        memcpy(&f, &u, sizeof(f));
+        return f;
+    }
+
+    // Signed normalized integer of `bits` bits, the GL 4.2 mapping
+    // where -1.0, 0.0 and 1.0 are all exact
+    inline int32_t snorm_from_float(GLfloat f, int bits)
+    {
+        const GLfloat max = (GLfloat) ((1 << (bits - 1)) - 1);
+        return (int32_t) std::lrint(std::min(std::max(f, -1.0f), 1.0f) * max);
+    }
+
+    inline GLfloat snorm_to_float(int32_t x, int bits)
+    {
+        const GLfloat max = (GLfloat) ((1 << (bits - 1)) - 1);
+        return std::max((GLfloat) x / max, -1.0f);
+    }
+
+    // x, y, z as 10-bit signed normalized integers, w = 0
+    inline GLuint normal_from_floats(GLfloat x, GLfloat y, GLfloat z)
+    {
+        return ((GLuint) snorm_from_float(x, 10) & 0x3FF)
+            | (((GLuint) snorm_from_float(y, 10) & 0x3FF) << 10)
+            | (((GLuint) snorm_from_float(z, 10) & 0x3FF) << 20);
+    }
+
+    inline GLfloat normal_component(GLuint packed, int i)
+    {
+        // Sign extend the 10 bits
+        const int32_t x = (int32_t) (packed << (22 - 10 * i)) >> 22;
+        return snorm_to_float(x, 10);
+    }
+
+    // position = offset + scale * snorm16, per axis
+    struct Quantization
+    {
+        GLfloat offset[3];
+        GLfloat scale[3];
+    };
+
+    inline Quantization quantization_of(const GLfloat *xyz, size_t count)
+    {
+        Quantization q = {};
+        for (int axis = 0; axis < 3; ++axis) {
+            GLfloat lo = 0.0f, hi = 0.0f;
+            for (size_t i = 0; i < count; ++i) {
+                const GLfloat x = xyz[3 * i + axis];
+                lo = i == 0 ? x : std::min(lo, x);
+                hi = i == 0 ? x : std::max(hi, x);
+            }
+            q.offset[axis] = (lo + hi) * 0.5f;
+            q.scale[axis] = hi > lo ? (hi - lo) * 0.5f : 1.0f;
+        }
+        return q;
+    }
+
+#if defined(__SSE2__)
+    // 4 vertices of 3 floats into 4 x, 4 y and 4 z
+    inline void deinterleave3(const GLfloat *xyz, __m128 *x, __m128 *y, __m128 *z)
+    {
+        const __m128 a = _mm_loadu_ps(xyz + 0);     // x0 y0 z0 x1
+        const __m128 b = _mm_loadu_ps(xyz + 4);     // y1 z1 x2 y2
+        const __m128 c = _mm_loadu_ps(xyz + 8);     // z2 x3 y3 z3
+
+        *x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        *y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                            _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)),
+                            _MM_SHUFFLE(2, 0, 2, 0));
+        *z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+                            _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)),
+                            _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    inline __m128i snorm4(__m128 v, GLfloat max)
+    {
+        v = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+        // Rounds to nearest even with the default MXCSR, like lrint()
+        return _mm_cvtps_epi32(_mm_mul_ps(v, _mm_set1_ps(max)));
+    }
+
+#    if !defined(__F16C__)
+    // half_from_float() on 4 floats, sign extended to 32 bits so that
+    // _mm_packs_epi32 keeps them intact
+    inline __m128i halves4(__m128 f)
+    {
+        const __m128i f16_max = _mm_set1_epi32((127 + 16) << 23);
+        const __m128i min_normal = _mm_set1_epi32((127 - 14) << 23);
+        const __m128i subnormal_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+        const __m128i normal_bias = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+
+        const __m128 sign = _mm_and_ps(f, _mm_castsi128_ps(_mm_set1_epi32((int) 0x80000000u)));
+        const __m128 abs = _mm_xor_ps(f, sign);
+        const __m128i u = _mm_castps_si128(abs);
+
+        const __m128i is_nan = _mm_castps_si128(_mm_cmpunord_ps(abs, abs));
+        const __m128i is_regular = _mm_cmpgt_epi32(f16_max, u);
+        const __m128i is_subnormal = _mm_cmpgt_epi32(min_normal, u);
+        const __m128i special = _mm_or_si128(_mm_and_si128(is_nan, _mm_set1_epi32(0x200)),
+                                             _mm_set1_epi32(0x7C00));
+
+        const __m128i subnormal = _mm_sub_epi32(
+            _mm_castps_si128(_mm_add_ps(abs, _mm_castsi128_ps(subnormal_magic))), subnormal_magic);
+
+        const __m128i mantissa_odd = _mm_srai_epi32(_mm_slli_epi32(u, 31 - 13), 31);
+        const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(u, normal_bias), mantissa_odd), 13);
+
+        const __m128i finite = _mm_or_si128(_mm_and_si128(is_subnormal, subnormal),
+                                            _mm_andnot_si128(is_subnormal, normal));
+        const __m128i h = _mm_or_si128(_mm_and_si128(is_regular, finite),
+                                       _mm_andnot_si128(is_regular, special));
+        return _mm_or_si128(h, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+    }
+#    endif
+#endif
+
+    inline void halves_from_floats(const GLfloat *in, GLhalf *out, size_t count)
+    {
+        size_t i = 0;
+#if defined(__SSE2__) && defined(__F16C__)
+        for (; i + 4 <= count; i += 4) {
+            const __m128i h = _mm_cvtps_ph(_mm_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), h);
+        }
+#elif defined(__SSE2__)
+        for (; i + 8 <= count; i += 8) {
+            const __m128i h = _mm_packs_epi32(halves4(_mm_loadu_ps(in + i)),
+                                              halves4(_mm_loadu_ps(in + i + 4)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), h);
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = half_from_float(in[i]);
+        }
+    }
+
+    // `xyz` are 3 floats per normal, `out` one INT_2_10_10_10_REV each
+    inline void normals_from_floats(const GLfloat *xyz, GLuint *out, size_t count)
+    {
+        size_t i = 0;
+#if defined(__SSE2__)
+        const __m128i mask = _mm_set1_epi32(0x3FF);
+        for (; i + 4 <= count; i += 4) {
+            __m128 x, y, z;
+            deinterleave3(xyz + 3 * i, &x, &y, &z);
+            const __m128i packed = _mm_or_si128(
+                _mm_and_si128(snorm4(x, 511.0f), mask),
+                _mm_or_si128(_mm_slli_epi32(_mm_and_si128(snorm4(y, 511.0f), mask), 10),
+                             _mm_slli_epi32(_mm_and_si128(snorm4(z, 511.0f), mask), 20)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = normal_from_floats(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]);
+        }
+    }
+
+    // `xyz` are 3 floats per position, `out` 4 normalized shorts each
+    // with w = 1.0
+    inline void positions_from_floats(const GLfloat *xyz, GLshort *out, size_t count, const Quantization &q)
+    {
+        const GLfloat inv_scale[3] = {1.0f / q.scale[0], 1.0f / q.scale[1], 1.0f / q.scale[2]};
+
+        size_t i = 0;
+#if defined(__SSE2__)
+        const __m128 offset_x = _mm_set1_ps(q.offset[0]);
+        const __m128 offset_y = _mm_set1_ps(q.offset[1]);
+        const __m128 offset_z = _mm_set1_ps(q.offset[2]);
+        const __m128 inv_scale_x = _mm_set1_ps(inv_scale[0]);
+        const __m128 inv_scale_y = _mm_set1_ps(inv_scale[1]);
+        const __m128 inv_scale_z = _mm_set1_ps(inv_scale[2]);
+        const __m128i w = _mm_set1_epi32(32767);
+        for (; i + 4 <= count; i += 4) {
+            __m128 x, y, z;
+            deinterleave3(xyz + 3 * i, &x, &y, &z);
+            const __m128i sx = snorm4(_mm_mul_ps(_mm_sub_ps(x, offset_x), inv_scale_x), 32767.0f);
+            const __m128i sy = snorm4(_mm_mul_ps(_mm_sub_ps(y, offset_y), inv_scale_y), 32767.0f);
+            const __m128i sz = snorm4(_mm_mul_ps(_mm_sub_ps(z, offset_z), inv_scale_z), 32767.0f);
+
+            const __m128i xy = _mm_packs_epi32(sx, sy);     // x0 x1 x2 x3 y0 y1 y2 y3
+            const __m128i zw = _mm_packs_epi32(sz, w);      // z0 z1 z2 z3 w  w  w  w
+            const __m128i xz = _mm_unpacklo_epi16(xy, zw);  // x0 z0 x1 z1 x2 z2 x3 z3
+            const __m128i yw = _mm_unpackhi_epi16(xy, zw);  // y0 w  y1 w  y2 w  y3 w
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * i), _mm_unpacklo_epi16(xz, yw));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * i + 8), _mm_unpackhi_epi16(xz, yw));
+        }
+#endif
+        for (; i < count; ++i) {
+            for (int axis = 0; axis < 3; ++axis) {
+                out[4 * i + axis] = (GLshort) snorm_from_float((xyz[3 * i + axis] - q.offset[axis]) * inv_scale[axis], 16);
+            }
+            out[4 * i + 3] = 32767;
+        }
+    }
+
+    enum class Semantic
+    {
+        POSITION,   // 3 components, may be quantized
+        NORMAL,     // 3 components of unit length
+        GENERIC,
+    };
+
+    struct Attribute
+    {
+        gl::Attribute_Location location;
+        Semantic semantic;
+        const GLfloat *data;        // vertex_count * components floats
+        GLint components;           // 1 to 4
+        GLfloat tolerance;          // max absolute error of a component
+    };
+
+    struct Packed_Attribute
+    {
+        gl::Attribute_Location location;
+        gl::Attribute_Size size;
+        gl::Attribute_Type type;
+        GLboolean normalized;
+        GLsizei stride;
+        size_t offset;              // in Packed_Mesh::data
+        GLfloat max_error;
+
+        // attribute = dequantize_offset + dequantize_scale * stored,
+        // 0 and 1 unless the positions are quantized
+        gl::Vec3f dequantize_offset;
+        gl::Vec3f dequantize_scale;
+    };
+
+    struct Packed_Mesh
+    {
+        std::vector<unsigned char> data;
+        std::vector<Packed_Attribute> attributes;
+        size_t vertex_count;
+        size_t float_bytes;         // the size of the data as floats
+    };
+
+    inline size_t align4(size_t n)
+    {
+        return (n + 3) & ~(size_t) 3;
+    }
+
+    // Appends a stream of `stride` bytes per vertex to the mesh
+    inline unsigned char *push_stream(Packed_Mesh *mesh, const Attribute &attribute, gl::Attribute_Type type,
+                                      GLboolean normalized, GLsizei stride, GLint size)
+    {
+        Packed_Attribute packed = {};
+        packed.location = attribute.location;
+        packed.size = static_cast<gl::Attribute_Size>(size);
+        packed.type = type;
+        packed.normalized = normalized;
+        packed.stride = stride;
+        packed.offset = mesh->data.size();
+        packed.dequantize_scale = {1.0f, 1.0f, 1.0f};
+        mesh->attributes.push_back(packed);
+
+        mesh->data.resize(packed.offset + align4((size_t) stride * mesh->vertex_count));
+        return mesh->data.data() + packed.offset;
+    }
+
+    inline void pop_stream(Packed_Mesh *mesh)
+    {
+        mesh->data.resize(mesh->attributes.back().offset);
+        mesh->attributes.pop_back();
+    }
+
+    inline bool try_normals(Packed_Mesh *mesh, const Attribute &attribute)
+    {
+        const size_t n = mesh->vertex_count;
+        auto out = reinterpret_cast<GLuint*>(
+            push_stream(mesh, attribute, gl::Attribute_Type::INT_2_10_10_10_REV, GL_TRUE, 4, 3));
+        normals_from_floats(attribute.data, out, n);
+
+        GLfloat error = 0.0f;
+        for (size_t i = 0; i < n; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                error = std::max(error, std::fabs(normal_component(out[i], c) - attribute.data[3 * i + c]));
+            }
+        }
+
+        mesh->attributes.back().max_error = error;
+        if (error <= attribute.tolerance) return true;
+        pop_stream(mesh);
+        return false;
+    }
+
+    inline bool try_positions(Packed_Mesh *mesh, const Attribute &attribute)
+    {
+        const size_t n = mesh->vertex_count;
+        const Quantization q = quantization_of(attribute.data, n);
+        auto out = reinterpret_cast<GLshort*>(
+            push_stream(mesh, attribute, gl::Attribute_Type::SHORT, GL_TRUE, 4 * sizeof(GLshort), 4));
+        positions_from_floats(attribute.data, out, n, q);
+
+        GLfloat error = 0.0f;
+        for (size_t i = 0; i < n; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                const GLfloat x = q.offset[c] + q.scale[c] * snorm_to_float(out[4 * i + c], 16);
+                error = std::max(error, std::fabs(x - attribute.data[3 * i + c]));
+            }
+        }
+
+        Packed_Attribute &packed = mesh->attributes.back();
+        packed.max_error = error;
+        packed.dequantize_offset = {q.offset[0], q.offset[1], q.offset[2]};
+        packed.dequantize_scale = {q.scale[0], q.scale[1], q.scale[2]};
+        if (error <= attribute.tolerance) return true;
+        pop_stream(mesh);
+        return false;
+    }
+
+    inline bool try_halves(Packed_Mesh *mesh, const Attribute &attribute)
+    {
+        const size_t n = mesh->vertex_count;
+        const size_t components = (size_t) attribute.components;
+        // 3 halves are padded to 4 to keep the stride a multiple of 4
+        const size_t stored = components == 3 ? 4 : components;
+        auto out = reinterpret_cast<GLhalf*>(
+            push_stream(mesh, attribute, gl::Attribute_Type::HALF_FLOAT, GL_FALSE,
+                        (GLsizei) (stored * sizeof(GLhalf)), attribute.components));
+
+        if (stored == components) {
+            halves_from_floats(attribute.data, out, n * components);
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                halves_from_floats(attribute.data + components * i, out + stored * i, components);
+                out[stored * i + components] = 0;
+            }
+        }
+
+        GLfloat error = 0.0f;
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t c = 0; c < components; ++c) {
+                const GLfloat x = attribute.data[components * i + c];
+                error = std::max(error, std::fabs(half_to_float(out[stored * i + c]) - x));
+            }
+        }
+
+        mesh->attributes.back().max_error = error;
+        if (error <= attribute.tolerance) return true;
+        pop_stream(mesh);
+        return false;
+    }
+
+    inline void push_floats(Packed_Mesh *mesh, const Attribute &attribute)
+    {
+        const size_t bytes = mesh->vertex_count * (size_t) attribute.components * sizeof(GLfloat);
+        auto out = push_stream(mesh, attribute, gl::Attribute_Type::FLOAT, GL_FALSE,
+                               (GLsizei) (attribute.components * sizeof(GLfloat)), attribute.components);
+        memcpy(out, attribute.data, bytes);
+    }
+
+    // Never fails: floats are the last resort for every attribute
+    inline Packed_Mesh pack(const Attribute *attributes, size_t count, size_t vertex_count)
+    {
+        Packed_Mesh mesh = {};
+        mesh.vertex_count = vertex_count;
+
+        for (size_t i = 0; i < count; ++i) {
+            const Attribute &attribute = attributes[i];
+            mesh.float_bytes += vertex_count * (size_t) attribute.components * sizeof(GLfloat);
+
+            const bool three = attribute.components == 3;
+            if (attribute.semantic == Semantic::NORMAL && three && try_normals(&mesh, attribute)) continue;
+            if (attribute.semantic == Semantic::POSITION && three && try_positions(&mesh, attribute)) continue;
+            if (try_halves(&mesh, attribute)) continue;
+            push_floats(&mesh, attribute);
+        }
+
+        return mesh;
+    }
+
+    // Points the attributes at the streams of the mesh, whose data must
+    // be in the buffer bound to Buffer_Target::ARRAY at `base`
+    inline void setup_attributes(const Packed_Mesh &mesh, size_t base = 0)
+    {
+        for (const auto &attribute : mesh.attributes) {
+            gl::enableVertexAttribArray(attribute.location);
+            gl::vertexAttribPointer(attribute.location, attribute.size, attribute.type,
+                                    attribute.normalized, attribute.stride,
+                                    reinterpret_cast<const GLvoid*>(base + attribute.offset));
+        }
+    }
+}
+
+#endif  // GL_PACK_HPP
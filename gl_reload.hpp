@@ -0,0 +1,205 @@
+#ifndef GL_RELOAD_HPP
+#define GL_RELOAD_HPP
+
+// Shader hot reloading for live tuning.
+//
+// A Watcher thread waits for inotify events on the shader files and
+// reads the new sources, so no file I/O happens on the render thread.
+// Between frames the render thread calls take_sources(), which never
+// waits for the watcher: it feeds the changed files into the
+// gl_source::Include_Cache, and the files that include them see the
+// new text too. Whatever is built from the cache next is built from
+// the new sources, e.g. after gl_variants::invalidate():
+//
+//     const gl_reload::Taken taken = gl_reload::take_sources(&watcher, &includes);
+//     if (taken.changed > 0) {
+//         gl_variants::invalidate(&variants);
+//     }
+//
+// A file whose new text is rejected keeps its previous text in the
+// cache, and taken.rejected counts it.
+//
+// The variants then rebuild in the background and the old programs
+// stay in use until the new ones are ready, or for good if the new
+// sources do not compile.
+//
+// Linux only. Include it after the GL headers, gl.hpp, gl_frame.hpp
+// and gl_source.hpp.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace gl_reload
+{
+    struct Watched_File
+    {
+        std::string path;
+        std::string dir;
+        std::string name;
+        int wd;
+
+        // Guarded by Watcher::mutex
+        bool changed;
+        std::string source;
+        double changed_at;
+    };
+
+    struct Watcher
+    {
+        int inotify_fd;
+        int stop_fd;
+        std::thread thread;
+        std::mutex mutex;
+        // Do not add files after start()
+        std::vector<Watched_File> files;
+    };
+
+    // Editors often save by writing a new file and renaming it over
+    // the old one, so the directories are watched, not the files.
+    inline bool watch(Watcher *watcher, const char *file_path)
+    {
+        Watched_File file = {};
+        file.path = file_path;
+        const char *slash = strrchr(file_path, '/');
+        file.dir = slash ? std::string(file_path, slash - file_path + 1) : std::string(".");
+        file.name = slash ? slash + 1 : file_path;
+
+        if (watcher->inotify_fd <= 0) {
+            watcher->inotify_fd = inotify_init1(IN_CLOEXEC);
+            if (watcher->inotify_fd < 0) return false;
+        }
+
+        file.wd = inotify_add_watch(watcher->inotify_fd, file.dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (file.wd < 0) return false;
+
+        watcher->files.push_back(file);
+        return true;
+    }
+
+    inline void handle_event(Watcher *watcher, const struct inotify_event *event)
+    {
+        if (event->len == 0) return;
+
+        for (auto &file : watcher->files) {
+            if (file.wd != event->wd || file.name != event->name) continue;
+
+            const double changed_at = gl_frame::now_secs();
+            std::string source;
+            if (!gl_source::read_file(file.path.c_str(), &source)) {
+                fprintf(stderr, "Could not read `%s`: %s\n", file.path.c_str(), strerror(errno));
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(watcher->mutex);
+            file.changed = true;
+            file.source = std::move(source);
+            file.changed_at = changed_at;
+        }
+    }
+
+    inline void watcher_thread(Watcher *watcher)
+    {
+        alignas(struct inotify_event) char buffer[4096];
+        struct pollfd fds[2] = {
+            {watcher->inotify_fd, POLLIN, 0},
+            {watcher->stop_fd, POLLIN, 0},
+        };
+
+        for (;;) {
+            if (poll(fds, 2, -1) < 0) {
+                if (errno == EINTR) continue;
+                return;
+            }
+
+            if (fds[1].revents) return;
+
+            const ssize_t n = read(watcher->inotify_fd, buffer, sizeof(buffer));
+            if (n <= 0) continue;
+
+            for (ssize_t i = 0; i < n; ) {
+                auto event = reinterpret_cast<const struct inotify_event *>(buffer + i);
+                handle_event(watcher, event);
+                i += sizeof(struct inotify_event) + event->len;
+            }
+        }
+    }
+
+    inline bool start(Watcher *watcher)
+    {
+        if (watcher->inotify_fd <= 0) return false;
+
+        watcher->stop_fd = eventfd(0, EFD_CLOEXEC);
+        if (watcher->stop_fd < 0) return false;
+
+        watcher->thread = std::thread(watcher_thread, watcher);
+        return true;
+    }
+
+    inline void stop(Watcher *watcher)
+    {
+        if (watcher->thread.joinable()) {
+            const uint64_t one = 1;
+            if (write(watcher->stop_fd, &one, sizeof(one)) < 0) {
+                fprintf(stderr, "Could not stop the shader watcher: %s\n", strerror(errno));
+            }
+            watcher->thread.join();
+        }
+
+        if (watcher->stop_fd > 0) close(watcher->stop_fd);
+        if (watcher->inotify_fd > 0) close(watcher->inotify_fd);
+        watcher->stop_fd = 0;
+        watcher->inotify_fd = 0;
+    }
+
+    struct Taken
+    {
+        size_t changed;         // files whose new text is in use
+        size_t rejected;        // files that kept their previous text
+        double changed_at;      // the earliest change of `changed`
+    };
+
+    // Feeds every changed file into the include cache, so whatever is
+    // assembled from it next sees the new sources. A file whose new
+    // text does not load, e.g. because of an #include that does not
+    // resolve, is rejected: the cache keeps its previous text, so the
+    // running programs and the next builds stay in sync. Never waits
+    // for the watcher thread.
+    inline Taken take_sources(Watcher *watcher, gl_source::Include_Cache *includes)
+    {
+        Taken taken = {};
+
+        std::unique_lock<std::mutex> lock(watcher->mutex, std::try_to_lock);
+        if (!lock.owns_lock()) return taken;
+
+        for (auto &file : watcher->files) {
+            if (!file.changed) continue;
+            file.changed = false;
+
+            gl_source::File *cached = gl_source::load(includes, file.path);
+            if (cached && gl_source::set_text(includes, cached, std::move(file.source))) {
+                taken.changed_at = taken.changed > 0
+                    ? std::min(taken.changed_at, file.changed_at)
+                    : file.changed_at;
+                taken.changed += 1;
+            } else {
+                taken.rejected += 1;
+            }
+        }
+
+        return taken;
+    }
+}
+
+#endif  // GL_RELOAD_HPP
@@ -0,0 +1,471 @@
+#ifndef GL_SOURCE_HPP
+#define GL_SOURCE_HPP
+
+// Shader source preprocessing: `#include "file"` resolution and
+// `#define` injection without building a concatenated copy of the
+// source.
+//
+// Every file is read and split at its #include lines once, then kept
+// in an Include_Cache. Assembling a shader only collects pointers to
+// the pieces of the cached files, which go to glShaderSource as
+// multiple strings with explicit lengths, so the driver does not have
+// to strlen them either. Every file is included at most once per
+// shader, like with #pragma once.
+//
+// The injected defines go right after the #version line of the root
+// file. Shader_Cache deduplicates the compiled shaders by the FNV-1a
+// hash of the final source: start_program() takes them from there.
+//
+// Include it after the GL headers and gl.hpp.
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gl_source
+{
+    const size_t INFO_LOG_CAPACITY = 1024;
+
+    const uint64_t FNV1A_OFFSET = 14695981039346656037ULL;
+    const uint64_t FNV1A_PRIME = 1099511628211ULL;
+
+    inline uint64_t fnv1a(uint64_t hash, const char *data, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= FNV1A_PRIME;
+        }
+        return hash;
+    }
+
+    struct File;
+
+    // Either a piece of the text of the file or an #include of another
+    // file
+    struct Segment
+    {
+        const GLchar *data;
+        GLint length;
+        File *include;
+    };
+
+    struct File
+    {
+        std::string path;
+        std::string text;
+        std::vector<Segment> segments;
+    };
+
+    struct Include_Cache
+    {
+        // unique_ptr keeps the Files in place, the segments point to them
+        std::map<std::string, std::unique_ptr<File>> files;
+        // The injected #define lines, interned so the pieces can point to them
+        std::set<std::string> defines;
+        size_t loads;
+    };
+
+    struct Source
+    {
+        std::vector<const GLchar *> strings;
+        std::vector<GLint> lengths;
+        uint64_t hash;
+    };
+
+    inline bool read_file(const char *file_path, std::string *result)
+    {
+        FILE *f = fopen(file_path, "rb");
+        if (!f) return false;
+
+        result->clear();
+        char chunk[4096];
+        size_t n = 0;
+        while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+            result->append(chunk, n);
+        }
+
+        const bool ok = !ferror(f);
+        fclose(f);
+        return ok;
+    }
+
+    inline std::string dir_of(const std::string &path)
+    {
+        const size_t slash = path.rfind('/');
+        return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+    }
+
+    // Recognizes `#include "name"` with optional spaces around `#`
+    inline bool parse_include(const char *begin, const char *end, std::string *name)
+    {
+        const char *s = begin;
+        while (s < end && (*s == ' ' || *s == '\t')) ++s;
+        if (s == end || *s != '#') return false;
+        ++s;
+        while (s < end && (*s == ' ' || *s == '\t')) ++s;
+        if (end - s < 7 || strncmp(s, "include", 7) != 0) return false;
+        s += 7;
+        while (s < end && (*s == ' ' || *s == '\t')) ++s;
+        if (s == end || *s != '"') return false;
+        ++s;
+        const char *close = static_cast<const char *>(memchr(s, '"', end - s));
+        if (!close) return false;
+        name->assign(s, close - s);
+        return true;
+    }
+
+    inline File *load(Include_Cache *cache, const std::string &path);
+
+    // Replaces the text of the file, e.g. after it changed on disk. The
+    // File stays at the same address, so the files that include it see
+    // the new text too. If an #include does not resolve the File keeps
+    // its previous text and segments.
+    inline bool set_text(Include_Cache *cache, File *file, std::string text)
+    {
+        std::vector<Segment> segments;
+        const char *const text_begin = text.data();
+        const char *const text_end = text_begin + text.size();
+        const char *piece = text_begin;
+        std::string name;
+
+        for (const char *line = text_begin; line < text_end; ) {
+            const char *newline = static_cast<const char *>(memchr(line, '\n', text_end - line));
+            const char *line_end = newline ? newline + 1 : text_end;
+
+            if (parse_include(line, line_end, &name)) {
+                File *include = load(cache, dir_of(file->path) + name);
+                if (!include) {
+                    fprintf(stderr, "%s: could not include `%s`\n", file->path.c_str(), name.c_str());
+                    return false;
+                }
+                if (line > piece) {
+                    segments.push_back({piece, static_cast<GLint>(line - piece), nullptr});
+                }
+                segments.push_back({nullptr, 0, include});
+                piece = line_end;
+            }
+
+            line = line_end;
+        }
+
+        if (text_end > piece) {
+            segments.push_back({piece, static_cast<GLint>(text_end - piece), nullptr});
+        }
+
+        // Moving a short string copies its characters, so the pieces
+        // are pointed into the text of the File again
+        file->text = std::move(text);
+        for (auto &segment : segments) {
+            if (segment.data) segment.data = file->text.data() + (segment.data - text_begin);
+        }
+        file->segments = std::move(segments);
+
+        return true;
+    }
+
+    // Reads the file only the first time it is asked for
+    inline File *load(Include_Cache *cache, const std::string &path)
+    {
+        auto &slot = cache->files[path];
+        if (slot) return slot.get();
+
+        slot.reset(new File());
+        slot->path = path;
+
+        std::string text;
+        if (!read_file(path.c_str(), &text)) {
+            fprintf(stderr, "Could not read `%s`: %s\n", path.c_str(), strerror(errno));
+            cache->files.erase(path);
+            return nullptr;
+        }
+        cache->loads += 1;
+
+        // It is already in the cache while its includes are resolved,
+        // so an include cycle does not recurse forever
+        File *file = slot.get();
+        if (!set_text(cache, file, std::move(text))) {
+            cache->files.erase(path);
+            return nullptr;
+        }
+
+        return file;
+    }
+
+    inline void push_piece(Source *source, const GLchar *data, GLint length)
+    {
+        source->strings.push_back(data);
+        source->lengths.push_back(length);
+        source->hash = fnv1a(source->hash, data, length);
+    }
+
+    inline void push_file(Source *source, const File *file, std::vector<const File *> *included)
+    {
+        for (const File *it : *included) {
+            if (it == file) return;
+        }
+        included->push_back(file);
+
+        for (const auto &segment : file->segments) {
+            if (segment.include) {
+                push_file(source, segment.include, included);
+            } else {
+                push_piece(source, segment.data, segment.length);
+            }
+        }
+    }
+
+    inline void push_defines(Include_Cache *cache, Source *source,
+                             const char *const *defines, size_t defines_count)
+    {
+        for (size_t i = 0; i < defines_count; ++i) {
+            auto line = cache->defines.insert(std::string("#define ") + defines[i] + "\n").first;
+            push_piece(source, line->data(), static_cast<GLint>(line->size()));
+        }
+    }
+
+    // `defines` are `NAME` or `NAME VALUE`
+    inline bool assemble(Include_Cache *cache, const std::string &path,
+                         const char *const *defines, size_t defines_count,
+                         Source *source)
+    {
+        source->strings.clear();
+        source->lengths.clear();
+        source->hash = FNV1A_OFFSET;
+
+        File *root = load(cache, path);
+        if (!root) return false;
+
+        std::vector<const File *> included = {root};
+        size_t first = 0;
+
+        // #version must stay the first line, so the defines go right
+        // after it and the rest of the first segment after them
+        if (!root->segments.empty() && !root->segments[0].include) {
+            const Segment &head = root->segments[0];
+            const char *const head_end = head.data + head.length;
+            const char *s = head.data;
+            while (s < head_end && (*s == ' ' || *s == '\t' || *s == '\n' || *s == '\r')) ++s;
+            if (head_end - s >= 8 && strncmp(s, "#version", 8) == 0) {
+                const char *newline = static_cast<const char *>(memchr(s, '\n', head_end - s));
+                const GLint version_length = newline
+                    ? static_cast<GLint>(newline + 1 - head.data)
+                    : head.length;
+                push_piece(source, head.data, version_length);
+                push_defines(cache, source, defines, defines_count);
+                if (version_length < head.length) {
+                    push_piece(source, head.data + version_length, head.length - version_length);
+                }
+                first = 1;
+            }
+        }
+
+        if (first == 0) push_defines(cache, source, defines, defines_count);
+
+        for (size_t i = first; i < root->segments.size(); ++i) {
+            const Segment &segment = root->segments[i];
+            if (segment.include) {
+                push_file(source, segment.include, &included);
+            } else {
+                push_piece(source, segment.data, segment.length);
+            }
+        }
+
+        return true;
+    }
+
+    inline gl::Shader compile_source(gl::Shader_Type type, const Source &source)
+    {
+        auto shader = gl::createShader(type);
+        gl::shaderSource(shader,
+                         static_cast<GLsizei>(source.strings.size()),
+                         const_cast<const GLchar **>(source.strings.data()),
+                         source.lengths.data());
+        gl::compileShader(shader);
+        return shader;
+    }
+
+    inline bool has_parallel_compile()
+    {
+#ifdef GL_KHR_parallel_shader_compile
+        GLint n = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &n);
+        for (GLint i = 0; i < n; ++i) {
+            auto name = reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, i));
+            if (strcmp(name, "GL_KHR_parallel_shader_compile") == 0 ||
+                strcmp(name, "GL_ARB_parallel_shader_compile") == 0) {
+                return true;
+            }
+        }
+#endif
+        return false;
+    }
+
+    // The shaders by the hash of their final source, so the programs
+    // built from the same source share one shader instead of compiling
+    // it again, e.g. the vertex shaders of the variants when only the
+    // fragment shader changed. A shader lives as long as one of the
+    // programs it was given to.
+    struct Cached_Shader
+    {
+        std::pair<GLenum, uint64_t> key;
+        size_t refs;
+    };
+
+    struct Shader_Cache
+    {
+        std::map<std::pair<GLenum, uint64_t>, gl::Shader> shaders;
+        std::map<GLuint, Cached_Shader> refs;
+        size_t hits;
+        size_t misses;
+    };
+
+    // Issues the compile unless a shader of the same final source is
+    // still alive, without waiting for the driver. Give it back with
+    // release().
+    inline gl::Shader acquire(Shader_Cache *cache, gl::Shader_Type type, const Source &source)
+    {
+        const auto key = std::make_pair(static_cast<GLenum>(type), source.hash);
+        auto it = cache->shaders.find(key);
+        if (it != cache->shaders.end()) {
+            cache->hits += 1;
+            cache->refs[it->second.unwrap].refs += 1;
+            return it->second;
+        }
+        cache->misses += 1;
+
+        auto shader = compile_source(type, source);
+        cache->shaders[key] = shader;
+        cache->refs[shader.unwrap] = {key, 1};
+        return shader;
+    }
+
+    inline void release(Shader_Cache *cache, gl::Shader shader)
+    {
+        auto it = cache->refs.find(shader.unwrap);
+        if (it == cache->refs.end()) return;
+        if (--it->second.refs > 0) return;
+
+        cache->shaders.erase(it->second.key);
+        cache->refs.erase(it);
+        gl::deleteObject(shader);
+    }
+
+    // Deletes a program of poll_program() and gives its shaders back
+    inline void delete_program(Shader_Cache *cache, gl::Program program, gl::Shader vert, gl::Shader frag)
+    {
+        gl::deleteObject(program);
+        release(cache, vert);
+        release(cache, frag);
+    }
+
+    // Everything is released by then, unless a program was leaked
+    inline void destroy(Shader_Cache *cache)
+    {
+        for (auto &it : cache->shaders) {
+            gl::deleteObject(it.second);
+        }
+        cache->shaders.clear();
+        cache->refs.clear();
+    }
+
+    // A program being compiled and linked, possibly in the background
+    struct Program_Build
+    {
+        Shader_Cache *shaders;
+        gl::Program program;
+        gl::Shader vert;
+        gl::Shader frag;
+        std::string vert_path;
+        std::string frag_path;
+    };
+
+    enum class Build_Status
+    {
+        Pending,
+        Done,
+        Failed,
+    };
+
+    // Issues the compile and the link without waiting for them.
+    // `before_link` may be NULL, otherwise it is called right before
+    // the link, e.g. to bind the attribute locations.
+    inline bool start_program(Include_Cache *includes, Shader_Cache *shaders,
+                              const std::string &vert_path, const std::string &frag_path,
+                              const char *const *defines, size_t defines_count,
+                              void (*before_link)(gl::Program program, void *data), void *data,
+                              Program_Build *build)
+    {
+        Source vert_source = {};
+        Source frag_source = {};
+        if (!assemble(includes, vert_path, defines, defines_count, &vert_source) ||
+            !assemble(includes, frag_path, defines, defines_count, &frag_source)) {
+            return false;
+        }
+
+        build->shaders = shaders;
+        build->vert_path = vert_path;
+        build->frag_path = frag_path;
+        build->vert = acquire(shaders, gl::Shader_Type::Vertex, vert_source);
+        build->frag = acquire(shaders, gl::Shader_Type::Fragment, frag_source);
+        build->program = gl::createProgram();
+        gl::attachShader(build->program, build->vert);
+        gl::attachShader(build->program, build->frag);
+        if (before_link) before_link(build->program, data);
+        gl::linkProgram(build->program);
+        return true;
+    }
+
+    // With `parallel` (see has_parallel_compile()) it returns Pending
+    // until the driver is done, without blocking. Otherwise it waits
+    // for the driver. On Done build->program is ready to use and
+    // belongs to the caller, who deletes it with delete_program() and
+    // build->vert and build->frag. On Failed the errors are printed and
+    // everything is deleted.
+    inline Build_Status poll_program(Program_Build *build, bool parallel)
+    {
+#ifdef GL_KHR_parallel_shader_compile
+        if (parallel && !gl::completionStatus(build->program)) return Build_Status::Pending;
+#else
+        (void) parallel;
+#endif
+
+        bool ok = true;
+        const struct { gl::Shader shader; const std::string &path; } shaders[] = {
+            {build->vert, build->vert_path},
+            {build->frag, build->frag_path},
+        };
+        for (const auto &it : shaders) {
+            if (!gl::compileStatus(it.shader)) {
+                auto log = gl::getShaderInfoLog<INFO_LOG_CAPACITY>(it.shader);
+                fprintf(stderr, "Shader compilation failed `%s`: %.*s\n",
+                        it.path.c_str(), (int) log.length, log.value);
+                ok = false;
+            }
+        }
+
+        if (ok && !gl::linkStatus(build->program)) {
+            auto log = gl::getProgramInfoLog<INFO_LOG_CAPACITY>(build->program);
+            fprintf(stderr, "Program link error: %.*s\n", (int) log.length, log.value);
+            ok = false;
+        }
+
+        if (!ok) {
+            delete_program(build->shaders, build->program, build->vert, build->frag);
+            build->program = {};
+            build->vert = {};
+            build->frag = {};
+            return Build_Status::Failed;
+        }
+
+        return Build_Status::Done;
+    }
+}
+
+#endif  // GL_SOURCE_HPP
@@ -0,0 +1,113 @@
+#ifndef GL_SYNC_HPP
+#define GL_SYNC_HPP
+
+// Frames in flight: the CPU builds frame F + N while the GPU still
+// renders frame F, and blocks only when it gets N frames ahead. Every
+// frame ends with a fence and frame F + N waits for the fence of frame
+// F before it touches what frame F used (the N copies of per-frame
+// buffers, for instance).
+//
+//     gl_sync::Frame_Ring<2> ring = {};
+//     while (running) {
+//         const size_t slot = gl_sync::begin_frame(&ring);
+//         ... write the per-frame data of `slot`, draw ...
+//         gl_sync::end_frame(&ring);
+//     }
+//     gl_sync::finish(&ring);
+//     gl_frame::Report blocked = gl_frame::report(ring.stats);
+//
+// A bigger N keeps both busy when their frame times vary, at the cost
+// of N frames of latency between the input and the screen. The stats
+// hold how long the CPU blocked on the GPU every frame, to tune N:
+// blocking every frame means the GPU is the bottleneck and a bigger N
+// only adds latency, never blocking means a smaller N would do.
+//
+// Include it after the GL headers, gl.hpp and gl_frame.hpp.
+
+#include <cstddef>
+
+namespace gl_sync
+{
+    // Slices of clientWaitSync, so a lost context or a hung GPU shows
+    // up as a loop instead of a single endless call
+    const GLuint64 WAIT_SLICE_NS = 1000000000;
+
+    // Blocks until the GPU is past `fence`, false if the wait failed
+    inline bool wait(const gl::Fence &fence)
+    {
+        // The commands up to the fence are flushed once, or they may sit
+        // in the driver and the fence never signal
+        bool flush = true;
+        for (;;) {
+            switch (gl::clientWaitSync(fence, flush, WAIT_SLICE_NS)) {
+            case gl::Wait_Result::ALREADY_SIGNALED:
+            case gl::Wait_Result::CONDITION_SATISFIED:
+                return true;
+            case gl::Wait_Result::WAIT_FAILED:
+                return false;
+            case gl::Wait_Result::TIMEOUT_EXPIRED:
+                flush = false;
+                break;
+            }
+        }
+    }
+
+    template <size_t N>
+    struct Frame_Ring
+    {
+        static_assert(N > 0, "at least one frame in flight");
+
+        // The fence of the last frame that used every slot
+        gl::Fence fences[N];
+        // Frames begun
+        size_t frame;
+        size_t slot;
+        // How long begin_frame blocked on the GPU, in seconds. Only the
+        // frames that had a fence to wait for are recorded, the first N
+        // never block.
+        double blocked;
+        gl_frame::Stats stats;
+    };
+
+    // Waits until the GPU is done with the frame that last used the
+    // slot of this frame and returns the slot, in [0, N)
+    template <size_t N>
+    size_t begin_frame(Frame_Ring<N> *ring)
+    {
+        ring->slot = ring->frame % N;
+        ring->frame += 1;
+        ring->blocked = 0.0;
+
+        gl::Fence &fence = ring->fences[ring->slot];
+        if (!fence) return ring->slot;
+
+        const double start = gl_frame::now_secs();
+        wait(fence);
+        ring->blocked = gl_frame::now_secs() - start;
+        fence.reset();
+
+        gl_frame::record(&ring->stats, ring->blocked, 0.0);
+        return ring->slot;
+    }
+
+    // After the last command of the frame
+    template <size_t N>
+    void end_frame(Frame_Ring<N> *ring)
+    {
+        ring->fences[ring->slot] = gl::fenceSync();
+    }
+
+    // Waits for every frame in flight, before the per-frame resources
+    // are deleted or read back. Not recorded in the stats.
+    template <size_t N>
+    void finish(Frame_Ring<N> *ring)
+    {
+        for (auto &fence : ring->fences) {
+            if (!fence) continue;
+            wait(fence);
+            fence.reset();
+        }
+    }
+}
+
+#endif  // GL_SYNC_HPP
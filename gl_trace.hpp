@@ -0,0 +1,425 @@
+#ifndef GL_TRACE_HPP
+#define GL_TRACE_HPP
+
+// Timeline of the gl.hpp calls, with the frames and passes around
+// them, exported as Chrome trace JSON. Open it in chrome://tracing or
+// in the Perfetto UI (ui.perfetto.dev), which read the same format.
+//
+// Define GL_HPP_TRACE and include it before gl.hpp to record every
+// wrapper: its name, its arguments, when it began and ended on the CPU
+// and on which thread. The markers work with or without it:
+//
+//     #define GL_HPP_TRACE
+//     #include "gl_trace.hpp"
+//     #include "gl.hpp"
+//
+//     gl_trace::name_thread("render");
+//     gl_trace::start();
+//     while (running) {
+//         gl_trace::Scope frame("frame", gl_trace::Category::FRAME);
+//         {
+//             gl_trace::Scope pass("shadows");
+//             ... gl:: calls ...
+//         }
+//     }
+//     gl_trace::stop();
+//     gl_trace::write_chrome_json("trace.json");
+//
+// Every thread records into buffers of its own that only it writes, so
+// recording takes no lock and never waits for another thread. The
+// events are written whole when they end, and write_chrome_json can
+// read them while the threads keep recording.
+//
+// Without GL_HPP_TRACE the wrappers compile to the same code as without
+// this header (bench/zero_cost.cpp checks it). With it, and stopped,
+// every wrapper checks a flag.
+//
+// The names of the scopes and markers are not copied: use literals or
+// strings that outlive the export. Does not depend on gl.hpp.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <type_traits>
+
+namespace gl_trace
+{
+    inline uint64_t now_ns()
+    {
+        struct timespec ts = {};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+    }
+
+    enum class Category : uint8_t
+    {
+        CALL,
+        FRAME,
+        PASS,
+        MARKER,
+    };
+
+    struct Arg
+    {
+        enum Kind : uint8_t
+        {
+            NONE,
+            INT,
+            UINT,
+            FLOAT,
+            POINTER,
+        };
+
+        Kind kind;
+        union
+        {
+            int64_t i;
+            uint64_t u;
+            double f;
+            const void *p;
+        };
+    };
+
+    // The arguments after the first MAX_ARGS are not recorded
+    const size_t MAX_ARGS = 6;
+
+    struct Event
+    {
+        const char *name;
+        // "a, b, c": the arguments as they were written in the wrapper
+        const char *arg_names;
+        uint64_t begin_ns;
+        uint64_t end_ns;
+        Category category;
+        uint8_t args_count;
+        Arg args[MAX_ARGS];
+    };
+
+    const size_t CHUNK_EVENTS = 16 * 1024;
+
+    // Chunks are never moved or freed while recording, so the exporter
+    // can read the first `count` events of a chunk at any time
+    struct Chunk
+    {
+        Event events[CHUNK_EVENTS];
+        std::atomic<size_t> count;
+        std::atomic<Chunk*> next;
+    };
+
+    struct Thread_Buffer
+    {
+        uint32_t tid;
+        std::atomic<const char*> name;
+        Chunk *first;
+        // Only touched by the thread of the buffer
+        Chunk *last;
+        Thread_Buffer *next;
+    };
+
+    struct Tracer
+    {
+        std::atomic<bool> recording;
+        std::atomic<uint64_t> start_ns;
+        // Pushed to the front by every thread the first time it records
+        std::atomic<Thread_Buffer*> threads;
+        std::atomic<uint32_t> next_tid;
+    };
+
+    inline Tracer tracer = {};
+    inline thread_local Thread_Buffer *thread_buffer = nullptr;
+
+    inline bool recording()
+    {
+        return tracer.recording.load(std::memory_order_relaxed);
+    }
+
+    inline void start()
+    {
+        uint64_t zero = 0;
+        tracer.start_ns.compare_exchange_strong(zero, now_ns());
+        tracer.recording.store(true, std::memory_order_relaxed);
+    }
+
+    // The events that are in flight are still recorded when they end
+    inline void stop()
+    {
+        tracer.recording.store(false, std::memory_order_relaxed);
+    }
+
+    // Drops every event recorded so far and restarts the clock at the
+    // next start(). Only while no thread records: stop() first. The
+    // chunks are kept for the threads that record again.
+    inline void clear()
+    {
+        for (Thread_Buffer *buffer = tracer.threads.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+            for (Chunk *chunk = buffer->first; chunk; chunk = chunk->next.load(std::memory_order_acquire)) {
+                chunk->count.store(0, std::memory_order_relaxed);
+            }
+        }
+        tracer.start_ns.store(0, std::memory_order_relaxed);
+    }
+
+    inline Thread_Buffer *local_buffer()
+    {
+        if (thread_buffer) return thread_buffer;
+
+        Thread_Buffer *buffer = new Thread_Buffer();
+        buffer->tid = tracer.next_tid.fetch_add(1, std::memory_order_relaxed) + 1;
+        buffer->first = buffer->last = new Chunk();
+        buffer->next = tracer.threads.load(std::memory_order_relaxed);
+        while (!tracer.threads.compare_exchange_weak(buffer->next, buffer, std::memory_order_release)) {}
+
+        thread_buffer = buffer;
+        return buffer;
+    }
+
+    // Shows up as the name of the calling thread in the trace
+    inline void name_thread(const char *name)
+    {
+        local_buffer()->name.store(name, std::memory_order_relaxed);
+    }
+
+    inline void record(const Event &event)
+    {
+        Thread_Buffer *buffer = local_buffer();
+        Chunk *chunk = buffer->last;
+        size_t count = chunk->count.load(std::memory_order_relaxed);
+        if (count == CHUNK_EVENTS) {
+            Chunk *next = new Chunk();
+            chunk->next.store(next, std::memory_order_release);
+            chunk = buffer->last = next;
+            count = 0;
+        }
+        chunk->events[count] = event;
+        chunk->count.store(count + 1, std::memory_order_release);
+    }
+
+    template <typename T>
+    Arg to_arg(const T &x, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type* = nullptr)
+    {
+        Arg arg = {Arg::INT, {}};
+        arg.i = (int64_t) x;
+        return arg;
+    }
+
+    template <typename T>
+    Arg to_arg(const T &x, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type* = nullptr)
+    {
+        Arg arg = {Arg::UINT, {}};
+        arg.u = (uint64_t) x;
+        return arg;
+    }
+
+    template <typename T>
+    Arg to_arg(const T &x, typename std::enable_if<std::is_enum<T>::value>::type* = nullptr)
+    {
+        Arg arg = {Arg::UINT, {}};
+        arg.u = (uint64_t) x;
+        return arg;
+    }
+
+    template <typename T>
+    Arg to_arg(const T &x, typename std::enable_if<std::is_floating_point<T>::value>::type* = nullptr)
+    {
+        Arg arg = {Arg::FLOAT, {}};
+        arg.f = (double) x;
+        return arg;
+    }
+
+    template <typename T>
+    Arg to_arg(T *x)
+    {
+        Arg arg = {Arg::POINTER, {}};
+        arg.p = (const void*) x;
+        return arg;
+    }
+
+    // The handles and the locations
+    template <typename T>
+    auto to_arg(const T &x) -> decltype(x.unwrap, Arg())
+    {
+        // A copy: the handles are packed
+        const auto unwrap = x.unwrap;
+        return to_arg(unwrap);
+    }
+
+    // Vectors, matrices, colors
+    inline Arg to_arg(...)
+    {
+        return {Arg::NONE, {}};
+    }
+
+    // Records the scope as one event when it ends
+    struct Scope
+    {
+        Event event;
+        bool active;
+
+        explicit Scope(const char *name, Category category = Category::PASS, const char *arg_names = "")
+        {
+            active = recording();
+            if (!active) return;
+            event.name = name;
+            event.arg_names = arg_names;
+            event.category = category;
+            event.args_count = 0;
+            event.begin_ns = now_ns();
+        }
+
+        Scope(const Scope&) = delete;
+        Scope &operator=(const Scope&) = delete;
+
+        ~Scope()
+        {
+            if (!active) return;
+            event.end_ns = now_ns();
+            record(event);
+        }
+
+        template <typename... Args>
+        void args(const Args &...xs)
+        {
+            if (!active) return;
+            const Arg all[] = {Arg(), to_arg(xs)...};
+            const size_t count = sizeof...(xs) < MAX_ARGS ? sizeof...(xs) : MAX_ARGS;
+            for (size_t i = 0; i < count; ++i) event.args[i] = all[i + 1];
+            event.args_count = (uint8_t) count;
+        }
+    };
+
+    // What GL_HPP_TRACE_CALL puts in every wrapper
+    struct Call_Scope: Scope
+    {
+        Call_Scope(const char *name, const char *arg_names): Scope(name, Category::CALL, arg_names) {}
+    };
+
+    // An instant on the timeline
+    inline void mark(const char *name)
+    {
+        if (!recording()) return;
+        Event event = {};
+        event.name = name;
+        event.arg_names = "";
+        event.category = Category::MARKER;
+        event.begin_ns = event.end_ns = now_ns();
+        record(event);
+    }
+
+    inline const char *category_name(Category category)
+    {
+        switch (category) {
+        case Category::CALL: return "gl";
+        case Category::FRAME: return "frame";
+        case Category::PASS: return "pass";
+        case Category::MARKER: return "marker";
+        }
+        return "?";
+    }
+
+    inline void write_json_string(FILE *out, const char *s, size_t length)
+    {
+        fputc('"', out);
+        for (size_t i = 0; i < length; ++i) {
+            const char c = s[i];
+            if (c == '"' || c == '\\') {
+                fputc('\\', out);
+                fputc(c, out);
+            } else if ((unsigned char) c < 0x20) {
+                fprintf(out, "\\u%04x", c);
+            } else {
+                fputc(c, out);
+            }
+        }
+        fputc('"', out);
+    }
+
+    inline void write_args(FILE *out, const Event &event)
+    {
+        fputs(",\"args\":{", out);
+        const char *names = event.arg_names;
+        for (size_t i = 0; i < event.args_count; ++i) {
+            // The next name of "a, b, c"
+            while (*names == ' ' || *names == ',') ++names;
+            const char *end = names;
+            while (*end && *end != ',') ++end;
+            size_t length = (size_t) (end - names);
+            while (length > 0 && names[length - 1] == ' ') --length;
+
+            if (i > 0) fputc(',', out);
+            if (length > 0) {
+                write_json_string(out, names, length);
+            } else {
+                fprintf(out, "\"%zu\"", i);
+            }
+            names = end;
+
+            const Arg &arg = event.args[i];
+            switch (arg.kind) {
+            case Arg::NONE: fputs(":\"{...}\"", out); break;
+            case Arg::INT: fprintf(out, ":%lld", (long long) arg.i); break;
+            case Arg::UINT: fprintf(out, ":%llu", (unsigned long long) arg.u); break;
+            case Arg::FLOAT: fprintf(out, ":%g", arg.f); break;
+            case Arg::POINTER: fprintf(out, ":\"%p\"", arg.p); break;
+            }
+        }
+        fputc('}', out);
+    }
+
+    // In microseconds since start(), which is what Chrome expects
+    inline void write_event(FILE *out, uint32_t tid, const Event &event, bool *first)
+    {
+        const uint64_t start_ns = tracer.start_ns.load(std::memory_order_relaxed);
+        const double ts = (double) (event.begin_ns - start_ns) / 1000.0;
+
+        fputs(*first ? "\n" : ",\n", out);
+        *first = false;
+        fputs("{\"name\":", out);
+        write_json_string(out, event.name, strlen(event.name));
+        fprintf(out, ",\"cat\":\"%s\",\"pid\":1,\"tid\":%u,\"ts\":%.3f", category_name(event.category), tid, ts);
+        if (event.category == Category::MARKER) {
+            fputs(",\"ph\":\"i\",\"s\":\"t\"", out);
+        } else {
+            fprintf(out, ",\"ph\":\"X\",\"dur\":%.3f", (double) (event.end_ns - event.begin_ns) / 1000.0);
+        }
+        if (event.args_count > 0) write_args(out, event);
+        fputc('}', out);
+    }
+
+    // Every event recorded so far, of every thread. Returns the number
+    // of events written.
+    inline size_t write_chrome_json(FILE *out)
+    {
+        size_t written = 0;
+        bool first = true;
+        fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", out);
+        for (Thread_Buffer *buffer = tracer.threads.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+            if (const char *name = buffer->name.load(std::memory_order_relaxed)) {
+                fputs(first ? "\n" : ",\n", out);
+                first = false;
+                fprintf(out, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+                        buffer->tid);
+                write_json_string(out, name, strlen(name));
+                fputs("}}", out);
+            }
+            for (Chunk *chunk = buffer->first; chunk; chunk = chunk->next.load(std::memory_order_acquire)) {
+                const size_t count = chunk->count.load(std::memory_order_acquire);
+                for (size_t i = 0; i < count; ++i) write_event(out, buffer->tid, chunk->events[i], &first);
+                written += count;
+            }
+        }
+        fputs("\n]}\n", out);
+        return written;
+    }
+
+    inline bool write_chrome_json(const char *path)
+    {
+        FILE *out = fopen(path, "w");
+        if (!out) return false;
+        write_chrome_json(out);
+        return fclose(out) == 0;
+    }
+}
+
+#endif  // GL_TRACE_HPP
@@ -0,0 +1,194 @@
+#ifndef GL_UNIFORMS_HPP
+#define GL_UNIFORMS_HPP
+
+// Shadow copies of the uniform values of a program, so uploading a
+// value the program already holds costs a comparison instead of a
+// call into the driver:
+//
+//     gl_uniforms::Shadow shadow = {};
+//     gl_uniforms::reset(&shadow, program);
+//     ...
+//     gl_uniforms::uniform(&shadow, u_resolution, gl::Vec2f {w, h});
+//
+// A Shadow mirrors one program and only knows about the values that
+// went through it, so:
+// - the program must be the current one, like for gl::uniform(),
+// - call reset() after the program is (re)linked or when the Shadow
+//   starts tracking another program, since linking resets the values,
+// - do not upload to the same program with gl::uniform() directly.
+//
+// An array uniform at location L occupies the locations L to
+// L + count - 1, one per element, so uploading the whole array and
+// uploading single elements of it can be mixed: each upload forgets
+// the values it overlaps.
+//
+// Include it after the GL headers and gl.hpp.
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__)
+#    include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#    include <arm_neon.h>
+#endif
+
+namespace gl_uniforms
+{
+    // memcmp(a, b, size) == 0 for the uniform arrays, which are short
+    // enough that the call into libc costs more than the comparison.
+    inline bool equal_bytes(const void *a, const void *b, size_t size)
+    {
+        auto x = static_cast<const unsigned char*>(a);
+        auto y = static_cast<const unsigned char*>(b);
+        size_t i = 0;
+#if defined(__SSE2__)
+        for (; i + 16 <= size; i += 16) {
+            const __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i)),
+                                              _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i)));
+            if (_mm_movemask_epi8(eq) != 0xFFFF) return false;
+        }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+        for (; i + 16 <= size; i += 16) {
+            if (vminvq_u8(vceqq_u8(vld1q_u8(x + i), vld1q_u8(y + i))) != 0xFF) return false;
+        }
+#endif
+        for (; i < size; ++i) {
+            if (x[i] != y[i]) return false;
+        }
+        return true;
+    }
+
+    struct Stats
+    {
+        size_t issued;          // uploads that reached GL
+        size_t skipped;         // uploads of the value GL already had
+        size_t bytes_skipped;
+    };
+
+    struct Value
+    {
+        std::vector<unsigned char> bytes;   // empty while unknown
+        size_t locations;                   // the array elements it covers
+    };
+
+    struct Shadow
+    {
+        gl::Program program;
+        // Indexed by the first location of the value. Locations are
+        // small in practice, explicit ones (see tools/reflect) in
+        // particular. No two known values overlap.
+        std::vector<Value> values;
+        size_t max_locations;
+        Stats stats;
+    };
+
+    // Forgets every value, e.g. after `program` was linked
+    inline void reset(Shadow *shadow, gl::Program program)
+    {
+        shadow->program = program;
+        for (auto &value : shadow->values) {
+            value.bytes.clear();
+        }
+    }
+
+    // Returns true and remembers the value if GL does not have it yet.
+    // `locations` is the number of array elements in `data`, 1 for a
+    // single value.
+    inline bool update(Shadow *shadow, gl::Uniform location, size_t locations,
+                       const void *data, size_t size)
+    {
+        const size_t index = static_cast<size_t>(location.unwrap);
+        if (index + locations > shadow->values.size()) {
+            shadow->values.resize(index + locations);
+        }
+
+        auto &value = shadow->values[index];
+        if (value.locations == locations && value.bytes.size() == size &&
+            equal_bytes(value.bytes.data(), data, size)) {
+            shadow->stats.skipped += 1;
+            shadow->stats.bytes_skipped += size;
+            return false;
+        }
+
+        // The values of the elements this one covers, and of the
+        // arrays before it that cover its first element, are stale
+        for (size_t i = index + 1; i < index + locations; ++i) {
+            shadow->values[i].bytes.clear();
+        }
+        const size_t first = index >= shadow->max_locations ? index - shadow->max_locations + 1 : 0;
+        for (size_t i = first; i < index; ++i) {
+            if (i + shadow->values[i].locations > index) shadow->values[i].bytes.clear();
+        }
+
+        auto bytes = static_cast<const unsigned char*>(data);
+        value.bytes.assign(bytes, bytes + size);
+        value.locations = locations;
+        if (locations > shadow->max_locations) shadow->max_locations = locations;
+        shadow->stats.issued += 1;
+        return true;
+    }
+
+    // T is any of the types gl::uniform() takes
+    template <typename T>
+    inline void uniform(Shadow *shadow, gl::Uniform location, const T &x)
+    {
+        static_assert(!gl::Is_Same<T, GLint>::value && !gl::Is_Same<T, GLuint>::value,
+                      "gl::uniform() would upload the integer as a float, use uniformi() or uniformui()");
+        // GL ignores location -1, so there is nothing to shadow
+        if (location.unwrap < 0) return;
+        if (update(shadow, location, 1, &x, sizeof(x))) {
+            gl::uniform(location, x);
+        }
+    }
+
+    inline void uniformi(Shadow *shadow, gl::Uniform location, GLint x)
+    {
+        if (location.unwrap < 0) return;
+        if (update(shadow, location, 1, &x, sizeof(x))) {
+            gl::uniformi(location, x);
+        }
+    }
+
+    inline void uniformui(Shadow *shadow, gl::Uniform location, GLuint x)
+    {
+        if (location.unwrap < 0) return;
+        if (update(shadow, location, 1, &x, sizeof(x))) {
+            gl::uniformui(location, x);
+        }
+    }
+
+    template <typename T>
+    inline void uniform(Shadow *shadow, gl::Uniform location, GLsizei count, const T *xs)
+    {
+        if (location.unwrap < 0 || count <= 0) return;
+        const size_t n = static_cast<size_t>(count);
+        if (update(shadow, location, n, xs, sizeof(*xs) * n)) {
+            gl::uniform(location, count, xs);
+        }
+    }
+
+    template <typename T, typename U>
+    inline void uniform(Shadow *shadow, gl::Typed_Uniform<T> location, const U &x)
+    {
+        static_assert(gl::Is_Uploadable_As<T, U>::value,
+                      "The value must have the type of the uniform, convert it explicitly");
+        static_assert(sizeof(U) == sizeof(T), "The value must have the layout of the uniform");
+        if (location.unwrap.unwrap < 0) return;
+        if (update(shadow, location.unwrap, 1, &x, sizeof(x))) {
+            gl::uniform(location, x);
+        }
+    }
+
+    template <typename T, GLsizei N, typename U>
+    inline void uniform(Shadow *shadow, gl::Typed_Uniform<T[N]> location, GLsizei count, const U *xs)
+    {
+        static_assert(gl::Is_Uploadable_As<T, U>::value,
+                      "The values must have the type of the uniform, convert them explicitly");
+        static_assert(sizeof(U) == sizeof(T), "The values must have the layout of the uniform");
+        uniform(shadow, location.unwrap, count, static_cast<const T *>(xs));
+    }
+}
+
+#endif  // GL_UNIFORMS_HPP
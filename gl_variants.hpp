@@ -0,0 +1,274 @@
+#ifndef GL_VARIANTS_HPP
+#define GL_VARIANTS_HPP
+
+// Shader variants: one program per combination of #define switches,
+// keyed by a bitset where bit i turns on the i-th define of the Set.
+//
+// Variants are compiled lazily the first time they are asked for.
+// With async compilation (GL_KHR_parallel_shader_compile) get() never
+// waits for the driver: until the requested variant is ready it
+// returns the fallback variant, which is compiled up front by init().
+// When more than `budget` variants are alive the least recently used
+// one is evicted.
+//
+// After the sources change (see gl_reload::take_sources) invalidate()
+// makes every variant rebuild on its next use. The old programs keep
+// being returned until the new ones are ready. The shaders whose final
+// source did not change are taken from the Shader_Cache instead of
+// being compiled again.
+//
+// Include it after the GL headers, gl.hpp, gl_frame.hpp and
+// gl_source.hpp.
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gl_variants
+{
+    using Key = uint64_t;
+
+    const size_t MAX_DEFINES = 64;
+
+    struct Variant
+    {
+        gl::Program program;    // 0 until the first build is done
+        gl::Shader vert;        // of `program`, from the Shader_Cache
+        gl::Shader frag;
+        gl_source::Program_Build build;
+        bool building;
+        bool stale;
+        bool failed;            // do not retry until invalidate()
+        double build_started_at;
+        uint64_t last_used;
+    };
+
+    struct Stats
+    {
+        size_t hits;            // the requested variant was ready
+        size_t fallbacks;       // the fallback was returned instead
+        size_t misses;          // the requested variant did not exist
+        size_t evictions;
+        size_t compiles;
+        size_t failures;
+        double compile_time_total;
+        double compile_time_max;
+        double last_compile_time;
+    };
+
+    struct Set
+    {
+        gl_source::Include_Cache *includes;
+        gl_source::Shader_Cache *shaders;
+        std::string vert_path;
+        std::string frag_path;
+        std::vector<std::string> defines;
+        Key fallback;
+        size_t budget;
+        bool async;
+
+        void (*before_link)(gl::Program program, void *data);
+        void *before_link_data;
+
+        std::unordered_map<Key, Variant> variants;
+        uint64_t clock;
+        Stats stats;
+    };
+
+    // `defines` are `NAME` or `NAME VALUE`, bit i of a Key turns on
+    // defines[i]. `budget` is the maximum number of variants alive at
+    // once, the fallback included.
+    inline Set make_set(gl_source::Include_Cache *includes, gl_source::Shader_Cache *shaders,
+                        const char *vert_path, const char *frag_path,
+                        const std::vector<std::string> &defines,
+                        Key fallback, size_t budget)
+    {
+        assert(defines.size() <= MAX_DEFINES);
+        assert(budget >= 1);
+
+        Set set = {};
+        set.includes = includes;
+        set.shaders = shaders;
+        set.vert_path = vert_path;
+        set.frag_path = frag_path;
+        set.defines = defines;
+        set.fallback = fallback;
+        set.budget = budget;
+        return set;
+    }
+
+    inline bool start_build(Set *set, Key key, Variant *variant)
+    {
+        const char *defines[MAX_DEFINES];
+        size_t defines_count = 0;
+        for (size_t i = 0; i < set->defines.size(); ++i) {
+            if (key & (Key(1) << i)) defines[defines_count++] = set->defines[i].c_str();
+        }
+
+        variant->build_started_at = gl_frame::now_secs();
+        variant->stale = false;
+        if (!gl_source::start_program(set->includes, set->shaders, set->vert_path, set->frag_path,
+                                      defines, defines_count,
+                                      set->before_link, set->before_link_data,
+                                      &variant->build)) {
+            set->stats.failures += 1;
+            variant->failed = true;
+            return false;
+        }
+
+        set->stats.compiles += 1;
+        variant->building = true;
+        return true;
+    }
+
+    inline void poll_build(Set *set, Variant *variant, bool async)
+    {
+        switch (gl_source::poll_program(&variant->build, async)) {
+        case gl_source::Build_Status::Pending:
+            return;
+
+        case gl_source::Build_Status::Failed:
+            set->stats.failures += 1;
+            variant->building = false;
+            // A stale build failing says nothing about the new sources
+            variant->failed = !variant->stale;
+            return;
+
+        case gl_source::Build_Status::Done:
+            break;
+        }
+
+        // For async builds this is the time until the variant was
+        // found ready, which is at most a frame late
+        const double compile_time = gl_frame::now_secs() - variant->build_started_at;
+        set->stats.compile_time_total += compile_time;
+        set->stats.compile_time_max = std::max(set->stats.compile_time_max, compile_time);
+        set->stats.last_compile_time = compile_time;
+
+        gl_source::delete_program(set->shaders, variant->program, variant->vert, variant->frag);
+        variant->program = variant->build.program;
+        variant->vert = variant->build.vert;
+        variant->frag = variant->build.frag;
+        variant->build.program = {};
+        variant->build.vert = {};
+        variant->build.frag = {};
+        variant->building = false;
+    }
+
+    // Compiles the fallback variant and waits for it. `async` makes
+    // the other variants compile in the background if the driver
+    // supports it.
+    inline bool init(Set *set, bool async)
+    {
+        set->async = async && gl_source::has_parallel_compile();
+
+        Variant &fallback = set->variants[set->fallback];
+        if (!start_build(set, set->fallback, &fallback)) return false;
+        poll_build(set, &fallback, false);
+        fallback.last_used = set->clock;
+        return fallback.program.unwrap != 0;
+    }
+
+    inline void evict_one(Set *set)
+    {
+        auto victim = set->variants.end();
+        for (auto it = set->variants.begin(); it != set->variants.end(); ++it) {
+            if (it->first == set->fallback || it->second.building) continue;
+            if (victim == set->variants.end() || it->second.last_used < victim->second.last_used) {
+                victim = it;
+            }
+        }
+
+        if (victim == set->variants.end()) return;
+
+        const Variant &variant = victim->second;
+        gl_source::delete_program(set->shaders, variant.program, variant.vert, variant.frag);
+        set->variants.erase(victim);
+        set->stats.evictions += 1;
+    }
+
+    // Moves the variant towards being up to date without blocking
+    // (unless the Set is not async)
+    inline void update(Set *set, Key key, Variant *variant)
+    {
+        if (variant->building) {
+            poll_build(set, variant, set->async);
+        }
+
+        // A build that could not start, e.g. because of a missing
+        // #include, has no program to poll
+        if (variant->stale && !variant->building && !variant->failed &&
+            start_build(set, key, variant)) {
+            poll_build(set, variant, set->async);
+        }
+    }
+
+    // The program to render with this frame: the requested variant if
+    // it is ready, otherwise the fallback.
+    inline gl::Program get(Set *set, Key key)
+    {
+        set->clock += 1;
+
+        // The fallback keeps rebuilding in the background even when it
+        // is not in use, so it is up to date when it is needed
+        if (key != set->fallback) {
+            update(set, set->fallback, &set->variants[set->fallback]);
+        }
+
+        auto it = set->variants.find(key);
+        if (it == set->variants.end()) {
+            set->stats.misses += 1;
+            while (set->variants.size() >= set->budget) {
+                const size_t size = set->variants.size();
+                evict_one(set);
+                if (set->variants.size() == size) break;
+            }
+            it = set->variants.emplace(key, Variant {}).first;
+            start_build(set, key, &it->second);
+        }
+
+        Variant &variant = it->second;
+        variant.last_used = set->clock;
+        update(set, key, &variant);
+
+        if (variant.program.unwrap != 0) {
+            set->stats.hits += 1;
+            return variant.program;
+        }
+
+        set->stats.fallbacks += 1;
+        Variant &fallback = set->variants[set->fallback];
+        fallback.last_used = set->clock;
+        return fallback.program;
+    }
+
+    // Rebuilds every variant on its next use, e.g. after the sources
+    // changed. The builds that are already running are finished and
+    // then started again.
+    inline void invalidate(Set *set)
+    {
+        for (auto &it : set->variants) {
+            it.second.stale = true;
+            it.second.failed = false;
+        }
+    }
+
+    inline void destroy(Set *set)
+    {
+        for (auto &it : set->variants) {
+            Variant &variant = it.second;
+            if (variant.building &&
+                gl_source::poll_program(&variant.build, false) == gl_source::Build_Status::Done) {
+                gl_source::delete_program(set->shaders, variant.build.program,
+                                          variant.build.vert, variant.build.frag);
+            }
+            gl_source::delete_program(set->shaders, variant.program, variant.vert, variant.frag);
+        }
+        set->variants.clear();
+    }
+}
+
+#endif  // GL_VARIANTS_HPP
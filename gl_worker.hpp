@@ -0,0 +1,233 @@
+#ifndef GL_WORKER_HPP
+#define GL_WORKER_HPP
+
+// Background resource creation on worker threads with their own EGL
+// contexts, shared with the render context, so streaming a level in
+// never blocks the render loop on uploads or shader links.
+//
+//     gl_worker::Pool pool = {};
+//     gl_worker::start(&pool, render_context, 2, 3, 3);
+//     gl_worker::submit(&pool, [=] {
+//         ... on a worker: genBuffer, bufferData, linkProgram ...
+//     }, [=] {
+//         ... back on the render thread: the objects are ready to use ...
+//     });
+//     while (running) {
+//         gl_worker::poll(&pool);
+//         ... render ...
+//     }
+//     gl_worker::stop(&pool);
+//
+// After every job the worker inserts a fence and flushes. poll hands a
+// job over to the render thread only once its fence has signaled, and
+// waits on it with a zero timeout, which is what GL asks for before a
+// context may use what another one created. Neither thread ever blocks
+// on the GPU. Like in any context the objects must be bound again in
+// the render context before their new contents are guaranteed to show.
+//
+// Vertex arrays, framebuffers, transform feedbacks and queries are not
+// shared between contexts: create them on the render thread.
+//
+// Debug builds assert that every call happens on the right thread.
+//
+// Include it after the GL headers, gl.hpp, gl_frame.hpp and
+// gl_egl.hpp. Link with -pthread.
+
+#include <cassert>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gl_worker
+{
+    struct Job
+    {
+        // On a worker thread, with its context current
+        std::function<void()> create;
+        // On the render thread once the GPU is done with `create`
+        std::function<void()> ready;
+        gl::Fence fence;
+    };
+
+    struct Stats
+    {
+        size_t submitted;
+        size_t handed_over;
+        // Seconds the workers spent in the jobs, off the render thread
+        double create_time_total;
+        double create_time_max;
+    };
+
+    struct Pool
+    {
+        gl_egl::Context render;
+        std::thread::id render_thread;
+        std::vector<gl_egl::Context> contexts;
+        std::vector<std::thread> threads;
+
+        std::mutex mutex;
+        std::condition_variable wake;
+        // Guarded by mutex
+        std::deque<Job> queued;
+        std::deque<Job> created;
+        bool stopping;
+        Stats stats;
+
+        // Only touched by the render thread: the jobs that are waiting
+        // for their fence, in order
+        std::deque<Job> fenced;
+    };
+
+    inline void assert_render_thread(const Pool &pool)
+    {
+        (void) pool;
+        assert(std::this_thread::get_id() == pool.render_thread);
+        assert(gl_egl::is_current(pool.render));
+    }
+
+    inline void worker_thread(Pool *pool, gl_egl::Context context)
+    {
+        if (!gl_egl::make_current(context)) {
+            fprintf(stderr, "Could not make a worker context current\n");
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(pool->mutex);
+        for (;;) {
+            pool->wake.wait(lock, [&] { return pool->stopping || !pool->queued.empty(); });
+            if (pool->stopping) break;
+
+            Job job = std::move(pool->queued.front());
+            pool->queued.pop_front();
+            lock.unlock();
+
+            assert(gl_egl::is_current(context));
+            const double start = gl_frame::now_secs();
+            job.create();
+            job.fence = gl::fenceSync();
+            // The fence must reach the GPU or the render thread would
+            // wait for it forever
+            glFlush();
+            const double create_time = gl_frame::now_secs() - start;
+
+            lock.lock();
+            pool->created.push_back(std::move(job));
+            pool->stats.create_time_total += create_time;
+            if (create_time > pool->stats.create_time_max) pool->stats.create_time_max = create_time;
+        }
+        lock.unlock();
+
+        gl_egl::release_current(context);
+    }
+
+    // On the render thread, with `render` current. Creates `count`
+    // worker contexts of version `major`.`minor` that share its objects.
+    inline bool start(Pool *pool, gl_egl::Context render, size_t count, EGLint major, EGLint minor)
+    {
+        pool->render = render;
+        pool->render_thread = std::this_thread::get_id();
+        assert_render_thread(*pool);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto context = gl_egl::create_shared_context(render, major, minor);
+            if (!context.has_value) return false;
+            pool->contexts.push_back(context.unwrap);
+        }
+        for (auto context : pool->contexts) {
+            pool->threads.emplace_back(worker_thread, pool, context);
+        }
+        return true;
+    }
+
+    // On the render thread. The jobs run in any order on any worker.
+    inline void submit(Pool *pool, std::function<void()> create, std::function<void()> ready)
+    {
+        assert_render_thread(*pool);
+
+        Job job;
+        job.create = std::move(create);
+        job.ready = std::move(ready);
+        {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            pool->queued.push_back(std::move(job));
+            pool->stats.submitted += 1;
+        }
+        pool->wake.notify_one();
+    }
+
+    // On the render thread, every frame. Calls `ready` of the jobs whose
+    // objects the GPU is done with and returns how many. Never waits for
+    // the workers or the GPU.
+    inline size_t poll(Pool *pool)
+    {
+        assert_render_thread(*pool);
+
+        {
+            std::unique_lock<std::mutex> lock(pool->mutex, std::try_to_lock);
+            if (lock.owns_lock()) {
+                for (auto &job : pool->created) pool->fenced.push_back(std::move(job));
+                pool->created.clear();
+            }
+        }
+
+        size_t handed_over = 0;
+        for (auto it = pool->fenced.begin(); it != pool->fenced.end(); ) {
+            if (gl::clientWaitSync(it->fence, false, 0) == gl::Wait_Result::TIMEOUT_EXPIRED) {
+                ++it;
+                continue;
+            }
+            it->fence.reset();
+            it->ready();
+            it = pool->fenced.erase(it);
+            handed_over += 1;
+        }
+
+        if (handed_over > 0) {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            pool->stats.handed_over += handed_over;
+        }
+        return handed_over;
+    }
+
+    // Jobs submitted and not handed over yet
+    inline size_t in_flight(Pool *pool)
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        return pool->stats.submitted - pool->stats.handed_over;
+    }
+
+    inline Stats stats(Pool *pool)
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        return pool->stats;
+    }
+
+    // On the render thread. The jobs that did not start are dropped, the
+    // objects of the ones that ran but were not handed over are leaked
+    // to the render context.
+    inline void stop(Pool *pool)
+    {
+        assert_render_thread(*pool);
+
+        {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            pool->stopping = true;
+            pool->queued.clear();
+        }
+        pool->wake.notify_all();
+        for (auto &thread : pool->threads) thread.join();
+        for (auto context : pool->contexts) gl_egl::destroy_shared_context(context);
+
+        pool->threads.clear();
+        pool->contexts.clear();
+        pool->created.clear();
+        pool->fenced.clear();
+    }
+}
+
+#endif  // GL_WORKER_HPP
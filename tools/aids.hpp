@@ -21,7 +21,7 @@
 //
 // ============================================================
 //
-// aids — 0.18.0 — std replacement for C++. Designed to aid developers
+// aids — 0.19.0 — std replacement for C++. Designed to aid developers
 // to a better programming experience.
 //
 // https://github.com/rexim/aids
@@ -30,6 +30,12 @@
 //
 // ChangeLog (https://semver.org/ is implied)
 //
+//   0.19.0 Arena
+//          Arena_Array
+//          Fix Dynamic_Array::concat() not expanding enough for big concats
+//          Format numbers with std::to_chars instead of snprintf/fprintf
+//          Write Pad and Caps in bulk instead of char by char
+//          Buffer all of the arguments of print() and println() into one fwrite
 //   0.18.0 Rename Args::pop() -> Args::shift()
 //          Add more details to Stretchy_Buffer deprecation message
 //   0.17.0 Dynamic_Array::concat()
@@ -82,6 +88,8 @@
 
 #include <cassert>
 #include <cctype>
+#include <charconv>
+#include <cstddef>
 #include <cerrno>
 #include <cstdint>
 #include <cstdio>
@@ -464,11 +472,160 @@ namespace aids
         }
 
         void concat(const T *items, size_t items_count)
+        {
+            while (size + items_count > capacity) {
+                expand_capacity();
+            }
+
+            memcpy(data + size, items, sizeof(T) * items_count);
+            size += items_count;
+        }
+
+        bool contains(T item)
+        {
+            for (size_t i = 0; i < size; ++i) {
+                if (item == data[i]) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // ARENA
+    ////////////////////////////////////////////////////////////
+
+    struct Arena_Region
+    {
+        Arena_Region *next;
+        size_t capacity;
+        size_t size;
+
+        char *data()
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+    };
+
+    struct Arena
+    {
+        size_t region_capacity;
+        Arena_Region *first;
+        Arena_Region *last;
+
+        static size_t align_up(size_t x, size_t align)
+        {
+            return (x + align - 1) & ~(align - 1);
+        }
+
+        void *alloc(size_t n, size_t align = alignof(max_align_t))
+        {
+            while (last) {
+                // The address is aligned, not the offset: data() is
+                // only as aligned as the end of the header.
+                const uintptr_t data = reinterpret_cast<uintptr_t>(last->data());
+                const size_t begin = align_up(data + last->size, align) - data;
+                if (begin + n <= last->capacity) {
+                    last->size = begin + n;
+                    return last->data() + begin;
+                }
+
+                if (!last->next) break;
+                last = last->next;
+                last->size = 0;
+            }
+
+            const size_t default_capacity = region_capacity ? region_capacity : 64 * 1024;
+            const size_t capacity = max(default_capacity, n + align);
+            auto region = (Arena_Region*) malloc(sizeof(Arena_Region) + capacity);
+            assert(region);
+            region->next = NULL;
+            region->capacity = capacity;
+            region->size = 0;
+
+            if (last) {
+                last->next = region;
+            } else {
+                first = region;
+            }
+            last = region;
+
+            return alloc(n, align);
+        }
+
+        // Grows the allocation in place if it is the last one in the
+        // current region, otherwise moves it to a new place in the
+        // arena. The old memory is not reclaimed until reset().
+        void *realloc(void *old_data, size_t old_size, size_t new_size, size_t align = alignof(max_align_t))
+        {
+            if (old_data && last &&
+                static_cast<char*>(old_data) + old_size == last->data() + last->size &&
+                static_cast<size_t>(static_cast<char*>(old_data) - last->data()) + new_size <= last->capacity) {
+                last->size += new_size - old_size;
+                return old_data;
+            }
+
+            void *new_data = alloc(new_size, align);
+            if (old_data) {
+                memcpy(new_data, old_data, min(old_size, new_size));
+            }
+            return new_data;
+        }
+
+        // Keeps all of the regions around for reuse
+        void reset()
+        {
+            last = first;
+            if (last) last->size = 0;
+        }
+
+        void free_all()
+        {
+            while (first) {
+                auto next = first->next;
+                free(first);
+                first = next;
+            }
+            last = NULL;
+        }
+    };
+
+    // Same as Dynamic_Array but takes its memory from an Arena, which
+    // makes it cheap to create lots of short lived arrays and drop
+    // them all at once with Arena::reset().
+    template <typename T>
+    struct Arena_Array
+    {
+        Arena *arena;
+        size_t capacity;
+        size_t size;
+        T *data;
+
+        void expand_capacity()
+        {
+            const size_t new_capacity = data ? 2 * capacity : 256;
+            data = (T*)arena->realloc((void*)data, capacity * sizeof(T), new_capacity * sizeof(T), alignof(T));
+            capacity = new_capacity;
+        }
+
+        void push(T item)
         {
             while (size + 1 > capacity) {
                 expand_capacity();
             }
 
+            memcpy(data + size, &item, sizeof(T));
+            size += 1;
+        }
+
+        void concat(const T *items, size_t items_count)
+        {
+            while (size + items_count > capacity) {
+                expand_capacity();
+            }
+
             memcpy(data + size, items, sizeof(T) * items_count);
             size += items_count;
         }
@@ -568,76 +725,71 @@ namespace aids
         }
     };
 
-    void sprint1(String_Buffer *buffer, const char *cstr)
+    void sprint1(String_Buffer *buffer, String_View view)
     {
-        int n = snprintf(
-            buffer->data + buffer->size,
-            buffer->capacity - buffer->size,
-            "%s", cstr);
-        buffer->size = min(buffer->size + n, buffer->capacity - 1);
+        const size_t n = min(view.count, buffer->capacity - buffer->size - 1);
+        memcpy(buffer->data + buffer->size, view.data, n);
+        buffer->size += n;
+        buffer->data[buffer->size] = '\0';
     }
 
-    void sprint1(String_Buffer *buffer, String_View view)
+    void sprint1(String_Buffer *buffer, const char *cstr)
     {
-        int n = snprintf(
-            buffer->data + buffer->size,
-            buffer->capacity - buffer->size,
-            "%.*s", (int) view.count, view.data);
-        buffer->size = min(buffer->size + n, buffer->capacity - 1);
+        sprint1(buffer, cstr_as_string_view(cstr));
     }
 
     void sprint1(String_Buffer *buffer, char c)
     {
-        int n = snprintf(
-            buffer->data + buffer->size,
-            buffer->capacity - buffer->size,
-            "%c", c);
-        buffer->size = min(buffer->size + n, buffer->capacity - 1);
+        sprint1(buffer, String_View {1, &c});
+    }
+
+    // Big enough for any integer and for "%f" of any float
+    const size_t NUMBER_CHARS_CAPACITY = 64;
+
+    template <typename Number>
+    String_View number_as_chars(char (&chars)[NUMBER_CHARS_CAPACITY], Number x)
+    {
+        auto result = std::to_chars(chars, chars + NUMBER_CHARS_CAPACITY, x);
+        assert(result.ec == std::errc());
+        return {static_cast<size_t>(result.ptr - chars), chars};
+    }
+
+    // Same as "%f"
+    String_View number_as_chars(char (&chars)[NUMBER_CHARS_CAPACITY], float x)
+    {
+        auto result = std::to_chars(chars, chars + NUMBER_CHARS_CAPACITY, x, std::chars_format::fixed, 6);
+        assert(result.ec == std::errc());
+        return {static_cast<size_t>(result.ptr - chars), chars};
     }
 
     void sprint1(String_Buffer *buffer, float f)
     {
-        int n = snprintf(
-            buffer->data + buffer->size,
-            buffer->capacity - buffer->size,
-            "%f", f);
-        buffer->size = min(buffer->size + n, buffer->capacity - 1);
+        char chars[NUMBER_CHARS_CAPACITY];
+        sprint1(buffer, number_as_chars(chars, f));
     }
 
     void sprint1(String_Buffer *buffer, unsigned long long x)
     {
-        int n = snprintf(
-            buffer->data + buffer->size,
-            buffer->capacity - buffer->size,
-            "%llu", x);
-        buffer->size = min(buffer->size + n, buffer->capacity - 1);
+        char chars[NUMBER_CHARS_CAPACITY];
+        sprint1(buffer, number_as_chars(chars, x));
     }
 
     void sprint1(String_Buffer *buffer, long unsigned int x)
     {
-        int n = snprintf(
-            buffer->data + buffer->size,
-            buffer->capacity - buffer->size,
-            "%lu", x);
-        buffer->size = min(buffer->size + n, buffer->capacity - 1);
+        char chars[NUMBER_CHARS_CAPACITY];
+        sprint1(buffer, number_as_chars(chars, x));
     }
 
     void sprint1(String_Buffer *buffer, int x)
     {
-        int n = snprintf(
-            buffer->data + buffer->size,
-            buffer->capacity - buffer->size,
-            "%d", x);
-        buffer->size = min(buffer->size + n, buffer->capacity - 1);
+        char chars[NUMBER_CHARS_CAPACITY];
+        sprint1(buffer, number_as_chars(chars, x));
     }
 
     void sprint1(String_Buffer *buffer, long int x)
     {
-        int n = snprintf(
-            buffer->data + buffer->size,
-            buffer->capacity - buffer->size,
-            "%ld", x);
-        buffer->size = min(buffer->size + n, buffer->capacity - 1);
+        char chars[NUMBER_CHARS_CAPACITY];
+        sprint1(buffer, number_as_chars(chars, x));
     }
 
     void sprint1(String_Buffer *buffer, bool b)
@@ -676,9 +828,10 @@ namespace aids
 
     void sprint1(String_Buffer *buffer, Pad pad)
     {
-        for (size_t i = 0; i < pad.n; ++i) {
-            sprint1(buffer, pad.c);
-        }
+        const size_t n = min(pad.n, buffer->capacity - buffer->size - 1);
+        memset(buffer->data + buffer->size, pad.c, n);
+        buffer->size += n;
+        buffer->data[buffer->size] = '\0';
     }
 
     struct Caps
@@ -719,38 +872,38 @@ namespace aids
 
     void print1(FILE *stream, float f)
     {
-        fprintf(stream, "%f", f);
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(stream, number_as_chars(chars, f));
     }
 
     void print1(FILE *stream, unsigned long long x)
     {
-        fprintf(stream, "%llu", x);
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(stream, number_as_chars(chars, x));
     }
 
     void print1(FILE *stream, long unsigned int x)
     {
-        fprintf(stream, "%lu", x);
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(stream, number_as_chars(chars, x));
     }
 
     void print1(FILE *stream, unsigned int x)
     {
-        fprintf(stream, "%u", x);
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(stream, number_as_chars(chars, x));
     }
 
     void print1(FILE *stream, int x)
     {
-        fprintf(stream, "%d", x);
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(stream, number_as_chars(chars, x));
     }
 
     void print1(FILE *stream, long int x)
     {
-        fprintf(stream, "%ld", x);
-    }
-
-    template <typename ... Types>
-    void print(FILE *stream, Types... args)
-    {
-        (print1(stream, args), ...);
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(stream, number_as_chars(chars, x));
     }
 
     void print1(FILE *stream, bool b)
@@ -758,6 +911,9 @@ namespace aids
         print1(stream, b ? "true" : "false");
     }
 
+    template <typename ... Types>
+    void print(FILE *stream, Types... args);
+
     template <typename T>
     void print1(FILE *stream, Maybe<T> maybe)
     {
@@ -768,24 +924,31 @@ namespace aids
         }
     }
 
-    template <typename ... Types>
-    void println(FILE *stream, Types... args)
-    {
-        (print1(stream, args), ...);
-        print1(stream, '\n');
-    }
+    const size_t PRINT_CHUNK_CAPACITY = 256;
 
     void print1(FILE *stream, Pad pad)
     {
-        for (size_t i = 0; i < pad.n; ++i) {
-            fputc(pad.c, stream);
+        char chunk[PRINT_CHUNK_CAPACITY];
+        memset(chunk, pad.c, min(pad.n, sizeof(chunk)));
+
+        for (size_t n = pad.n; n > 0; ) {
+            const size_t m = min(n, sizeof(chunk));
+            fwrite(chunk, 1, m, stream);
+            n -= m;
         }
     }
 
     void print1(FILE *stream, Caps caps)
     {
-        for (size_t i = 0; i < caps.unwrap.count; ++i) {
-            print1(stream, (char) toupper(caps.unwrap.data[i]));
+        char chunk[PRINT_CHUNK_CAPACITY];
+
+        for (String_View view = caps.unwrap; view.count > 0; ) {
+            const size_t m = min(view.count, sizeof(chunk));
+            for (size_t i = 0; i < m; ++i) {
+                chunk[i] = (char) toupper(view.data[i]);
+            }
+            fwrite(chunk, 1, m, stream);
+            view.chop(m);
         }
     }
 
@@ -794,6 +957,166 @@ namespace aids
         print1(stream, buffer.view());
     }
 
+    // print() and println() format all of their arguments into one of
+    // these on the stack and hand it to the stream with a single fwrite,
+    // instead of locking the stream for every argument.
+    struct Print_Buffer
+    {
+        FILE *stream;
+        size_t size;
+        char data[4 * PRINT_CHUNK_CAPACITY];
+
+        void flush()
+        {
+            if (size > 0) {
+                fwrite(data, 1, size, stream);
+                size = 0;
+            }
+        }
+
+        void write(const char *bytes, size_t n)
+        {
+            if (size + n > sizeof(data)) {
+                flush();
+                if (n > sizeof(data)) {
+                    fwrite(bytes, 1, n, stream);
+                    return;
+                }
+            }
+            memcpy(data + size, bytes, n);
+            size += n;
+        }
+    };
+
+    // Whatever has no overload of its own is printed by its print1()
+    // for FILE*, after what is buffered so far.
+    template <typename T>
+    void print1(Print_Buffer *buffer, T x)
+    {
+        buffer->flush();
+        print1(buffer->stream, x);
+    }
+
+    void print1(Print_Buffer *buffer, String_View view)
+    {
+        buffer->write(view.data, view.count);
+    }
+
+    void print1(Print_Buffer *buffer, const char *s)
+    {
+        buffer->write(s, strlen(s));
+    }
+
+    void print1(Print_Buffer *buffer, char *s)
+    {
+        buffer->write(s, strlen(s));
+    }
+
+    void print1(Print_Buffer *buffer, char c)
+    {
+        buffer->write(&c, 1);
+    }
+
+    void print1(Print_Buffer *buffer, bool b)
+    {
+        print1(buffer, b ? "true" : "false");
+    }
+
+    void print1(Print_Buffer *buffer, float f)
+    {
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(buffer, number_as_chars(chars, f));
+    }
+
+    void print1(Print_Buffer *buffer, unsigned long long x)
+    {
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(buffer, number_as_chars(chars, x));
+    }
+
+    void print1(Print_Buffer *buffer, long unsigned int x)
+    {
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(buffer, number_as_chars(chars, x));
+    }
+
+    void print1(Print_Buffer *buffer, unsigned int x)
+    {
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(buffer, number_as_chars(chars, x));
+    }
+
+    void print1(Print_Buffer *buffer, int x)
+    {
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(buffer, number_as_chars(chars, x));
+    }
+
+    void print1(Print_Buffer *buffer, long int x)
+    {
+        char chars[NUMBER_CHARS_CAPACITY];
+        print1(buffer, number_as_chars(chars, x));
+    }
+
+    template <typename T>
+    void print1(Print_Buffer *buffer, Maybe<T> maybe)
+    {
+        if (!maybe.has_value) {
+            print1(buffer, "None");
+        } else {
+            print1(buffer, "Some(");
+            print1(buffer, maybe.unwrap);
+            print1(buffer, ")");
+        }
+    }
+
+    void print1(Print_Buffer *buffer, Pad pad)
+    {
+        char chunk[PRINT_CHUNK_CAPACITY];
+        memset(chunk, pad.c, min(pad.n, sizeof(chunk)));
+
+        for (size_t n = pad.n; n > 0; ) {
+            const size_t m = min(n, sizeof(chunk));
+            buffer->write(chunk, m);
+            n -= m;
+        }
+    }
+
+    void print1(Print_Buffer *buffer, Caps caps)
+    {
+        char chunk[PRINT_CHUNK_CAPACITY];
+
+        for (String_View view = caps.unwrap; view.count > 0; ) {
+            const size_t m = min(view.count, sizeof(chunk));
+            for (size_t i = 0; i < m; ++i) {
+                chunk[i] = (char) toupper(view.data[i]);
+            }
+            buffer->write(chunk, m);
+            view.chop(m);
+        }
+    }
+
+    void print1(Print_Buffer *buffer, String_Buffer another_buffer)
+    {
+        print1(buffer, another_buffer.view());
+    }
+
+    template <typename ... Types>
+    void print(FILE *stream, Types... args)
+    {
+        Print_Buffer buffer;
+        buffer.stream = stream;
+        buffer.size = 0;
+        (print1(&buffer, args), ...);
+        buffer.flush();
+    }
+
+    template <typename ... Types>
+    void println(FILE *stream, Types... args)
+    {
+        print(stream, args..., '\n');
+    }
+
     ////////////////////////////////////////////////////////////
     // UTF-8
     ////////////////////////////////////////////////////////////
@@ -0,0 +1,219 @@
+// Microbenchmark of the aids containers and formatting against the
+// implementations they replaced in 0.19.0.
+
+#include <ctime>
+#include "aids.hpp"
+
+using namespace aids;
+
+namespace old
+{
+    template <typename T>
+    struct Dynamic_Array
+    {
+        size_t capacity;
+        size_t size;
+        T *data;
+
+        void expand_capacity()
+        {
+            capacity = data ? 2 * capacity : 256;
+            data = (T*)realloc((void*)data, capacity * sizeof(T));
+        }
+
+        void push(T item)
+        {
+            while (size + 1 > capacity) {
+                expand_capacity();
+            }
+
+            memcpy(data + size, &item, sizeof(T));
+            size += 1;
+        }
+    };
+
+    void sprint1(String_Buffer *buffer, int x)
+    {
+        int n = snprintf(
+            buffer->data + buffer->size,
+            buffer->capacity - buffer->size,
+            "%d", x);
+        buffer->size = min(buffer->size + n, buffer->capacity - 1);
+    }
+
+    void sprint1(String_Buffer *buffer, String_View view)
+    {
+        int n = snprintf(
+            buffer->data + buffer->size,
+            buffer->capacity - buffer->size,
+            "%.*s", (int) view.count, view.data);
+        buffer->size = min(buffer->size + n, buffer->capacity - 1);
+    }
+
+    void print1(FILE *stream, int x)
+    {
+        fprintf(stream, "%d", x);
+    }
+
+    void print1(FILE *stream, float f)
+    {
+        fprintf(stream, "%f", f);
+    }
+
+    void print1(FILE *stream, Pad pad)
+    {
+        for (size_t i = 0; i < pad.n; ++i) {
+            fputc(pad.c, stream);
+        }
+    }
+
+    template <typename ... Types>
+    void println(FILE *stream, Types... args)
+    {
+        (aids::print1(stream, args), ...);
+        aids::print1(stream, '\n');
+    }
+}
+
+const size_t ITERATIONS = 1000 * 1000;
+
+double now_secs()
+{
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+size_t name_width_padding(const char *name)
+{
+    const size_t WIDTH = 32;
+    const size_t n = strlen(name);
+    return n > WIDTH ? 1 : WIDTH - n;
+}
+
+template <typename Body>
+void bench(const char *name, Body body)
+{
+    const double start = now_secs();
+    body();
+    const double ns_per_iteration = (now_secs() - start) * 1e9 / (double) ITERATIONS;
+    println(stdout, name, Pad {name_width_padding(name), ' '}, (float) ns_per_iteration, " ns/op");
+}
+
+int main()
+{
+    FILE *null = fopen("/dev/null", "wb");
+    assert(null);
+
+    const size_t ARRAYS_COUNT = 1000;
+    const size_t ARRAY_SIZE = ITERATIONS / ARRAYS_COUNT;
+
+    bench("old::Dynamic_Array::push", [&]() {
+        for (size_t i = 0; i < ARRAYS_COUNT; ++i) {
+            old::Dynamic_Array<int> xs = {};
+            for (size_t j = 0; j < ARRAY_SIZE; ++j) xs.push((int) j);
+            free(xs.data);
+        }
+    });
+
+    bench("Dynamic_Array::push", [&]() {
+        for (size_t i = 0; i < ARRAYS_COUNT; ++i) {
+            Dynamic_Array<int> xs = {};
+            for (size_t j = 0; j < ARRAY_SIZE; ++j) xs.push((int) j);
+            free(xs.data);
+        }
+    });
+
+    bench("Arena_Array::push", [&]() {
+        Arena arena = {};
+        for (size_t i = 0; i < ARRAYS_COUNT; ++i) {
+            Arena_Array<int> xs = {&arena, 0, 0, NULL};
+            for (size_t j = 0; j < ARRAY_SIZE; ++j) xs.push((int) j);
+            arena.reset();
+        }
+        arena.free_all();
+    });
+
+    {
+        Arena arena = {};
+        for (size_t i = 0; i < 16; ++i) {
+            arena.alloc(1 + i, 1);
+            Arena_Array<long double> xs = {&arena, 0, 0, NULL};
+            xs.push(0.0L);
+            assert(reinterpret_cast<uintptr_t>(xs.data) % alignof(long double) == 0);
+        }
+        arena.free_all();
+    }
+
+    char data[1024];
+    String_Buffer buffer = {sizeof(data), data, 0};
+
+    bench("old::sprint1(int)", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            buffer.size = 0;
+            old::sprint1(&buffer, (int) i);
+        }
+    });
+
+    bench("sprint1(int)", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            buffer.size = 0;
+            sprint1(&buffer, (int) i);
+        }
+    });
+
+    bench("old::sprint1(String_View)", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            buffer.size = 0;
+            old::sprint1(&buffer, "GL_TEXTURE_CUBE_MAP_POSITIVE_X"_sv);
+        }
+    });
+
+    bench("sprint1(String_View)", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            buffer.size = 0;
+            sprint1(&buffer, "GL_TEXTURE_CUBE_MAP_POSITIVE_X"_sv);
+        }
+    });
+
+    bench("old::print1(int)", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) old::print1(null, (int) i);
+    });
+
+    bench("print1(int)", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) print1(null, (int) i);
+    });
+
+    bench("old::print1(float)", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) old::print1(null, (float) i * 0.001f);
+    });
+
+    bench("print1(float)", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) print1(null, (float) i * 0.001f);
+    });
+
+    bench("old::print1(Pad {32})", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) old::print1(null, Pad {32, ' '});
+    });
+
+    bench("print1(Pad {32})", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) print1(null, Pad {32, ' '});
+    });
+
+    // A line of `spec gl.xml commands`
+    bench("old::println(...)", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            old::println(null, "// ", "gl.xml", ":", (long int) i, ": ", "glDrawElementsBaseVertex"_sv);
+        }
+    });
+
+    bench("println(...)", [&]() {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            println(null, "// ", "gl.xml", ":", (long int) i, ": ", "glDrawElementsBaseVertex"_sv);
+        }
+    });
+
+    fclose(null);
+
+    return 0;
+}
@@ -0,0 +1,494 @@
+// Build-time reflection of the GLSL shader interfaces.
+//
+// Reads the global `in` declarations of the vertex shaders and the
+// `uniform` declarations of both stages and generates a C++ struct per
+// program with their locations as compile-time constants:
+//
+//     namespace shaders
+//     {
+//         struct Epic
+//         {
+//             ...
+//             // layout(location = 1) uniform float u_time;
+//             static constexpr gl::Typed_Uniform<GLfloat> u_time = {{1}};
+//         };
+//     }
+//
+// so the C++ code binds nothing by name at runtime, and uploading a
+// value of the wrong type to a uniform is a compile error. Every
+// declaration must have an explicit `layout(location = N)`
+// (GL_ARB_explicit_attrib_location, GL_ARB_explicit_uniform_location).
+// `#include "file"` is followed like gl_source.hpp does.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+#include "aids.hpp"
+
+#define ARRAY_LEN(xs) (sizeof(xs) / sizeof(xs[0]))
+
+using namespace aids;
+
+struct Glsl_Type
+{
+    String_View glsl;
+    // The T of gl::Typed_Uniform<T>, empty if gl.hpp has no typed
+    // gl::uniform() overload for it yet
+    String_View uniform;
+    // The gl::Attribute_Size of a vertex attribute of this type, empty
+    // if it cannot be one
+    String_View attribute_size;
+    bool integer;
+};
+
+const Glsl_Type glsl_types[] = {
+    {"float"_sv,     "GLfloat"_sv,   "ONE"_sv,   false},
+    {"vec2"_sv,      "gl::Vec2f"_sv, "TWO"_sv,   false},
+    {"vec3"_sv,      "gl::Vec3f"_sv, "THREE"_sv, false},
+    {"vec4"_sv,      "gl::Vec4f"_sv, "FOUR"_sv,  false},
+    {"int"_sv,       "GLint"_sv,     "ONE"_sv,   true},
+    {"ivec2"_sv,     "gl::Vec2i"_sv, "TWO"_sv,   true},
+    {"ivec3"_sv,     "gl::Vec3i"_sv, "THREE"_sv, true},
+    {"ivec4"_sv,     "gl::Vec4i"_sv, "FOUR"_sv,  true},
+    {"uint"_sv,      "GLuint"_sv,    "ONE"_sv,   true},
+    {"bool"_sv,      "GLint"_sv,     ""_sv,      false},
+    {"mat2"_sv,      "gl::Mat2f"_sv, ""_sv,      false},
+    {"mat3"_sv,      "gl::Mat3f"_sv, ""_sv,      false},
+    {"mat4"_sv,      "gl::Mat4f"_sv, ""_sv,      false},
+    {"sampler2D"_sv, "GLint"_sv,     ""_sv,      false},
+};
+
+const Glsl_Type *find_glsl_type(String_View name)
+{
+    for (size_t i = 0; i < ARRAY_LEN(glsl_types); ++i) {
+        if (glsl_types[i].glsl == name) return &glsl_types[i];
+    }
+    return nullptr;
+}
+
+enum class Storage
+{
+    In,
+    Uniform,
+};
+
+struct Declaration
+{
+    Storage storage;
+    long location;
+    String_View type;
+    String_View name;
+    long array_size;            // 0 if it is not an array
+    const char *file_path;
+    size_t line;
+};
+
+struct Token
+{
+    String_View text;
+    const char *file_path;
+    size_t line;
+};
+
+[[noreturn]]
+void fail_at(const char *file_path, size_t line, String_View message)
+{
+    println(stderr, file_path, ":", line, ": [ERROR] ", message);
+    exit(1);
+}
+
+bool is_ident_char(char c)
+{
+    return isalnum(c) || c == '_';
+}
+
+// Splits the GLSL source into identifiers, numbers and single
+// punctuation characters. Comments are dropped. Preprocessor lines are
+// dropped too, except for #include which is followed. Like in
+// gl_source.hpp every file is included at most once, include cycles
+// and files included by several others too. `include_stack` holds
+// the files being tokenized, outermost first.
+void tokenize(const char *file_path, std::vector<Token> *tokens,
+              std::vector<std::string> *include_stack, std::set<std::string> *included)
+{
+    if (!included->insert(file_path).second) return;
+
+    auto maybe_source = read_file_as_string_view(file_path);
+    if (!maybe_source.has_value) {
+        println(stderr, "[ERROR] Could not read file `", file_path, "`: ", strerror(errno));
+        for (size_t i = include_stack->size(); i > 0; --i) {
+            println(stderr, "    included from `", (*include_stack)[i - 1].c_str(), "`");
+        }
+        exit(1);
+    }
+    include_stack->push_back(file_path);
+    // The tokens point into the source, so it lives until the exit
+    String_View source = maybe_source.unwrap;
+
+    size_t line = 1;
+    bool line_start = true;
+    while (source.count > 0) {
+        const char c = *source.data;
+
+        if (c == '\n') {
+            line += 1;
+            line_start = true;
+            source.chop(1);
+        } else if (isspace(c)) {
+            source.chop(1);
+        } else if (source.has_prefix("//"_sv)) {
+            source.chop_by_delim('\n');
+            line += 1;
+            line_start = true;
+        } else if (source.has_prefix("/*"_sv)) {
+            source.chop(2);
+            while (source.count > 0 && !source.has_prefix("*/"_sv)) {
+                if (*source.data == '\n') line += 1;
+                source.chop(1);
+            }
+            source.chop(2);
+        } else if (c == '#' && line_start) {
+            String_View directive = source.chop_by_delim('\n');
+            directive.chop(1);
+            directive = directive.trim();
+            const size_t directive_line = line;
+            line += 1;
+
+            if (directive.has_prefix("include"_sv)) {
+                directive.chop(strlen("include"));
+                directive = directive.trim();
+                if (directive.count < 2 || directive.data[0] != '"' || directive.data[directive.count - 1] != '"') {
+                    fail_at(file_path, directive_line, "expected #include \"file\""_sv);
+                }
+                directive.chop(1);
+                directive.chop_back(1);
+
+                std::string include_path = file_path;
+                const size_t slash = include_path.rfind('/');
+                include_path = slash == std::string::npos ? std::string() : include_path.substr(0, slash + 1);
+                include_path.append(directive.data, directive.count);
+                // The tokens point to it, so it lives until the exit too
+                tokenize(strdup(include_path.c_str()), tokens, include_stack, included);
+            }
+        } else if (is_ident_char(c)) {
+            size_t n = 0;
+            while (n < source.count && (is_ident_char(source.data[n]) || source.data[n] == '.')) ++n;
+            tokens->push_back({{n, source.data}, file_path, line});
+            source.chop(n);
+            line_start = false;
+        } else {
+            tokens->push_back({{1, source.data}, file_path, line});
+            source.chop(1);
+            line_start = false;
+        }
+    }
+
+    include_stack->pop_back();
+}
+
+// Interprets one global statement (the tokens up to its `;`) and adds
+// it to `declarations` if it is a `uniform` declaration or, with
+// `vertex`, an `in` declaration. The `in` of the other stages are not
+// vertex attributes.
+void parse_statement(bool vertex, const Token *tokens, size_t count,
+                     std::vector<Declaration> *declarations)
+{
+    if (count == 0) return;
+
+    const char *file_path = tokens[0].file_path;
+    Declaration declaration = {};
+    declaration.location = -1;
+    declaration.file_path = file_path;
+    declaration.line = tokens[0].line;
+
+    size_t i = 0;
+    bool has_storage = false;
+    while (i < count) {
+        const String_View word = tokens[i].text;
+
+        if (word == "layout"_sv) {
+            // layout(location = N)
+            if (i + 1 >= count || tokens[i + 1].text != "("_sv) {
+                fail_at(file_path, tokens[i].line, "expected `(` after `layout`"_sv);
+            }
+            i += 2;
+            while (i < count && tokens[i].text != ")"_sv) {
+                if (tokens[i].text == "location"_sv && i + 2 < count && tokens[i + 1].text == "="_sv) {
+                    auto location = tokens[i + 2].text.as_integer<long>();
+                    if (!location.has_value) {
+                        fail_at(file_path, tokens[i].line, "location is not a number"_sv);
+                    }
+                    declaration.location = location.unwrap;
+                    i += 3;
+                } else {
+                    i += 1;
+                }
+            }
+            i += 1;
+        } else if (word == "in"_sv || word == "attribute"_sv) {
+            declaration.storage = Storage::In;
+            has_storage = true;
+            i += 1;
+        } else if (word == "uniform"_sv) {
+            declaration.storage = Storage::Uniform;
+            has_storage = true;
+            i += 1;
+        } else if (word == "flat"_sv || word == "smooth"_sv || word == "noperspective"_sv ||
+                   word == "highp"_sv || word == "mediump"_sv || word == "lowp"_sv ||
+                   word == "invariant"_sv || word == "centroid"_sv) {
+            i += 1;
+        } else {
+            break;
+        }
+    }
+
+    if (!has_storage) return;
+    if (declaration.storage == Storage::In && !vertex) return;
+
+    if (i + 1 >= count) {
+        fail_at(file_path, declaration.line, "expected the type and the name of the declaration"_sv);
+    }
+    declaration.type = tokens[i].text;
+    declaration.name = tokens[i + 1].text;
+    i += 2;
+
+    if (i < count && tokens[i].text == "["_sv) {
+        auto size = i + 1 < count ? tokens[i + 1].text.as_integer<long>() : Maybe<long> {};
+        if (!size.has_value) {
+            fail_at(file_path, declaration.line, "array size must be a number"_sv);
+        }
+        declaration.array_size = size.unwrap;
+        i += 3;
+    }
+
+    if (i != count) {
+        fail_at(file_path, declaration.line, "only one declaration per statement is supported"_sv);
+    }
+
+    if (declaration.location < 0) {
+        println(stderr, file_path, ":", declaration.line, ": [ERROR] `", declaration.name,
+                "` has no layout(location = N)");
+        exit(1);
+    }
+
+    declarations->push_back(declaration);
+}
+
+std::vector<Declaration> parse_shader(const char *file_path, bool vertex)
+{
+    std::vector<Token> tokens;
+    std::vector<std::string> include_stack;
+    std::set<std::string> included;
+    tokenize(file_path, &tokens, &include_stack, &included);
+
+    std::vector<Declaration> declarations;
+    size_t depth = 0;
+    size_t statement = 0;
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        const String_View text = tokens[i].text;
+        if (text == "{"_sv || text == "("_sv) {
+            depth += 1;
+        } else if (text == "}"_sv || text == ")"_sv) {
+            if (depth > 0) depth -= 1;
+            // The end of a function body
+            if (depth == 0 && text == "}"_sv) statement = i + 1;
+        } else if (text == ";"_sv && depth == 0) {
+            parse_statement(vertex, &tokens[statement], i - statement, &declarations);
+            statement = i + 1;
+        }
+    }
+
+    return declarations;
+}
+
+struct Program
+{
+    String_View name;
+    const char *vert_path;
+    const char *frag_path;
+    std::vector<Declaration> attributes;
+    std::vector<Declaration> uniforms;
+};
+
+// An array uniform takes one location per element
+bool locations_overlap(const Declaration &a, const Declaration &b)
+{
+    const long a_end = a.location + std::max(a.array_size, 1L);
+    const long b_end = b.location + std::max(b.array_size, 1L);
+    return a.location < b_end && b.location < a_end;
+}
+
+void add_uniforms(Program *program, const std::vector<Declaration> &declarations)
+{
+    for (const auto &declaration : declarations) {
+        if (declaration.storage != Storage::Uniform) continue;
+
+        bool found = false;
+        for (const auto &uniform : program->uniforms) {
+            if (uniform.name == declaration.name) {
+                if (uniform.type != declaration.type ||
+                    uniform.location != declaration.location ||
+                    uniform.array_size != declaration.array_size) {
+                    println(stderr, declaration.file_path, ":", declaration.line, ": [ERROR] `",
+                            declaration.name, "` does not match its declaration at ",
+                            uniform.file_path, ":", uniform.line);
+                    exit(1);
+                }
+                found = true;
+            } else if (locations_overlap(uniform, declaration)) {
+                println(stderr, declaration.file_path, ":", declaration.line, ": [ERROR] `",
+                        declaration.name, "` has the same location as `", uniform.name, "` at ",
+                        uniform.file_path, ":", uniform.line);
+                exit(1);
+            }
+        }
+
+        if (!found) program->uniforms.push_back(declaration);
+    }
+}
+
+// <name>=<vertex shader>,<fragment shader>
+Program parse_program(char *arg)
+{
+    Program program = {};
+    char *equals = strchr(arg, '=');
+    char *comma = equals ? strchr(equals, ',') : nullptr;
+    if (!equals || !comma) {
+        println(stderr, "[ERROR] `", arg, "` is not <name>=<vertex shader>,<fragment shader>");
+        exit(1);
+    }
+    *equals = '\0';
+    *comma = '\0';
+    program.name = cstr_as_string_view(arg);
+    program.vert_path = equals + 1;
+    program.frag_path = comma + 1;
+
+    const auto vert = parse_shader(program.vert_path, true);
+    for (const auto &declaration : vert) {
+        if (declaration.storage == Storage::In) program.attributes.push_back(declaration);
+    }
+    add_uniforms(&program, vert);
+    add_uniforms(&program, parse_shader(program.frag_path, false));
+
+    return program;
+}
+
+void print_declaration_comment(FILE *stream, const Declaration &declaration)
+{
+    print(stream, "        // layout(location = ", declaration.location, ") ",
+          declaration.storage == Storage::In ? "in " : "uniform ",
+          declaration.type, " ", declaration.name);
+    if (declaration.array_size > 0) print(stream, "[", declaration.array_size, "]");
+    println(stream, ";");
+}
+
+void print_program(FILE *stream, const Program &program)
+{
+    println(stream, "    struct ", program.name);
+    println(stream, "    {");
+    println(stream, "        static constexpr const char *vert_path = \"", program.vert_path, "\";");
+    println(stream, "        static constexpr const char *frag_path = \"", program.frag_path, "\";");
+
+    for (const auto &attribute : program.attributes) {
+        const Glsl_Type *type = find_glsl_type(attribute.type);
+        if (!type || type->attribute_size.count == 0 || attribute.array_size > 0) {
+            println(stderr, attribute.file_path, ":", attribute.line, ": [ERROR] `", attribute.type,
+                    "` is not supported as a vertex attribute type");
+            exit(1);
+        }
+
+        println(stream);
+        print_declaration_comment(stream, attribute);
+        println(stream, "        static constexpr gl::Attribute_Location ", attribute.name,
+                " = {", attribute.location, "};");
+        println(stream, "        static constexpr gl::Attribute_Size ", attribute.name,
+                "_size = gl::Attribute_Size::", type->attribute_size, ";");
+        println(stream, "        static constexpr bool ", attribute.name,
+                "_integer = ", type->integer, ";");
+    }
+
+    for (const auto &uniform : program.uniforms) {
+        const Glsl_Type *type = find_glsl_type(uniform.type);
+
+        println(stream);
+        print_declaration_comment(stream, uniform);
+        if (type && type->uniform.count > 0 && uniform.array_size == 0) {
+            println(stream, "        static constexpr gl::Typed_Uniform<", type->uniform, "> ",
+                    uniform.name, " = {{", uniform.location, "}};");
+        } else if (type && type->uniform.count > 0) {
+            println(stream, "        static constexpr gl::Typed_Uniform<", type->uniform,
+                    "[", uniform.array_size, "]> ", uniform.name, " = {{", uniform.location, "}};");
+        } else {
+            println(stream, "        static constexpr gl::Uniform ", uniform.name,
+                    " = {", uniform.location, "};");
+        }
+    }
+
+    println(stream, "    };");
+}
+
+void usage(FILE *stream)
+{
+    println(stream, "Usage: reflect [--output <file>] <name>=<vertex shader>,<fragment shader>...");
+}
+
+int main(int argc, char *argv[])
+{
+    Args args = {argc, argv};
+    args.shift();
+
+    const char *output_path = nullptr;
+    if (!args.empty() && cstr_as_string_view(*args.argv) == "--output"_sv) {
+        args.shift();
+        if (args.empty()) {
+            println(stderr, "[ERROR] No value is provided for option `--output`");
+            usage(stderr);
+            exit(1);
+        }
+        output_path = args.shift();
+    }
+
+    if (args.empty()) {
+        println(stderr, "[ERROR] No programs are provided");
+        usage(stderr);
+        exit(1);
+    }
+
+    std::vector<Program> programs;
+    while (!args.empty()) {
+        programs.push_back(parse_program(args.shift()));
+    }
+
+    FILE *stream = stdout;
+    if (output_path) {
+        stream = fopen(output_path, "wb");
+        if (!stream) {
+            println(stderr, "[ERROR] Could not write file `", output_path, "`: ", strerror(errno));
+            exit(1);
+        }
+    }
+
+    println(stream, "// Generated by tools/reflect. Do not edit.");
+    println(stream, "#ifndef SHADERS_HPP");
+    println(stream, "#define SHADERS_HPP");
+    println(stream);
+    println(stream, "namespace shaders");
+    println(stream, "{");
+    for (size_t i = 0; i < programs.size(); ++i) {
+        if (i > 0) println(stream);
+        print_program(stream, programs[i]);
+    }
+    println(stream, "}");
+    println(stream);
+    println(stream, "#endif  // SHADERS_HPP");
+
+    if (output_path && fclose(stream) != 0) {
+        println(stderr, "[ERROR] Could not write file `", output_path, "`: ", strerror(errno));
+        exit(1);
+    }
+
+    return 0;
+}
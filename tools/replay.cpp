@@ -0,0 +1,765 @@
+// Replays a capture of gl_capture.hpp on a headless EGL context (Mesa
+// llvmpipe works fine) and reports how long every frame took on the CPU
+// and on the GPU, so a captured frame becomes a benchmark that runs
+// anywhere:
+//
+//     $ ./replay [--original-timing] [--per-frame] frames.glcap
+//
+// The capture is decompressed into memory first. The CPU time of a
+// frame is the time it takes to issue its calls, the GPU time is
+// measured with timestamp queries around them, which leaves
+// TIME_ELAPSED to the queries of the capture. By default the frames run
+// back to back, as fast as possible. With --original-timing every frame
+// starts when it started in the capture.
+//
+// The objects get new names in the replay: the names the capture
+// recorded are mapped to them, and so are the uniform locations the
+// capture looked up. The locations it never looked up (set with a
+// layout qualifier) are used as they are.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#include "../gl.hpp"
+#include "../gl_capture.hpp"
+#include "../gl_egl.hpp"
+#include "../gl_frame.hpp"
+
+using gl_capture::Op;
+using gl_capture::Reader;
+
+struct Names
+{
+    std::unordered_map<GLuint, GLuint> buffers;
+    // Shaders and programs share their names
+    std::unordered_map<GLuint, GLuint> programs;
+    std::unordered_map<GLuint, GLuint> vertex_arrays;
+    std::unordered_map<GLuint, GLuint> queries;
+    std::unordered_map<GLuint, GLuint> transform_feedbacks;
+    std::unordered_map<uint64_t, GLsync> syncs;
+    // By the captured program and location
+    std::map<std::pair<GLuint, GLint>, GLint> locations;
+    // The captured name of the program in use
+    GLuint program;
+};
+
+GLuint name(const std::unordered_map<GLuint, GLuint> &names, GLuint captured)
+{
+    auto it = names.find(captured);
+    return it == names.end() ? captured : it->second;
+}
+
+GLsync sync(const Names &names, uint64_t captured)
+{
+    auto it = names.syncs.find(captured);
+    return it == names.syncs.end() ? nullptr : it->second;
+}
+
+GLint location(const Names &names, GLint captured)
+{
+    auto it = names.locations.find({names.program, captured});
+    return it == names.locations.end() ? captured : it->second;
+}
+
+void gen_names(Reader *reader, std::unordered_map<GLuint, GLuint> *names, void (*gen)(GLsizei, GLuint*))
+{
+    const GLsizei n = (GLsizei) gl_capture::get_int(reader);
+    std::vector<GLuint> replayed(n > 0 ? n : 0);
+    gen(n, replayed.data());
+    for (GLsizei i = 0; i < n; ++i) {
+        (*names)[(GLuint) gl_capture::get_uint(reader)] = replayed[i];
+    }
+}
+
+void delete_names(Reader *reader, std::unordered_map<GLuint, GLuint> *names, void (*del)(GLsizei, const GLuint*))
+{
+    const GLsizei n = (GLsizei) gl_capture::get_int(reader);
+    std::vector<GLuint> replayed;
+    for (GLsizei i = 0; i < n; ++i) {
+        const GLuint captured = (GLuint) gl_capture::get_uint(reader);
+        replayed.push_back(name(*names, captured));
+        names->erase(captured);
+    }
+    del(n, replayed.data());
+}
+
+// The count and the values of a glUniform*v
+template <typename T>
+const T *values(Reader *reader, GLsizei *count)
+{
+    *count = (GLsizei) gl_capture::get_int(reader);
+    size_t size = 0;
+    const unsigned char *bytes = gl_capture::get_bytes(reader, &size);
+    return reinterpret_cast<const T*>(bytes);
+}
+
+// Whatever the queries of the capture write
+struct Scratch
+{
+    GLint ints[16];
+    GLuint64 uint64;
+    GLuint uint;
+    std::vector<GLchar> log;
+};
+
+GLuint get_name(Reader *reader)
+{
+    return (GLuint) gl_capture::get_uint(reader);
+}
+
+GLenum get_enum(Reader *reader)
+{
+    return (GLenum) gl_capture::get_uint(reader);
+}
+
+GLint get_glint(Reader *reader)
+{
+    return (GLint) gl_capture::get_int(reader);
+}
+
+const void *get_offset(Reader *reader)
+{
+    return (const void*) (uintptr_t) gl_capture::get_uint(reader);
+}
+
+// Every call but FRAME. Returns false on an op it does not know.
+bool replay_call(Reader *reader, Op op, Names *names, Scratch *scratch)
+{
+    switch (op) {
+    case Op::glAttachShader: {
+        const GLuint program = get_name(reader);
+        const GLuint shader = get_name(reader);
+        glAttachShader(name(names->programs, program), name(names->programs, shader));
+    } break;
+
+    case Op::glBeginConditionalRender: {
+        const GLuint id = get_name(reader);
+        glBeginConditionalRender(name(names->queries, id), get_enum(reader));
+    } break;
+
+    case Op::glBeginQuery: {
+        const GLenum target = get_enum(reader);
+        glBeginQuery(target, name(names->queries, get_name(reader)));
+    } break;
+
+    case Op::glBeginTransformFeedback:
+        glBeginTransformFeedback(get_enum(reader));
+        break;
+
+    case Op::glBindAttribLocation: {
+        const GLuint program = get_name(reader);
+        const GLuint index = get_name(reader);
+        glBindAttribLocation(name(names->programs, program), index, gl_capture::get_string(reader));
+    } break;
+
+    case Op::glBindBuffer: {
+        const GLenum target = get_enum(reader);
+        glBindBuffer(target, name(names->buffers, get_name(reader)));
+    } break;
+
+    case Op::glBindBufferBase: {
+        const GLenum target = get_enum(reader);
+        const GLuint index = get_name(reader);
+        glBindBufferBase(target, index, name(names->buffers, get_name(reader)));
+    } break;
+
+    case Op::glBindTransformFeedback: {
+        const GLenum target = get_enum(reader);
+        glBindTransformFeedback(target, name(names->transform_feedbacks, get_name(reader)));
+    } break;
+
+    case Op::glBindVertexArray:
+        glBindVertexArray(name(names->vertex_arrays, get_name(reader)));
+        break;
+
+    case Op::glBufferData: {
+        const GLenum target = get_enum(reader);
+        const GLsizeiptr size = (GLsizeiptr) gl_capture::get_int(reader);
+        const GLenum usage = get_enum(reader);
+        const void *data = nullptr;
+        if (gl_capture::get_uint(reader)) {
+            size_t data_size = 0;
+            data = gl_capture::get_bytes(reader, &data_size);
+        }
+        glBufferData(target, size, data, usage);
+    } break;
+
+    case Op::glClear:
+        glClear((GLbitfield) gl_capture::get_uint(reader));
+        break;
+
+    case Op::glClearColor: {
+        const GLfloat r = gl_capture::get_float(reader);
+        const GLfloat g = gl_capture::get_float(reader);
+        const GLfloat b = gl_capture::get_float(reader);
+        const GLfloat a = gl_capture::get_float(reader);
+        glClearColor(r, g, b, a);
+    } break;
+
+    case Op::glClientWaitSync: {
+        GLsync fence = sync(*names, gl_capture::get_uint(reader));
+        const GLbitfield flags = (GLbitfield) gl_capture::get_uint(reader);
+        const GLuint64 timeout = gl_capture::get_uint(reader);
+        if (fence) glClientWaitSync(fence, flags, timeout);
+    } break;
+
+    case Op::glColorMask: {
+        const GLboolean r = (GLboolean) gl_capture::get_uint(reader);
+        const GLboolean g = (GLboolean) gl_capture::get_uint(reader);
+        const GLboolean b = (GLboolean) gl_capture::get_uint(reader);
+        const GLboolean a = (GLboolean) gl_capture::get_uint(reader);
+        glColorMask(r, g, b, a);
+    } break;
+
+    case Op::glCompileShader:
+        glCompileShader(name(names->programs, get_name(reader)));
+        break;
+
+    case Op::glCreateProgram:
+        names->programs[get_name(reader)] = glCreateProgram();
+        break;
+
+    case Op::glCreateShader: {
+        const GLenum type = get_enum(reader);
+        names->programs[get_name(reader)] = glCreateShader(type);
+    } break;
+
+    case Op::glDebugMessageControl: {
+        const GLenum source = get_enum(reader);
+        const GLenum type = get_enum(reader);
+        const GLenum severity = get_enum(reader);
+        const GLboolean enabled = (GLboolean) gl_capture::get_uint(reader);
+        const GLsizei count = get_glint(reader);
+        std::vector<GLuint> ids;
+        for (GLsizei i = 0; i < count; ++i) ids.push_back(get_name(reader));
+        glDebugMessageControl(source, type, severity, count, ids.data(), enabled);
+    } break;
+
+    case Op::glDebugMessageInsert: {
+        const GLenum source = get_enum(reader);
+        const GLenum type = get_enum(reader);
+        const GLuint id = get_name(reader);
+        const GLenum severity = get_enum(reader);
+        GLint length = 0;
+        const GLchar *message = gl_capture::get_string(reader, &length);
+        glDebugMessageInsert(source, type, id, severity, length, message);
+    } break;
+
+    case Op::glDeleteBuffers:
+        delete_names(reader, &names->buffers, glDeleteBuffers);
+        break;
+
+    case Op::glDeleteProgram: {
+        const GLuint program = get_name(reader);
+        glDeleteProgram(name(names->programs, program));
+        names->programs.erase(program);
+    } break;
+
+    case Op::glDeleteQueries:
+        delete_names(reader, &names->queries, glDeleteQueries);
+        break;
+
+    case Op::glDeleteShader: {
+        const GLuint shader = get_name(reader);
+        glDeleteShader(name(names->programs, shader));
+        names->programs.erase(shader);
+    } break;
+
+    case Op::glDeleteSync: {
+        const uint64_t captured = gl_capture::get_uint(reader);
+        if (GLsync fence = sync(*names, captured)) glDeleteSync(fence);
+        names->syncs.erase(captured);
+    } break;
+
+    case Op::glDeleteTransformFeedbacks:
+        delete_names(reader, &names->transform_feedbacks, glDeleteTransformFeedbacks);
+        break;
+
+    case Op::glDeleteVertexArrays:
+        delete_names(reader, &names->vertex_arrays, glDeleteVertexArrays);
+        break;
+
+    case Op::glDepthMask:
+        glDepthMask((GLboolean) gl_capture::get_uint(reader));
+        break;
+
+    case Op::glDisable:
+        glDisable(get_enum(reader));
+        break;
+
+    case Op::glDrawArrays: {
+        const GLenum mode = get_enum(reader);
+        const GLint first = get_glint(reader);
+        const GLsizei count = get_glint(reader);
+        glDrawArrays(mode, first, count);
+    } break;
+
+    case Op::glDrawElements: {
+        const GLenum mode = get_enum(reader);
+        const GLsizei count = get_glint(reader);
+        const GLenum type = get_enum(reader);
+        glDrawElements(mode, count, type, get_offset(reader));
+    } break;
+
+    case Op::glDrawElementsBaseVertex: {
+        const GLenum mode = get_enum(reader);
+        const GLsizei count = get_glint(reader);
+        const GLenum type = get_enum(reader);
+        const void *indices = get_offset(reader);
+        glDrawElementsBaseVertex(mode, count, type, indices, get_glint(reader));
+    } break;
+
+    case Op::glDrawTransformFeedback: {
+        const GLenum mode = get_enum(reader);
+        glDrawTransformFeedback(mode, name(names->transform_feedbacks, get_name(reader)));
+    } break;
+
+    case Op::glEnable:
+        glEnable(get_enum(reader));
+        break;
+
+    case Op::glEnableVertexAttribArray:
+        glEnableVertexAttribArray(get_name(reader));
+        break;
+
+    case Op::glEndConditionalRender:
+        glEndConditionalRender();
+        break;
+
+    case Op::glEndQuery:
+        glEndQuery(get_enum(reader));
+        break;
+
+    case Op::glEndTransformFeedback:
+        glEndTransformFeedback();
+        break;
+
+    case Op::glFenceSync: {
+        const GLenum condition = get_enum(reader);
+        const GLbitfield flags = (GLbitfield) gl_capture::get_uint(reader);
+        names->syncs[gl_capture::get_uint(reader)] = glFenceSync(condition, flags);
+    } break;
+
+    case Op::glGenBuffers:
+        gen_names(reader, &names->buffers, glGenBuffers);
+        break;
+
+    case Op::glGenQueries:
+        gen_names(reader, &names->queries, glGenQueries);
+        break;
+
+    case Op::glGenTransformFeedbacks:
+        gen_names(reader, &names->transform_feedbacks, glGenTransformFeedbacks);
+        break;
+
+    case Op::glGenVertexArrays:
+        gen_names(reader, &names->vertex_arrays, glGenVertexArrays);
+        break;
+
+    case Op::glGetAttribLocation: {
+        const GLuint program = get_name(reader);
+        glGetAttribLocation(name(names->programs, program), gl_capture::get_string(reader));
+    } break;
+
+    case Op::glGetError:
+        glGetError();
+        break;
+
+    case Op::glGetProgramInfoLog: {
+        const GLuint program = get_name(reader);
+        const GLsizei size = get_glint(reader);
+        scratch->log.resize(size > 0 ? size : 1);
+        glGetProgramInfoLog(name(names->programs, program), size, nullptr, scratch->log.data());
+    } break;
+
+    case Op::glGetProgramiv: {
+        const GLuint program = get_name(reader);
+        glGetProgramiv(name(names->programs, program), get_enum(reader), scratch->ints);
+    } break;
+
+    case Op::glGetQueryObjectui64v: {
+        const GLuint id = get_name(reader);
+        glGetQueryObjectui64v(name(names->queries, id), get_enum(reader), &scratch->uint64);
+    } break;
+
+    case Op::glGetQueryObjectuiv: {
+        const GLuint id = get_name(reader);
+        glGetQueryObjectuiv(name(names->queries, id), get_enum(reader), &scratch->uint);
+    } break;
+
+    case Op::glGetShaderInfoLog: {
+        const GLuint shader = get_name(reader);
+        const GLsizei size = get_glint(reader);
+        scratch->log.resize(size > 0 ? size : 1);
+        glGetShaderInfoLog(name(names->programs, shader), size, nullptr, scratch->log.data());
+    } break;
+
+    case Op::glGetShaderiv: {
+        const GLuint shader = get_name(reader);
+        glGetShaderiv(name(names->programs, shader), get_enum(reader), scratch->ints);
+    } break;
+
+    case Op::glGetString:
+        glGetString(get_enum(reader));
+        break;
+
+    case Op::glGetSynciv: {
+        GLsync fence = sync(*names, gl_capture::get_uint(reader));
+        const GLenum pname = get_enum(reader);
+        const GLsizei count = std::min<GLsizei>(get_glint(reader), 16);
+        if (fence) glGetSynciv(fence, pname, count, nullptr, scratch->ints);
+    } break;
+
+    case Op::glGetUniformLocation: {
+        const GLuint program = get_name(reader);
+        const GLint captured = get_glint(reader);
+        const GLint replayed = glGetUniformLocation(name(names->programs, program), gl_capture::get_string(reader));
+        if (captured >= 0) names->locations[{program, captured}] = replayed;
+    } break;
+
+    case Op::glLinkProgram:
+        glLinkProgram(name(names->programs, get_name(reader)));
+        break;
+
+    case Op::glPrimitiveRestartIndex:
+        glPrimitiveRestartIndex(get_name(reader));
+        break;
+
+    case Op::glShaderSource: {
+        const GLuint shader = get_name(reader);
+        const GLsizei count = get_glint(reader);
+        std::vector<const GLchar*> strings;
+        std::vector<GLint> lengths;
+        for (GLsizei i = 0; i < count; ++i) {
+            GLint length = 0;
+            strings.push_back(gl_capture::get_string(reader, &length));
+            lengths.push_back(length);
+        }
+        glShaderSource(name(names->programs, shader), count, strings.data(), lengths.data());
+    } break;
+
+    case Op::glTransformFeedbackVaryings: {
+        const GLuint program = get_name(reader);
+        const GLenum mode = get_enum(reader);
+        const GLsizei count = get_glint(reader);
+        std::vector<const GLchar*> varyings;
+        for (GLsizei i = 0; i < count; ++i) varyings.push_back(gl_capture::get_string(reader));
+        glTransformFeedbackVaryings(name(names->programs, program), count, varyings.data(), mode);
+    } break;
+
+    case Op::glUniform1f: {
+        const GLint at = location(*names, get_glint(reader));
+        glUniform1f(at, gl_capture::get_float(reader));
+    } break;
+
+    case Op::glUniform2f: {
+        const GLint at = location(*names, get_glint(reader));
+        const GLfloat x = gl_capture::get_float(reader);
+        const GLfloat y = gl_capture::get_float(reader);
+        glUniform2f(at, x, y);
+    } break;
+
+    case Op::glUniform3f: {
+        const GLint at = location(*names, get_glint(reader));
+        const GLfloat x = gl_capture::get_float(reader);
+        const GLfloat y = gl_capture::get_float(reader);
+        const GLfloat z = gl_capture::get_float(reader);
+        glUniform3f(at, x, y, z);
+    } break;
+
+    case Op::glUniform4f: {
+        const GLint at = location(*names, get_glint(reader));
+        const GLfloat x = gl_capture::get_float(reader);
+        const GLfloat y = gl_capture::get_float(reader);
+        const GLfloat z = gl_capture::get_float(reader);
+        const GLfloat w = gl_capture::get_float(reader);
+        glUniform4f(at, x, y, z, w);
+    } break;
+
+    case Op::glUniform1i: {
+        const GLint at = location(*names, get_glint(reader));
+        glUniform1i(at, get_glint(reader));
+    } break;
+
+    case Op::glUniform2i: {
+        const GLint at = location(*names, get_glint(reader));
+        const GLint x = get_glint(reader);
+        const GLint y = get_glint(reader);
+        glUniform2i(at, x, y);
+    } break;
+
+    case Op::glUniform3i: {
+        const GLint at = location(*names, get_glint(reader));
+        const GLint x = get_glint(reader);
+        const GLint y = get_glint(reader);
+        const GLint z = get_glint(reader);
+        glUniform3i(at, x, y, z);
+    } break;
+
+    case Op::glUniform4i: {
+        const GLint at = location(*names, get_glint(reader));
+        const GLint x = get_glint(reader);
+        const GLint y = get_glint(reader);
+        const GLint z = get_glint(reader);
+        const GLint w = get_glint(reader);
+        glUniform4i(at, x, y, z, w);
+    } break;
+
+    case Op::glUniform1ui: {
+        const GLint at = location(*names, get_glint(reader));
+        glUniform1ui(at, get_name(reader));
+    } break;
+
+    case Op::glUniform1fv:
+    case Op::glUniform2fv:
+    case Op::glUniform3fv:
+    case Op::glUniform4fv: {
+        const GLint at = location(*names, get_glint(reader));
+        GLsizei count = 0;
+        const GLfloat *xs = values<GLfloat>(reader, &count);
+        if (op == Op::glUniform1fv) glUniform1fv(at, count, xs);
+        if (op == Op::glUniform2fv) glUniform2fv(at, count, xs);
+        if (op == Op::glUniform3fv) glUniform3fv(at, count, xs);
+        if (op == Op::glUniform4fv) glUniform4fv(at, count, xs);
+    } break;
+
+    case Op::glUniform1iv:
+    case Op::glUniform2iv:
+    case Op::glUniform3iv:
+    case Op::glUniform4iv: {
+        const GLint at = location(*names, get_glint(reader));
+        GLsizei count = 0;
+        const GLint *xs = values<GLint>(reader, &count);
+        if (op == Op::glUniform1iv) glUniform1iv(at, count, xs);
+        if (op == Op::glUniform2iv) glUniform2iv(at, count, xs);
+        if (op == Op::glUniform3iv) glUniform3iv(at, count, xs);
+        if (op == Op::glUniform4iv) glUniform4iv(at, count, xs);
+    } break;
+
+    case Op::glUniform1uiv: {
+        const GLint at = location(*names, get_glint(reader));
+        GLsizei count = 0;
+        const GLuint *xs = values<GLuint>(reader, &count);
+        glUniform1uiv(at, count, xs);
+    } break;
+
+    case Op::glUniformMatrix2fv:
+    case Op::glUniformMatrix3fv:
+    case Op::glUniformMatrix4fv: {
+        const GLint at = location(*names, get_glint(reader));
+        const GLsizei count = get_glint(reader);
+        const GLboolean transpose = (GLboolean) gl_capture::get_uint(reader);
+        size_t size = 0;
+        const GLfloat *xs = reinterpret_cast<const GLfloat*>(gl_capture::get_bytes(reader, &size));
+        if (op == Op::glUniformMatrix2fv) glUniformMatrix2fv(at, count, transpose, xs);
+        if (op == Op::glUniformMatrix3fv) glUniformMatrix3fv(at, count, transpose, xs);
+        if (op == Op::glUniformMatrix4fv) glUniformMatrix4fv(at, count, transpose, xs);
+    } break;
+
+    case Op::glUseProgram:
+        names->program = get_name(reader);
+        glUseProgram(name(names->programs, names->program));
+        break;
+
+    case Op::glVertexAttribIPointer: {
+        const GLuint index = get_name(reader);
+        const GLint size = get_glint(reader);
+        const GLenum type = get_enum(reader);
+        const GLsizei stride = get_glint(reader);
+        glVertexAttribIPointer(index, size, type, stride, get_offset(reader));
+    } break;
+
+    case Op::glVertexAttribPointer: {
+        const GLuint index = get_name(reader);
+        const GLint size = get_glint(reader);
+        const GLenum type = get_enum(reader);
+        const GLboolean normalized = (GLboolean) gl_capture::get_uint(reader);
+        const GLsizei stride = get_glint(reader);
+        glVertexAttribPointer(index, size, type, normalized, stride, get_offset(reader));
+    } break;
+
+    case Op::glWaitSync: {
+        GLsync fence = sync(*names, gl_capture::get_uint(reader));
+        const GLbitfield flags = (GLbitfield) gl_capture::get_uint(reader);
+        const GLuint64 timeout = gl_capture::get_uint(reader);
+        if (fence) glWaitSync(fence, flags, timeout);
+    } break;
+
+    case Op::FRAME:
+    case Op::COUNT:
+    default:
+        return false;
+    }
+    return true;
+}
+
+struct Frame
+{
+    double cpu;
+    double gpu;
+    // When it started in the capture, in seconds since the start
+    double captured_start;
+};
+
+// The `p` percentile, of the frames sorted by `time`
+double percentile(std::vector<double> times, double p)
+{
+    if (times.empty()) return 0.0;
+    std::sort(times.begin(), times.end());
+    return times[std::min(times.size() - 1, (size_t) (p * (double) times.size()))];
+}
+
+void summary(const char *name, const std::vector<double> &times)
+{
+    double total = 0.0;
+    for (double time : times) total += time;
+    printf("%-4s %10.3f %10.3f %10.3f %10.3f %10.3f\n", name,
+           times.empty() ? 0.0 : total / (double) times.size() * 1000.0,
+           percentile(times, 0.50) * 1000.0, percentile(times, 0.95) * 1000.0,
+           percentile(times, 0.99) * 1000.0, percentile(times, 1.0) * 1000.0);
+}
+
+void usage(FILE *stream)
+{
+    fprintf(stream, "Usage: replay [--original-timing] [--per-frame] <capture>\n");
+    fprintf(stream, "    --original-timing  Start every frame when it started in the capture\n");
+    fprintf(stream, "    --per-frame        Print the times of every frame\n");
+}
+
+int main(int argc, char *argv[])
+{
+    bool original_timing = false;
+    bool per_frame = false;
+    const char *path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--original-timing") == 0) {
+            original_timing = true;
+        } else if (strcmp(argv[i], "--per-frame") == 0) {
+            per_frame = true;
+        } else if (strcmp(argv[i], "--help") == 0) {
+            usage(stdout);
+            return 0;
+        } else if (!path) {
+            path = argv[i];
+        } else {
+            usage(stderr);
+            return 1;
+        }
+    }
+    if (!path) {
+        usage(stderr);
+        return 1;
+    }
+
+    Reader reader = {};
+    gl_capture::Header header = {};
+    if (!gl_capture::load(&reader, path, &header)) {
+        fprintf(stderr, "Could not read the capture `%s`\n", path);
+        return 1;
+    }
+
+    auto context = gl_egl::create_headless_context(3, 3);
+    if (!context.has_value) {
+        fprintf(stderr, "Could not create a headless EGL context\n");
+        return 1;
+    }
+
+    // Stands for the framebuffer the capture rendered to
+    const GLsizei width = (GLsizei) header.width, height = (GLsizei) header.height;
+    GLuint fbo = 0, color = 0, depth = 0;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glGenRenderbuffers(1, &color);
+    glBindRenderbuffer(GL_RENDERBUFFER, color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    glGenRenderbuffers(1, &depth);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depth);
+    glViewport(0, 0, width, height);
+
+    printf("Renderer: %s\n", gl::getString(gl::String_Name::RENDERER));
+    printf("Capture:  %s, %zu bytes of calls for %llux%llu\n", path, reader.data.size(),
+           (unsigned long long) header.width, (unsigned long long) header.height);
+
+    Names names = {};
+    Scratch scratch = {};
+    std::vector<Frame> frames;
+    // A begin and an end timestamp per frame
+    std::vector<GLuint> timestamps;
+    size_t calls = 0;
+
+    const double start = gl_frame::now_secs();
+    double captured_start = 0.0;
+    double frame_start = start;
+    auto begin_frame = [&] {
+        if (original_timing) gl_frame::sleep_until(start + captured_start);
+        frame_start = gl_frame::now_secs();
+        GLuint queries[2] = {};
+        glGenQueries(2, queries);
+        timestamps.insert(timestamps.end(), queries, queries + 2);
+        glQueryCounter(queries[0], GL_TIMESTAMP);
+    };
+
+    begin_frame();
+    while (!gl_capture::at_end(reader)) {
+        const Op op = (Op) reader.data[reader.pos++];
+        if (op == Op::FRAME) {
+            glQueryCounter(timestamps.back(), GL_TIMESTAMP);
+            // What the swap of the capture did
+            glFlush();
+            frames.push_back({gl_frame::now_secs() - frame_start, 0.0, captured_start});
+            captured_start = (double) gl_capture::get_uint(&reader) * 1e-9;
+            if (!gl_capture::at_end(reader)) begin_frame();
+        } else if (!replay_call(&reader, op, &names, &scratch)) {
+            fprintf(stderr, "Unknown call %u at byte %zu\n", (unsigned) op, reader.pos - 1);
+            return 1;
+        } else {
+            calls += 1;
+        }
+        if (!reader.ok) {
+            fprintf(stderr, "The capture is truncated at byte %zu\n", reader.pos);
+            return 1;
+        }
+    }
+
+    glFinish();
+    for (size_t i = 0; i < frames.size(); ++i) {
+        GLuint64 begin = 0, end = 0;
+        glGetQueryObjectui64v(timestamps[2 * i], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(timestamps[2 * i + 1], GL_QUERY_RESULT, &end);
+        frames[i].gpu = (double) (end - begin) * 1e-9;
+    }
+    glDeleteQueries((GLsizei) timestamps.size(), timestamps.data());
+
+    if (per_frame) {
+        printf("%6s %10s %10s %10s\n", "frame", "start ms", "cpu ms", "gpu ms");
+        for (size_t i = 0; i < frames.size(); ++i) {
+            printf("%6zu %10.3f %10.3f %10.3f\n", i, frames[i].captured_start * 1000.0,
+                   frames[i].cpu * 1000.0, frames[i].gpu * 1000.0);
+        }
+    }
+
+    std::vector<double> cpu, gpu;
+    for (const Frame &frame : frames) {
+        cpu.push_back(frame.cpu);
+        gpu.push_back(frame.gpu);
+    }
+    printf("%zu frames, %zu calls in %.3f s\n", frames.size(), calls, gl_frame::now_secs() - start);
+    printf("%-4s %10s %10s %10s %10s %10s\n", "", "avg ms", "p50 ms", "p95 ms", "p99 ms", "max ms");
+    summary("cpu", cpu);
+    summary("gpu", gpu);
+
+    gl_egl::destroy_context(context.unwrap);
+
+    return 0;
+}
@@ -1,9 +1,18 @@
 #include <set>
 #include <map>
 #include <vector>
+#include <atomic>
+#include <thread>
+#include <ctime>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 #include "aids.hpp"
 #include <libxml/parser.h>
 #include <libxml/tree.h>
+#include <libxml/xmlreader.h>
 
 #define ARRAY_LEN(xs) (sizeof(xs) / sizeof(xs[0]))
 
@@ -47,94 +56,24 @@ String_View xmlstr_as_string_view(const xmlChar *xmlstr)
     return cstr_as_string_view((const char *)xmlstr);
 }
 
+// The streaming parser frees the nodes as soon as it moves past
+// them, so everything that ends up in the Registry has to be copied.
+String_View copy_string_view(String_View view)
+{
+    if (view.count == 0) return view;
+
+    char *data = (char*) malloc(view.count);
+    assert(data);
+    memcpy(data, view.data, view.count);
+    return {view.count, data};
+}
+
 #define FOREACH_CHILD(child, node) \
     for (auto child = node->children, it = child; child; child = child->next, it = child, (void) it)
 #define FOREACH_CHILD_NAME(child, node, _name) \
     FOREACH_CHILD(child, node) \
         if (xmlStrcmp(child->name, _name) == 0)
 
-void commands_subcommand(const char *filepath, xmlDocPtr doc)
-{
-#define DEBUG_IT(...) println(stdout, filepath, ":", it->line, ": ", __VA_ARGS__)
-    const auto registry = doc->children;
-    FOREACH_CHILD_NAME(commands, registry, "commands"_xml) {
-        FOREACH_CHILD_NAME(command, commands, "command"_xml) {
-            DEBUG_IT("command");
-            FOREACH_CHILD(tag, command) {
-                if (xmlStrcmp(it->name, "text"_xml) != 0) {
-                    DEBUG_IT(Pad {2, ' '}, it->name);
-                    if (xmlStrcmp(it->name, "proto"_xml) == 0) {
-                        FOREACH_CHILD(proto_child, tag) {
-                            if (xmlStrcmp(it->name, "text"_xml) != 0) {
-                                DEBUG_IT(Pad {4, ' '}, it->name);
-                                DEBUG_IT(Pad {4, ' '}, it->children->content);
-                            }
-                        }
-                    } else if (xmlStrcmp(it->name, "param"_xml) == 0) {
-                        FOREACH_CHILD(params_child, tag) {
-                            if (xmlStrcmp(it->name, "text"_xml) != 0) {
-                                DEBUG_IT(Pad {4, ' '}, it->name);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
-#undef DEBUG_IT
-}
-
-void gen_subcommand(const char *filepath, xmlDocPtr doc)
-{
-    std::map<String_View, std::map<String_View, String_View>> groups;
-
-    auto registry = doc->children;
-    FOREACH_CHILD_NAME (enums, registry, "enums"_xml) {
-        FOREACH_CHILD_NAME (enoom, enums, "enum"_xml) {
-            auto group_prop = find_node(enoom->properties, "group"_xml);
-            auto name_prop = find_node(enoom->properties, "name"_xml);
-            if (!name_prop) {
-                println(stdout, filepath, ":", enoom->line, ": enum without name found");
-                fflush(stdout);
-                abort();
-            }
-            auto name_text = xmlstr_as_string_view(name_prop->children->content);
-
-            auto value_prop = find_node(enoom->properties, "value"_xml);
-            if (!value_prop) {
-                println(stdout, filepath, ":", enoom->line, ": enum without value found");
-                fflush(stdout);
-                abort();
-            }
-            auto value_text = xmlstr_as_string_view(value_prop->children->content);
-
-            if (group_prop) {
-                auto group_text = xmlstr_as_string_view(group_prop->children->content);
-
-                while (group_text.count) {
-                    auto group = group_text.chop_by_delim(',');
-                    if (groups[group][name_text].count > 0) {
-                        println(stdout, filepath, ":", enoom->line, " enum value ", name_text, " is redefined");
-                        fflush(stdout);
-                        abort();
-                    }
-                    groups[group][name_text] = value_text;
-                }
-            }
-        }
-    }
-
-    print_header(stdout);
-    for (const auto &group : groups) {
-        println(stdout, "enum class ", group.first, " {");
-        for (const auto &enoom: group.second) {
-            println(stdout, "  ", enoom.first.subview(3, enoom.first.count - 3), " = ", enoom.second, ",");
-        }
-        println(stdout, "};");
-    }
-    print_footer(stdout);
-}
-
 //#define DEBUG
 
 #ifdef DEBUG
@@ -154,8 +93,64 @@ void print1(FILE *stream, Sig sig)
     print(stream, "{ name: \"", sig.name, "\", type: \"", sig.type, "\" }");
 }
 
+struct Command
+{
+    long line;
+    Maybe<Sig> sig;
+    std::vector<Sig> params;
+};
+
+struct Feature
+{
+    String_View api;
+    String_View name;
+    String_View number;
+};
+
+struct Registry
+{
+    std::map<String_View, std::map<String_View, String_View>> groups;
+    std::vector<Command> commands;
+    std::vector<Feature> features;
+};
+
+void registry_add_enum(Registry *registry, const char *filepath, long line,
+                       const xmlChar *name, const xmlChar *value, const xmlChar *group)
+{
+    if (!name) {
+        println(stdout, filepath, ":", line, ": enum without name found");
+        fflush(stdout);
+        abort();
+    }
+    auto name_text = xmlstr_as_string_view(name);
+
+    if (!value) {
+        println(stdout, filepath, ":", line, ": enum without value found");
+        fflush(stdout);
+        abort();
+    }
+    auto value_text = xmlstr_as_string_view(value);
+
+    if (group) {
+        auto group_text = xmlstr_as_string_view(group);
+
+        while (group_text.count) {
+            auto group = group_text.chop_by_delim(',');
+            if (registry->groups[group][name_text].count > 0) {
+                println(stdout, filepath, ":", line, " enum value ", name_text, " is redefined");
+                fflush(stdout);
+                abort();
+            }
+            registry->groups[group][name_text] = value_text;
+        }
+    }
+}
+
 Sig extract_sig(const char *filepath, size_t level, xmlNodePtr node)
 {
+    (void) filepath;
+    (void) level;
+
     Sig result = {};
 
     FOREACH_CHILD(child, node) {
@@ -174,49 +169,824 @@ Sig extract_sig(const char *filepath, size_t level, xmlNodePtr node)
     return result;
 }
 
-void commands_subcommand(const char *filepath, xmlDocPtr doc)
+Command extract_command(const char *filepath, xmlNodePtr command)
 {
-    auto registry = doc->children;
-    FOREACH_CHILD_NAME(commands, registry, "commands"_xml) {
-        FOREACH_CHILD_NAME(command, commands, "command"_xml) {
-            DEBUG_TAG(command, "command");
-            Maybe<Sig> command_sig = {};
-            std::vector<Sig> command_params;
-            FOREACH_CHILD(prop, command) {
-                if (xmlStrcmp(prop->name, "text"_xml) != 0) {
-                    DEBUG_TAG(prop, Pad{2, ' '}, prop->name);
-                    if (xmlStrcmp(prop->name, "proto"_xml) == 0) {
-                        command_sig = {true, extract_sig(filepath, 4, prop)};
-                    } else if (xmlStrcmp(prop->name, "param"_xml) == 0) {
-                        command_params.push_back(extract_sig(filepath, 4, prop));
-                    }
-                }
+    DEBUG_TAG(command, "command");
+    Command result = {};
+    result.line = xmlGetLineNo(command);
+    FOREACH_CHILD(prop, command) {
+        if (xmlStrcmp(prop->name, "text"_xml) != 0) {
+            DEBUG_TAG(prop, Pad{2, ' '}, prop->name);
+            if (xmlStrcmp(prop->name, "proto"_xml) == 0) {
+                result.sig = {true, extract_sig(filepath, 4, prop)};
+            } else if (xmlStrcmp(prop->name, "param"_xml) == 0) {
+                result.params.push_back(extract_sig(filepath, 4, prop));
             }
-#ifndef DEBUG
-            assert(command_sig.has_value);
+        }
+    }
+    return result;
+}
+
+String_View xml_prop_as_string_view(xmlNodePtr node, const xmlChar *name)
+{
+    auto prop = find_node(node->properties, name);
+    if (!prop) return {};
+    return xmlstr_as_string_view(prop->children->content);
+}
+
+Registry parse_registry_dom(const char *filepath, xmlDocPtr doc)
+{
+    Registry registry = {};
+
+    auto root = doc->children;
+    FOREACH_CHILD_NAME (enums, root, "enums"_xml) {
+        FOREACH_CHILD_NAME (enoom, enums, "enum"_xml) {
+            auto name_prop = find_node(enoom->properties, "name"_xml);
+            auto value_prop = find_node(enoom->properties, "value"_xml);
+            auto group_prop = find_node(enoom->properties, "group"_xml);
+            registry_add_enum(&registry, filepath, xmlGetLineNo(enoom),
+                              name_prop ? name_prop->children->content : NULL,
+                              value_prop ? value_prop->children->content : NULL,
+                              group_prop ? group_prop->children->content : NULL);
+        }
+    }
+
+    FOREACH_CHILD_NAME(commands, root, "commands"_xml) {
+        FOREACH_CHILD_NAME(command, commands, "command"_xml) {
+            registry.commands.push_back(extract_command(filepath, command));
+        }
+    }
+
+    FOREACH_CHILD_NAME(feature, root, "feature"_xml) {
+        registry.features.push_back({
+            xml_prop_as_string_view(feature, "api"_xml),
+            xml_prop_as_string_view(feature, "name"_xml),
+            xml_prop_as_string_view(feature, "number"_xml),
+        });
+    }
+
+    return registry;
+}
+
+// Single pass over the spec with xmlTextReader. Only one <command>
+// subtree is expanded at a time and every top-level section we don't
+// care about is skipped without building nodes for it, so the memory
+// usage is bounded by the size of the extracted Registry rather than
+// the size of the whole DOM.
+Registry parse_registry_stream(const char *filepath)
+{
+    Registry registry = {};
+
+    xmlTextReaderPtr reader = xmlReaderForFile(filepath, NULL, 0);
+    if (!reader) {
+        println(stderr, "Could not read file `", filepath, "`");
+        exit(1);
+    }
+    defer(xmlFreeTextReader(reader));
+
+    enum {
+        SECTION_OTHER = 0,
+        SECTION_ENUMS,
+        SECTION_COMMANDS,
+    } section = SECTION_OTHER;
+
+    int ret = xmlTextReaderRead(reader);
+    while (ret == 1) {
+        if (xmlTextReaderNodeType(reader) != XML_READER_TYPE_ELEMENT) {
+            ret = xmlTextReaderRead(reader);
+            continue;
+        }
+
+        const int depth = xmlTextReaderDepth(reader);
+        const xmlChar *name = xmlTextReaderConstName(reader);
 
-            println(stdout, "// ", filepath, ":", command->line, ": ", command_sig.unwrap.name);
-            if (command_sig.unwrap.type.count == 0) {
-                print(stdout, "void");
+        if (depth == 1) {
+            if (xmlStrcmp(name, "enums"_xml) == 0) {
+                section = SECTION_ENUMS;
+            } else if (xmlStrcmp(name, "commands"_xml) == 0) {
+                section = SECTION_COMMANDS;
+            } else if (xmlStrcmp(name, "feature"_xml) == 0) {
+                auto attribute = [&](const xmlChar *attribute_name) -> String_View {
+                    auto value = xmlTextReaderGetAttribute(reader, attribute_name);
+                    return value ? xmlstr_as_string_view(value) : String_View {};
+                };
+                registry.features.push_back({
+                    attribute("api"_xml),
+                    attribute("name"_xml),
+                    attribute("number"_xml),
+                });
+                section = SECTION_OTHER;
+                ret = xmlTextReaderNext(reader);
+                continue;
             } else {
-                print(stdout, command_sig.unwrap.type);
+                section = SECTION_OTHER;
+                ret = xmlTextReaderNext(reader);
+                continue;
             }
-            print(stdout, " ");
-            print(stdout, command_sig.unwrap.name);
-            print(stdout, "(");
-            bool first = true;
-            for (const auto &param: command_params) {
-                if (!first) {
-                    print(stdout, ", ");
-                }
-                print(stdout, param.type, ' ', param.name);
-                first = false;
+        } else if (depth == 2 && section == SECTION_ENUMS && xmlStrcmp(name, "enum"_xml) == 0) {
+            // xmlTextReaderGetAttribute returns copies that we own
+            registry_add_enum(&registry, filepath,
+                              xmlGetLineNo(xmlTextReaderCurrentNode(reader)),
+                              xmlTextReaderGetAttribute(reader, "name"_xml),
+                              xmlTextReaderGetAttribute(reader, "value"_xml),
+                              xmlTextReaderGetAttribute(reader, "group"_xml));
+        } else if (depth == 2 && section == SECTION_COMMANDS && xmlStrcmp(name, "command"_xml) == 0) {
+            xmlNodePtr node = xmlTextReaderExpand(reader);
+            if (!node) break;
+
+            auto command = extract_command(filepath, node);
+            command.sig.unwrap.name = copy_string_view(command.sig.unwrap.name);
+            command.sig.unwrap.type = copy_string_view(command.sig.unwrap.type);
+            for (auto &param: command.params) {
+                param.name = copy_string_view(param.name);
+                param.type = copy_string_view(param.type);
             }
-            print(stdout, ")");
-            println(stdout);
-#endif
+            registry.commands.push_back(command);
+
+            ret = xmlTextReaderNext(reader);
+            continue;
+        }
+
+        ret = xmlTextReaderRead(reader);
+    }
+
+    if (ret != 0) {
+        println(stderr, filepath, ": could not parse the spec");
+        exit(1);
+    }
+
+    return registry;
+}
+
+////////////////////////////////////////////////////////////
+// REGISTRY CACHE
+////////////////////////////////////////////////////////////
+
+// The cache is a flat little blob that is mmap-ed as is: a header,
+// the arrays of fixed size records and the pool of all the strings
+// they refer to. Loading it only rebuilds the std containers of the
+// Registry, all of the strings keep pointing into the mapping.
+
+const char CACHE_MAGIC[8] = {'G', 'L', 'S', 'P', 'E', 'C', '\0', '\0'};
+// Bump it on every change of the records below or of what the parser
+// puts into them
+const uint64_t CACHE_VERSION = 3;
+
+struct Cache_String
+{
+    uint32_t offset;
+    uint32_t count;
+};
+
+struct Cache_Header
+{
+    char magic[8];
+    uint64_t version;
+    uint64_t spec_hash;
+    uint64_t layout_hash;
+    uint64_t groups_count;
+    uint64_t enums_count;
+    uint64_t commands_count;
+    uint64_t params_count;
+    uint64_t features_count;
+    uint64_t strings_size;
+};
+
+struct Cache_Group
+{
+    Cache_String name;
+    uint32_t enums_begin;
+    uint32_t enums_count;
+};
+
+struct Cache_Enum
+{
+    Cache_String name;
+    Cache_String value;
+};
+
+struct Cache_Command
+{
+    int64_t line;
+    uint32_t has_sig;
+    Cache_String name;
+    Cache_String type;
+    uint32_t params_begin;
+    uint32_t params_count;
+};
+
+struct Cache_Param
+{
+    Cache_String name;
+    Cache_String type;
+};
+
+struct Cache_Feature
+{
+    Cache_String api;
+    Cache_String name;
+    Cache_String number;
+};
+
+uint64_t fnv1a(String_View view)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < view.count; ++i) {
+        hash ^= (uint8_t) view.data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Of the sizes of the records, so a cache written with another layout
+// is rejected even if CACHE_VERSION was not bumped
+uint64_t layout_hash()
+{
+    const uint64_t layout[] = {
+        sizeof(Cache_Header),
+        sizeof(Cache_Group),
+        sizeof(Cache_Enum),
+        sizeof(Cache_Command),
+        sizeof(Cache_Param),
+        sizeof(Cache_Feature),
+    };
+    return fnv1a({sizeof(layout), reinterpret_cast<const char*>(layout)});
+}
+
+Maybe<String_View> map_file(const char *filepath)
+{
+    int fd = open(filepath, O_RDONLY);
+    if (fd < 0) return {};
+    defer(close(fd));
+
+    struct stat statbuf = {};
+    if (fstat(fd, &statbuf) < 0) return {};
+    if (statbuf.st_size == 0) return {true, {}};
+
+    void *data = mmap(NULL, statbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) return {};
+
+    return {true, {static_cast<size_t>(statbuf.st_size), static_cast<const char*>(data)}};
+}
+
+struct Cache_Builder
+{
+    std::vector<Cache_Group> groups;
+    std::vector<Cache_Enum> enums;
+    std::vector<Cache_Command> commands;
+    std::vector<Cache_Param> params;
+    std::vector<Cache_Feature> features;
+    std::vector<char> strings;
+
+    Cache_String string(String_View view)
+    {
+        Cache_String result = {(uint32_t) strings.size(), (uint32_t) view.count};
+        strings.insert(strings.end(), view.data, view.data + view.count);
+        return result;
+    }
+};
+
+template <typename T>
+bool write_array(FILE *stream, const std::vector<T> &xs)
+{
+    return fwrite(xs.data(), sizeof(T), xs.size(), stream) == xs.size();
+}
+
+void save_registry_cache(const char *cache_path, uint64_t spec_hash, const Registry &registry)
+{
+    Cache_Builder builder = {};
+
+    for (const auto &group: registry.groups) {
+        builder.groups.push_back({
+            builder.string(group.first),
+            (uint32_t) builder.enums.size(),
+            (uint32_t) group.second.size()
+        });
+        for (const auto &enoom: group.second) {
+            builder.enums.push_back({builder.string(enoom.first), builder.string(enoom.second)});
+        }
+    }
+
+    for (const auto &command: registry.commands) {
+        builder.commands.push_back({
+            command.line,
+            command.sig.has_value,
+            builder.string(command.sig.unwrap.name),
+            builder.string(command.sig.unwrap.type),
+            (uint32_t) builder.params.size(),
+            (uint32_t) command.params.size()
+        });
+        for (const auto &param: command.params) {
+            builder.params.push_back({builder.string(param.name), builder.string(param.type)});
+        }
+    }
+
+    for (const auto &feature: registry.features) {
+        builder.features.push_back({
+            builder.string(feature.api),
+            builder.string(feature.name),
+            builder.string(feature.number)
+        });
+    }
+
+    Cache_Header header = {};
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version        = CACHE_VERSION;
+    header.spec_hash      = spec_hash;
+    header.layout_hash    = layout_hash();
+    header.groups_count   = builder.groups.size();
+    header.enums_count    = builder.enums.size();
+    header.commands_count = builder.commands.size();
+    header.params_count   = builder.params.size();
+    header.features_count = builder.features.size();
+    header.strings_size   = builder.strings.size();
+
+    // Write into a temporary file and rename it so a concurrent run
+    // never observes a half written cache.
+    String_Buffer tmp_path = {};
+    char tmp_path_data[4096];
+    tmp_path.capacity = sizeof(tmp_path_data);
+    tmp_path.data = tmp_path_data;
+    sprint(&tmp_path, cache_path, ".tmp");
+
+    FILE *stream = fopen(tmp_path.data, "wb");
+    if (!stream) {
+        println(stderr, "[WARN] Could not write cache `", tmp_path.data, "`: ", strerror(errno));
+        return;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, stream) == 1
+        && write_array(stream, builder.groups)
+        && write_array(stream, builder.enums)
+        && write_array(stream, builder.commands)
+        && write_array(stream, builder.params)
+        && write_array(stream, builder.features)
+        && write_array(stream, builder.strings);
+    ok = fclose(stream) == 0 && ok;
+
+    if (!ok || rename(tmp_path.data, cache_path) < 0) {
+        println(stderr, "[WARN] Could not write cache `", cache_path, "`: ", strerror(errno));
+        unlink(tmp_path.data);
+    }
+}
+
+// Every index and string of the records is within the arrays of the
+// cache, so a corrupted cache is rejected instead of read out of bounds
+bool cache_is_consistent(const Cache_Header &header,
+                         const Cache_Group *groups, const Cache_Enum *enums,
+                         const Cache_Command *commands, const Cache_Param *params,
+                         const Cache_Feature *features)
+{
+    auto in_range = [](uint64_t begin, uint64_t count, uint64_t size) {
+        return begin <= size && count <= size - begin;
+    };
+    auto string_ok = [&](Cache_String s) {
+        return in_range(s.offset, s.count, header.strings_size);
+    };
+
+    for (size_t i = 0; i < header.groups_count; ++i) {
+        if (!string_ok(groups[i].name) ||
+            !in_range(groups[i].enums_begin, groups[i].enums_count, header.enums_count)) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < header.enums_count; ++i) {
+        if (!string_ok(enums[i].name) || !string_ok(enums[i].value)) return false;
+    }
+    for (size_t i = 0; i < header.commands_count; ++i) {
+        if (!string_ok(commands[i].name) || !string_ok(commands[i].type) ||
+            !in_range(commands[i].params_begin, commands[i].params_count, header.params_count)) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < header.params_count; ++i) {
+        if (!string_ok(params[i].name) || !string_ok(params[i].type)) return false;
+    }
+    for (size_t i = 0; i < header.features_count; ++i) {
+        if (!string_ok(features[i].api) || !string_ok(features[i].name) ||
+            !string_ok(features[i].number)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool load_registry_cache(const char *cache_path, uint64_t spec_hash, Registry *registry)
+{
+    auto maybe_cache = map_file(cache_path);
+    if (!maybe_cache.has_value) return false;
+    auto cache = maybe_cache.unwrap;
+
+    // The strings of the Registry point into the mapping, so it is only
+    // unmapped when the cache is rejected
+    bool loaded = false;
+    defer(if (!loaded && cache.count > 0) munmap((void*) cache.data, cache.count));
+
+    Cache_Header header = {};
+    if (cache.count < sizeof(header)) return false;
+    memcpy(&header, cache.data, sizeof(header));
+
+    if (memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != CACHE_VERSION ||
+        header.spec_hash != spec_hash ||
+        header.layout_hash != layout_hash()) {
+        return false;
+    }
+
+    // Every count is at most the size of the file, so the sum below
+    // does not overflow
+    if (header.groups_count   > cache.count ||
+        header.enums_count    > cache.count ||
+        header.commands_count > cache.count ||
+        header.params_count   > cache.count ||
+        header.features_count > cache.count ||
+        header.strings_size   > cache.count) {
+        return false;
+    }
+
+    const size_t expected_size = sizeof(header)
+        + header.groups_count   * sizeof(Cache_Group)
+        + header.enums_count    * sizeof(Cache_Enum)
+        + header.commands_count * sizeof(Cache_Command)
+        + header.params_count   * sizeof(Cache_Param)
+        + header.features_count * sizeof(Cache_Feature)
+        + header.strings_size;
+    if (cache.count != expected_size) return false;
+
+    // All the record types are 4 or 8 bytes aligned and the mapping is
+    // page aligned, so the arrays can be used in place.
+    const char *cursor = cache.data + sizeof(header);
+    auto groups   = (const Cache_Group*)   cursor; cursor += header.groups_count   * sizeof(Cache_Group);
+    auto enums    = (const Cache_Enum*)    cursor; cursor += header.enums_count    * sizeof(Cache_Enum);
+    auto commands = (const Cache_Command*) cursor; cursor += header.commands_count * sizeof(Cache_Command);
+    auto params   = (const Cache_Param*)   cursor; cursor += header.params_count   * sizeof(Cache_Param);
+    auto features = (const Cache_Feature*) cursor; cursor += header.features_count * sizeof(Cache_Feature);
+    const char *strings = cursor;
+
+    if (!cache_is_consistent(header, groups, enums, commands, params, features)) return false;
+
+    auto string = [&](Cache_String s) -> String_View {
+        return {s.count, strings + s.offset};
+    };
+
+    for (size_t i = 0; i < header.groups_count; ++i) {
+        auto &group = registry->groups.emplace_hint(
+            registry->groups.end(),
+            string(groups[i].name),
+            std::map<String_View, String_View>())->second;
+        for (size_t j = 0; j < groups[i].enums_count; ++j) {
+            const auto &enoom = enums[groups[i].enums_begin + j];
+            group.emplace_hint(group.end(), string(enoom.name), string(enoom.value));
+        }
+    }
+
+    registry->commands.reserve(header.commands_count);
+    for (size_t i = 0; i < header.commands_count; ++i) {
+        Command command = {};
+        command.line = commands[i].line;
+        command.sig = {commands[i].has_sig != 0, {string(commands[i].name), string(commands[i].type)}};
+        command.params.reserve(commands[i].params_count);
+        for (size_t j = 0; j < commands[i].params_count; ++j) {
+            const auto &param = params[commands[i].params_begin + j];
+            command.params.push_back({string(param.name), string(param.type)});
+        }
+        registry->commands.push_back(command);
+    }
+
+    registry->features.reserve(header.features_count);
+    for (size_t i = 0; i < header.features_count; ++i) {
+        registry->features.push_back({
+            string(features[i].api),
+            string(features[i].name),
+            string(features[i].number)
+        });
+    }
+
+    loaded = true;
+    return true;
+}
+
+// Leaves the file untouched (including its mtime) when the content
+// did not change, so the make rules depending on it are not rerun.
+// Returns true if the file was actually written.
+bool write_file_if_changed(const char *filepath, String_View content)
+{
+    auto maybe_old = map_file(filepath);
+    if (maybe_old.has_value) {
+        auto old = maybe_old.unwrap;
+        const bool same = old == content;
+        if (old.count > 0) munmap((void*) old.data, old.count);
+        if (same) return false;
+    }
+
+    FILE *stream = fopen(filepath, "wb");
+    if (!stream) {
+        println(stderr, "Could not write file `", filepath, "`: ", strerror(errno));
+        exit(1);
+    }
+    fwrite(content.data, 1, content.count, stream);
+    if (fclose(stream) != 0) {
+        println(stderr, "Could not write file `", filepath, "`: ", strerror(errno));
+        exit(1);
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////
+// PARALLEL EMITTER
+////////////////////////////////////////////////////////////
+
+size_t jobs = 1;
+
+const size_t EMIT_CHUNK_SIZE = 64;
+
+// Calls print_item(stream, i) for every i in [0, items_count). With
+// more than one job the items are split into chunks of
+// EMIT_CHUNK_SIZE which the workers pick up one by one and print into
+// their own in-memory streams. The chunks are then written out in
+// their original order, so the output is byte-identical to the serial
+// one.
+template <typename Print_Item>
+void emit_items(FILE *stream, size_t items_count, Print_Item print_item)
+{
+    const size_t chunks_count = (items_count + EMIT_CHUNK_SIZE - 1) / EMIT_CHUNK_SIZE;
+    const size_t workers_count = min(jobs, chunks_count);
+
+    if (workers_count <= 1) {
+        for (size_t i = 0; i < items_count; ++i) {
+            print_item(stream, i);
+        }
+        return;
+    }
+
+    struct Chunk
+    {
+        char *data;
+        size_t size;
+    };
+
+    std::vector<Chunk> chunks(chunks_count);
+    std::atomic<size_t> next_chunk(0);
+
+    auto worker = [&]() {
+        for (size_t chunk = next_chunk++; chunk < chunks_count; chunk = next_chunk++) {
+            FILE *chunk_stream = open_memstream(&chunks[chunk].data, &chunks[chunk].size);
+            assert(chunk_stream);
+
+            const size_t end = min((chunk + 1) * EMIT_CHUNK_SIZE, items_count);
+            for (size_t i = chunk * EMIT_CHUNK_SIZE; i < end; ++i) {
+                print_item(chunk_stream, i);
+            }
+
+            fclose(chunk_stream);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < workers_count; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread: workers) {
+        thread.join();
+    }
+
+    for (const auto &chunk: chunks) {
+        fwrite(chunk.data, 1, chunk.size, stream);
+        free(chunk.data);
+    }
+}
+
+////////////////////////////////////////////////////////////
+// SUBCOMMANDS
+////////////////////////////////////////////////////////////
+
+void gen_subcommand(FILE *stream, const char *, const Registry &registry)
+{
+    using Group = std::pair<const String_View, std::map<String_View, String_View>>;
+
+    std::vector<const Group*> groups;
+    groups.reserve(registry.groups.size());
+    for (const auto &group: registry.groups) {
+        groups.push_back(&group);
+    }
+
+    print_header(stream);
+    emit_items(stream, groups.size(), [&](FILE *stream, size_t i) {
+        const auto &group = *groups[i];
+        println(stream, "enum class ", group.first, " {");
+        for (const auto &enoom: group.second) {
+            println(stream, "  ", enoom.first.subview(3, enoom.first.count - 3), " = ", enoom.second, ",");
+        }
+        println(stream, "};");
+    });
+    print_footer(stream);
+}
+
+void commands_subcommand(FILE *stream, const char *filepath, const Registry &registry)
+{
+    emit_items(stream, registry.commands.size(), [&](FILE *stream, size_t i) {
+        const auto &command = registry.commands[i];
+        assert(command.sig.has_value);
+
+        println(stream, "// ", filepath, ":", command.line, ": ", command.sig.unwrap.name);
+        if (command.sig.unwrap.type.count == 0) {
+            print(stream, "void");
+        } else {
+            print(stream, command.sig.unwrap.type);
+        }
+        print(stream, " ");
+        print(stream, command.sig.unwrap.name);
+        print(stream, "(");
+        bool first = true;
+        for (const auto &param: command.params) {
+            if (!first) {
+                print(stream, ", ");
+            }
+            print(stream, param.type, ' ', param.name);
+            first = false;
+        }
+        print(stream, ")");
+        println(stream);
+    });
+}
+
+void features_subcommand(FILE *stream, const char *, const Registry &registry)
+{
+    for (const auto &feature: registry.features) {
+        println(stream, feature.api, " ", feature.number, " ", feature.name);
+    }
+}
+
+// The enum classes of gl.hpp and the groups of the spec they are
+// subsets of. names_subcommand generates a to_string() for each of
+// them.
+struct Typed_Enum
+{
+    String_View name;
+    String_View group;
+};
+
+Typed_Enum gl_hpp_enums[] = {
+    {"Shader_Type"_sv,                       "ShaderType"_sv},
+    {"Draw_Mode"_sv,                         "PrimitiveType"_sv},
+    {"Buffer_Target"_sv,                     "BufferTargetARB"_sv},
+    {"Buffer_Usage"_sv,                      "BufferUsageARB"_sv},
+    {"Indexed_Buffer_Target"_sv,             "BufferTargetARB"_sv},
+    {"Attribute_Type"_sv,                    "VertexAttribPointerType"_sv},
+    {"Attribute_IType"_sv,                   "VertexAttribIType"_sv},
+    {"String_Name"_sv,                       "StringName"_sv},
+    {"Element_Index_Type"_sv,                "DrawElementsType"_sv},
+    {"Capability"_sv,                        "EnableCap"_sv},
+    {"Transform_Feedback_Buffer_Mode"_sv,    "TransformFeedbackBufferMode"_sv},
+    {"Transform_Feedback_Primitive_Mode"_sv, "PrimitiveType"_sv},
+    {"Query_Target"_sv,                      "QueryTarget"_sv},
+    {"Conditional_Render_Mode"_sv,           "ConditionalRenderMode"_sv},
+    {"Wait_Result"_sv,                       "SyncStatus"_sv},
+    {"Debug_Source"_sv,                      "DebugSource"_sv},
+    {"Debug_Type"_sv,                        "DebugType"_sv},
+    {"Debug_Severity"_sv,                    "DebugSeverity"_sv},
+};
+
+struct Enum_Name
+{
+    unsigned long long value;
+    String_View name;
+};
+
+Maybe<unsigned long long> parse_enum_value(String_View value)
+{
+    if (value.has_prefix("0x"_sv)) {
+        value.chop(2);
+        return value.from_hex<unsigned long long>();
+    }
+
+    auto integer = value.as_integer<long long>();
+    if (!integer.has_value) return {};
+    return {true, static_cast<unsigned long long>(integer.unwrap)};
+}
+
+// Finds the smallest table size that makes `value % size` collision
+// free for the given values. That gives an O(1) lookup with a single
+// probe and no hashing beyond the modulo.
+Maybe<size_t> find_perfect_table_size(const std::vector<Enum_Name> &names)
+{
+    const size_t MAX_TABLE_SIZE_FACTOR = 64;
+
+    std::vector<bool> taken;
+    for (size_t size = names.size(); size <= names.size() * MAX_TABLE_SIZE_FACTOR; ++size) {
+        taken.assign(size, false);
+        bool collision = false;
+        for (size_t i = 0; !collision && i < names.size(); ++i) {
+            const size_t slot = names[i].value % size;
+            collision = taken[slot];
+            taken[slot] = true;
+        }
+
+        if (!collision) {
+            return {true, size};
+        }
+    }
+
+    return {};
+}
+
+void names_subcommand(FILE *stream, const char *filepath, const Registry &registry)
+{
+    println(stream, "#ifndef GL_NAMES_HPP_");
+    println(stream, "#define GL_NAMES_HPP_");
+    println(stream);
+    println(stream, "// Generated by tools/spec from gl.xml. Do not edit by hand.");
+    println(stream, "//");
+    println(stream, "// Every table maps the values of an enum group to their names. The");
+    println(stream, "// size of a table is chosen so `value % size` never collides, which");
+    println(stream, "// makes gl::names::name_of() a single constexpr array access. Include");
+    println(stream, "// this after gl.hpp to also get to_string() for its enum classes.");
+    println(stream);
+    println(stream, "#include <cstddef>");
+    println(stream);
+    println(stream, "namespace gl {");
+    println(stream, "namespace names {");
+    println(stream, "    struct Entry");
+    println(stream, "    {");
+    println(stream, "        unsigned long long value;");
+    println(stream, "        const char *name;");
+    println(stream, "    };");
+    println(stream);
+    println(stream, "    // Returns nullptr if the value does not belong to the group");
+    println(stream, "    template <size_t N>");
+    println(stream, "    constexpr const char *name_of(const Entry (&table)[N], unsigned long long value)");
+    println(stream, "    {");
+    println(stream, "        const Entry &entry = table[value % N];");
+    println(stream, "        return entry.name && entry.value == value ? entry.name : nullptr;");
+    println(stream, "    }");
+
+    for (const auto &group: registry.groups) {
+        // Several names usually share the same value (the core name and
+        // its vendor aliases). The shortest one is the core one.
+        std::map<unsigned long long, String_View> unique;
+        for (const auto &enoom: group.second) {
+            auto value = parse_enum_value(enoom.second);
+            if (!value.has_value) {
+                println(stderr, filepath, ": [WARN] could not parse value `", enoom.second, "` of ", enoom.first);
+                continue;
+            }
+
+            auto it = unique.find(value.unwrap);
+            if (it == unique.end() || enoom.first.count < it->second.count) {
+                unique[value.unwrap] = enoom.first;
+            }
+        }
+
+        std::vector<Enum_Name> names;
+        for (const auto &name: unique) {
+            names.push_back({name.first, name.second});
+        }
+
+        auto table_size = find_perfect_table_size(names);
+        if (!table_size.has_value) {
+            println(stderr, filepath, ": [WARN] could not find a perfect table for group ", group.first);
+            continue;
+        }
+
+        std::vector<Maybe<Enum_Name>> table(table_size.unwrap);
+        for (const auto &name: names) {
+            table[name.value % table_size.unwrap] = {true, name};
+        }
+
+        println(stream);
+        println(stream, "    inline constexpr Entry ", group.first, "[", table_size.unwrap, "] = {");
+        for (const auto &slot: table) {
+            if (slot.has_value) {
+                println(stream, "        {", slot.unwrap.value, "ULL, \"", slot.unwrap.name, "\"},");
+            } else {
+                println(stream, "        {0, nullptr},");
+            }
+        }
+        println(stream, "    };");
+    }
+
+    println(stream, "}  // namespace names");
+    println(stream);
+    println(stream, "#ifdef GL_HPP");
+    for (size_t i = 0; i < ARRAY_LEN(gl_hpp_enums); ++i) {
+        if (registry.groups.find(gl_hpp_enums[i].group) == registry.groups.end()) {
+            println(stderr, filepath, ": [ERROR] group ", gl_hpp_enums[i].group,
+                    " of gl::", gl_hpp_enums[i].name, " is not defined");
+            exit(1);
         }
+
+        println(stream, "    constexpr const char *to_string(", gl_hpp_enums[i].name, " x)");
+        println(stream, "    {");
+        println(stream, "        return names::name_of(names::", gl_hpp_enums[i].group, ", static_cast<GLenum>(x));");
+        println(stream, "    }");
+        println(stream);
     }
+    println(stream, "#endif  // GL_HPP");
+    println(stream, "}  // namespace gl");
+    println(stream);
+    println(stream, "#endif  // GL_NAMES_HPP_");
 }
 
 #undef DEBUG_TAG
@@ -224,19 +994,43 @@ void commands_subcommand(const char *filepath, xmlDocPtr doc)
 struct Subcommand
 {
     String_View name;
-    void (*run)(const char *filepath, xmlDocPtr doc);
+    void (*run)(FILE *stream, const char *filepath, const Registry &registry);
     String_View help;
 };
 
 Subcommand subcommands[] = {
     {"gen"_sv, gen_subcommand, "Generate the gl.hpp from <spec.xml>"_sv},
     {"commands"_sv, commands_subcommand, "Generate OpenGL commands"_sv},
+    {"features"_sv, features_subcommand, "List the API versions defined in <spec.xml>"_sv},
+    {"names"_sv, names_subcommand, "Generate the enum value to name tables of gl_names.hpp"_sv},
+};
+
+struct Option
+{
+    String_View name;
+    bool *flag;
+    const char **value;
+    String_View help;
+};
+
+bool stream_mode = false;
+bool print_stats = false;
+const char *cache_path = NULL;
+const char *output_path = NULL;
+const char *jobs_option = NULL;
+
+Option options[] = {
+    {"--stream"_sv, &stream_mode, NULL, "Parse <spec.xml> in a single streaming pass instead of loading the whole DOM"_sv},
+    {"--stats"_sv, &print_stats, NULL, "Report the generation time and the peak RSS to stderr"_sv},
+    {"--cache"_sv, NULL, &cache_path, "<file> Reuse the registry parsed by a previous run if <spec.xml> did not change"_sv},
+    {"--output"_sv, NULL, &output_path, "<file> Write into <file> instead of stdout, but only if the content changed"_sv},
+    {"--jobs"_sv, NULL, &jobs_option, "<n> Format the output on <n> threads"_sv},
 };
 
 void usage(FILE *stream)
 {
     println(stream, "Not enough arguments provided");
-    println(stream, "Usage: spec <spec.xml> <subcommand>");
+    println(stream, "Usage: spec [options] <spec.xml> <subcommand>");
     println(stream, "Subcommands:");
 
     const size_t WIDTH = 10;
@@ -249,20 +1043,39 @@ void usage(FILE *stream)
                 Pad {name_width > WIDTH ? 0 : WIDTH - name_width, ' '},
                 subcommands[i].help);
     }
+
+    println(stream, "Options:");
+    for (size_t i = 0; i < ARRAY_LEN(options); ++i) {
+        const size_t name_width = options[i].name.count;
+        println(stream,
+                "    ",
+                options[i].name,
+                Pad {name_width > WIDTH ? 0 : WIDTH - name_width, ' '},
+                options[i].help);
+    }
 }
 
-int main(int argc, char *argv[])
+float seconds_since(struct timespec start)
 {
-    Args args = {argc, argv};
-    args.shift();
+    struct timespec now = {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (float) (now.tv_sec - start.tv_sec) + (float) (now.tv_nsec - start.tv_nsec) * 1e-9f;
+}
 
-    if (args.empty()) {
-        println(stderr, "[ERROR] Spec XML file is not provided");
-        usage(stderr);
-        exit(1);
-    }
+void report_stats(FILE *stream, float parse_secs, float emit_secs)
+{
+    struct rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    println(stream, "[STATS] parse:    ", parse_secs * 1000.0f, " ms");
+    println(stream, "[STATS] emit:     ", emit_secs * 1000.0f, " ms");
+    println(stream, "[STATS] peak RSS: ", usage.ru_maxrss, " KiB");
+}
 
-    const char *filepath = args.shift();
+Registry parse_registry(const char *filepath)
+{
+    if (stream_mode) {
+        return parse_registry_stream(filepath);
+    }
 
     auto maybeContent = read_file_as_string_view(filepath);
     if (!maybeContent.has_value) {
@@ -272,11 +1085,58 @@ int main(int argc, char *argv[])
     }
     auto content = maybeContent.unwrap;
 
-    LIBXML_TEST_VERSION;
-
     xmlDocPtr doc = xmlReadMemory(content.data, content.count, "noname.xml", NULL, 0);
-    defer(xmlCleanupParser());
-    defer(xmlMemoryDump());
+    return parse_registry_dom(filepath, doc);
+}
+
+int main(int argc, char *argv[])
+{
+    Args args = {argc, argv};
+    args.shift();
+
+    while (!args.empty() && cstr_as_string_view(*args.argv).has_prefix("--"_sv)) {
+        const char *flag = args.shift();
+        bool found = false;
+        for (size_t i = 0; !found && i < ARRAY_LEN(options); ++i) {
+            if (options[i].name == cstr_as_string_view(flag)) {
+                if (options[i].flag) {
+                    *options[i].flag = true;
+                } else {
+                    if (args.empty()) {
+                        println(stderr, "[ERROR] No value is provided for option `", flag, "`");
+                        usage(stderr);
+                        exit(1);
+                    }
+                    *options[i].value = args.shift();
+                }
+                found = true;
+            }
+        }
+
+        if (!found) {
+            println(stderr, "[ERROR] Unknown option `", flag, "`");
+            usage(stderr);
+            exit(1);
+        }
+    }
+
+    if (jobs_option) {
+        auto maybe_jobs = cstr_as_string_view(jobs_option).as_integer<long>();
+        if (!maybe_jobs.has_value || maybe_jobs.unwrap <= 0) {
+            println(stderr, "[ERROR] `", jobs_option, "` is not a valid number of jobs");
+            usage(stderr);
+            exit(1);
+        }
+        jobs = (size_t) maybe_jobs.unwrap;
+    }
+
+    if (args.empty()) {
+        println(stderr, "[ERROR] Spec XML file is not provided");
+        usage(stderr);
+        exit(1);
+    }
+
+    const char *filepath = args.shift();
 
     if (args.empty()) {
         println(stderr, "[ERROR] subcommand is not provided");
@@ -288,7 +1148,58 @@ int main(int argc, char *argv[])
 
     for (size_t i = 0; i < ARRAY_LEN(subcommands); ++i) {
         if (subcommands[i].name == cstr_as_string_view(subcommand)) {
-            subcommands[i].run(filepath, doc);
+            LIBXML_TEST_VERSION;
+            defer(xmlCleanupParser());
+            defer(xmlMemoryDump());
+
+            struct timespec start = {};
+            clock_gettime(CLOCK_MONOTONIC, &start);
+
+            Registry registry = {};
+            if (cache_path) {
+                auto maybe_spec = map_file(filepath);
+                if (!maybe_spec.has_value) {
+                    println(stderr, "Could not read file `", filepath, "`: ",
+                            strerror(errno));
+                    exit(1);
+                }
+                const uint64_t spec_hash = fnv1a(maybe_spec.unwrap);
+
+                if (!load_registry_cache(cache_path, spec_hash, &registry)) {
+                    registry = parse_registry(filepath);
+                    save_registry_cache(cache_path, spec_hash, registry);
+                } else if (print_stats) {
+                    println(stderr, "[STATS] registry is loaded from `", cache_path, "`");
+                }
+            } else {
+                registry = parse_registry(filepath);
+            }
+            const float parse_secs = seconds_since(start);
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            if (output_path) {
+                char *output = NULL;
+                size_t output_size = 0;
+                FILE *stream = open_memstream(&output, &output_size);
+                assert(stream);
+                subcommands[i].run(stream, filepath, registry);
+                fclose(stream);
+
+                const bool written = write_file_if_changed(output_path, {output_size, output});
+                free(output);
+                if (print_stats && !written) {
+                    println(stderr, "[STATS] `", output_path, "` is up to date");
+                }
+            } else {
+                subcommands[i].run(stdout, filepath, registry);
+                fflush(stdout);
+            }
+            const float emit_secs = seconds_since(start);
+
+            if (print_stats) {
+                report_stats(stderr, parse_secs, emit_secs);
+            }
+
             return 0;
         }
     }